@@ -0,0 +1,84 @@
+# CMAKE generated file: DO NOT EDIT!
+# Generated by "Unix Makefiles" Generator, CMake Version 3.25
+
+# The generator used is:
+set(CMAKE_DEPENDS_GENERATOR "Unix Makefiles")
+
+# The top level Makefile was generated from the following files:
+set(CMAKE_MAKEFILE_DEPENDS
+  "CMakeCache.txt"
+  "/root/repo/CMakeLists.txt"
+  "CMakeFiles/3.25.1/CMakeCXXCompiler.cmake"
+  "CMakeFiles/3.25.1/CMakeSystem.cmake"
+  "/root/repo/cmake/CompilerOptionsLinux.cmake"
+  "/root/repo/projects/CMakeLists.txt"
+  "/root/repo/test/CMakeLists.txt"
+  "/usr/share/cmake-3.25/Modules/CMakeCXXInformation.cmake"
+  "/usr/share/cmake-3.25/Modules/CMakeCommonLanguageInclude.cmake"
+  "/usr/share/cmake-3.25/Modules/CMakeGenericSystem.cmake"
+  "/usr/share/cmake-3.25/Modules/CMakeInitializeConfigs.cmake"
+  "/usr/share/cmake-3.25/Modules/CMakeLanguageInformation.cmake"
+  "/usr/share/cmake-3.25/Modules/CMakeParseImplicitLinkInfo.cmake"
+  "/usr/share/cmake-3.25/Modules/CMakeSystemSpecificInformation.cmake"
+  "/usr/share/cmake-3.25/Modules/CMakeSystemSpecificInitialize.cmake"
+  "/usr/share/cmake-3.25/Modules/Compiler/CMakeCommonCompilerMacros.cmake"
+  "/usr/share/cmake-3.25/Modules/Compiler/GNU-CXX.cmake"
+  "/usr/share/cmake-3.25/Modules/Compiler/GNU.cmake"
+  "/usr/share/cmake-3.25/Modules/FindOpenMP.cmake"
+  "/usr/share/cmake-3.25/Modules/FindPackageHandleStandardArgs.cmake"
+  "/usr/share/cmake-3.25/Modules/FindPackageMessage.cmake"
+  "/usr/share/cmake-3.25/Modules/Platform/Linux-GNU-CXX.cmake"
+  "/usr/share/cmake-3.25/Modules/Platform/Linux-GNU.cmake"
+  "/usr/share/cmake-3.25/Modules/Platform/Linux.cmake"
+  "/usr/share/cmake-3.25/Modules/Platform/UnixPaths.cmake"
+  )
+
+# The corresponding makefile is:
+set(CMAKE_MAKEFILE_OUTPUTS
+  "Makefile"
+  "CMakeFiles/cmake.check_cache"
+  )
+
+# Byproducts of CMake generate step:
+set(CMAKE_MAKEFILE_PRODUCTS
+  "CMakeFiles/CMakeDirectoryInformation.cmake"
+  "projects/CMakeFiles/CMakeDirectoryInformation.cmake"
+  "test/CMakeFiles/CMakeDirectoryInformation.cmake"
+  )
+
+# Dependency information for all targets:
+set(CMAKE_DEPEND_INFO_FILES
+  "projects/CMakeFiles/Final_Project_HPC_Sequential_Library.dir/DependInfo.cmake"
+  "projects/CMakeFiles/Final_Project_HPC_Parallel_Library.dir/DependInfo.cmake"
+  "test/CMakeFiles/Final_Project_HPC_Main.dir/DependInfo.cmake"
+  "test/CMakeFiles/Final_Project_HPC_Measurement_Sequential_1.dir/DependInfo.cmake"
+  "test/CMakeFiles/Final_Project_HPC_Measurement_Sequential_2.dir/DependInfo.cmake"
+  "test/CMakeFiles/Final_Project_HPC_Measurement_Parallel_1.dir/DependInfo.cmake"
+  "test/CMakeFiles/Final_Project_HPC_Measurement_Parallel_2.dir/DependInfo.cmake"
+  "test/CMakeFiles/Final_Project_HPC_Measurement_Parallel_3.dir/DependInfo.cmake"
+  "test/CMakeFiles/Final_Project_HPC_Measurement_Parallel_4.dir/DependInfo.cmake"
+  "test/CMakeFiles/Final_Project_HPC_Measurement_Parallel_5.dir/DependInfo.cmake"
+  "test/CMakeFiles/Final_Project_HPC_Measurement_Parallel_6.dir/DependInfo.cmake"
+  "test/CMakeFiles/Final_Project_HPC_Measurement_Parallel_7.dir/DependInfo.cmake"
+  "test/CMakeFiles/Final_Project_HPC_Measurement_Parallel_8.dir/DependInfo.cmake"
+  "test/CMakeFiles/Final_Project_HPC_Measurement_Parallel_9.dir/DependInfo.cmake"
+  "test/CMakeFiles/Final_Project_HPC_Measurement_Parallel_10.dir/DependInfo.cmake"
+  "test/CMakeFiles/Final_Project_HPC_Measurement_Parallel_11.dir/DependInfo.cmake"
+  "test/CMakeFiles/Final_Project_HPC_Measurement_Parallel_12.dir/DependInfo.cmake"
+  "test/CMakeFiles/Final_Project_HPC_Measurement_Parallel_13.dir/DependInfo.cmake"
+  "test/CMakeFiles/Final_Project_HPC_Measurement_Parallel_14.dir/DependInfo.cmake"
+  "test/CMakeFiles/Final_Project_HPC_Measurement_Parallel_15.dir/DependInfo.cmake"
+  "test/CMakeFiles/Final_Project_HPC_Measurement_Parallel_16.dir/DependInfo.cmake"
+  "test/CMakeFiles/Final_Project_HPC_Measurement_Parallel_17.dir/DependInfo.cmake"
+  "test/CMakeFiles/Final_Project_HPC_Measurement_Parallel_18.dir/DependInfo.cmake"
+  "test/CMakeFiles/Final_Project_HPC_Measurement_Parallel_19.dir/DependInfo.cmake"
+  "test/CMakeFiles/Final_Project_HPC_Measurement_Parallel_20.dir/DependInfo.cmake"
+  "test/CMakeFiles/Final_Project_HPC_Measurement_Parallel_21.dir/DependInfo.cmake"
+  "test/CMakeFiles/Final_Project_HPC_Measurement_Parallel_22.dir/DependInfo.cmake"
+  "test/CMakeFiles/Final_Project_HPC_Measurement_Parallel_23.dir/DependInfo.cmake"
+  "test/CMakeFiles/Final_Project_HPC_Measurement_Parallel_24.dir/DependInfo.cmake"
+  "test/CMakeFiles/Final_Project_HPC_Measurement_Parallel_25.dir/DependInfo.cmake"
+  "test/CMakeFiles/Data_Generator.dir/DependInfo.cmake"
+  "test/CMakeFiles/Mean_Times_Printer.dir/DependInfo.cmake"
+  "test/CMakeFiles/Main_Sample.dir/DependInfo.cmake"
+  )
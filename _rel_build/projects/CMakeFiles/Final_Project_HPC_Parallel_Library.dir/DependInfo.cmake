@@ -0,0 +1,24 @@
+
+# Consider dependencies only in project.
+set(CMAKE_DEPENDS_IN_PROJECT_ONLY OFF)
+
+# The set of languages for which implicit dependencies are needed:
+set(CMAKE_DEPENDS_LANGUAGES
+  )
+
+# The set of dependency files which are needed:
+set(CMAKE_DEPENDS_DEPENDENCY_FILES
+  "/root/repo/projects/src/parallel/ClusteringCheckpoint.cpp" "projects/CMakeFiles/Final_Project_HPC_Parallel_Library.dir/src/parallel/ClusteringCheckpoint.cpp.o" "gcc" "projects/CMakeFiles/Final_Project_HPC_Parallel_Library.dir/src/parallel/ClusteringCheckpoint.cpp.o.d"
+  "/root/repo/projects/src/parallel/DistanceKernelDispatcher.cpp" "projects/CMakeFiles/Final_Project_HPC_Parallel_Library.dir/src/parallel/DistanceKernelDispatcher.cpp.o" "gcc" "projects/CMakeFiles/Final_Project_HPC_Parallel_Library.dir/src/parallel/DistanceKernelDispatcher.cpp.o.d"
+  "/root/repo/projects/src/parallel/KdTree.cpp" "projects/CMakeFiles/Final_Project_HPC_Parallel_Library.dir/src/parallel/KdTree.cpp.o" "gcc" "projects/CMakeFiles/Final_Project_HPC_Parallel_Library.dir/src/parallel/KdTree.cpp.o.d"
+  "/root/repo/projects/src/utils/DataIteratorUtils.cpp" "projects/CMakeFiles/Final_Project_HPC_Parallel_Library.dir/src/utils/DataIteratorUtils.cpp.o" "gcc" "projects/CMakeFiles/Final_Project_HPC_Parallel_Library.dir/src/utils/DataIteratorUtils.cpp.o.d"
+  "/root/repo/projects/src/utils/PiLambdaIteratorUtils.cpp" "projects/CMakeFiles/Final_Project_HPC_Parallel_Library.dir/src/utils/PiLambdaIteratorUtils.cpp.o" "gcc" "projects/CMakeFiles/Final_Project_HPC_Parallel_Library.dir/src/utils/PiLambdaIteratorUtils.cpp.o.d"
+  "/root/repo/projects/src/utils/Timer.cpp" "projects/CMakeFiles/Final_Project_HPC_Parallel_Library.dir/src/utils/Timer.cpp.o" "gcc" "projects/CMakeFiles/Final_Project_HPC_Parallel_Library.dir/src/utils/Timer.cpp.o.d"
+  )
+
+# Targets to which this target links.
+set(CMAKE_TARGET_LINKED_INFO_FILES
+  )
+
+# Fortran module output directory.
+set(CMAKE_Fortran_TARGET_MODULE_DIR "")
@@ -0,0 +1,21 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/Final_Project_HPC_Parallel_Library.dir/src/parallel/ClusteringCheckpoint.cpp.o"
+  "CMakeFiles/Final_Project_HPC_Parallel_Library.dir/src/parallel/ClusteringCheckpoint.cpp.o.d"
+  "CMakeFiles/Final_Project_HPC_Parallel_Library.dir/src/parallel/DistanceKernelDispatcher.cpp.o"
+  "CMakeFiles/Final_Project_HPC_Parallel_Library.dir/src/parallel/DistanceKernelDispatcher.cpp.o.d"
+  "CMakeFiles/Final_Project_HPC_Parallel_Library.dir/src/parallel/KdTree.cpp.o"
+  "CMakeFiles/Final_Project_HPC_Parallel_Library.dir/src/parallel/KdTree.cpp.o.d"
+  "CMakeFiles/Final_Project_HPC_Parallel_Library.dir/src/utils/DataIteratorUtils.cpp.o"
+  "CMakeFiles/Final_Project_HPC_Parallel_Library.dir/src/utils/DataIteratorUtils.cpp.o.d"
+  "CMakeFiles/Final_Project_HPC_Parallel_Library.dir/src/utils/PiLambdaIteratorUtils.cpp.o"
+  "CMakeFiles/Final_Project_HPC_Parallel_Library.dir/src/utils/PiLambdaIteratorUtils.cpp.o.d"
+  "CMakeFiles/Final_Project_HPC_Parallel_Library.dir/src/utils/Timer.cpp.o"
+  "CMakeFiles/Final_Project_HPC_Parallel_Library.dir/src/utils/Timer.cpp.o.d"
+  "libFinal_Project_HPC_Parallel_Library.a"
+  "libFinal_Project_HPC_Parallel_Library.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/Final_Project_HPC_Parallel_Library.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
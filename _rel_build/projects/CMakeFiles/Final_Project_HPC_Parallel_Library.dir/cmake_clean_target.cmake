@@ -0,0 +1,3 @@
+file(REMOVE_RECURSE
+  "libFinal_Project_HPC_Parallel_Library.a"
+)
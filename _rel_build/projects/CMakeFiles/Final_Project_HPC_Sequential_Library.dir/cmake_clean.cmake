@@ -0,0 +1,15 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/Final_Project_HPC_Sequential_Library.dir/src/utils/DataIteratorUtils.cpp.o"
+  "CMakeFiles/Final_Project_HPC_Sequential_Library.dir/src/utils/DataIteratorUtils.cpp.o.d"
+  "CMakeFiles/Final_Project_HPC_Sequential_Library.dir/src/utils/PiLambdaIteratorUtils.cpp.o"
+  "CMakeFiles/Final_Project_HPC_Sequential_Library.dir/src/utils/PiLambdaIteratorUtils.cpp.o.d"
+  "CMakeFiles/Final_Project_HPC_Sequential_Library.dir/src/utils/Timer.cpp.o"
+  "CMakeFiles/Final_Project_HPC_Sequential_Library.dir/src/utils/Timer.cpp.o.d"
+  "libFinal_Project_HPC_Sequential_Library.a"
+  "libFinal_Project_HPC_Sequential_Library.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/Final_Project_HPC_Sequential_Library.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/Data_Generator.dir/src/main-data-generator.cpp.o"
+  "CMakeFiles/Data_Generator.dir/src/main-data-generator.cpp.o.d"
+  "Data_Generator"
+  "Data_Generator.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/Data_Generator.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
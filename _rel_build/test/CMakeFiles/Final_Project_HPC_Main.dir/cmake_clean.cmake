@@ -0,0 +1,37 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/Final_Project_HPC_Main.dir/src/ClusteringAlgorithmExecutor.cpp.o"
+  "CMakeFiles/Final_Project_HPC_Main.dir/src/ClusteringAlgorithmExecutor.cpp.o.d"
+  "CMakeFiles/Final_Project_HPC_Main.dir/src/cli/CliArgumentException.cpp.o"
+  "CMakeFiles/Final_Project_HPC_Main.dir/src/cli/CliArgumentException.cpp.o.d"
+  "CMakeFiles/Final_Project_HPC_Main.dir/src/cli/CliArguments.cpp.o"
+  "CMakeFiles/Final_Project_HPC_Main.dir/src/cli/CliArguments.cpp.o.d"
+  "CMakeFiles/Final_Project_HPC_Main.dir/src/cli/CliArgumentsParser.cpp.o"
+  "CMakeFiles/Final_Project_HPC_Main.dir/src/cli/CliArgumentsParser.cpp.o.d"
+  "CMakeFiles/Final_Project_HPC_Main.dir/src/data/BinaryDataset.cpp.o"
+  "CMakeFiles/Final_Project_HPC_Main.dir/src/data/BinaryDataset.cpp.o.d"
+  "CMakeFiles/Final_Project_HPC_Main.dir/src/data/DataReader.cpp.o"
+  "CMakeFiles/Final_Project_HPC_Main.dir/src/data/DataReader.cpp.o.d"
+  "CMakeFiles/Final_Project_HPC_Main.dir/src/data/DataWriter.cpp.o"
+  "CMakeFiles/Final_Project_HPC_Main.dir/src/data/DataWriter.cpp.o.d"
+  "CMakeFiles/Final_Project_HPC_Main.dir/src/data/IoException.cpp.o"
+  "CMakeFiles/Final_Project_HPC_Main.dir/src/data/IoException.cpp.o.d"
+  "CMakeFiles/Final_Project_HPC_Main.dir/src/data/MalformedFileException.cpp.o"
+  "CMakeFiles/Final_Project_HPC_Main.dir/src/data/MalformedFileException.cpp.o.d"
+  "CMakeFiles/Final_Project_HPC_Main.dir/src/data/MappedFile.cpp.o"
+  "CMakeFiles/Final_Project_HPC_Main.dir/src/data/MappedFile.cpp.o.d"
+  "CMakeFiles/Final_Project_HPC_Main.dir/src/data/NpyFormat.cpp.o"
+  "CMakeFiles/Final_Project_HPC_Main.dir/src/data/NpyFormat.cpp.o.d"
+  "CMakeFiles/Final_Project_HPC_Main.dir/src/data/ParallelDataReader.cpp.o"
+  "CMakeFiles/Final_Project_HPC_Main.dir/src/data/ParallelDataReader.cpp.o.d"
+  "CMakeFiles/Final_Project_HPC_Main.dir/src/data/ResultsChecker.cpp.o"
+  "CMakeFiles/Final_Project_HPC_Main.dir/src/data/ResultsChecker.cpp.o.d"
+  "CMakeFiles/Final_Project_HPC_Main.dir/src/main.cpp.o"
+  "CMakeFiles/Final_Project_HPC_Main.dir/src/main.cpp.o.d"
+  "Final_Project_HPC_Main"
+  "Final_Project_HPC_Main.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/Final_Project_HPC_Main.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,27 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/Final_Project_HPC_Measurement_Parallel_1.dir/src/data/BinaryDataset.cpp.o"
+  "CMakeFiles/Final_Project_HPC_Measurement_Parallel_1.dir/src/data/BinaryDataset.cpp.o.d"
+  "CMakeFiles/Final_Project_HPC_Measurement_Parallel_1.dir/src/data/DataReader.cpp.o"
+  "CMakeFiles/Final_Project_HPC_Measurement_Parallel_1.dir/src/data/DataReader.cpp.o.d"
+  "CMakeFiles/Final_Project_HPC_Measurement_Parallel_1.dir/src/data/DataWriter.cpp.o"
+  "CMakeFiles/Final_Project_HPC_Measurement_Parallel_1.dir/src/data/DataWriter.cpp.o.d"
+  "CMakeFiles/Final_Project_HPC_Measurement_Parallel_1.dir/src/data/IoException.cpp.o"
+  "CMakeFiles/Final_Project_HPC_Measurement_Parallel_1.dir/src/data/IoException.cpp.o.d"
+  "CMakeFiles/Final_Project_HPC_Measurement_Parallel_1.dir/src/data/MalformedFileException.cpp.o"
+  "CMakeFiles/Final_Project_HPC_Measurement_Parallel_1.dir/src/data/MalformedFileException.cpp.o.d"
+  "CMakeFiles/Final_Project_HPC_Measurement_Parallel_1.dir/src/data/MappedFile.cpp.o"
+  "CMakeFiles/Final_Project_HPC_Measurement_Parallel_1.dir/src/data/MappedFile.cpp.o.d"
+  "CMakeFiles/Final_Project_HPC_Measurement_Parallel_1.dir/src/data/NpyFormat.cpp.o"
+  "CMakeFiles/Final_Project_HPC_Measurement_Parallel_1.dir/src/data/NpyFormat.cpp.o.d"
+  "CMakeFiles/Final_Project_HPC_Measurement_Parallel_1.dir/src/data/ResultsChecker.cpp.o"
+  "CMakeFiles/Final_Project_HPC_Measurement_Parallel_1.dir/src/data/ResultsChecker.cpp.o.d"
+  "CMakeFiles/Final_Project_HPC_Measurement_Parallel_1.dir/src/main-measurements.cpp.o"
+  "CMakeFiles/Final_Project_HPC_Measurement_Parallel_1.dir/src/main-measurements.cpp.o.d"
+  "Final_Project_HPC_Measurement_Parallel_1"
+  "Final_Project_HPC_Measurement_Parallel_1.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/Final_Project_HPC_Measurement_Parallel_1.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,29 @@
+
+# Consider dependencies only in project.
+set(CMAKE_DEPENDS_IN_PROJECT_ONLY OFF)
+
+# The set of languages for which implicit dependencies are needed:
+set(CMAKE_DEPENDS_LANGUAGES
+  )
+
+# The set of dependency files which are needed:
+set(CMAKE_DEPENDS_DEPENDENCY_FILES
+  "/root/repo/test/src/data/BinaryDataset.cpp" "test/CMakeFiles/Final_Project_HPC_Measurement_Parallel_11.dir/src/data/BinaryDataset.cpp.o" "gcc" "test/CMakeFiles/Final_Project_HPC_Measurement_Parallel_11.dir/src/data/BinaryDataset.cpp.o.d"
+  "/root/repo/test/src/data/DataReader.cpp" "test/CMakeFiles/Final_Project_HPC_Measurement_Parallel_11.dir/src/data/DataReader.cpp.o" "gcc" "test/CMakeFiles/Final_Project_HPC_Measurement_Parallel_11.dir/src/data/DataReader.cpp.o.d"
+  "/root/repo/test/src/data/DataWriter.cpp" "test/CMakeFiles/Final_Project_HPC_Measurement_Parallel_11.dir/src/data/DataWriter.cpp.o" "gcc" "test/CMakeFiles/Final_Project_HPC_Measurement_Parallel_11.dir/src/data/DataWriter.cpp.o.d"
+  "/root/repo/test/src/data/IoException.cpp" "test/CMakeFiles/Final_Project_HPC_Measurement_Parallel_11.dir/src/data/IoException.cpp.o" "gcc" "test/CMakeFiles/Final_Project_HPC_Measurement_Parallel_11.dir/src/data/IoException.cpp.o.d"
+  "/root/repo/test/src/data/MalformedFileException.cpp" "test/CMakeFiles/Final_Project_HPC_Measurement_Parallel_11.dir/src/data/MalformedFileException.cpp.o" "gcc" "test/CMakeFiles/Final_Project_HPC_Measurement_Parallel_11.dir/src/data/MalformedFileException.cpp.o.d"
+  "/root/repo/test/src/data/MappedFile.cpp" "test/CMakeFiles/Final_Project_HPC_Measurement_Parallel_11.dir/src/data/MappedFile.cpp.o" "gcc" "test/CMakeFiles/Final_Project_HPC_Measurement_Parallel_11.dir/src/data/MappedFile.cpp.o.d"
+  "/root/repo/test/src/data/NpyFormat.cpp" "test/CMakeFiles/Final_Project_HPC_Measurement_Parallel_11.dir/src/data/NpyFormat.cpp.o" "gcc" "test/CMakeFiles/Final_Project_HPC_Measurement_Parallel_11.dir/src/data/NpyFormat.cpp.o.d"
+  "/root/repo/test/src/data/ResultsChecker.cpp" "test/CMakeFiles/Final_Project_HPC_Measurement_Parallel_11.dir/src/data/ResultsChecker.cpp.o" "gcc" "test/CMakeFiles/Final_Project_HPC_Measurement_Parallel_11.dir/src/data/ResultsChecker.cpp.o.d"
+  "/root/repo/test/src/main-measurements.cpp" "test/CMakeFiles/Final_Project_HPC_Measurement_Parallel_11.dir/src/main-measurements.cpp.o" "gcc" "test/CMakeFiles/Final_Project_HPC_Measurement_Parallel_11.dir/src/main-measurements.cpp.o.d"
+  )
+
+# Targets to which this target links.
+set(CMAKE_TARGET_LINKED_INFO_FILES
+  "/root/repo/_rel_build/projects/CMakeFiles/Final_Project_HPC_Sequential_Library.dir/DependInfo.cmake"
+  "/root/repo/_rel_build/projects/CMakeFiles/Final_Project_HPC_Parallel_Library.dir/DependInfo.cmake"
+  )
+
+# Fortran module output directory.
+set(CMAKE_Fortran_TARGET_MODULE_DIR "")
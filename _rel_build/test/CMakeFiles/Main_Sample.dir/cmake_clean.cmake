@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/Main_Sample.dir/src/main-sample.cpp.o"
+  "CMakeFiles/Main_Sample.dir/src/main-sample.cpp.o.d"
+  "Main_Sample"
+  "Main_Sample.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/Main_Sample.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
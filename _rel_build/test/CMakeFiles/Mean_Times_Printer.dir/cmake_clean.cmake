@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/Mean_Times_Printer.dir/src/main-mean-times-printer.cpp.o"
+  "CMakeFiles/Mean_Times_Printer.dir/src/main-mean-times-printer.cpp.o.d"
+  "Mean_Times_Printer"
+  "Mean_Times_Printer.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/Mean_Times_Printer.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,162 @@
+# CMake generated Testfile for 
+# Source directory: /root/repo/test
+# Build directory: /root/repo/_rel_build/test
+# 
+# This file includes the relevant testing commands required for 
+# testing this directory and lists subdirectories to be tested as well.
+add_test([=[iris-parallel-v1]=] "Final_Project_HPC_Main" "-t" "-p" "1" "iris")
+set_tests_properties([=[iris-parallel-v1]=] PROPERTIES  SKIP_RETURN_CODE "4" _BACKTRACE_TRIPLES "/root/repo/test/CMakeLists.txt;129;add_test;/root/repo/test/CMakeLists.txt;0;")
+add_test([=[iris-parallel-v2]=] "Final_Project_HPC_Main" "-t" "-p" "2" "iris")
+set_tests_properties([=[iris-parallel-v2]=] PROPERTIES  SKIP_RETURN_CODE "4" _BACKTRACE_TRIPLES "/root/repo/test/CMakeLists.txt;129;add_test;/root/repo/test/CMakeLists.txt;0;")
+add_test([=[iris-parallel-v3]=] "Final_Project_HPC_Main" "-t" "-p" "3" "iris")
+set_tests_properties([=[iris-parallel-v3]=] PROPERTIES  SKIP_RETURN_CODE "4" _BACKTRACE_TRIPLES "/root/repo/test/CMakeLists.txt;129;add_test;/root/repo/test/CMakeLists.txt;0;")
+add_test([=[iris-parallel-v4]=] "Final_Project_HPC_Main" "-t" "-p" "4" "iris")
+set_tests_properties([=[iris-parallel-v4]=] PROPERTIES  SKIP_RETURN_CODE "4" _BACKTRACE_TRIPLES "/root/repo/test/CMakeLists.txt;129;add_test;/root/repo/test/CMakeLists.txt;0;")
+add_test([=[iris-parallel-v5]=] "Final_Project_HPC_Main" "-t" "-p" "5" "iris")
+set_tests_properties([=[iris-parallel-v5]=] PROPERTIES  SKIP_RETURN_CODE "4" _BACKTRACE_TRIPLES "/root/repo/test/CMakeLists.txt;129;add_test;/root/repo/test/CMakeLists.txt;0;")
+add_test([=[iris-parallel-v6]=] "Final_Project_HPC_Main" "-t" "-p" "6" "iris")
+set_tests_properties([=[iris-parallel-v6]=] PROPERTIES  SKIP_RETURN_CODE "4" _BACKTRACE_TRIPLES "/root/repo/test/CMakeLists.txt;129;add_test;/root/repo/test/CMakeLists.txt;0;")
+add_test([=[iris-parallel-v7]=] "Final_Project_HPC_Main" "-t" "-p" "7" "iris")
+set_tests_properties([=[iris-parallel-v7]=] PROPERTIES  SKIP_RETURN_CODE "4" _BACKTRACE_TRIPLES "/root/repo/test/CMakeLists.txt;129;add_test;/root/repo/test/CMakeLists.txt;0;")
+add_test([=[iris-parallel-v12]=] "Final_Project_HPC_Main" "-t" "-p" "12" "iris")
+set_tests_properties([=[iris-parallel-v12]=] PROPERTIES  SKIP_RETURN_CODE "4" _BACKTRACE_TRIPLES "/root/repo/test/CMakeLists.txt;129;add_test;/root/repo/test/CMakeLists.txt;0;")
+add_test([=[iris-parallel-v13]=] "Final_Project_HPC_Main" "-t" "-p" "13" "iris")
+set_tests_properties([=[iris-parallel-v13]=] PROPERTIES  SKIP_RETURN_CODE "4" _BACKTRACE_TRIPLES "/root/repo/test/CMakeLists.txt;129;add_test;/root/repo/test/CMakeLists.txt;0;")
+add_test([=[iris-parallel-v14]=] "Final_Project_HPC_Main" "-t" "-p" "14" "iris")
+set_tests_properties([=[iris-parallel-v14]=] PROPERTIES  SKIP_RETURN_CODE "4" _BACKTRACE_TRIPLES "/root/repo/test/CMakeLists.txt;129;add_test;/root/repo/test/CMakeLists.txt;0;")
+add_test([=[iris-parallel-v16]=] "Final_Project_HPC_Main" "-t" "-p" "16" "iris")
+set_tests_properties([=[iris-parallel-v16]=] PROPERTIES  SKIP_RETURN_CODE "4" _BACKTRACE_TRIPLES "/root/repo/test/CMakeLists.txt;129;add_test;/root/repo/test/CMakeLists.txt;0;")
+add_test([=[iris-parallel-v17]=] "Final_Project_HPC_Main" "-t" "-p" "17" "iris")
+set_tests_properties([=[iris-parallel-v17]=] PROPERTIES  SKIP_RETURN_CODE "4" _BACKTRACE_TRIPLES "/root/repo/test/CMakeLists.txt;129;add_test;/root/repo/test/CMakeLists.txt;0;")
+add_test([=[iris-parallel-v18]=] "Final_Project_HPC_Main" "-t" "-p" "18" "iris")
+set_tests_properties([=[iris-parallel-v18]=] PROPERTIES  SKIP_RETURN_CODE "4" _BACKTRACE_TRIPLES "/root/repo/test/CMakeLists.txt;129;add_test;/root/repo/test/CMakeLists.txt;0;")
+add_test([=[iris-parallel-v19]=] "Final_Project_HPC_Main" "-t" "-p" "19" "iris")
+set_tests_properties([=[iris-parallel-v19]=] PROPERTIES  SKIP_RETURN_CODE "4" _BACKTRACE_TRIPLES "/root/repo/test/CMakeLists.txt;129;add_test;/root/repo/test/CMakeLists.txt;0;")
+add_test([=[iris-parallel-v20]=] "Final_Project_HPC_Main" "-t" "-p" "20" "iris")
+set_tests_properties([=[iris-parallel-v20]=] PROPERTIES  SKIP_RETURN_CODE "4" _BACKTRACE_TRIPLES "/root/repo/test/CMakeLists.txt;129;add_test;/root/repo/test/CMakeLists.txt;0;")
+add_test([=[iris-parallel-v21]=] "Final_Project_HPC_Main" "-t" "-p" "21" "iris")
+set_tests_properties([=[iris-parallel-v21]=] PROPERTIES  SKIP_RETURN_CODE "4" _BACKTRACE_TRIPLES "/root/repo/test/CMakeLists.txt;129;add_test;/root/repo/test/CMakeLists.txt;0;")
+add_test([=[iris-parallel-v22]=] "Final_Project_HPC_Main" "-t" "-p" "22" "iris")
+set_tests_properties([=[iris-parallel-v22]=] PROPERTIES  SKIP_RETURN_CODE "4" _BACKTRACE_TRIPLES "/root/repo/test/CMakeLists.txt;129;add_test;/root/repo/test/CMakeLists.txt;0;")
+add_test([=[iris-parallel-v23]=] "Final_Project_HPC_Main" "-t" "-p" "23" "iris")
+set_tests_properties([=[iris-parallel-v23]=] PROPERTIES  SKIP_RETURN_CODE "4" _BACKTRACE_TRIPLES "/root/repo/test/CMakeLists.txt;129;add_test;/root/repo/test/CMakeLists.txt;0;")
+add_test([=[iris-parallel-v24]=] "Final_Project_HPC_Main" "-t" "-p" "24" "iris")
+set_tests_properties([=[iris-parallel-v24]=] PROPERTIES  SKIP_RETURN_CODE "4" _BACKTRACE_TRIPLES "/root/repo/test/CMakeLists.txt;129;add_test;/root/repo/test/CMakeLists.txt;0;")
+add_test([=[checkpoint-dataset]=] "Data_Generator" "1000" "7" "/root/repo/_rel_build/test/checkpoint.data")
+set_tests_properties([=[checkpoint-dataset]=] PROPERTIES  FIXTURES_SETUP "checkpoint-dataset" _BACKTRACE_TRIPLES "/root/repo/test/CMakeLists.txt;144;add_test;/root/repo/test/CMakeLists.txt;0;")
+add_test([=[checkpoint-parallel-v1-cleanup]=] "/usr/bin/cmake" "-E" "rm" "-f" "/root/repo/_rel_build/test/checkpoint-v1.bin")
+set_tests_properties([=[checkpoint-parallel-v1-cleanup]=] PROPERTIES  FIXTURES_SETUP "checkpoint-v1-cleanup" _BACKTRACE_TRIPLES "/root/repo/test/CMakeLists.txt;154;add_test;/root/repo/test/CMakeLists.txt;0;")
+add_test([=[checkpoint-parallel-v1-interrupt]=] "Final_Project_HPC_Main" "-p" "1" "--checkpoint-path=/root/repo/_rel_build/test/checkpoint-v1.bin" "--checkpoint-stop=400" "/root/repo/_rel_build/test/checkpoint.data")
+set_tests_properties([=[checkpoint-parallel-v1-interrupt]=] PROPERTIES  FIXTURES_REQUIRED "checkpoint-dataset;checkpoint-v1-cleanup" FIXTURES_SETUP "checkpoint-v1" PASS_REGULAR_EXPRESSION "Clustering stopped after 400 samples" _BACKTRACE_TRIPLES "/root/repo/test/CMakeLists.txt;155;add_test;/root/repo/test/CMakeLists.txt;0;")
+add_test([=[checkpoint-parallel-v1-resume]=] "Final_Project_HPC_Main" "-t" "-p" "1" "--checkpoint-path=/root/repo/_rel_build/test/checkpoint-v1.bin" "/root/repo/_rel_build/test/checkpoint.data")
+set_tests_properties([=[checkpoint-parallel-v1-resume]=] PROPERTIES  FIXTURES_REQUIRED "checkpoint-dataset;checkpoint-v1" PASS_REGULAR_EXPRESSION "Resuming the clustering.*Test completed successfully" _BACKTRACE_TRIPLES "/root/repo/test/CMakeLists.txt;164;add_test;/root/repo/test/CMakeLists.txt;0;")
+add_test([=[checkpoint-parallel-v2-cleanup]=] "/usr/bin/cmake" "-E" "rm" "-f" "/root/repo/_rel_build/test/checkpoint-v2.bin")
+set_tests_properties([=[checkpoint-parallel-v2-cleanup]=] PROPERTIES  FIXTURES_SETUP "checkpoint-v2-cleanup" _BACKTRACE_TRIPLES "/root/repo/test/CMakeLists.txt;154;add_test;/root/repo/test/CMakeLists.txt;0;")
+add_test([=[checkpoint-parallel-v2-interrupt]=] "Final_Project_HPC_Main" "-p" "2" "--checkpoint-path=/root/repo/_rel_build/test/checkpoint-v2.bin" "--checkpoint-stop=400" "/root/repo/_rel_build/test/checkpoint.data")
+set_tests_properties([=[checkpoint-parallel-v2-interrupt]=] PROPERTIES  FIXTURES_REQUIRED "checkpoint-dataset;checkpoint-v2-cleanup" FIXTURES_SETUP "checkpoint-v2" PASS_REGULAR_EXPRESSION "Clustering stopped after 400 samples" _BACKTRACE_TRIPLES "/root/repo/test/CMakeLists.txt;155;add_test;/root/repo/test/CMakeLists.txt;0;")
+add_test([=[checkpoint-parallel-v2-resume]=] "Final_Project_HPC_Main" "-t" "-p" "2" "--checkpoint-path=/root/repo/_rel_build/test/checkpoint-v2.bin" "/root/repo/_rel_build/test/checkpoint.data")
+set_tests_properties([=[checkpoint-parallel-v2-resume]=] PROPERTIES  FIXTURES_REQUIRED "checkpoint-dataset;checkpoint-v2" PASS_REGULAR_EXPRESSION "Resuming the clustering.*Test completed successfully" _BACKTRACE_TRIPLES "/root/repo/test/CMakeLists.txt;164;add_test;/root/repo/test/CMakeLists.txt;0;")
+add_test([=[checkpoint-parallel-v3-cleanup]=] "/usr/bin/cmake" "-E" "rm" "-f" "/root/repo/_rel_build/test/checkpoint-v3.bin")
+set_tests_properties([=[checkpoint-parallel-v3-cleanup]=] PROPERTIES  FIXTURES_SETUP "checkpoint-v3-cleanup" _BACKTRACE_TRIPLES "/root/repo/test/CMakeLists.txt;154;add_test;/root/repo/test/CMakeLists.txt;0;")
+add_test([=[checkpoint-parallel-v3-interrupt]=] "Final_Project_HPC_Main" "-p" "3" "--checkpoint-path=/root/repo/_rel_build/test/checkpoint-v3.bin" "--checkpoint-stop=400" "/root/repo/_rel_build/test/checkpoint.data")
+set_tests_properties([=[checkpoint-parallel-v3-interrupt]=] PROPERTIES  FIXTURES_REQUIRED "checkpoint-dataset;checkpoint-v3-cleanup" FIXTURES_SETUP "checkpoint-v3" PASS_REGULAR_EXPRESSION "Clustering stopped after 400 samples" _BACKTRACE_TRIPLES "/root/repo/test/CMakeLists.txt;155;add_test;/root/repo/test/CMakeLists.txt;0;")
+add_test([=[checkpoint-parallel-v3-resume]=] "Final_Project_HPC_Main" "-t" "-p" "3" "--checkpoint-path=/root/repo/_rel_build/test/checkpoint-v3.bin" "/root/repo/_rel_build/test/checkpoint.data")
+set_tests_properties([=[checkpoint-parallel-v3-resume]=] PROPERTIES  FIXTURES_REQUIRED "checkpoint-dataset;checkpoint-v3" PASS_REGULAR_EXPRESSION "Resuming the clustering.*Test completed successfully" _BACKTRACE_TRIPLES "/root/repo/test/CMakeLists.txt;164;add_test;/root/repo/test/CMakeLists.txt;0;")
+add_test([=[checkpoint-parallel-v11-cleanup]=] "/usr/bin/cmake" "-E" "rm" "-f" "/root/repo/_rel_build/test/checkpoint-v11.bin")
+set_tests_properties([=[checkpoint-parallel-v11-cleanup]=] PROPERTIES  FIXTURES_SETUP "checkpoint-v11-cleanup" _BACKTRACE_TRIPLES "/root/repo/test/CMakeLists.txt;154;add_test;/root/repo/test/CMakeLists.txt;0;")
+add_test([=[checkpoint-parallel-v11-interrupt]=] "Final_Project_HPC_Main" "-p" "11" "--checkpoint-path=/root/repo/_rel_build/test/checkpoint-v11.bin" "--checkpoint-stop=400" "/root/repo/_rel_build/test/checkpoint.data")
+set_tests_properties([=[checkpoint-parallel-v11-interrupt]=] PROPERTIES  FIXTURES_REQUIRED "checkpoint-dataset;checkpoint-v11-cleanup" FIXTURES_SETUP "checkpoint-v11" PASS_REGULAR_EXPRESSION "Clustering stopped after 400 samples" _BACKTRACE_TRIPLES "/root/repo/test/CMakeLists.txt;155;add_test;/root/repo/test/CMakeLists.txt;0;")
+add_test([=[checkpoint-parallel-v11-resume]=] "Final_Project_HPC_Main" "-t" "-p" "11" "--checkpoint-path=/root/repo/_rel_build/test/checkpoint-v11.bin" "/root/repo/_rel_build/test/checkpoint.data")
+set_tests_properties([=[checkpoint-parallel-v11-resume]=] PROPERTIES  FIXTURES_REQUIRED "checkpoint-dataset;checkpoint-v11" PASS_REGULAR_EXPRESSION "Resuming the clustering.*Test completed successfully" _BACKTRACE_TRIPLES "/root/repo/test/CMakeLists.txt;164;add_test;/root/repo/test/CMakeLists.txt;0;")
+add_test([=[checkpoint-parallel-v14-cleanup]=] "/usr/bin/cmake" "-E" "rm" "-f" "/root/repo/_rel_build/test/checkpoint-v14.bin")
+set_tests_properties([=[checkpoint-parallel-v14-cleanup]=] PROPERTIES  FIXTURES_SETUP "checkpoint-v14-cleanup" _BACKTRACE_TRIPLES "/root/repo/test/CMakeLists.txt;154;add_test;/root/repo/test/CMakeLists.txt;0;")
+add_test([=[checkpoint-parallel-v14-interrupt]=] "Final_Project_HPC_Main" "-p" "14" "--checkpoint-path=/root/repo/_rel_build/test/checkpoint-v14.bin" "--checkpoint-stop=400" "/root/repo/_rel_build/test/checkpoint.data")
+set_tests_properties([=[checkpoint-parallel-v14-interrupt]=] PROPERTIES  FIXTURES_REQUIRED "checkpoint-dataset;checkpoint-v14-cleanup" FIXTURES_SETUP "checkpoint-v14" PASS_REGULAR_EXPRESSION "Clustering stopped after 400 samples" _BACKTRACE_TRIPLES "/root/repo/test/CMakeLists.txt;155;add_test;/root/repo/test/CMakeLists.txt;0;")
+add_test([=[checkpoint-parallel-v14-resume]=] "Final_Project_HPC_Main" "-t" "-p" "14" "--checkpoint-path=/root/repo/_rel_build/test/checkpoint-v14.bin" "/root/repo/_rel_build/test/checkpoint.data")
+set_tests_properties([=[checkpoint-parallel-v14-resume]=] PROPERTIES  FIXTURES_REQUIRED "checkpoint-dataset;checkpoint-v14" PASS_REGULAR_EXPRESSION "Resuming the clustering.*Test completed successfully" _BACKTRACE_TRIPLES "/root/repo/test/CMakeLists.txt;164;add_test;/root/repo/test/CMakeLists.txt;0;")
+add_test([=[checkpoint-parallel-v22-cleanup]=] "/usr/bin/cmake" "-E" "rm" "-f" "/root/repo/_rel_build/test/checkpoint-v22.bin")
+set_tests_properties([=[checkpoint-parallel-v22-cleanup]=] PROPERTIES  FIXTURES_SETUP "checkpoint-v22-cleanup" _BACKTRACE_TRIPLES "/root/repo/test/CMakeLists.txt;154;add_test;/root/repo/test/CMakeLists.txt;0;")
+add_test([=[checkpoint-parallel-v22-interrupt]=] "Final_Project_HPC_Main" "-p" "22" "--checkpoint-path=/root/repo/_rel_build/test/checkpoint-v22.bin" "--checkpoint-stop=400" "/root/repo/_rel_build/test/checkpoint.data")
+set_tests_properties([=[checkpoint-parallel-v22-interrupt]=] PROPERTIES  FIXTURES_REQUIRED "checkpoint-dataset;checkpoint-v22-cleanup" FIXTURES_SETUP "checkpoint-v22" PASS_REGULAR_EXPRESSION "Clustering stopped after 400 samples" _BACKTRACE_TRIPLES "/root/repo/test/CMakeLists.txt;155;add_test;/root/repo/test/CMakeLists.txt;0;")
+add_test([=[checkpoint-parallel-v22-resume]=] "Final_Project_HPC_Main" "-t" "-p" "22" "--checkpoint-path=/root/repo/_rel_build/test/checkpoint-v22.bin" "/root/repo/_rel_build/test/checkpoint.data")
+set_tests_properties([=[checkpoint-parallel-v22-resume]=] PROPERTIES  FIXTURES_REQUIRED "checkpoint-dataset;checkpoint-v22" PASS_REGULAR_EXPRESSION "Resuming the clustering.*Test completed successfully" _BACKTRACE_TRIPLES "/root/repo/test/CMakeLists.txt;164;add_test;/root/repo/test/CMakeLists.txt;0;")
+add_test([=[checkpoint-parallel-mismatch]=] "Final_Project_HPC_Main" "-p" "3" "--checkpoint-path=/root/repo/_rel_build/test/checkpoint-v1.bin" "/root/repo/_rel_build/test/checkpoint.data")
+set_tests_properties([=[checkpoint-parallel-mismatch]=] PROPERTIES  FIXTURES_REQUIRED "checkpoint-dataset;checkpoint-v1" PASS_REGULAR_EXPRESSION "has been saved by a different clustering" _BACKTRACE_TRIPLES "/root/repo/test/CMakeLists.txt;190;add_test;/root/repo/test/CMakeLists.txt;0;")
+add_test([=[metric-dataset]=] "Data_Generator" "600" "7" "/root/repo/_rel_build/test/metric.data")
+set_tests_properties([=[metric-dataset]=] PROPERTIES  FIXTURES_SETUP "metric-dataset" _BACKTRACE_TRIPLES "/root/repo/test/CMakeLists.txt;206;add_test;/root/repo/test/CMakeLists.txt;0;")
+add_test([=[manhattan-parallel-v1]=] "Final_Project_HPC_Main" "-t" "-p" "1" "--metric=manhattan" "/root/repo/_rel_build/test/metric.data")
+set_tests_properties([=[manhattan-parallel-v1]=] PROPERTIES  FIXTURES_REQUIRED "metric-dataset" PASS_REGULAR_EXPRESSION "Test completed successfully" _BACKTRACE_TRIPLES "/root/repo/test/CMakeLists.txt;219;add_test;/root/repo/test/CMakeLists.txt;0;")
+add_test([=[manhattan-parallel-v2]=] "Final_Project_HPC_Main" "-t" "-p" "2" "--metric=manhattan" "/root/repo/_rel_build/test/metric.data")
+set_tests_properties([=[manhattan-parallel-v2]=] PROPERTIES  FIXTURES_REQUIRED "metric-dataset" PASS_REGULAR_EXPRESSION "Test completed successfully" _BACKTRACE_TRIPLES "/root/repo/test/CMakeLists.txt;219;add_test;/root/repo/test/CMakeLists.txt;0;")
+add_test([=[manhattan-parallel-v3]=] "Final_Project_HPC_Main" "-t" "-p" "3" "--metric=manhattan" "/root/repo/_rel_build/test/metric.data")
+set_tests_properties([=[manhattan-parallel-v3]=] PROPERTIES  FIXTURES_REQUIRED "metric-dataset" PASS_REGULAR_EXPRESSION "Test completed successfully" _BACKTRACE_TRIPLES "/root/repo/test/CMakeLists.txt;219;add_test;/root/repo/test/CMakeLists.txt;0;")
+add_test([=[chebyshev-parallel-v1]=] "Final_Project_HPC_Main" "-t" "-p" "1" "--metric=chebyshev" "/root/repo/_rel_build/test/metric.data")
+set_tests_properties([=[chebyshev-parallel-v1]=] PROPERTIES  FIXTURES_REQUIRED "metric-dataset" PASS_REGULAR_EXPRESSION "Test completed successfully" _BACKTRACE_TRIPLES "/root/repo/test/CMakeLists.txt;219;add_test;/root/repo/test/CMakeLists.txt;0;")
+add_test([=[chebyshev-parallel-v2]=] "Final_Project_HPC_Main" "-t" "-p" "2" "--metric=chebyshev" "/root/repo/_rel_build/test/metric.data")
+set_tests_properties([=[chebyshev-parallel-v2]=] PROPERTIES  FIXTURES_REQUIRED "metric-dataset" PASS_REGULAR_EXPRESSION "Test completed successfully" _BACKTRACE_TRIPLES "/root/repo/test/CMakeLists.txt;219;add_test;/root/repo/test/CMakeLists.txt;0;")
+add_test([=[chebyshev-parallel-v3]=] "Final_Project_HPC_Main" "-t" "-p" "3" "--metric=chebyshev" "/root/repo/_rel_build/test/metric.data")
+set_tests_properties([=[chebyshev-parallel-v3]=] PROPERTIES  FIXTURES_REQUIRED "metric-dataset" PASS_REGULAR_EXPRESSION "Test completed successfully" _BACKTRACE_TRIPLES "/root/repo/test/CMakeLists.txt;219;add_test;/root/repo/test/CMakeLists.txt;0;")
+add_test([=[cosine-parallel-v1]=] "Final_Project_HPC_Main" "-t" "-p" "1" "--metric=cosine" "/root/repo/_rel_build/test/metric.data")
+set_tests_properties([=[cosine-parallel-v1]=] PROPERTIES  FIXTURES_REQUIRED "metric-dataset" PASS_REGULAR_EXPRESSION "Test completed successfully" _BACKTRACE_TRIPLES "/root/repo/test/CMakeLists.txt;219;add_test;/root/repo/test/CMakeLists.txt;0;")
+add_test([=[cosine-parallel-v2]=] "Final_Project_HPC_Main" "-t" "-p" "2" "--metric=cosine" "/root/repo/_rel_build/test/metric.data")
+set_tests_properties([=[cosine-parallel-v2]=] PROPERTIES  FIXTURES_REQUIRED "metric-dataset" PASS_REGULAR_EXPRESSION "Test completed successfully" _BACKTRACE_TRIPLES "/root/repo/test/CMakeLists.txt;219;add_test;/root/repo/test/CMakeLists.txt;0;")
+add_test([=[cosine-parallel-v3]=] "Final_Project_HPC_Main" "-t" "-p" "3" "--metric=cosine" "/root/repo/_rel_build/test/metric.data")
+set_tests_properties([=[cosine-parallel-v3]=] PROPERTIES  FIXTURES_REQUIRED "metric-dataset" PASS_REGULAR_EXPRESSION "Test completed successfully" _BACKTRACE_TRIPLES "/root/repo/test/CMakeLists.txt;219;add_test;/root/repo/test/CMakeLists.txt;0;")
+add_test([=[minkowski-parallel-v1]=] "Final_Project_HPC_Main" "-t" "-p" "1" "--metric=minkowski" "/root/repo/_rel_build/test/metric.data")
+set_tests_properties([=[minkowski-parallel-v1]=] PROPERTIES  FIXTURES_REQUIRED "metric-dataset" PASS_REGULAR_EXPRESSION "Test completed successfully" _BACKTRACE_TRIPLES "/root/repo/test/CMakeLists.txt;219;add_test;/root/repo/test/CMakeLists.txt;0;")
+add_test([=[minkowski-parallel-v2]=] "Final_Project_HPC_Main" "-t" "-p" "2" "--metric=minkowski" "/root/repo/_rel_build/test/metric.data")
+set_tests_properties([=[minkowski-parallel-v2]=] PROPERTIES  FIXTURES_REQUIRED "metric-dataset" PASS_REGULAR_EXPRESSION "Test completed successfully" _BACKTRACE_TRIPLES "/root/repo/test/CMakeLists.txt;219;add_test;/root/repo/test/CMakeLists.txt;0;")
+add_test([=[minkowski-parallel-v3]=] "Final_Project_HPC_Main" "-t" "-p" "3" "--metric=minkowski" "/root/repo/_rel_build/test/metric.data")
+set_tests_properties([=[minkowski-parallel-v3]=] PROPERTIES  FIXTURES_REQUIRED "metric-dataset" PASS_REGULAR_EXPRESSION "Test completed successfully" _BACKTRACE_TRIPLES "/root/repo/test/CMakeLists.txt;219;add_test;/root/repo/test/CMakeLists.txt;0;")
+add_test([=[incremental-manhattan]=] "Final_Project_HPC_Main" "-p" "1" "--metric=manhattan" "--test-incremental" "/root/repo/_rel_build/test/metric.data")
+set_tests_properties([=[incremental-manhattan]=] PROPERTIES  FIXTURES_REQUIRED "metric-dataset" PASS_REGULAR_EXPRESSION "Test completed successfully" _BACKTRACE_TRIPLES "/root/repo/test/CMakeLists.txt;240;add_test;/root/repo/test/CMakeLists.txt;0;")
+add_test([=[incremental-chebyshev]=] "Final_Project_HPC_Main" "-p" "1" "--metric=chebyshev" "--test-incremental" "/root/repo/_rel_build/test/metric.data")
+set_tests_properties([=[incremental-chebyshev]=] PROPERTIES  FIXTURES_REQUIRED "metric-dataset" PASS_REGULAR_EXPRESSION "Test completed successfully" _BACKTRACE_TRIPLES "/root/repo/test/CMakeLists.txt;240;add_test;/root/repo/test/CMakeLists.txt;0;")
+add_test([=[incremental-cosine]=] "Final_Project_HPC_Main" "-p" "1" "--metric=cosine" "--test-incremental" "/root/repo/_rel_build/test/metric.data")
+set_tests_properties([=[incremental-cosine]=] PROPERTIES  FIXTURES_REQUIRED "metric-dataset" PASS_REGULAR_EXPRESSION "Test completed successfully" _BACKTRACE_TRIPLES "/root/repo/test/CMakeLists.txt;240;add_test;/root/repo/test/CMakeLists.txt;0;")
+add_test([=[incremental-minkowski]=] "Final_Project_HPC_Main" "-p" "1" "--metric=minkowski" "--test-incremental" "/root/repo/_rel_build/test/metric.data")
+set_tests_properties([=[incremental-minkowski]=] PROPERTIES  FIXTURES_REQUIRED "metric-dataset" PASS_REGULAR_EXPRESSION "Test completed successfully" _BACKTRACE_TRIPLES "/root/repo/test/CMakeLists.txt;240;add_test;/root/repo/test/CMakeLists.txt;0;")
+add_test([=[incremental-euclidean]=] "Final_Project_HPC_Main" "-p" "1" "--metric=euclidean" "--test-incremental" "/root/repo/_rel_build/test/metric.data")
+set_tests_properties([=[incremental-euclidean]=] PROPERTIES  FIXTURES_REQUIRED "metric-dataset" PASS_REGULAR_EXPRESSION "Test completed successfully" _BACKTRACE_TRIPLES "/root/repo/test/CMakeLists.txt;240;add_test;/root/repo/test/CMakeLists.txt;0;")
+add_test([=[distance-matrix-output]=] "Final_Project_HPC_Main" "-p" "24" "--distance-matrix-output-path=/root/repo/_rel_build/test/distance-matrix.bin" "/root/repo/_rel_build/test/metric.data")
+set_tests_properties([=[distance-matrix-output]=] PROPERTIES  FIXTURES_REQUIRED "metric-dataset" FIXTURES_SETUP "distance-matrix" _BACKTRACE_TRIPLES "/root/repo/test/CMakeLists.txt;259;add_test;/root/repo/test/CMakeLists.txt;0;")
+add_test([=[distance-matrix-input]=] "Final_Project_HPC_Main" "-t" "-p" "24" "--distance-matrix-path=/root/repo/_rel_build/test/distance-matrix.bin" "/root/repo/_rel_build/test/metric.data")
+set_tests_properties([=[distance-matrix-input]=] PROPERTIES  FIXTURES_REQUIRED "metric-dataset;distance-matrix" PASS_REGULAR_EXPRESSION "read from.*Test completed successfully" _BACKTRACE_TRIPLES "/root/repo/test/CMakeLists.txt;267;add_test;/root/repo/test/CMakeLists.txt;0;")
+add_test([=[distance-matrix-mismatch]=] "Final_Project_HPC_Main" "-p" "24" "--distance-matrix-path=/root/repo/_rel_build/test/distance-matrix.bin" "/root/repo/_rel_build/test/checkpoint.data")
+set_tests_properties([=[distance-matrix-mismatch]=] PROPERTIES  FIXTURES_REQUIRED "checkpoint-dataset;distance-matrix" PASS_REGULAR_EXPRESSION "Malformed distance matrix file" _BACKTRACE_TRIPLES "/root/repo/test/CMakeLists.txt;287;add_test;/root/repo/test/CMakeLists.txt;0;")
+add_test([=[cuts-parallel-v1]=] "Final_Project_HPC_Main" "-p" "1" "--test-cuts=16" "/root/repo/_rel_build/test/checkpoint.data")
+set_tests_properties([=[cuts-parallel-v1]=] PROPERTIES  FIXTURES_REQUIRED "checkpoint-dataset" PASS_REGULAR_EXPRESSION "Test completed successfully" _BACKTRACE_TRIPLES "/root/repo/test/CMakeLists.txt;308;add_test;/root/repo/test/CMakeLists.txt;0;")
+add_test([=[cuts-parallel-v22]=] "Final_Project_HPC_Main" "-p" "22" "--test-cuts=16" "/root/repo/_rel_build/test/checkpoint.data")
+set_tests_properties([=[cuts-parallel-v22]=] PROPERTIES  FIXTURES_REQUIRED "checkpoint-dataset" PASS_REGULAR_EXPRESSION "Test completed successfully" _BACKTRACE_TRIPLES "/root/repo/test/CMakeLists.txt;308;add_test;/root/repo/test/CMakeLists.txt;0;")
+add_test([=[cophenetic-parallel-v1]=] "Final_Project_HPC_Main" "-p" "1" "--test-cophenetic" "/root/repo/_rel_build/test/checkpoint.data")
+set_tests_properties([=[cophenetic-parallel-v1]=] PROPERTIES  FIXTURES_REQUIRED "checkpoint-dataset" PASS_REGULAR_EXPRESSION "Test completed successfully" _BACKTRACE_TRIPLES "/root/repo/test/CMakeLists.txt;329;add_test;/root/repo/test/CMakeLists.txt;0;")
+add_test([=[cophenetic-parallel-v22]=] "Final_Project_HPC_Main" "-p" "22" "--test-cophenetic" "/root/repo/_rel_build/test/checkpoint.data")
+set_tests_properties([=[cophenetic-parallel-v22]=] PROPERTIES  FIXTURES_REQUIRED "checkpoint-dataset" PASS_REGULAR_EXPRESSION "Test completed successfully" _BACKTRACE_TRIPLES "/root/repo/test/CMakeLists.txt;329;add_test;/root/repo/test/CMakeLists.txt;0;")
+add_test([=[compact-pi-parallel-v11]=] "Final_Project_HPC_Main" "-t" "-p" "11" "--compact-pi" "/root/repo/_rel_build/test/checkpoint.data")
+set_tests_properties([=[compact-pi-parallel-v11]=] PROPERTIES  FIXTURES_REQUIRED "checkpoint-dataset" PASS_REGULAR_EXPRESSION "32-bit unsigned integers.*Test completed successfully" _BACKTRACE_TRIPLES "/root/repo/test/CMakeLists.txt;350;add_test;/root/repo/test/CMakeLists.txt;0;")
+add_test([=[compact-pi-parallel-v12]=] "Final_Project_HPC_Main" "-t" "-p" "12" "--compact-pi" "/root/repo/_rel_build/test/checkpoint.data")
+set_tests_properties([=[compact-pi-parallel-v12]=] PROPERTIES  FIXTURES_REQUIRED "checkpoint-dataset" PASS_REGULAR_EXPRESSION "32-bit unsigned integers.*Test completed successfully" _BACKTRACE_TRIPLES "/root/repo/test/CMakeLists.txt;350;add_test;/root/repo/test/CMakeLists.txt;0;")
+add_test([=[compact-pi-parallel-v16]=] "Final_Project_HPC_Main" "-t" "-p" "16" "--compact-pi" "/root/repo/_rel_build/test/checkpoint.data")
+set_tests_properties([=[compact-pi-parallel-v16]=] PROPERTIES  FIXTURES_REQUIRED "checkpoint-dataset" PASS_REGULAR_EXPRESSION "32-bit unsigned integers.*Test completed successfully" _BACKTRACE_TRIPLES "/root/repo/test/CMakeLists.txt;350;add_test;/root/repo/test/CMakeLists.txt;0;")
+add_test([=[compact-pi-parallel-v20]=] "Final_Project_HPC_Main" "-t" "-p" "20" "--compact-pi" "/root/repo/_rel_build/test/checkpoint.data")
+set_tests_properties([=[compact-pi-parallel-v20]=] PROPERTIES  FIXTURES_REQUIRED "checkpoint-dataset" PASS_REGULAR_EXPRESSION "32-bit unsigned integers.*Test completed successfully" _BACKTRACE_TRIPLES "/root/repo/test/CMakeLists.txt;350;add_test;/root/repo/test/CMakeLists.txt;0;")
+add_test([=[single-precision-parallel-v15]=] "Final_Project_HPC_Main" "-t" "-p" "15" "/root/repo/_rel_build/test/checkpoint.data")
+set_tests_properties([=[single-precision-parallel-v15]=] PROPERTIES  FIXTURES_REQUIRED "checkpoint-dataset" PASS_REGULAR_EXPRESSION "single precision.*Test completed successfully" SKIP_RETURN_CODE "4" _BACKTRACE_TRIPLES "/root/repo/test/CMakeLists.txt;374;add_test;/root/repo/test/CMakeLists.txt;0;")
+add_test([=[single-precision-parallel-v25]=] "Final_Project_HPC_Main" "-t" "-p" "25" "/root/repo/_rel_build/test/checkpoint.data")
+set_tests_properties([=[single-precision-parallel-v25]=] PROPERTIES  FIXTURES_REQUIRED "checkpoint-dataset" PASS_REGULAR_EXPRESSION "single precision.*Test completed successfully" SKIP_RETURN_CODE "4" _BACKTRACE_TRIPLES "/root/repo/test/CMakeLists.txt;374;add_test;/root/repo/test/CMakeLists.txt;0;")
+add_test([=[masked-tail-parallel-v13]=] "Final_Project_HPC_Main" "-t" "-p" "13" "/root/repo/_rel_build/test/checkpoint.data")
+set_tests_properties([=[masked-tail-parallel-v13]=] PROPERTIES  FIXTURES_REQUIRED "checkpoint-dataset" PASS_REGULAR_EXPRESSION "Test completed successfully" SKIP_RETURN_CODE "4" _BACKTRACE_TRIPLES "/root/repo/test/CMakeLists.txt;394;add_test;/root/repo/test/CMakeLists.txt;0;")
+add_test([=[out-of-core-dataset]=] "Final_Project_HPC_Main" "-p" "11" "--binary-output-path=/root/repo/_rel_build/test/out-of-core.bin" "/root/repo/_rel_build/test/checkpoint.data")
+set_tests_properties([=[out-of-core-dataset]=] PROPERTIES  FIXTURES_REQUIRED "checkpoint-dataset" FIXTURES_SETUP "out-of-core-dataset" _BACKTRACE_TRIPLES "/root/repo/test/CMakeLists.txt;406;add_test;/root/repo/test/CMakeLists.txt;0;")
+add_test([=[out-of-core-parallel-v11-0]=] "Final_Project_HPC_Main" "-t" "-p" "11" "--out-of-core=0" "/root/repo/_rel_build/test/out-of-core.bin")
+set_tests_properties([=[out-of-core-parallel-v11-0]=] PROPERTIES  FIXTURES_REQUIRED "out-of-core-dataset" PASS_REGULAR_EXPRESSION "read out of core.*Test completed successfully" _BACKTRACE_TRIPLES "/root/repo/test/CMakeLists.txt;426;add_test;/root/repo/test/CMakeLists.txt;0;")
+add_test([=[out-of-core-parallel-v11-4096]=] "Final_Project_HPC_Main" "-t" "-p" "11" "--out-of-core=4096" "/root/repo/_rel_build/test/out-of-core.bin")
+set_tests_properties([=[out-of-core-parallel-v11-4096]=] PROPERTIES  FIXTURES_REQUIRED "out-of-core-dataset" PASS_REGULAR_EXPRESSION "read out of core.*Test completed successfully" _BACKTRACE_TRIPLES "/root/repo/test/CMakeLists.txt;426;add_test;/root/repo/test/CMakeLists.txt;0;")
+add_test([=[out-of-core-parallel-v20-0]=] "Final_Project_HPC_Main" "-t" "-p" "20" "--out-of-core=0" "/root/repo/_rel_build/test/out-of-core.bin")
+set_tests_properties([=[out-of-core-parallel-v20-0]=] PROPERTIES  FIXTURES_REQUIRED "out-of-core-dataset" PASS_REGULAR_EXPRESSION "read out of core.*Test completed successfully" _BACKTRACE_TRIPLES "/root/repo/test/CMakeLists.txt;426;add_test;/root/repo/test/CMakeLists.txt;0;")
+add_test([=[out-of-core-parallel-v20-4096]=] "Final_Project_HPC_Main" "-t" "-p" "20" "--out-of-core=4096" "/root/repo/_rel_build/test/out-of-core.bin")
+set_tests_properties([=[out-of-core-parallel-v20-4096]=] PROPERTIES  FIXTURES_REQUIRED "out-of-core-dataset" PASS_REGULAR_EXPRESSION "read out of core.*Test completed successfully" _BACKTRACE_TRIPLES "/root/repo/test/CMakeLists.txt;426;add_test;/root/repo/test/CMakeLists.txt;0;")
+add_test([=[visualizer-output]=] "Final_Project_HPC_Main" "-p" "1" "--visualizer-output-path=/root/repo/_rel_build/test/visualizer.txt" "/root/repo/test/resources/visualizer.data")
+set_tests_properties([=[visualizer-output]=] PROPERTIES  FIXTURES_SETUP "visualizer-output" _BACKTRACE_TRIPLES "/root/repo/test/CMakeLists.txt;446;add_test;/root/repo/test/CMakeLists.txt;0;")
+add_test([=[visualizer-output-compare]=] "/usr/bin/cmake" "-E" "compare_files" "/root/repo/_rel_build/test/visualizer.txt" "/root/repo/test/resources/visualizer-reference.txt")
+set_tests_properties([=[visualizer-output-compare]=] PROPERTIES  FIXTURES_REQUIRED "visualizer-output" _BACKTRACE_TRIPLES "/root/repo/test/CMakeLists.txt;454;add_test;/root/repo/test/CMakeLists.txt;0;")
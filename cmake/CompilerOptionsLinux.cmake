@@ -157,10 +157,6 @@ add_compile_options(
     -Wl,-z,relro
     -fno-common
     -fopenmp
-    -msse
-    -msse3
-    -mavx
-    -march=native
     -fconcepts-diagnostics-depth=10
     # Build-type-related options
     $<$<CONFIG:Release>:-O3>
@@ -168,3 +164,13 @@ add_compile_options(
     $<$<CONFIG:Debug>:-g3>
     $<$<CONFIG:Debug>:-ggdb>
 )
+
+# Tune the code for the CPU of the machine building it, unless a portable binary is requested
+if (NOT PORTABLE_BUILD)
+    add_compile_options(
+        -msse
+        -msse3
+        -mavx
+        -march=native
+    )
+endif ()
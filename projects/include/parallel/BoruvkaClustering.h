@@ -0,0 +1,424 @@
+#ifndef FINAL_PROJECT_HPC_BORUVKACLUSTERING_H
+#define FINAL_PROJECT_HPC_BORUVKACLUSTERING_H
+
+#include "../utils/DataIteratorUtils.h"
+#include "../utils/Types.h"
+#include "KdTree.h"
+#include "Logger.h"
+#include "PiLambdaIteratorUtils.h"
+#include "SpanningTreeConverter.h"
+#include "Timer.h"
+#include <cmath>
+#include <limits>
+#include <omp.h>
+#include <type_traits>
+#include <vector>
+
+namespace cluster::parallel {
+
+/**
+ * Class providing a parallel implementation of the clustering algorithm, designed for data samples
+ * having few attributes, that computes the Euclidean minimum spanning tree of the data samples
+ * using the Borůvka algorithm accelerated by a kd-tree, and then converts it into the pointer
+ * representation.<br>
+ * At every round of the Borůvka algorithm, each data sample looks for the closest data sample
+ * belonging to a different cluster. The search of all the samples held by a leaf of the kd-tree is
+ * performed at once by a single-tree traversal starting from the root, discarding the nodes whose
+ * bounding box is farther than the candidates found so far, as well as the nodes whose samples all
+ * belong to the same cluster of the leaf. Hence, the query side is always a leaf, and pairs of
+ * internal nodes are never pruned together as a dual-tree traversal would do. Then, every cluster
+ * is connected to its closest cluster, so that the number of clusters at least halves every round.
+ * The leaves are processed in parallel.<br>
+ * The distances are computed exactly like <code>SequentialClustering</code> does, so the computed
+ * <code>pi</code> and <code>lambda</code> are the same, even when some distances are equal.
+ * However, the bounding boxes become less and less effective as the number of attributes grows,
+ * hence this implementation is convenient only if the data samples have few attributes, e.g., at
+ * most 8.<br>
+ * Moreover, the only method of this class uses the first 6 timers offered by the
+ * <code>Timer</code> class to measure the time taken by each step of the algorithm.
+ *
+ * @tparam PD <code>true</code> if the clustering method should parallelize the search of the
+ * closest data samples using threads, <code>false</code> otherwise.
+ *
+ * @author DeB
+ * @author Jonathan
+ * @version 1.3 2022-10-16
+ * @since 1.0
+ */
+template <bool PD = true>
+class BoruvkaClustering {
+
+    // Imports
+    using Logger = utils::Logger;
+    using Timer = utils::Timer;
+    using PiLambdaIteratorUtils = utils::PiLambdaIteratorUtils;
+    using DataIteratorUtils = utils::DataIteratorUtils<double>;
+
+private:
+    /**
+     * Value marking a node of the kd-tree whose data samples belong to different clusters.
+     */
+    static const constexpr std::size_t MIXED_CLUSTERS = std::numeric_limits<std::size_t>::max();
+
+    /**
+     * Candidate edge of the minimum spanning tree, i.e., the closest data sample belonging to a
+     * different cluster found so far.
+     */
+    struct Candidate {
+
+        /**
+         * Square of the distance between the two data samples.
+         */
+        double squaredDistance;
+
+        /**
+         * Position in the kd-tree of the data sample looking for its closest data sample.
+         */
+        std::size_t source;
+
+        /**
+         * Position in the kd-tree of the closest data sample.
+         */
+        std::size_t destination;
+    };
+
+public:
+    /**
+     * Parallel implementation of the clustering algorithm based on the Borůvka algorithm, where
+     * the closest data samples are searched with a single-tree traversal of a kd-tree for every
+     * leaf.
+     *
+     * @tparam D Type of the data structure/iterator holding the data samples to cluster.
+     * @tparam P Type of the data structure/iterator holding the <code>pi</code> values.
+     * @tparam L Type of the data structure/iterator holding the <code>lambda</code> values.
+     * @param data Data structure/iterator holding the data samples to cluster. The data samples
+     * <b>MUST BE</b> neither aligned nor padded.
+     * @param dataSamplesCount Number of data samples.
+     * @param dimension Number of attributes of each sample.
+     * @param pi Data structure/iterator holding the <code>pi</code> values. This data structure
+     * <b>MUST BE</b> big enough to contain all the <code>pi</code> values, which are exactly
+     * <code>dataSamplesCount</code>.
+     * @param lambda Data structure/iterator holding the <code>lambda</code> values. This data
+     * structure <b>MUST BE</b> big enough to contain all the <code>lambda</code> values, which are
+     * exactly <code>dataSamplesCount</code>.
+     * @param threadsCount Number of threads to use to parallelize the search of the closest data
+     * samples and the computation of the square roots. If not specified, or if <code>0</code> is
+     * specified, then this method uses the default number of threads computed by OpenMP.<br>
+     * This parameter takes effect only if <code>PD</code> is <code>true</code>.
+     * @throws std::invalid_argument If the elements of <code>pi</code> cannot store the index of
+     * the last data sample.
+     */
+    template <utils::ParallelDataIterator D, utils::PiIterator P, utils::LambdaIterator L>
+    static void cluster(const D &data,
+                        const std::size_t dataSamplesCount,
+                        const std::size_t dimension,
+                        P &pi,
+                        L &lambda,
+                        const std::size_t threadsCount = 0) {
+
+        // Check that pi can store the indices of all the data samples
+        PiLambdaIteratorUtils::requirePiCapacity<P>(dataSamplesCount);
+
+        Timer::start<0>();
+        // Efficient iterator pointing to the first element of the dataset
+        auto dataBegin = DataIteratorUtils::createEfficientIterator(data, "First element of data");
+        // Gather the data samples in a unique array, unless they are already stored in one, since
+        // the kd-tree reads them through a pointer
+        std::vector<double> gatheredPoints{};
+        const double *points = nullptr;
+        if constexpr (std::is_same_v<decltype(dataBegin), const double *>) {
+            points = dataBegin;
+        } else {
+            gatheredPoints.resize(dataSamplesCount * dimension);
+            for (std::size_t i = 0; i < dataSamplesCount; i++) {
+                const double *const sample =
+                        DataIteratorUtils::getSampleAt<D>(dataBegin, i, dimension);
+                std::copy_n(sample, dimension, &(gatheredPoints[i * dimension]));
+            }
+            points = gatheredPoints.data();
+        }
+
+        // Efficient iterator pointing to the first element of pi
+        const auto piBegin = PiLambdaIteratorUtils::createEfficientIterator<utils::PiElement<P>, P>(
+                pi, "First element of pi");
+        // Efficient iterator pointing to the first element of lambda
+        const auto lambdaBegin = PiLambdaIteratorUtils::createEfficientIterator<double, L>(
+                lambda, "First element of lambda");
+
+        // Parent of each data sample in the union-find structure holding the clusters
+        std::vector<std::size_t> parents{};
+        parents.resize(dataSamplesCount);
+        // Cluster of every data sample at the beginning of the current round
+        std::vector<std::size_t> clusters{};
+        clusters.resize(dataSamplesCount);
+        // Closest data sample of every data sample, and of every cluster
+        std::vector<Candidate> sampleCandidates{};
+        sampleCandidates.resize(dataSamplesCount);
+        std::vector<Candidate> clusterCandidates{};
+        clusterCandidates.resize(dataSamplesCount);
+        // Edges of the minimum spanning tree
+        std::vector<SpanningTreeEdge> edges{};
+        edges.reserve(dataSamplesCount);
+        Timer::stop<0>();
+
+        // Log the initial progress
+        Logger::startLoggingProgress<0, 1, 2, 3, 4, 5>(dataSamplesCount);
+
+        Timer::start<1>();
+        // **** 1) Build the kd-tree ****
+        const KdTree tree{points, dataSamplesCount, dimension, dimension};
+        // The gathered data samples are not needed anymore, since the tree holds a copy of them
+        gatheredPoints = std::vector<double>{};
+        // Cluster of the data samples held by every node, if they all belong to the same one
+        std::vector<std::size_t> nodeClusters{};
+        nodeClusters.resize(tree.getNodesCount());
+        for (std::size_t position = 0; position < dataSamplesCount; position++) {
+            parents[position] = position;
+        }
+        Timer::stop<1>();
+
+        // Perform the rounds until all the data samples belong to the same cluster
+        while (edges.size() + 1 < dataSamplesCount) {
+            // Log the progress
+            Logger::updateProgress<1, 0, 1, 2, 3, 4, 5>(edges.size() + 1, dataSamplesCount);
+
+            Timer::start<3>();
+            // Compute the cluster of every data sample and of every node
+            for (std::size_t position = 0; position < dataSamplesCount; position++) {
+                clusters[position] = findRoot(parents, position);
+            }
+            computeNodeClusters(tree, clusters, nodeClusters);
+            Timer::stop<3>();
+
+            Timer::start<2>();
+            // **** 2) Find the closest data sample of every data sample ****
+            const std::vector<std::size_t> &leaves = tree.getLeaves();
+#pragma omp parallel for default(none)                                        \
+        shared(leaves, tree, clusters, nodeClusters, sampleCandidates) schedule(dynamic) \
+                num_threads(threadsCount) if (PD)
+            for (std::size_t l = 0; l < leaves.size(); l++) {
+                searchClosestSamples(tree, leaves[l], clusters, nodeClusters, sampleCandidates);
+            }
+            Timer::stop<2>();
+
+            Timer::start<3>();
+            // **** 3) Connect every cluster to its closest cluster ****
+            for (std::size_t position = 0; position < dataSamplesCount; position++) {
+                clusterCandidates[position] = {std::numeric_limits<double>::infinity(), 0, 0};
+            }
+            for (std::size_t position = 0; position < dataSamplesCount; position++) {
+                Candidate &clusterCandidate = clusterCandidates[clusters[position]];
+                if (isBetter(sampleCandidates[position], clusterCandidate)) {
+                    clusterCandidate = sampleCandidates[position];
+                }
+            }
+            for (std::size_t position = 0; position < dataSamplesCount; position++) {
+                const Candidate &candidate = clusterCandidates[position];
+                if (clusters[position] == position &&
+                    candidate.squaredDistance < std::numeric_limits<double>::infinity()) {
+                    const std::size_t sourceRoot = findRoot(parents, candidate.source);
+                    const std::size_t destinationRoot = findRoot(parents, candidate.destination);
+                    // Two clusters may have chosen the same edge
+                    if (sourceRoot != destinationRoot) {
+                        parents[sourceRoot] = destinationRoot;
+                        edges.push_back({tree.getIndex(candidate.source),
+                                         tree.getIndex(candidate.destination),
+                                         candidate.squaredDistance});
+                    }
+                }
+            }
+            Timer::stop<3>();
+        }
+
+        // Compute the square roots of the weights of the edges, so that the distances that are
+        // equal once rooted are merged together, like the sequential implementation does
+        Timer::start<5>();
+#pragma omp parallel for default(none) shared(edges) num_threads(threadsCount) if (PD)
+        for (std::size_t i = 0; i < edges.size(); i++) {
+            edges[i].weight = sqrt(edges[i].weight);
+        }
+        Timer::stop<5>();
+
+        Timer::start<4>();
+        // **** 4) Convert the minimum spanning tree into the pointer representation ****
+        SpanningTreeConverter::toPointerRepresentation<P, L>(
+                edges, dataSamplesCount, piBegin, lambdaBegin);
+        Timer::stop<4>();
+
+        // Log the final progress
+        Logger::updateProgress<1, 0, 1, 2, 3, 4, 5>(dataSamplesCount, dataSamplesCount);
+    }
+
+private:
+    /**
+     * Computes the cluster of the data samples held by every node of the kd-tree.
+     *
+     * @param tree The kd-tree.
+     * @param clusters Cluster of every data sample.
+     * @param nodeClusters Vector where to store the cluster of every node, or
+     * <code>BoruvkaClustering::MIXED_CLUSTERS</code> if the samples held by the node belong to
+     * different clusters.
+     */
+    static inline void computeNodeClusters(const KdTree &tree,
+                                           const std::vector<std::size_t> &clusters,
+                                           std::vector<std::size_t> &nodeClusters) {
+
+        // Children have greater indices than their parents, so visit the nodes backwards
+        for (std::size_t node = tree.getNodesCount(); node-- > 0;) {
+            if (tree.isLeaf(node)) {
+                std::size_t nodeCluster = clusters[tree.getBegin(node)];
+                for (std::size_t position = tree.getBegin(node) + 1; position < tree.getEnd(node);
+                     position++) {
+                    if (clusters[position] != nodeCluster) {
+                        nodeCluster = MIXED_CLUSTERS;
+                        break;
+                    }
+                }
+                nodeClusters[node] = nodeCluster;
+            } else {
+                const std::size_t leftCluster = nodeClusters[tree.getLeftChild(node)];
+                const std::size_t rightCluster = nodeClusters[tree.getRightChild(node)];
+                nodeClusters[node] = (leftCluster == rightCluster) ? leftCluster : MIXED_CLUSTERS;
+            }
+        }
+    }
+
+    /**
+     * Finds, for every data sample held by the specified leaf, the closest data sample belonging
+     * to a different cluster.
+     *
+     * @param tree The kd-tree.
+     * @param leaf Index of the leaf.
+     * @param clusters Cluster of every data sample.
+     * @param nodeClusters Cluster of every node.
+     * @param sampleCandidates Vector where to store the closest data sample of every data sample.
+     */
+    static inline void searchClosestSamples(const KdTree &tree,
+                                            const std::size_t leaf,
+                                            const std::vector<std::size_t> &clusters,
+                                            const std::vector<std::size_t> &nodeClusters,
+                                            std::vector<Candidate> &sampleCandidates) {
+
+        for (std::size_t position = tree.getBegin(leaf); position < tree.getEnd(leaf);
+             position++) {
+            sampleCandidates[position] = {std::numeric_limits<double>::infinity(), position, 0};
+        }
+
+        // Greatest distance between a data sample of the leaf and its closest data sample
+        double bound = std::numeric_limits<double>::infinity();
+        searchClosestSamples(tree, leaf, 0, clusters, nodeClusters, sampleCandidates, bound);
+    }
+
+    /**
+     * Looks among the data samples held by a node for the closest data sample of every data
+     * sample held by the specified leaf.
+     *
+     * @param tree The kd-tree.
+     * @param leaf Index of the leaf.
+     * @param node Index of the node.
+     * @param clusters Cluster of every data sample.
+     * @param nodeClusters Cluster of every node.
+     * @param sampleCandidates Closest data sample found so far for every data sample.
+     * @param bound Greatest square of the distance between a data sample of the leaf and the
+     * closest data sample found so far, or the smallest one if all the samples of the leaf belong
+     * to the same cluster. Nodes whose bounding box is farther than this value are discarded.
+     */
+    static void searchClosestSamples(const KdTree &tree,
+                                     const std::size_t leaf,
+                                     const std::size_t node,
+                                     const std::vector<std::size_t> &clusters,
+                                     const std::vector<std::size_t> &nodeClusters,
+                                     std::vector<Candidate> &sampleCandidates,
+                                     double &bound) {
+
+        // Discard the node if all its samples belong to the same cluster of the leaf samples
+        if (nodeClusters[node] != MIXED_CLUSTERS && nodeClusters[node] == nodeClusters[leaf]) {
+            return;
+        }
+        // Discard the node if it is too far. Equal distances must be considered, since the ties
+        // are broken using the positions of the samples
+        if (tree.computeSquaredBoxDistance(leaf, node) > bound) {
+            return;
+        }
+
+        if (tree.isLeaf(node)) {
+            // Compare all the pairs of samples belonging to different clusters
+            const bool isLeafPure = nodeClusters[leaf] != MIXED_CLUSTERS;
+            double newBound = isLeafPure ? std::numeric_limits<double>::infinity() : 0;
+            for (std::size_t source = tree.getBegin(leaf); source < tree.getEnd(leaf); source++) {
+                Candidate &candidate = sampleCandidates[source];
+                for (std::size_t destination = tree.getBegin(node); destination < tree.getEnd(node);
+                     destination++) {
+                    if (clusters[source] != clusters[destination]) {
+                        const Candidate newCandidate{
+                                tree.computeSquaredDistance(source, destination),
+                                source,
+                                destination};
+                        if (isBetter(newCandidate, candidate)) {
+                            candidate = newCandidate;
+                        }
+                    }
+                }
+                // If all the samples of the leaf belong to the same cluster, then only the closest
+                // candidate of the leaf matters, since it is the only one that can become the
+                // closest candidate of the cluster
+                newBound = isLeafPure ? std::min(newBound, candidate.squaredDistance)
+                                      : std::max(newBound, candidate.squaredDistance);
+            }
+            bound = newBound;
+        } else {
+            // Visit the closest child first, so to tighten the bound as soon as possible
+            std::size_t firstChild = tree.getLeftChild(node);
+            std::size_t secondChild = tree.getRightChild(node);
+            if (tree.computeSquaredBoxDistance(leaf, secondChild) <
+                tree.computeSquaredBoxDistance(leaf, firstChild)) {
+                std::swap(firstChild, secondChild);
+            }
+            searchClosestSamples(
+                    tree, leaf, firstChild, clusters, nodeClusters, sampleCandidates, bound);
+            searchClosestSamples(
+                    tree, leaf, secondChild, clusters, nodeClusters, sampleCandidates, bound);
+        }
+    }
+
+    /**
+     * Checks if a candidate edge is better than another one, i.e., if it is shorter. Equal
+     * distances are ordered using the positions of the two data samples, so that every edge is
+     * different from the others and no cycle can be created.
+     *
+     * @param first First candidate.
+     * @param second Second candidate.
+     * @return <code>true</code> if the first candidate is better than the second one,
+     * <code>false</code> otherwise.
+     */
+    static inline bool isBetter(const Candidate &first, const Candidate &second) {
+
+        if (first.squaredDistance < second.squaredDistance) {
+            return true;
+        }
+        if (second.squaredDistance < first.squaredDistance || std::isinf(second.squaredDistance)) {
+            return false;
+        }
+        return std::minmax(first.source, first.destination) <
+               std::minmax(second.source, second.destination);
+    }
+
+    /**
+     * Finds the root of the cluster the specified data sample belongs to, halving the path to it.
+     *
+     * @param parents Parent of each data sample in the union-find structure.
+     * @param position Position of the data sample in the kd-tree.
+     * @return The position of the root of the cluster.
+     */
+    static inline std::size_t findRoot(std::vector<std::size_t> &parents, std::size_t position) {
+
+        while (parents[position] != position) {
+            parents[position] = parents[parents[position]];
+            position = parents[position];
+        }
+        return position;
+    }
+};
+}  // namespace cluster::parallel
+
+#endif  // FINAL_PROJECT_HPC_BORUVKACLUSTERING_H
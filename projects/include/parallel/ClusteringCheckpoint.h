@@ -0,0 +1,262 @@
+#ifndef FINAL_PROJECT_HPC_CLUSTERINGCHECKPOINT_H
+#define FINAL_PROJECT_HPC_CLUSTERINGCHECKPOINT_H
+
+#include "../utils/PiLambdaIteratorUtils.h"
+#include <chrono>
+#include <cstddef>
+#include <cstdint>
+#include <filesystem>
+#include <vector>
+
+namespace cluster::parallel {
+
+/**
+ * Class that periodically saves to a binary file the state of a running clustering, so that it
+ * can be resumed if the process is interrupted.<br>
+ * After the first <code>n</code> data samples have been added to the dendrogram, the whole state
+ * of the SLINK algorithm is made of the first <code>n</code> values of <code>pi</code> and
+ * <code>lambda</code>, hence only these values are saved, together with <code>n</code>, which is
+ * also the offset of the first data sample still to process. The file is written to a temporary
+ * file first and then renamed, so that an interruption while saving never corrupts the previous
+ * checkpoint.<br>
+ * The file is made of a header, holding a magic number, the version of the format, some flags,
+ * the identifiers of the distance computer and of the metric, the number of data samples, their
+ * dimension and <code>n</code>, followed by the <code>n</code> values of <code>pi</code>, as 64-bit
+ * unsigned integers, and the <code>n</code> values of <code>lambda</code>, as doubles. All the
+ * values are stored in the native byte order.<br>
+ * A limit on the number of data samples to add to the dendrogram can be specified, so that the
+ * clustering saves the checkpoint and stops as soon as the limit is reached, as if the process
+ * had been interrupted.
+ *
+ * @author DeB
+ * @author Jonathan
+ * @version 1.2 2022-10-16
+ * @since 1.0
+ */
+class ClusteringCheckpoint {
+
+    // Imports
+    using PiLambdaIteratorUtils = utils::PiLambdaIteratorUtils;
+
+public:
+    /**
+     * Creates a new checkpoint stored in the specified file.
+     *
+     * @param filePath Path of the file holding the checkpoint.
+     * @param interval Minimum time between two consecutive saves of the checkpoint.
+     * @param samplesLimit Number of data samples after which the clustering is stopped, once the
+     * checkpoint has been saved. If not specified, or if <code>0</code> is specified, then the
+     * clustering is never stopped.
+     */
+    ClusteringCheckpoint(std::filesystem::path filePath,
+                         std::chrono::milliseconds interval,
+                         std::size_t samplesLimit = 0);
+
+    /**
+     * Returns the path of the file holding the checkpoint.
+     *
+     * @return The path of the file holding the checkpoint.
+     */
+    const std::filesystem::path &getFilePath() const noexcept;
+
+    /**
+     * Checks whether enough time has elapsed since the last save, or since the creation of this
+     * object if no save has been performed yet, so that the checkpoint must be saved again.
+     *
+     * @return <code>true</code> if the checkpoint must be saved, <code>false</code> otherwise.
+     */
+    inline bool isDue() const noexcept {
+
+        return std::chrono::steady_clock::now() >= this->nextSaveTime;
+    }
+
+    /**
+     * Checks whether the clustering must be stopped after the first <code>n</code> data samples
+     * have been added to the dendrogram, so that the checkpoint must be saved.
+     *
+     * @param n Number of data samples already added to the dendrogram.
+     * @return <code>true</code> if the clustering must be stopped, <code>false</code> otherwise.
+     */
+    inline bool isStopDue(const std::size_t n) const noexcept {
+
+        return this->samplesLimit != 0 && n >= this->samplesLimit;
+    }
+
+    /**
+     * Checks whether the last save of the checkpoint has stopped the clustering before all the
+     * data samples have been added to the dendrogram.<br>
+     * In this case, <code>pi</code> and <code>lambda</code> hold a partial state that can only be
+     * used to resume the clustering.
+     *
+     * @return <code>true</code> if the clustering has been stopped, <code>false</code> otherwise.
+     */
+    inline bool isInterrupted() const noexcept {
+
+        return this->interrupted;
+    }
+
+    /**
+     * Saves the state of the clustering after the first <code>n</code> data samples have been
+     * added to the dendrogram.
+     *
+     * @tparam P Type of the data structure/iterator holding <code>pi</code>.
+     * @tparam L Type of the data structure/iterator holding <code>lambda</code>.
+     * @tparam EP Type of the efficient iterator iterating over <code>pi</code>.
+     * @tparam EL Type of the efficient iterator iterating over <code>lambda</code>.
+     * @param n Number of data samples already added to the dendrogram.
+     * @param dataSamplesCount Number of data samples to cluster.
+     * @param dimension Number of attributes of each data sample.
+     * @param distanceComputer Identifier of the distance computer used by the clustering.
+     * @param metric Identifier of the metric used by the clustering.
+     * @param squaredLambdas <code>true</code> if <code>lambda</code> holds the squares of the
+     * distances, <code>false</code> otherwise.
+     * @param piBegin Efficient iterator pointing to the first element of <code>pi</code>.
+     * @param lambdaBegin Efficient iterator pointing to the first element of <code>lambda</code>.
+     * @throws std::runtime_error If an I/O error occurs while writing the file.
+     */
+    template <typename P, typename L, typename EP, typename EL>
+    void save(const std::size_t n,
+              const std::size_t dataSamplesCount,
+              const std::size_t dimension,
+              const std::uint32_t distanceComputer,
+              const std::uint32_t metric,
+              const bool squaredLambdas,
+              const EP &piBegin,
+              const EL &lambdaBegin) {
+
+        // Gather the values, since pi and lambda may not be contiguous
+        this->piBuffer.resize(n);
+        this->lambdaBuffer.resize(n);
+        for (std::size_t i = 0; i < n; i++) {
+            this->piBuffer[i] =
+                    PiLambdaIteratorUtils::getElementAt<utils::PiElement<P>, P>(piBegin, i);
+            this->lambdaBuffer[i] = PiLambdaIteratorUtils::getElementAt<double, L>(lambdaBegin, i);
+        }
+
+        this->writeFile(n, dataSamplesCount, dimension, distanceComputer, metric, squaredLambdas);
+        this->interrupted = n < dataSamplesCount && this->isStopDue(n);
+    }
+
+    /**
+     * Restores the state of the clustering saved in the file, if any.
+     *
+     * @tparam P Type of the data structure/iterator holding <code>pi</code>.
+     * @tparam L Type of the data structure/iterator holding <code>lambda</code>.
+     * @tparam EP Type of the efficient iterator iterating over <code>pi</code>.
+     * @tparam EL Type of the efficient iterator iterating over <code>lambda</code>.
+     * @param dataSamplesCount Number of data samples to cluster.
+     * @param dimension Number of attributes of each data sample.
+     * @param distanceComputer Identifier of the distance computer used by the clustering.
+     * @param metric Identifier of the metric used by the clustering.
+     * @param squaredLambdas <code>true</code> if <code>lambda</code> holds the squares of the
+     * distances, <code>false</code> otherwise.
+     * @param piBegin Efficient iterator pointing to the first element of <code>pi</code>.
+     * @param lambdaBegin Efficient iterator pointing to the first element of <code>lambda</code>.
+     * @return The number of data samples already added to the dendrogram, or <code>0</code> if
+     * the file does not exist.
+     * @throws std::runtime_error If an I/O error occurs while reading the file, or if the file is
+     * malformed.
+     * @throws std::invalid_argument If the file has been saved while clustering a different number
+     * of data samples, data samples with a different dimension, or using a different distance
+     * computer or metric.
+     */
+    template <typename P, typename L, typename EP, typename EL>
+    std::size_t restore(const std::size_t dataSamplesCount,
+                        const std::size_t dimension,
+                        const std::uint32_t distanceComputer,
+                        const std::uint32_t metric,
+                        const bool squaredLambdas,
+                        const EP &piBegin,
+                        const EL &lambdaBegin) {
+
+        this->interrupted = false;
+        const std::size_t n = this->readFile(
+                dataSamplesCount, dimension, distanceComputer, metric, squaredLambdas);
+        for (std::size_t i = 0; i < n; i++) {
+            PiLambdaIteratorUtils::getElementAt<utils::PiElement<P>, P>(piBegin, i) =
+                    static_cast<utils::PiElement<P>>(this->piBuffer[i]);
+            PiLambdaIteratorUtils::getElementAt<double, L>(lambdaBegin, i) = this->lambdaBuffer[i];
+        }
+        return n;
+    }
+
+private:
+    /**
+     * Path of the file holding the checkpoint.
+     */
+    std::filesystem::path filePath;
+
+    /**
+     * Minimum time between two consecutive saves of the checkpoint.
+     */
+    std::chrono::milliseconds interval;
+
+    /**
+     * Instant after which the checkpoint must be saved again.
+     */
+    std::chrono::steady_clock::time_point nextSaveTime;
+
+    /**
+     * Number of data samples after which the clustering is stopped, or <code>0</code> if it is
+     * never stopped.
+     */
+    std::size_t samplesLimit;
+
+    /**
+     * <code>true</code> if the last save has stopped the clustering, <code>false</code> otherwise.
+     */
+    bool interrupted;
+
+    /**
+     * Buffer holding the values of <code>pi</code> being written or read.
+     */
+    std::vector<std::uint64_t> piBuffer;
+
+    /**
+     * Buffer holding the values of <code>lambda</code> being written or read.
+     */
+    std::vector<double> lambdaBuffer;
+
+    /**
+     * Writes the checkpoint file, using the values held by the buffers.
+     *
+     * @param n Number of data samples already added to the dendrogram.
+     * @param dataSamplesCount Number of data samples to cluster.
+     * @param dimension Number of attributes of each data sample.
+     * @param distanceComputer Identifier of the distance computer used by the clustering.
+     * @param metric Identifier of the metric used by the clustering.
+     * @param squaredLambdas <code>true</code> if <code>lambda</code> holds the squares of the
+     * distances, <code>false</code> otherwise.
+     * @throws std::runtime_error If an I/O error occurs while writing the file.
+     */
+    void writeFile(std::size_t n,
+                   std::size_t dataSamplesCount,
+                   std::size_t dimension,
+                   std::uint32_t distanceComputer,
+                   std::uint32_t metric,
+                   bool squaredLambdas);
+
+    /**
+     * Reads the checkpoint file, if it exists, placing the values in the buffers.
+     *
+     * @param dataSamplesCount Number of data samples to cluster.
+     * @param dimension Number of attributes of each data sample.
+     * @param distanceComputer Identifier of the distance computer used by the clustering.
+     * @param metric Identifier of the metric used by the clustering.
+     * @param squaredLambdas <code>true</code> if <code>lambda</code> holds the squares of the
+     * distances, <code>false</code> otherwise.
+     * @return The number of data samples already added to the dendrogram, or <code>0</code> if
+     * the file does not exist.
+     * @throws std::runtime_error If an I/O error occurs while reading the file, or if the file is
+     * malformed.
+     * @throws std::invalid_argument If the file does not match the specified parameters.
+     */
+    std::size_t readFile(std::size_t dataSamplesCount,
+                         std::size_t dimension,
+                         std::uint32_t distanceComputer,
+                         std::uint32_t metric,
+                         bool squaredLambdas);
+};
+}  // namespace cluster::parallel
+
+#endif  // FINAL_PROJECT_HPC_CLUSTERINGCHECKPOINT_H
@@ -0,0 +1,241 @@
+#ifndef FINAL_PROJECT_HPC_COPHENETICINDEX_H
+#define FINAL_PROJECT_HPC_COPHENETICINDEX_H
+
+#include "../utils/Types.h"
+#include "LinkageMatrixConverter.h"
+#include <algorithm>
+#include <bit>
+#include <cstddef>
+#include <utility>
+#include <vector>
+
+namespace cluster::parallel {
+
+/**
+ * Index answering in constant time the queries about the cophenetic distance between two data
+ * samples, i.e., the height at which they are merged into the same cluster of the single-linkage
+ * dendrogram.<br>
+ * The dendrogram, obtained from the pointer representation through its linkage matrix, is the
+ * Cartesian tree of the merge heights: every merge is the parent of the two merges that created
+ * the clusters it joins, which are lower. Hence, the index lists the data samples in the in-order
+ * of the tree, storing between every two consecutive data samples the height of the merge visited
+ * between them. The lowest common ancestor of two data samples is the highest merge visited
+ * between them, so their cophenetic distance is the maximum of the heights stored between their
+ * positions. This range maximum query is answered in constant time by a sparse table, whose
+ * <code>k</code>-th level holds the maximum of every range of <code>2^k</code> consecutive
+ * heights, by combining the two overlapping ranges that cover the queried one.<br>
+ * The index takes <code>O(n log n)</code> time to be built and <code>O(n log n)</code> memory,
+ * since the sparse table holds <code>log n</code> levels of <code>n - 1</code> heights. It is not
+ * the <code>O(n)</code> memory Cartesian tree with a linear-space lowest common ancestor index,
+ * which would require a block decomposition of the heights to keep the queries in constant time.
+ * The levels of the sparse table, as well as the batches of queries, are computed in parallel.
+ *
+ * @tparam PQ <code>true</code> if the index should parallelize its construction and the batches
+ * of queries using threads, <code>false</code> otherwise.
+ *
+ * @author DeB
+ * @author Jonathan
+ * @version 1.1 2022-10-16
+ * @since 1.0
+ */
+template <bool PQ = true>
+class CopheneticIndex {
+
+public:
+    /**
+     * Builds the index of the dendrogram described by the specified pointer representation.
+     *
+     * @tparam P Type of the data structure/iterator holding <code>pi</code>.
+     * @tparam L Type of the data structure/iterator holding <code>lambda</code>.
+     * @param pi Data structure/iterator holding the <code>pi</code> values, as computed by the
+     * clustering algorithm.
+     * @param lambda Data structure/iterator holding the <code>lambda</code> values, as computed by
+     * the clustering algorithm.
+     * @param dataSamplesCount Number of data samples that have been clustered.
+     * @param threadsCount Number of threads to use to build the index. If not specified, or if
+     * <code>0</code> is specified, then this constructor uses the default number of threads
+     * computed by OpenMP.<br>
+     * This parameter takes effect only if <code>PQ</code> is <code>true</code>.
+     */
+    template <utils::PiIterator P, utils::LambdaIterator L>
+    CopheneticIndex(P &pi,
+                    L &lambda,
+                    const std::size_t dataSamplesCount,
+                    const std::size_t threadsCount = 0) :
+        dataSamplesCount(dataSamplesCount),
+        positions(),
+        gapsCount(0),
+        sparseTable() {
+
+        if (dataSamplesCount < 2) {
+            this->positions.resize(dataSamplesCount, 0);
+            return;
+        }
+
+        // **** 1) Compute the in-order of the dendrogram ****
+        const std::vector<LinkageMatrixRow> linkageMatrix =
+                LinkageMatrixConverter<PQ>::toLinkageMatrix(
+                        pi, lambda, dataSamplesCount, threadsCount);
+        this->gapsCount = dataSamplesCount - 1;
+        this->positions.resize(dataSamplesCount);
+        // The first level of the sparse table holds the heights between consecutive data samples
+        this->sparseTable.resize(this->gapsCount);
+
+        // Visit the tree from the root, i.e., the last merge, without recursion. When a merge is
+        // popped, its right subtree, its height and its left subtree are pushed, in this order
+        std::vector<std::pair<std::size_t, bool>> stack{};
+        stack.emplace_back(2 * dataSamplesCount - 2, false);
+        std::size_t nextPosition = 0;
+        while (!stack.empty()) {
+            const auto [cluster, isHeight] = stack.back();
+            stack.pop_back();
+            if (isHeight) {
+                // The height lies between the last placed data sample and the next one
+                this->sparseTable[nextPosition - 1] =
+                        linkageMatrix[cluster - dataSamplesCount].height;
+            } else if (cluster < dataSamplesCount) {
+                this->positions[cluster] = nextPosition;
+                ++nextPosition;
+            } else {
+                const LinkageMatrixRow &row = linkageMatrix[cluster - dataSamplesCount];
+                stack.emplace_back(row.secondCluster, false);
+                stack.emplace_back(cluster, true);
+                stack.emplace_back(row.firstCluster, false);
+            }
+        }
+
+        // **** 2) Build the sparse table ****
+        // The k-th level holds the maximum of the ranges of 2^k heights, computed from the two
+        // halves stored in the previous level
+        const std::size_t levelsCount = std::bit_width(this->gapsCount);
+        this->sparseTable.resize(levelsCount * this->gapsCount);
+        for (std::size_t k = 1; k < levelsCount; k++) {
+            const std::size_t halfSize = std::size_t{1} << (k - 1);
+            const std::size_t rangesCount = this->gapsCount - 2 * halfSize + 1;
+            const double *const previousLevel = &(this->sparseTable[(k - 1) * this->gapsCount]);
+            double *const level = &(this->sparseTable[k * this->gapsCount]);
+#pragma omp parallel for default(none) shared(previousLevel, level) \
+        firstprivate(halfSize, rangesCount) num_threads(threadsCount) if (PQ)
+            for (std::size_t p = 0; p < rangesCount; p++) {
+                level[p] = std::max(previousLevel[p], previousLevel[p + halfSize]);
+            }
+        }
+    }
+
+    /**
+     * Returns the cophenetic distance between the two specified data samples.
+     *
+     * @param first Index of the first data sample.
+     * @param second Index of the second data sample.
+     * @return The height at which the two data samples are merged into the same cluster, or
+     * <code>0</code> if they are the same data sample.
+     */
+    double getCopheneticDistance(const std::size_t first, const std::size_t second) const {
+
+        std::size_t begin = this->positions[first];
+        std::size_t end = this->positions[second];
+        if (begin == end) {
+            return 0;
+        }
+        if (end < begin) {
+            std::swap(begin, end);
+        }
+
+        // Cover the heights between the two positions with two ranges of the same power of two
+        const std::size_t k = std::bit_width(end - begin) - 1;
+        const double *const level = &(this->sparseTable[k * this->gapsCount]);
+        return std::max(level[begin], level[end - (std::size_t{1} << k)]);
+    }
+
+    /**
+     * Returns the cophenetic distances between the specified pairs of data samples.
+     *
+     * @param pairs Pairs of indices of data samples.
+     * @param distances Vector where the cophenetic distances will be placed. It is resized to the
+     * number of pairs, and the distance between the data samples of <code>pairs[q]</code> is
+     * placed at position <code>q</code>.
+     * @param threadsCount Number of threads to use to answer the queries. If not specified, or if
+     * <code>0</code> is specified, then this method uses the default number of threads computed by
+     * OpenMP.<br>
+     * This parameter takes effect only if <code>PQ</code> is <code>true</code>.
+     */
+    void getCopheneticDistances(const std::vector<std::pair<std::size_t, std::size_t>> &pairs,
+                                std::vector<double> &distances,
+                                const std::size_t threadsCount = 0) const {
+
+        distances.resize(pairs.size());
+#pragma omp parallel for default(none) shared(pairs, distances) num_threads(threadsCount) if (PQ)
+        for (std::size_t q = 0; q < pairs.size(); q++) {
+            distances[q] = this->getCopheneticDistance(pairs[q].first, pairs[q].second);
+        }
+    }
+
+    /**
+     * Returns the cophenetic distances between all the pairs of data samples, stored as a
+     * condensed distance matrix, i.e., in the same layout used by
+     * <code>ParallelClustering::clusterDistanceMatrix</code> and by
+     * <code>scipy.cluster.hierarchy.cophenet</code>. In this way, they can be correlated with the
+     * distances between the data samples to validate the dendrogram.
+     *
+     * @param distances Vector where the cophenetic distances will be placed. It is resized to
+     * <code>n * (n - 1) / 2</code>, where <code>n</code> is the number of data samples.
+     * @param threadsCount Number of threads to use to answer the queries. If not specified, or if
+     * <code>0</code> is specified, then this method uses the default number of threads computed by
+     * OpenMP.<br>
+     * This parameter takes effect only if <code>PQ</code> is <code>true</code>.
+     */
+    void getCondensedCopheneticDistances(std::vector<double> &distances,
+                                         const std::size_t threadsCount = 0) const {
+
+        const std::size_t count = this->dataSamplesCount;
+        // The last data sample has no row, since all its pairs are stored in the previous rows
+        const std::size_t rowsCount = (count < 2) ? 0 : count - 1;
+        distances.resize(rowsCount * count / 2);
+        // The rows get shorter, so they are distributed dynamically
+#pragma omp parallel for default(none) shared(distances) firstprivate(count, rowsCount) \
+        schedule(dynamic, 64) num_threads(threadsCount) if (PQ)
+        for (std::size_t i = 0; i < rowsCount; i++) {
+            double *const row = &(distances[count * i - i * (i + 1) / 2]);
+            for (std::size_t j = i + 1; j < count; j++) {
+                row[j - i - 1] = this->getCopheneticDistance(i, j);
+            }
+        }
+    }
+
+    /**
+     * Returns the number of data samples of the dendrogram.
+     *
+     * @return The number of data samples of the dendrogram.
+     */
+    std::size_t getDataSamplesCount() const noexcept {
+
+        return this->dataSamplesCount;
+    }
+
+private:
+    /**
+     * Number of data samples of the dendrogram.
+     */
+    std::size_t dataSamplesCount;
+
+    /**
+     * Position of every data sample in the in-order of the dendrogram.
+     */
+    std::vector<std::size_t> positions;
+
+    /**
+     * Number of heights between consecutive data samples in the in-order of the dendrogram, i.e.,
+     * the length of every level of the sparse table.
+     */
+    std::size_t gapsCount;
+
+    /**
+     * Levels of the sparse table, one after the other. The <code>p</code>-th element of the
+     * <code>k</code>-th level is the maximum height between the data samples at positions
+     * <code>p</code> and <code>p + 2^k</code>.
+     */
+    std::vector<double> sparseTable;
+};
+}  // namespace cluster::parallel
+
+#endif  // FINAL_PROJECT_HPC_COPHENETICINDEX_H
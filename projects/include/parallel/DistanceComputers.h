@@ -8,7 +8,7 @@ namespace cluster::parallel {
  *
  * @author DeB
  * @author Jonathan
- * @version 1.2 2022-07-30
+ * @version 1.7 2022-10-08
  * @since 1.0
  */
 enum class DistanceComputers {
@@ -101,7 +101,119 @@ enum class DistanceComputers {
      * must be padded with <code>0</code> at the end until the number of attributes becomes a
      * multiple of <code>ParallelClustering::AVX_PACK_SIZE</code>.
      */
-    AVX_OPTIMIZED_NO_SQUARE_ROOT
+    AVX_OPTIMIZED_NO_SQUARE_ROOT,
+
+    /**
+     * Computes the Euclidean distance between two data samples using AVX and FMA instructions.<br>
+     * With respect to the <code>DistanceComputers::AVX_OPTIMIZED</code> algorithm, this one
+     * squares the differences and adds them to the partial sums using fused multiply-add
+     * instructions, and keeps 4 independent partial sums in the registers, so that each
+     * instruction does not wait for the result of the previous one.<br>
+     * The attributes of each data sample <b>MUST BE</b> stored sequentially in memory, and must
+     * be 32 bytes-aligned (i.e., the memory address of the first attribute of each data sample must
+     * be a multiple of 32).<br>
+     * Moreover, the number of attributes of the data samples must be a multiple of
+     * <code>ParallelClustering::AVX_PACK_SIZE</code>. If it is not the case, then the data samples
+     * must be padded with <code>0</code> at the end until the number of attributes becomes a
+     * multiple of <code>ParallelClustering::AVX_PACK_SIZE</code>.<br>
+     * This algorithm requires a CPU supporting the FMA instructions.
+     */
+    AVX_FMA,
+
+    /**
+     * Computes the Euclidean distance between two data samples using AVX and FMA instructions.<br>
+     * Like the <code>DistanceComputers::AVX_FMA</code> algorithm, this one uses fused multiply-add
+     * instructions and keeps 4 independent partial sums in the registers.<br>
+     * Moreover, this algorithm computes the squares of the distances, avoiding the computation
+     * of the square roots.<br>
+     * The attributes of each data sample <b>MUST BE</b> stored sequentially in memory, and must
+     * be 32 bytes-aligned (i.e., the memory address of the first attribute of each data sample must
+     * be a multiple of 32).<br>
+     * Moreover, the number of attributes of the data samples must be a multiple of
+     * <code>ParallelClustering::AVX_PACK_SIZE</code>. If it is not the case, then the data samples
+     * must be padded with <code>0</code> at the end until the number of attributes becomes a
+     * multiple of <code>ParallelClustering::AVX_PACK_SIZE</code>.<br>
+     * This algorithm requires a CPU supporting the FMA instructions.
+     */
+    AVX_FMA_NO_SQUARE_ROOT,
+
+    /**
+     * Computes the squares of the Euclidean distances between a data sample and
+     * <code>ParallelClustering::AVX_PACK_SIZE</code> other data samples at a time using AVX
+     * instructions.<br>
+     * The data samples <b>MUST BE</b> stored in blocks of
+     * <code>ParallelClustering::AVX_PACK_SIZE</code> consecutive data samples whose attributes are
+     * interleaved, i.e., each block holds the first attribute of all its data samples, then the
+     * second attribute of all its data samples, and so on. In this way, each lane of an AVX
+     * register holds an attribute of a different data sample, and no horizontal sum is needed.
+     * This is especially convenient for data samples with few attributes, which would fill only a
+     * few lanes otherwise.<br>
+     * The data structure/iterator holding the data samples iterates over the blocks, not over the
+     * data samples. The blocks must be 32 bytes-aligned, and the last one must be padded with
+     * <code>0</code> until it holds <code>ParallelClustering::AVX_PACK_SIZE</code> data samples.
+     * Hence, if the blocks are contiguous in memory, then they hold exactly
+     * <code>ParallelClustering::computeAvxInterleavedSize</code> attributes.<br>
+     * Like the <code>DistanceComputers::AVX_OPTIMIZED_NO_SQUARE_ROOT</code> algorithm, this one
+     * avoids the computation of the square roots, which are computed at the end of the
+     * algorithm. This algorithm is supported only by the <code>ExecutionModes::STAGED</code>
+     * execution mode.
+     */
+    AVX_INTERLEAVED_NO_SQUARE_ROOT,
+
+    /**
+     * Computes the Euclidean distance between two data samples using AVX-512 instructions.<br>
+     * This algorithm does not store any partial sum into memory, but keeps them in the
+     * registers. The last attributes of each data sample, which may not fill a whole
+     * <code>ParallelClustering::AVX512_PACK_SIZE</code> pack, are processed using masks.<br>
+     * The attributes of each data sample <b>MUST BE</b> stored sequentially in memory, but they
+     * need neither to be aligned nor to be padded with <code>0</code>. Hence, if the data samples
+     * are contiguous in memory, then the stride between them is exactly the number of their
+     * attributes.<br>
+     * This algorithm requires a CPU supporting the AVX-512 Foundation instructions.
+     */
+    AVX512,
+
+    /**
+     * Computes the Euclidean distance between two data samples using AVX-512 instructions.<br>
+     * Like the <code>DistanceComputers::AVX512</code> algorithm, this one keeps the partial sums
+     * in the registers and processes the last attributes of each data sample using masks.<br>
+     * Moreover, this algorithm computes the squares of the distances, avoiding the computation
+     * of the square roots.<br>
+     * The attributes of each data sample <b>MUST BE</b> stored sequentially in memory, but they
+     * need neither to be aligned nor to be padded with <code>0</code>. Hence, if the data samples
+     * are contiguous in memory, then the stride between them is exactly the number of their
+     * attributes.<br>
+     * This algorithm requires a CPU supporting the AVX-512 Foundation instructions.
+     */
+    AVX512_NO_SQUARE_ROOT,
+
+    /**
+     * Computes the squares of the Euclidean distances between two data samples using the fastest
+     * kernel supported by the CPU the application is running on, selected at run-time by the
+     * <code>DistanceKernelDispatcher</code> class.<br>
+     * Like the <code>DistanceComputers::AVX512_NO_SQUARE_ROOT</code> algorithm, this one avoids the
+     * computation of the square roots, which are computed at the end of the algorithm.<br>
+     * The attributes of each data sample <b>MUST BE</b> stored sequentially in memory, but they
+     * need neither to be aligned nor to be padded with <code>0</code>. Hence, if the data samples
+     * are contiguous in memory, then the stride between them is exactly the number of their
+     * attributes.<br>
+     * This algorithm can be executed on any x86-64 CPU.
+     */
+    AUTO,
+
+    /**
+     * Computes the squares of the Euclidean distances between two data samples by expanding them
+     * as <code>||x||^2 + ||y||^2 - 2 * x * y</code>, using AVX and FMA instructions.<br>
+     * The squared norm of each data sample is computed only once, so that each distance costs a
+     * single dot product, which is computed for several data samples at a time like in a matrix
+     * product. Since the expansion loses precision when the distance is much smaller than the
+     * norms, such distances are computed again in the classical way.<br>
+     * The attributes of the data samples <b>MUST BE</b> <code>double</code>s, aligned and padded
+     * like for the <code>DistanceComputers::AVX_OPTIMIZED_NO_SQUARE_ROOT</code> algorithm. This
+     * algorithm is supported only by the <code>ExecutionModes::BLOCKED</code> execution mode, and
+     * requires a CPU supporting the FMA instructions.
+     */
+    NORM_EXPANSION
 };
 }  // namespace cluster::parallel
 #endif  // FINAL_PROJECT_HPC_DISTANCECOMPUTERS_H
@@ -0,0 +1,121 @@
+#ifndef FINAL_PROJECT_HPC_DISTANCEKERNELDISPATCHER_H
+#define FINAL_PROJECT_HPC_DISTANCEKERNELDISPATCHER_H
+
+#include <atomic>
+#include <cstddef>
+
+namespace cluster::parallel {
+
+/**
+ * Enumeration of the instruction sets the <code>DistanceKernelDispatcher</code> can select to
+ * compute the distances between the data samples.
+ *
+ * @author DeB
+ * @author Jonathan
+ * @version 1.0 2022-09-22
+ * @since 1.0
+ */
+enum class InstructionSets {
+
+    /**
+     * SSE2 instructions, available on every x86-64 CPU.
+     */
+    SSE2,
+
+    /**
+     * AVX instructions.
+     */
+    AVX,
+
+    /**
+     * AVX2 instructions together with the fused multiply-add ones.
+     */
+    AVX2_FMA,
+
+    /**
+     * AVX-512 Foundation instructions.
+     */
+    AVX512
+};
+
+/**
+ * Class that selects at run-time the fastest kernel that computes the distance between two data
+ * samples, based on the instruction sets supported by the CPU the application is running on.<br>
+ * The CPU is probed only once, the first time a distance is computed, and the selected kernel is
+ * then bound through a function pointer. All the kernels compute the square of the Euclidean
+ * distance, and they require neither the data samples to be aligned nor to be padded.<br>
+ * Since every kernel is compiled for its own instruction set, the same binary can be executed on
+ * CPUs supporting different instruction sets, regardless of the options given to the compiler.
+ *
+ * @author DeB
+ * @author Jonathan
+ * @version 1.0 2022-09-22
+ * @since 1.0
+ */
+class DistanceKernelDispatcher {
+
+public:
+    /**
+     * Type of the kernels computing the square of the distance between two data samples.
+     */
+    using DistanceKernel = double (*)(const double *firstPoint,
+                                      const double *secondPoint,
+                                      std::size_t dimension) noexcept;
+
+    /**
+     * Computes the square of the Euclidean distance between two data samples using the fastest
+     * kernel supported by the CPU.
+     *
+     * @param firstPoint Pointer to the first attribute of the first data sample.
+     * @param secondPoint Pointer to the first attribute of the second data sample.
+     * @param dimension Number of attributes of the two data samples.
+     * @return The square of the distance between the two data samples.
+     */
+    static inline double computeSquaredDistance(const double *const firstPoint,
+                                                const double *const secondPoint,
+                                                const std::size_t dimension) noexcept {
+
+        return kernel.load(std::memory_order_relaxed)(firstPoint, secondPoint, dimension);
+    }
+
+    /**
+     * Returns the fastest instruction set supported by the CPU the application is running on,
+     * among the ones the dispatcher can use. The CPU is probed only the first time this method is
+     * called.
+     *
+     * @return The instruction set used to compute the distances.
+     */
+    static InstructionSets getSelectedInstructionSet() noexcept;
+
+    /**
+     * Returns a human-readable description of the specified instruction set.
+     *
+     * @param instructionSet Instruction set to describe.
+     * @return The description of the instruction set.
+     */
+    static const char *getDescription(InstructionSets instructionSet) noexcept;
+
+private:
+    /**
+     * Kernel used to compute the distances. Initially, it points to a kernel that selects the
+     * fastest kernel, binds it, and then uses it to compute the requested distance.
+     */
+    static std::atomic<DistanceKernel> kernel;
+
+    /**
+     * Selects the fastest kernel supported by the CPU, binds it so that it is used for all the
+     * following computations, and then uses it to compute the square of the distance between the
+     * specified data samples.
+     *
+     * @param firstPoint Pointer to the first attribute of the first data sample.
+     * @param secondPoint Pointer to the first attribute of the second data sample.
+     * @param dimension Number of attributes of the two data samples.
+     * @return The square of the distance between the two data samples.
+     */
+    static double bindKernel(const double *firstPoint,
+                             const double *secondPoint,
+                             std::size_t dimension) noexcept;
+};
+}  // namespace cluster::parallel
+
+#endif  // FINAL_PROJECT_HPC_DISTANCEKERNELDISPATCHER_H
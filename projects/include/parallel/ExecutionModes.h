@@ -0,0 +1,57 @@
+#ifndef FINAL_PROJECT_HPC_EXECUTIONMODES_H
+#define FINAL_PROJECT_HPC_EXECUTIONMODES_H
+
+namespace cluster::parallel {
+/**
+ * Enumeration of all the ways the parallel clustering algorithm can organize the threads that
+ * execute the stages of each iteration.
+ *
+ * @author DeB
+ * @author Jonathan
+ * @version 1.3 2022-10-16
+ * @since 1.0
+ */
+enum class ExecutionModes {
+
+    /**
+     * Executes the stages of each iteration one after the other, opening a new parallel region
+     * every time a stage is parallelized.<br>
+     * The number of threads used by each stage can be specified separately.
+     */
+    STAGED,
+
+    /**
+     * Opens a unique parallel region that lasts for the whole execution of the clustering
+     * algorithm. The threads of the team are kept alive across all the iterations, and are
+     * synchronized using barriers instead of being created and joined for every stage of every
+     * iteration.<br>
+     * All the parallelized stages are executed by the same team, whose size is the number of
+     * threads requested for the computation of the distances.
+     */
+    PERSISTENT_TEAM,
+
+    /**
+     * Works like <code>ExecutionModes::PERSISTENT_TEAM</code>, but overlaps the iterations: while
+     * the master thread adds the current data sample to the dendrogram, the other threads of the
+     * team already compute the distances required by the following data sample, which are stored
+     * in a second part-row array. The master thread joins them as soon as it completes its work.
+     * <br>
+     * The overlap takes place only if the computation of the distances is parallelized.
+     */
+    PIPELINED,
+
+    /**
+     * Works like <code>ExecutionModes::STAGED</code>, but processes the data samples in blocks of
+     * consecutive ones: the distances required by all the data samples of a block are computed in
+     * a unique sweep over the previous data samples, so that each of them is read from the memory
+     * once per block instead of once per data sample. Then, the data samples of the block are
+     * added to the dendrogram one after the other, as in the staged mode.<br>
+     * The part-rows of all the data samples of a block are kept at the same time, so this mode
+     * holds <code>ParallelClustering::BLOCK_SIZE</code> times as many part-row values as the
+     * staged mode, i.e., <code>8 * n</code> instead of <code>n</code>.<br>
+     * The number of threads used by each stage can be specified separately.
+     */
+    BLOCKED
+};
+}  // namespace cluster::parallel
+#endif  // FINAL_PROJECT_HPC_EXECUTIONMODES_H
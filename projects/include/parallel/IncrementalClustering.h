@@ -0,0 +1,354 @@
+#ifndef FINAL_PROJECT_HPC_INCREMENTALCLUSTERING_H
+#define FINAL_PROJECT_HPC_INCREMENTALCLUSTERING_H
+
+#include "../utils/DistanceMetrics.h"
+#include "../utils/PiLambdaIteratorUtils.h"
+#include "../utils/Types.h"
+#include "DistanceComputers.h"
+#include "ParallelClustering.h"
+#include <algorithm>
+#include <cmath>
+#include <cstdint>
+#include <cstring>
+#include <immintrin.h>
+#include <limits>
+#include <new>
+#include <stdexcept>
+#include <vector>
+
+namespace cluster::parallel {
+
+/**
+ * Class providing a stateful, parallel implementation of the clustering algorithm that accepts the
+ * data samples incrementally.<br>
+ * Since the SLINK algorithm only looks at the data samples <code>0, ..., n</code> when it adds the
+ * data sample <code>n</code> to the dendrogram, the data samples can be appended one after the
+ * other as soon as they are available, without re-running the clustering from scratch. After each
+ * append, the dendrogram of all the data samples appended so far can be queried.<br>
+ * The object keeps its own copy of the data samples, padded and aligned as the distance computer
+ * requires, together with <code>pi</code>, <code>lambda</code> and the part row, all of which grow
+ * as new data samples are appended. Each append performs the same stages of
+ * <code>ParallelClustering::cluster</code> with the <code>ExecutionModes::STAGED</code> mode.
+ *
+ * @tparam C Enumeration constant specifying the algorithm to use to compute the distance between
+ * two data samples. The same restrictions of <code>ParallelClustering::cluster</code> apply.
+ * @tparam S Type of the attributes of the data samples. It must be either <code>double</code>,
+ * which is the default, or <code>float</code>.
+ * @tparam PD <code>true</code> if the distances between each new data sample and the previous ones
+ * should be computed in parallel using threads, <code>false</code> otherwise.
+ * @tparam PF <code>true</code> if the structural fix after each new data sample is added to the
+ * dendrogram should be computed in parallel using threads, <code>false</code> otherwise.
+ * @tparam MT Policy describing the metric used to measure the distance between two data samples.
+ * The same restrictions of <code>ParallelClustering::cluster</code> apply.
+ * @tparam PE Type of the elements of <code>pi</code>. It must be either <code>std::size_t</code>,
+ * which is the default, or <code>std::uint32_t</code>, which halves the memory taken by
+ * <code>pi</code> but limits the number of data samples to <code>2^32</code>.
+ *
+ * @author DeB
+ * @author Jonathan
+ * @version 1.2 2022-10-16
+ * @since 1.0
+ */
+template <DistanceComputers C = DistanceComputers::AUTO,
+          typename S = double,
+          bool PD = true,
+          bool PF = true,
+          typename MT = utils::EuclideanMetric,
+          typename PE = std::size_t>
+class IncrementalClustering {
+
+    // Imports
+    using Kernels = ParallelClustering<PD, PF, false, false>;
+    using PiLambdaIteratorUtils = utils::PiLambdaIteratorUtils;
+
+    static_assert(std::is_same_v<S, double> || std::is_same_v<S, float>,
+                  "The attributes of the data samples must be either doubles or floats.");
+    static_assert(std::is_same_v<S, double> || Kernels::isSinglePrecisionSupported(C),
+                  "The specified distance computer does not support float attributes.");
+    static_assert(std::is_same_v<MT, utils::EuclideanMetric> || Kernels::isMetricSupported(C),
+                  "The specified distance computer supports only the Euclidean metric.");
+    static_assert(std::is_same_v<PE, std::size_t> || std::is_same_v<PE, std::uint32_t>,
+                  "The elements of pi must be either std::size_t or std::uint32_t.");
+
+    /**
+     * Alignment, in bytes, of every data sample stored in the buffer. It is enough for all the
+     * distance computers.
+     */
+    static const constexpr std::size_t ALIGNMENT = 64;
+
+    /**
+     * Number of data samples the buffer can hold when the first data sample is appended.
+     */
+    static const constexpr std::size_t INITIAL_CAPACITY = 1024;
+
+public:
+    /**
+     * Creates a new object clustering data samples having the specified number of attributes.
+     *
+     * @param dimension Number of attributes of each data sample.
+     * @param distanceComputationThreadsCount Number of threads to use to parallelize the
+     * computation of the distances between each new data sample and the previous ones. If not
+     * specified, or if <code>0</code> is specified, then the default number of threads computed by
+     * OpenMP is used.<br>
+     * This parameter takes effect only if <code>PD</code> is <code>true</code>.
+     * @param structuralFixThreadsCount Number of threads to use to parallelize the structural fix
+     * after each new data sample is added to the dendrogram. If not specified, or if
+     * <code>0</code> is specified, then the default number of threads computed by OpenMP is
+     * used.<br>
+     * This parameter takes effect only if <code>PF</code> is <code>true</code>.
+     * @throws std::invalid_argument If the dimension is <code>0</code>.
+     */
+    explicit IncrementalClustering(const std::size_t dimension,
+                                   const std::size_t distanceComputationThreadsCount = 0,
+                                   const std::size_t structuralFixThreadsCount = 0) :
+        dimension(dimension),
+        stride(Kernels::template computeStride<C, S>(dimension)),
+        distanceComputationThreadsCount(distanceComputationThreadsCount),
+        structuralFixThreadsCount(structuralFixThreadsCount),
+        data(nullptr),
+        capacity(0),
+        pi(),
+        lambda(),
+        m(),
+        inverseNorms() {
+
+        if (dimension == 0) {
+            throw std::invalid_argument("The data samples must have at least one attribute");
+        }
+    }
+
+    IncrementalClustering(const IncrementalClustering &) = delete;
+    IncrementalClustering(IncrementalClustering &&) = delete;
+    IncrementalClustering &operator=(const IncrementalClustering &) = delete;
+    IncrementalClustering &operator=(IncrementalClustering &&) = delete;
+
+    /**
+     * Destroys the object, releasing the buffer holding the data samples.
+     */
+    ~IncrementalClustering() {
+
+        _mm_free(this->data);
+    }
+
+    /**
+     * Appends a new data sample, adding it to the dendrogram.
+     *
+     * @param sample Pointer to the first attribute of the data sample. The data sample <b>MUST
+     * BE</b> made of exactly <code>dimension</code> attributes, and it needs to be neither aligned
+     * nor padded, since it is copied.
+     * @throws std::invalid_argument If the elements of <code>pi</code> cannot store the index of
+     * the new data sample.
+     */
+    void append(const S *const sample) {
+
+        // Make room for the new data sample, if its index can be stored in pi
+        const std::size_t n = this->pi.size();
+        PiLambdaIteratorUtils::requirePiCapacity<std::vector<PE>>(n + 1);
+        if (n == this->capacity) {
+            this->reserve(std::max(INITIAL_CAPACITY, 2 * this->capacity));
+        }
+
+        // Copy the new data sample, padding it with zeros
+        S *const currentDataN = &(this->data[n * this->stride]);
+        std::memcpy(currentDataN, sample, this->dimension * sizeof(S));
+        std::fill(currentDataN + this->dimension, currentDataN + this->stride, S{0});
+
+        // Compute the inverse of the norm of the new data sample, if the metric requires it
+        if constexpr (MT::REQUIRES_NORMS) {
+            this->inverseNorms[n] =
+                    MT::computeInverseNorm(Kernels::template computeMetricValue<C, MT>(
+                            currentDataN, currentDataN + this->stride, currentDataN));
+        }
+
+        // **** 1) Set pi(n + 1) to n + 1, lambda(n + 1) to infinity ****
+        this->pi.push_back(static_cast<PE>(n));
+        this->lambda.push_back(std::numeric_limits<double>::infinity());
+        if (n == 0) {
+            // No more operations need to be performed for the first data sample
+            return;
+        }
+
+        // Efficient iterators pointing to the first element of pi, lambda and the data samples
+        PE *const piBegin = this->pi.data();
+        double *const lambdaBegin = this->lambda.data();
+        const S *const dataBegin = this->data;
+        S *const mBegin = this->m.data();
+
+        // **** 2) Set M(i) to d(i, n + 1) for i = 1,..,n ****
+        Kernels::template computeDistances<C, MT, const S *>(n,
+                                                             dataBegin,
+                                                             this->stride,
+                                                             currentDataN,
+                                                             currentDataN + this->stride,
+                                                             mBegin,
+                                                             this->inverseNorms.data(),
+                                                             this->distanceComputationThreadsCount);
+
+        // **** 3) For i from 1 to n ****
+        Kernels::template addNewPoint<std::vector<PE>, std::vector<double>>(
+                piBegin, lambdaBegin, mBegin, mBegin + n, n);
+
+        // **** 4) For i from 1 to n ****
+        Kernels::template fixStructure<std::vector<PE>, std::vector<double>>(
+                piBegin, lambdaBegin, n, this->structuralFixThreadsCount);
+    }
+
+    /**
+     * Appends several data samples, adding them to the dendrogram one after the other.
+     *
+     * @param samples Pointer to the first attribute of the first data sample. The data samples
+     * <b>MUST BE</b> stored one after the other, each made of exactly <code>dimension</code>
+     * attributes, and they need to be neither aligned nor padded, since they are copied.
+     * @param samplesCount Number of data samples to append.
+     * @throws std::invalid_argument If the elements of <code>pi</code> cannot store the index of
+     * the last data sample.
+     */
+    void appendBatch(const S *const samples, const std::size_t samplesCount) {
+
+        // Allocate the space for all the data samples at once
+        if (this->pi.size() + samplesCount > this->capacity) {
+            this->reserve(std::max(this->pi.size() + samplesCount, 2 * this->capacity));
+        }
+
+        for (std::size_t i = 0; i < samplesCount; i++) {
+            this->append(&(samples[i * this->dimension]));
+        }
+    }
+
+    /**
+     * Returns the number of data samples appended so far.
+     *
+     * @return The number of data samples appended so far.
+     */
+    inline std::size_t getDataSamplesCount() const noexcept {
+
+        return this->pi.size();
+    }
+
+    /**
+     * Returns the number of attributes of each data sample.
+     *
+     * @return The number of attributes of each data sample.
+     */
+    inline std::size_t getDimension() const noexcept {
+
+        return this->dimension;
+    }
+
+    /**
+     * Returns the <code>pi</code> values of the dendrogram of the data samples appended so far.
+     *
+     * @return The <code>pi</code> values, one for each data sample appended so far.
+     */
+    inline const std::vector<PE> &getPi() const noexcept {
+
+        return this->pi;
+    }
+
+    /**
+     * Returns the <code>lambda</code> values of the dendrogram of the data samples appended so
+     * far.<br>
+     * If the distance computer avoids the computation of the square roots, then this method
+     * applies the transformation of the metric on a copy of the values, so that the following
+     * appends are not affected.
+     *
+     * @return The <code>lambda</code> values, one for each data sample appended so far.
+     */
+    std::vector<double> getLambda() const {
+
+        std::vector<double> result{this->lambda};
+        if constexpr (Kernels::template isTransformDeferred<C, MT>()) {
+            for (double &value : result) {
+                value = MT::transform(value);
+            }
+        }
+        return result;
+    }
+
+private:
+    /**
+     * Number of attributes of each data sample.
+     */
+    const std::size_t dimension;
+
+    /**
+     * Number of attributes between the first attribute of a data sample and the first attribute of
+     * the following sample in the buffer.
+     */
+    const std::size_t stride;
+
+    /**
+     * Number of threads to use to compute the distances in parallel.
+     */
+    const std::size_t distanceComputationThreadsCount;
+
+    /**
+     * Number of threads to use to compute the structural fix in parallel.
+     */
+    const std::size_t structuralFixThreadsCount;
+
+    /**
+     * Buffer holding the data samples appended so far, padded and aligned as the distance computer
+     * requires.
+     */
+    S *data;
+
+    /**
+     * Number of data samples the buffer can hold.
+     */
+    std::size_t capacity;
+
+    /**
+     * <code>pi</code> values of the data samples appended so far.
+     */
+    std::vector<PE> pi;
+
+    /**
+     * <code>lambda</code> values of the data samples appended so far, or the values accumulated by
+     * the metric if the distance computer avoids the computation of the square roots.
+     */
+    std::vector<double> lambda;
+
+    /**
+     * Part row values.
+     */
+    std::vector<S> m;
+
+    /**
+     * Inverses of the norms of the data samples appended so far, if the metric requires them.
+     */
+    std::vector<S> inverseNorms;
+
+    /**
+     * Grows the buffer holding the data samples, and the other data structures, so that they can
+     * hold the specified number of data samples.
+     *
+     * @param newCapacity Number of data samples the data structures must be able to hold.
+     * @throws std::bad_alloc If the buffer cannot be allocated.
+     */
+    void reserve(const std::size_t newCapacity) {
+
+        // Allocate the new buffer and move the data samples into it
+        auto *const newData =
+                static_cast<S *>(_mm_malloc(newCapacity * this->stride * sizeof(S), ALIGNMENT));
+        if (newData == nullptr) {
+            throw std::bad_alloc();
+        }
+        if (this->data != nullptr) {
+            std::memcpy(newData, this->data, this->pi.size() * this->stride * sizeof(S));
+            _mm_free(this->data);
+        }
+        this->data = newData;
+        this->capacity = newCapacity;
+
+        this->pi.reserve(newCapacity);
+        this->lambda.reserve(newCapacity);
+        this->m.resize(newCapacity);
+        if constexpr (MT::REQUIRES_NORMS) {
+            this->inverseNorms.resize(newCapacity);
+        }
+    }
+};
+}  // namespace cluster::parallel
+
+#endif  // FINAL_PROJECT_HPC_INCREMENTALCLUSTERING_H
@@ -0,0 +1,284 @@
+#ifndef FINAL_PROJECT_HPC_KDTREE_H
+#define FINAL_PROJECT_HPC_KDTREE_H
+
+#include <cstddef>
+#include <vector>
+
+namespace cluster::parallel {
+
+/**
+ * Class representing a kd-tree built over a set of data samples.<br>
+ * Every node of the tree holds a contiguous range of data samples, together with the bounding box
+ * enclosing them. Internal nodes split their range in two halves along the dimension where the
+ * bounding box is the widest, while leaves hold at most <code>KdTree::LEAF_SIZE</code> data
+ * samples. The data samples are copied into the tree only once, already reordered, so that the
+ * samples held by every node are contiguous in memory.<br>
+ * The nodes are stored in pre-order, hence every child has a greater index than its parent.
+ *
+ * @author DeB
+ * @author Jonathan
+ * @version 1.1 2022-10-16
+ * @since 1.0
+ */
+class KdTree {
+
+public:
+    /**
+     * Maximum number of data samples held by a leaf.
+     */
+    static const constexpr std::size_t LEAF_SIZE = 32;
+
+    /**
+     * Builds a new kd-tree over the specified data samples.<br>
+     * The data samples are only read, and they can be released as soon as the tree is built.
+     *
+     * @param points Pointer to the first attribute of the first data sample. The data samples
+     * <b>MUST BE</b> stored one after the other, <code>stride</code> values apart.
+     * @param dataSamplesCount Number of data samples.
+     * @param dimension Number of attributes of each data sample.
+     * @param stride Number of values between the first attribute of a data sample and the first
+     * attribute of the following one. It <b>MUST BE</b> at least <code>dimension</code>.
+     */
+    KdTree(const double *points,
+           std::size_t dataSamplesCount,
+           std::size_t dimension,
+           std::size_t stride);
+
+    KdTree(const KdTree &) = delete;
+    KdTree(KdTree &&) = delete;
+    KdTree &operator=(const KdTree &) = delete;
+    KdTree &operator=(KdTree &&) = delete;
+
+    /**
+     * Destroys the tree.
+     */
+    ~KdTree();
+
+    /**
+     * Returns the number of nodes of the tree.
+     *
+     * @return The number of nodes.
+     */
+    inline std::size_t getNodesCount() const noexcept {
+
+        return this->begins.size();
+    }
+
+    /**
+     * Checks if the specified node is a leaf.
+     *
+     * @param node Index of the node.
+     * @return <code>true</code> if the node is a leaf, <code>false</code> otherwise.
+     */
+    inline bool isLeaf(const std::size_t node) const noexcept {
+
+        // The root is never a child, so 0 marks the absence of children
+        return this->leftChildren[node] == 0;
+    }
+
+    /**
+     * Returns the first child of the specified internal node.
+     *
+     * @param node Index of the node.
+     * @return The index of the first child.
+     */
+    inline std::size_t getLeftChild(const std::size_t node) const noexcept {
+
+        return this->leftChildren[node];
+    }
+
+    /**
+     * Returns the second child of the specified internal node.
+     *
+     * @param node Index of the node.
+     * @return The index of the second child.
+     */
+    inline std::size_t getRightChild(const std::size_t node) const noexcept {
+
+        return this->rightChildren[node];
+    }
+
+    /**
+     * Returns the position of the first data sample held by the specified node.
+     *
+     * @param node Index of the node.
+     * @return The position of the first data sample.
+     */
+    inline std::size_t getBegin(const std::size_t node) const noexcept {
+
+        return this->begins[node];
+    }
+
+    /**
+     * Returns the position following the one of the last data sample held by the specified node.
+     *
+     * @param node Index of the node.
+     * @return The position following the one of the last data sample.
+     */
+    inline std::size_t getEnd(const std::size_t node) const noexcept {
+
+        return this->ends[node];
+    }
+
+    /**
+     * Returns the attributes of the data sample at the specified position of the tree.
+     *
+     * @param position Position of the data sample in the tree.
+     * @return Pointer to the first attribute of the data sample.
+     */
+    inline const double *getPoint(const std::size_t position) const noexcept {
+
+        return &(this->points[position * this->dimension]);
+    }
+
+    /**
+     * Returns the index the data sample at the specified position of the tree had in the original
+     * data set.
+     *
+     * @param position Position of the data sample in the tree.
+     * @return The original index of the data sample.
+     */
+    inline std::size_t getIndex(const std::size_t position) const noexcept {
+
+        return this->indices[position];
+    }
+
+    /**
+     * Returns the indices of the leaves of the tree.
+     *
+     * @return The indices of the leaves.
+     */
+    inline const std::vector<std::size_t> &getLeaves() const noexcept {
+
+        return this->leaves;
+    }
+
+    /**
+     * Computes the square of the minimum distance between the bounding boxes of two nodes.<br>
+     * The result is never greater than the square of the distance between any two data samples
+     * held by the nodes, computed by <code>KdTree::computeSquaredDistance</code>, even when
+     * rounding errors occur, since it performs the same operations on values that are never
+     * farther apart.
+     *
+     * @param firstNode Index of the first node.
+     * @param secondNode Index of the second node.
+     * @return The square of the minimum distance between the two bounding boxes.
+     */
+    double computeSquaredBoxDistance(std::size_t firstNode,
+                                     std::size_t secondNode) const noexcept;
+
+    /**
+     * Computes the square of the Euclidean distance between the data samples at the specified
+     * positions of the tree. The attributes are accumulated in order, like the sequential
+     * implementation of the clustering algorithm does.
+     *
+     * @param firstPosition Position of the first data sample in the tree.
+     * @param secondPosition Position of the second data sample in the tree.
+     * @return The square of the distance between the two data samples.
+     */
+    inline double computeSquaredDistance(
+            const std::size_t firstPosition, const std::size_t secondPosition) const noexcept {
+
+        const double *const firstPoint = this->getPoint(firstPosition);
+        const double *const secondPoint = this->getPoint(secondPosition);
+
+        double sum = 0;
+        for (std::size_t k = 0; k < this->dimension; k++) {
+            const double difference = firstPoint[k] - secondPoint[k];
+            sum += difference * difference;
+        }
+        return sum;
+    }
+
+private:
+    /**
+     * Number of attributes of each data sample.
+     */
+    std::size_t dimension;
+
+    /**
+     * Attributes of the data samples, reordered so that the samples held by every node are
+     * contiguous.
+     */
+    std::vector<double> points;
+
+    /**
+     * Original index of every data sample held by the tree.
+     */
+    std::vector<std::size_t> indices;
+
+    /**
+     * Position of the first data sample held by every node.
+     */
+    std::vector<std::size_t> begins;
+
+    /**
+     * Position following the one of the last data sample held by every node.
+     */
+    std::vector<std::size_t> ends;
+
+    /**
+     * First child of every node, or <code>0</code> if the node is a leaf.
+     */
+    std::vector<std::size_t> leftChildren;
+
+    /**
+     * Second child of every node, or <code>0</code> if the node is a leaf.
+     */
+    std::vector<std::size_t> rightChildren;
+
+    /**
+     * Lower corner of the bounding box of every node.
+     */
+    std::vector<double> lowerBounds;
+
+    /**
+     * Upper corner of the bounding box of every node.
+     */
+    std::vector<double> upperBounds;
+
+    /**
+     * Indices of the leaves of the tree.
+     */
+    std::vector<std::size_t> leaves;
+
+    /**
+     * Creates the node holding the specified range of data samples, together with all its
+     * descendants.
+     *
+     * @param originalPoints Pointer to the first attribute of the first data sample, in the
+     * original order.
+     * @param stride Number of values between the first attribute of a data sample and the first
+     * attribute of the following one.
+     * @param begin Position of the first data sample held by the node.
+     * @param end Position following the one of the last data sample held by the node.
+     */
+    void buildNode(const double *originalPoints,
+                   std::size_t stride,
+                   std::size_t begin,
+                   std::size_t end);
+
+    /**
+     * Reorders the specified range of data samples so that the sample at the middle position is
+     * the one that would be there if the range were sorted along the specified dimension, every
+     * sample before it is not greater, and every sample after it is not smaller.
+     *
+     * @param originalPoints Pointer to the first attribute of the first data sample, in the
+     * original order.
+     * @param stride Number of values between the first attribute of a data sample and the first
+     * attribute of the following one.
+     * @param splitDimension Dimension along which the data samples are compared.
+     * @param begin Position of the first data sample of the range.
+     * @param middle Position of the data sample to select.
+     * @param end Position following the one of the last data sample of the range.
+     */
+    void selectMedian(const double *originalPoints,
+                      std::size_t stride,
+                      std::size_t splitDimension,
+                      std::size_t begin,
+                      std::size_t middle,
+                      std::size_t end);
+};
+}  // namespace cluster::parallel
+
+#endif  // FINAL_PROJECT_HPC_KDTREE_H
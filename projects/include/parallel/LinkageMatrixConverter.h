@@ -0,0 +1,340 @@
+#ifndef FINAL_PROJECT_HPC_LINKAGEMATRIXCONVERTER_H
+#define FINAL_PROJECT_HPC_LINKAGEMATRIXCONVERTER_H
+
+#include "../utils/Types.h"
+#include "PiLambdaIteratorUtils.h"
+#include <algorithm>
+#include <cstddef>
+#include <omp.h>
+#include <utility>
+#include <vector>
+
+namespace cluster::parallel {
+
+/**
+ * Row of the linkage matrix of the single-linkage dendrogram, describing the merge of two
+ * clusters.<br>
+ * The clusters are numbered like SciPy does: the cluster made only of the <code>i</code>-th data
+ * sample is the cluster <code>i</code>, while the cluster created by the <code>k</code>-th merge is
+ * the cluster <code>dataSamplesCount + k</code>.
+ *
+ * @author DeB
+ * @author Jonathan
+ * @version 1.0 2022-10-11
+ * @since 1.0
+ */
+struct LinkageMatrixRow {
+
+    /**
+     * Smaller number of the two merged clusters.
+     */
+    std::size_t firstCluster;
+
+    /**
+     * Greater number of the two merged clusters.
+     */
+    std::size_t secondCluster;
+
+    /**
+     * Distance at which the two clusters are merged.
+     */
+    double height;
+
+    /**
+     * Number of data samples in the cluster created by the merge.
+     */
+    std::size_t size;
+};
+
+/**
+ * Class converting the pointer representation of the single-linkage dendrogram, i.e., the
+ * <code>pi</code> and <code>lambda</code> values computed by the implementations of the clustering
+ * algorithm, into the SciPy-style linkage matrix.<br>
+ * In the pointer representation, the <code>i</code>-th data sample joins the cluster of the
+ * <code>pi[i]</code>-th one at distance <code>lambda[i]</code>. Therefore, the merges are sorted by
+ * increasing <code>lambda</code>, breaking the ties by index like the stable sort of SciPy does,
+ * and then they are replayed in order using a union-find structure over the data samples, whose
+ * roots keep the number of the cluster they represent, so that each merge finds the two clusters
+ * it joins. The sort is parallelized by sorting a chunk of the merges per thread and then merging
+ * the sorted chunks pairwise, while the replay is sequential but takes almost linear time.
+ *
+ * @tparam PS <code>true</code> if the conversion should parallelize the sort of the merges using
+ * threads, <code>false</code> otherwise.
+ *
+ * @author DeB
+ * @author Jonathan
+ * @version 1.2 2022-10-15
+ * @since 1.0
+ */
+template <bool PS = true>
+class LinkageMatrixConverter {
+
+    // Imports
+    using PiLambdaIteratorUtils = utils::PiLambdaIteratorUtils;
+
+private:
+    /**
+     * Merge of the pointer representation, i.e., a data sample joining the cluster of another one.
+     */
+    struct Merge {
+
+        /**
+         * Distance at which the data sample joins the other cluster.
+         */
+        double height;
+
+        /**
+         * Index of the data sample.
+         */
+        std::size_t sample;
+
+        /**
+         * Index of the data sample whose cluster is joined, i.e., <code>pi[sample]</code>.
+         */
+        std::size_t joinedSample;
+
+        /**
+         * Checks whether this merge happens before the specified one.
+         *
+         * @param other The other merge.
+         * @return <code>true</code> if this merge happens at a smaller distance, or at the same
+         * distance but for a data sample with a smaller index, <code>false</code> otherwise.
+         */
+        bool operator<(const Merge &other) const noexcept {
+
+            return this->height < other.height ||
+                   (!(other.height < this->height) && this->sample < other.sample);
+        }
+    };
+
+public:
+    /**
+     * Converts the specified pointer representation into the linkage matrix.
+     *
+     * @tparam P Type of the data structure/iterator holding <code>pi</code>.
+     * @tparam L Type of the data structure/iterator holding <code>lambda</code>.
+     * @param pi Data structure/iterator holding the <code>pi</code> values, as computed by the
+     * clustering algorithm.
+     * @param lambda Data structure/iterator holding the <code>lambda</code> values, as computed by
+     * the clustering algorithm.
+     * @param dataSamplesCount Number of data samples that have been clustered.
+     * @param sortThreadsCount Number of threads to use to parallelize the sort of the merges. If
+     * not specified, or if <code>0</code> is specified, then this method uses the default number
+     * of threads computed by OpenMP.<br>
+     * This parameter takes effect only if <code>PS</code> is <code>true</code>.
+     * @return The linkage matrix, made of <code>dataSamplesCount - 1</code> rows sorted by height.
+     */
+    template <utils::PiIterator P, utils::LambdaIterator L>
+    static std::vector<LinkageMatrixRow> toLinkageMatrix(P &pi,
+                                                         L &lambda,
+                                                         const std::size_t dataSamplesCount,
+                                                         const std::size_t sortThreadsCount = 0) {
+
+        std::vector<LinkageMatrixRow> linkageMatrix{};
+        if (dataSamplesCount < 2) {
+            return linkageMatrix;
+        }
+        const std::size_t mergesCount = dataSamplesCount - 1;
+
+        // Efficient iterator pointing to the first element of pi
+        const auto piBegin = PiLambdaIteratorUtils::createEfficientIterator<utils::PiElement<P>, P>(
+                pi, "First element of pi");
+        // Efficient iterator pointing to the first element of lambda
+        const auto lambdaBegin = PiLambdaIteratorUtils::createEfficientIterator<double, L>(
+                lambda, "First element of lambda");
+
+        // **** 1) Sort the merges by height ****
+        // The last data sample does not join any cluster, since it is the root of the dendrogram
+        std::vector<Merge> merges{};
+        merges.resize(mergesCount);
+        for (std::size_t i = 0; i < mergesCount; i++) {
+            merges[i] = {PiLambdaIteratorUtils::getElementAt<double, L>(lambdaBegin, i),
+                         i,
+                         PiLambdaIteratorUtils::getElementAt<utils::PiElement<P>, P>(piBegin, i)};
+        }
+        sortMerges(merges, sortThreadsCount);
+
+        // **** 2) Replay the merges ****
+        // Parent of each data sample in the union-find structure
+        std::vector<std::size_t> parents{};
+        parents.resize(dataSamplesCount);
+        // Number of the cluster each root represents, and the number of data samples in it
+        std::vector<std::size_t> clusters{};
+        clusters.resize(dataSamplesCount);
+        std::vector<std::size_t> sizes{};
+        sizes.resize(dataSamplesCount, 1);
+        for (std::size_t i = 0; i < dataSamplesCount; i++) {
+            parents[i] = i;
+            clusters[i] = i;
+        }
+
+        linkageMatrix.resize(mergesCount);
+        for (std::size_t k = 0; k < mergesCount; k++) {
+            const auto &[height, sample, joinedSample] = merges[k];
+            std::size_t firstRoot = findRoot(parents, sample);
+            std::size_t secondRoot = findRoot(parents, joinedSample);
+            const std::size_t firstCluster = clusters[firstRoot];
+            const std::size_t secondCluster = clusters[secondRoot];
+
+            // Attach the smaller cluster to the bigger one, which becomes the new cluster
+            if (sizes[firstRoot] < sizes[secondRoot]) {
+                std::swap(firstRoot, secondRoot);
+            }
+            parents[secondRoot] = firstRoot;
+            sizes[firstRoot] += sizes[secondRoot];
+            clusters[firstRoot] = dataSamplesCount + k;
+            linkageMatrix[k] = {std::min(firstCluster, secondCluster),
+                                std::max(firstCluster, secondCluster),
+                                height,
+                                sizes[firstRoot]};
+        }
+
+        return linkageMatrix;
+    }
+
+private:
+    /**
+     * Number of merges sorted by insertion before they are merged with the following ones.
+     */
+    static constexpr std::size_t RUN_LENGTH = 32;
+
+    /**
+     * Sorts the specified merges. Every thread sorts a chunk of the merges with a bottom-up merge
+     * sort, whose runs of <code>RUN_LENGTH</code> merges are first sorted by insertion, then the
+     * sorted chunks are merged pairwise, halving their number at every round.<br>
+     * Every thread executes the same number of rounds on its chunk, sized on the longest one, so
+     * that all the sorted chunks end up in the same vector.
+     *
+     * @param merges Merges to sort.
+     * @param sortThreadsCount Number of threads to use to sort the merges. If <code>0</code> is
+     * specified, then this method uses the default number of threads computed by OpenMP.
+     */
+    static void sortMerges(std::vector<Merge> &merges, const std::size_t sortThreadsCount) {
+
+        // Buffer where the runs and the chunks are merged to, swapped with the merges after every
+        // round. It is copied from the merges, since its values are overwritten anyway
+        std::vector<Merge> buffer{merges};
+        // Vector holding the sorted chunks at the end of the last round
+        std::vector<Merge> *sorted = &merges;
+
+#pragma omp parallel default(none) shared(merges, buffer, sorted) num_threads(sortThreadsCount) \
+        if (PS)
+        {
+            // Compute the chunk of the merges sorted by the current thread
+            const auto chunksCount = static_cast<std::size_t>(omp_get_num_threads());
+            const auto chunk = static_cast<std::size_t>(omp_get_thread_num());
+            const std::size_t count = merges.size();
+            auto chunkBegin = [count, chunksCount](const std::size_t index) -> std::size_t {
+                return count * std::min(index, chunksCount) / chunksCount;
+            };
+            const std::size_t begin = chunkBegin(chunk);
+            const std::size_t end = chunkBegin(chunk + 1);
+
+            // **** 1) Sort the runs of the chunk by insertion ****
+            for (std::size_t runBegin = begin; runBegin < end; runBegin += RUN_LENGTH) {
+                insertionSort(merges, runBegin, std::min(runBegin + RUN_LENGTH, end));
+            }
+
+            // **** 2) Merge the sorted runs of the chunk pairwise ****
+            std::vector<Merge> *source = &merges;
+            std::vector<Merge> *destination = &buffer;
+            const std::size_t longestChunkSize = (count + chunksCount - 1) / chunksCount;
+            for (std::size_t width = RUN_LENGTH; width < longestChunkSize; width *= 2) {
+                for (std::size_t runBegin = begin; runBegin < end; runBegin += 2 * width) {
+                    mergeRuns(*source,
+                              *destination,
+                              runBegin,
+                              std::min(runBegin + width, end),
+                              std::min(runBegin + 2 * width, end));
+                }
+                std::swap(source, destination);
+            }
+
+            // **** 3) Merge the sorted chunks pairwise ****
+            // The thread owning the first chunk of a pair merges it with the second one, or copies
+            // it if the pair is incomplete
+            for (std::size_t width = 1; width < chunksCount; width *= 2) {
+#pragma omp barrier
+                if (chunk % (2 * width) == 0) {
+                    mergeRuns(*source,
+                              *destination,
+                              begin,
+                              chunkBegin(chunk + width),
+                              chunkBegin(chunk + 2 * width));
+                }
+                std::swap(source, destination);
+            }
+#pragma omp single
+            sorted = source;
+        }
+
+        // Move the merges back, if the last round has left them in the buffer
+        if (sorted != &merges) {
+            merges.swap(buffer);
+        }
+    }
+
+    /**
+     * Sorts the specified range of merges by insertion.
+     *
+     * @param merges Merges containing the range to sort.
+     * @param begin Position of the first merge of the range.
+     * @param end Position following the last merge of the range.
+     */
+    static inline void insertionSort(std::vector<Merge> &merges,
+                                     const std::size_t begin,
+                                     const std::size_t end) noexcept {
+
+        for (std::size_t i = begin + 1; i < end; i++) {
+            const Merge merge = merges[i];
+            // Shift the greater merges one position forward, until the place of the merge is found
+            std::size_t position = i;
+            while (position > begin && merge < merges[position - 1]) {
+                merges[position] = merges[position - 1];
+                position--;
+            }
+            merges[position] = merge;
+        }
+    }
+
+    /**
+     * Merges two adjacent sorted ranges of merges into the same positions of another vector.
+     *
+     * @param source Merges containing the two sorted ranges.
+     * @param destination Vector where the merged range will be placed.
+     * @param begin Position of the first merge of the first range.
+     * @param middle Position of the first merge of the second range, which may be empty.
+     * @param end Position following the last merge of the second range.
+     */
+    static inline void mergeRuns(const std::vector<Merge> &source,
+                                 std::vector<Merge> &destination,
+                                 const std::size_t begin,
+                                 const std::size_t middle,
+                                 const std::size_t end) {
+
+        std::merge(source.cbegin() + static_cast<std::ptrdiff_t>(begin),
+                   source.cbegin() + static_cast<std::ptrdiff_t>(middle),
+                   source.cbegin() + static_cast<std::ptrdiff_t>(middle),
+                   source.cbegin() + static_cast<std::ptrdiff_t>(end),
+                   destination.begin() + static_cast<std::ptrdiff_t>(begin));
+    }
+
+    /**
+     * Finds the root of the cluster the specified data sample belongs to, halving the path to it.
+     *
+     * @param parents Parent of each data sample in the union-find structure.
+     * @param index Index of the data sample.
+     * @return The index of the root of the cluster.
+     */
+    static inline std::size_t findRoot(std::vector<std::size_t> &parents, std::size_t index) {
+
+        while (parents[index] != index) {
+            parents[index] = parents[parents[index]];
+            index = parents[index];
+        }
+        return index;
+    }
+};
+}  // namespace cluster::parallel
+
+#endif  // FINAL_PROJECT_HPC_LINKAGEMATRIXCONVERTER_H
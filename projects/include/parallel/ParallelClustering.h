@@ -2,16 +2,22 @@
 #define FINAL_PROJECT_HPC_PARALLELCLUSTERING_H
 
 #include "../utils/DataIteratorUtils.h"
+#include "../utils/DistanceMetrics.h"
 #include "../utils/Types.h"
+#include "ClusteringCheckpoint.h"
 #include "DistanceComputers.h"
+#include "DistanceKernelDispatcher.h"
+#include "ExecutionModes.h"
 #include "Logger.h"
 #include "PiLambdaIteratorUtils.h"
 #include "Timer.h"
+#include <array>
 #include <cmath>
 #include <immintrin.h>
 #include <limits>
 #include <memory>
 #include <omp.h>
+#include <stdexcept>
 #include <vector>
 
 namespace cluster::parallel {
@@ -33,25 +39,49 @@ namespace cluster::parallel {
  * only if the distance computation algorithm is one of:
  * <ul>
  *      <li><code>DistanceComputers::SSE_OPTIMIZED_NO_SQUARE_ROOT</code>;</li>
- *      <li><code>DistanceComputers::AVX_OPTIMIZED_NO_SQUARE_ROOT</code>.</li>
+ *      <li><code>DistanceComputers::AVX_OPTIMIZED_NO_SQUARE_ROOT</code>;</li>
+ *      <li><code>DistanceComputers::AVX_FMA_NO_SQUARE_ROOT</code>;</li>
+ *      <li><code>DistanceComputers::AVX_INTERLEAVED_NO_SQUARE_ROOT</code>;</li>
+ *      <li><code>DistanceComputers::AVX512_NO_SQUARE_ROOT</code>;</li>
+ *      <li><code>DistanceComputers::AUTO</code>;</li>
+ *      <li><code>DistanceComputers::NORM_EXPANSION</code>.</li>
  * </ul>
  * In all the other cases, it has no effect.
  * @tparam A <code>true</code> if the clustering method should check for the memory alignment of the
  * data samples, <code>false</code> otherwise. This template argument take effect only if the
- * distance computation algorithm is not <code>DistanceComputers::CLASSICAL</code>.
+ * distance computation algorithm requires the data samples to be aligned, i.e., if it is neither
+ * <code>DistanceComputers::CLASSICAL</code>, nor one of the AVX-512 algorithms, nor
+ * <code>DistanceComputers::AUTO</code>.
+ * @tparam M Enumeration constant specifying how the threads executing the stages of each iteration
+ * are organized. By default, a new parallel region is opened every time a stage is parallelized.
+ * <br>
+ * The data samples can have either <code>double</code> or <code>float</code> attributes. In the
+ * latter case, the distances are computed in single precision, and each SSE, AVX or AVX-512 pack
+ * holds twice as many attributes.<br>
+ * The distances are Euclidean by default, but any of the metrics of <code>utils</code> can be
+ * used instead, e.g., <code>utils::ManhattanMetric</code> or <code>utils::CosineMetric</code>.
+ * The metric is computed with the same instruction set of the distance computer, and, if the
+ * latter avoids the computation of the square roots, then the metric defers its transformation
+ * to the end of the algorithm in the same way.
  *
  * @author DeB
  * @author Jonathan
- * @version 1.6 2022-08-16
+ * @version 1.27 2022-10-16
  * @since 1.0
  */
-template <bool PD = true, bool PF = false, bool PS = false, bool A = false>
+template <bool PD = true,
+          bool PF = false,
+          bool PS = false,
+          bool A = false,
+          ExecutionModes M = ExecutionModes::STAGED>
 class ParallelClustering {
 
     // Imports
     using Logger = utils::Logger;
     using Timer = utils::Timer;
     using PiLambdaIteratorUtils = utils::PiLambdaIteratorUtils;
+    template <typename S>
+    using DataIteratorUtils = utils::DataIteratorUtils<S>;
 
 private:
     /**
@@ -63,6 +93,32 @@ private:
     template <typename... Ts>
     static constexpr std::false_type always_false{};
 
+    /**
+     * Number of distances each thread computes every time it requests new work, if the execution
+     * mode is <code>ExecutionModes::PIPELINED</code>.
+     */
+    static const constexpr std::size_t PIPELINE_CHUNK_SIZE = 256;
+
+    /**
+     * Number of consecutive data samples whose distances are computed in the same sweep over the
+     * previous data samples, if the execution mode is <code>ExecutionModes::BLOCKED</code>.
+     */
+    static const constexpr std::size_t BLOCK_SIZE = 8;
+
+    /**
+     * Fraction of the sum of the squared norms of two data samples below which the square of
+     * their distance computed by <code>DistanceComputers::NORM_EXPANSION</code> is affected by
+     * cancellation, and it is computed again in the classical way.
+     */
+    static const constexpr double NORM_EXPANSION_REFINEMENT_THRESHOLD = 1.0 / 1024;
+
+    /**
+     * Number of independent partial sums kept in the registers by the
+     * <code>DistanceComputers::AVX_FMA</code> and
+     * <code>DistanceComputers::AVX_FMA_NO_SQUARE_ROOT</code> distance computers.
+     */
+    static const constexpr std::size_t FMA_ACCUMULATORS_COUNT = 4;
+
 public:
     /**
      * Size of the SSE pack.
@@ -74,11 +130,49 @@ public:
      */
     static const constexpr std::size_t AVX_PACK_SIZE = 4;
 
+    /**
+     * Size of the AVX-512 pack.
+     */
+    static const constexpr std::size_t AVX512_PACK_SIZE = 8;
+
+    /**
+     * Size of the SSE pack, if the attributes of the data samples are <code>float</code>s.
+     */
+    static const constexpr std::size_t SSE_FLOAT_PACK_SIZE = 4;
+
+    /**
+     * Size of the AVX pack, if the attributes of the data samples are <code>float</code>s.
+     */
+    static const constexpr std::size_t AVX_FLOAT_PACK_SIZE = 8;
+
+    /**
+     * Size of the AVX-512 pack, if the attributes of the data samples are <code>float</code>s.
+     */
+    static const constexpr std::size_t AVX512_FLOAT_PACK_SIZE = 16;
+
     /**
      * Parallel implementation of the clustering algorithm.
      *
      * @tparam C Enumeration constant specifying the algorithm to use to compute the distance
-     * between two data samples.
+     * between two data samples. If <code>S</code> is <code>float</code>, then it must be one of
+     * <code>DistanceComputers::CLASSICAL</code>, <code>DistanceComputers::SSE_OPTIMIZED</code>,
+     * <code>DistanceComputers::SSE_OPTIMIZED_NO_SQUARE_ROOT</code>,
+     * <code>DistanceComputers::AVX_OPTIMIZED</code>,
+     * <code>DistanceComputers::AVX_OPTIMIZED_NO_SQUARE_ROOT</code>,
+     * <code>DistanceComputers::AVX512</code> and
+     * <code>DistanceComputers::AVX512_NO_SQUARE_ROOT</code>.
+     * @tparam S Type of the attributes of the data samples. It must be either <code>double</code>,
+     * which is the default, or <code>float</code>. In the latter case, the padding and the
+     * alignment the distance computers require are the same in bytes, hence the number of
+     * attributes of each data sample must be a multiple of the <code>float</code> pack sizes.
+     * @tparam MT Policy describing the metric used to measure the distance between two data
+     * samples. It defaults to <code>utils::EuclideanMetric</code>. Any other metric is supported
+     * only if <code>C</code> is one of <code>DistanceComputers::CLASSICAL</code>, the SSE
+     * distance computers, <code>DistanceComputers::AVX</code>,
+     * <code>DistanceComputers::AVX_OPTIMIZED</code>,
+     * <code>DistanceComputers::AVX_OPTIMIZED_NO_SQUARE_ROOT</code>,
+     * <code>DistanceComputers::AVX_FMA</code> and
+     * <code>DistanceComputers::AVX_FMA_NO_SQUARE_ROOT</code>.
      * @tparam D Type of the data structure/iterator holding the data samples to cluster.
      * @tparam P Type of the data structure/iterator holding the <code>pi</code> values.
      * @tparam L Type of the data structure/iterator holding the <code>lambda</code> values.
@@ -87,29 +181,54 @@ public:
      * @param dimension Number of attributes of each sample.
      * @param pi Data structure/iterator holding the <code>pi</code> values. This data structure
      * <b>MUST BE</b> big enough to contain all the <code>pi</code> values, which are exactly
-     * <code>dataSamplesCount</code>.
+     * <code>dataSamplesCount</code>.<br>
+     * Its elements can be either <code>std::size_t</code> or <code>std::uint32_t</code>.
      * @param lambda Data structure/iterator holding the <code>lambda</code> values. This data
      * structure <b>MUST BE</b> big enough to contain all the <code>lambda</code> values, which are
      * exactly <code>dataSamplesCount</code>.
      * @param distanceComputationThreadsCount Number of threads to use to parallelize the
      * computation of the distance between the data samples. If not specified, or if <code>0</code>
      * is specified, then this method uses the default number of threads computed by OpenMP.<br>
-     * This parameter takes effect only if <code>PD</code> is <code>true</code>.
+     * This parameter takes effect only if <code>PD</code> is <code>true</code>. If <code>M</code>
+     * is either <code>ExecutionModes::PERSISTENT_TEAM</code> or
+     * <code>ExecutionModes::PIPELINED</code>, then this is the size of the team executing all the
+     * parallelized stages, and it takes effect if either <code>PD</code> or <code>PF</code> is
+     * <code>true</code>.
      * @param structuralFixThreadsCount Number of threads to use to parallelize the computation of
      * structural fix after a new data sample is added to the dendrogram. If not specified, or if
      * <code>0</code> is specified, then this method uses the default number of threads computed by
-     * OpenMP.<br> This parameter takes effect only if <code>PF</code> is <code>true</code>.
+     * OpenMP.<br> This parameter takes effect only if <code>PF</code> is <code>true</code> and
+     * <code>M</code> is either <code>ExecutionModes::STAGED</code> or
+     * <code>ExecutionModes::BLOCKED</code>.
      * @param squareRootThreadsCount Number of threads to use to parallelize the computation of
      * square roots of the distances. If not specified, or if <code>0</code> is specified, then this
      * method uses the default number of threads computed by OpenMP.<br> This parameter takes effect
      * only if <code>PS</code> is <code>true</code>, and if the distance computation algorithm is
-     * either <code>DistanceComputers::SSE_OPTIMIZED_NO_SQUARE_ROOT</code> or
-     * <code>DistanceComputers::AVX_OPTIMIZED_NO_SQUARE_ROOT</code>.
+     * one of <code>DistanceComputers::SSE_OPTIMIZED_NO_SQUARE_ROOT</code>,
+     * <code>DistanceComputers::AVX_OPTIMIZED_NO_SQUARE_ROOT</code>,
+     * <code>DistanceComputers::AVX_FMA_NO_SQUARE_ROOT</code>,
+     * <code>DistanceComputers::AVX_INTERLEAVED_NO_SQUARE_ROOT</code>,
+     * <code>DistanceComputers::AVX512_NO_SQUARE_ROOT</code>, <code>DistanceComputers::AUTO</code>
+     * and <code>DistanceComputers::NORM_EXPANSION</code>.
+     * @param checkpoint Checkpoint where the state of the clustering is periodically saved. If the
+     * checkpoint file already exists, then the clustering is resumed from the state it holds,
+     * instead of starting from the first data sample. If not specified, or if
+     * <code>nullptr</code> is specified, then no checkpoint is saved. If the checkpoint stops the
+     * clustering, then this method returns as soon as it has been saved, leaving in
+     * <code>pi</code> and <code>lambda</code> the partial state it holds.<br>
+     * This parameter is supported only if <code>M</code> is <code>ExecutionModes::STAGED</code>
+     * and <code>C</code> is not <code>DistanceComputers::AVX_INTERLEAVED_NO_SQUARE_ROOT</code>.
      * @throws std::invalid_argument If the data samples alignment check has been requested and one
-     * of the data samples in not correctly aligned.
+     * of the data samples in not correctly aligned, if a checkpoint is specified but it is not
+     * supported, if the checkpoint file has been saved by a different clustering, or if the
+     * elements of <code>pi</code> cannot store the index of the last data sample.
+     * @throws std::runtime_error If an I/O error occurs while reading or writing the checkpoint
+     * file.
      */
     template <DistanceComputers C,
-              utils::ParallelDataIterator D,
+              typename S = double,
+              typename MT = utils::EuclideanMetric,
+              utils::ParallelDataIterator<S> D,
               utils::PiIterator P,
               utils::LambdaIterator L>
     static void cluster(const D &data,
@@ -119,30 +238,35 @@ public:
                         L &lambda,
                         const std::size_t distanceComputationThreadsCount = 0,
                         const std::size_t structuralFixThreadsCount = 0,
-                        const std::size_t squareRootThreadsCount = 0) {
+                        const std::size_t squareRootThreadsCount = 0,
+                        ClusteringCheckpoint *const checkpoint = nullptr) {
+
+        static_assert(std::is_same_v<S, double> || std::is_same_v<S, float>,
+                      "The attributes of the data samples must be either doubles or floats.");
+        static_assert(std::is_same_v<S, double> ||
+                              ParallelClustering::isSinglePrecisionSupported(C),
+                      "The specified distance computer does not support float attributes.");
+        static_assert(C != DistanceComputers::NORM_EXPANSION || M == ExecutionModes::BLOCKED,
+                      "The specified distance computer is supported only by the blocked mode.");
+        static_assert(C != DistanceComputers::AVX_INTERLEAVED_NO_SQUARE_ROOT ||
+                              M == ExecutionModes::STAGED,
+                      "The specified distance computer is supported only by the staged mode.");
+        static_assert(std::is_same_v<MT, utils::EuclideanMetric> ||
+                              ParallelClustering::isMetricSupported(C),
+                      "The specified distance computer supports only the Euclidean metric.");
+
+        // Check that pi can store the indices of all the data samples
+        PiLambdaIteratorUtils::requirePiCapacity<P>(dataSamplesCount);
 
         Timer::start<0>();
 
-        // Computes the stride of the data samples, i.e., the number of doubles between the first
+        // Computes the stride of the data samples, i.e., the number of attributes between the first
         // attribute of a data sample and the first attribute of the following sample if they are
         // contiguous in memory
-        // NOLINTNEXTLINE(cppcoreguidelines-init-variables)
-        std::size_t stride;
-        if constexpr (C == DistanceComputers::AVX || C == DistanceComputers::AVX_OPTIMIZED ||
-                      C == DistanceComputers::AVX_OPTIMIZED_NO_SQUARE_ROOT) {
-            stride = ParallelClustering::computeAvxDimension(dimension);
-        } else if constexpr (C == DistanceComputers::SSE || C == DistanceComputers::SSE_OPTIMIZED ||
-                             C == DistanceComputers::SSE_OPTIMIZED_NO_SQUARE_ROOT) {
-            stride = ParallelClustering::computeSseDimension(dimension);
-        } else {
-            stride = dimension;
-        }
-
-        // Array containing the part-row values
-        auto *const __restrict__ m = new double[dataSamplesCount];
+        const std::size_t stride = ParallelClustering::computeStride<C, S>(dimension);
 
         // Efficient iterator pointing to the first element of pi
-        const auto piBegin = PiLambdaIteratorUtils::createEfficientIterator<std::size_t, P>(
+        const auto piBegin = PiLambdaIteratorUtils::createEfficientIterator<utils::PiElement<P>, P>(
                 pi, "First element of pi");
         // Efficient iterator pointing to the first element of lambda
         const auto lambdaBegin = PiLambdaIteratorUtils::createEfficientIterator<double, L>(
@@ -154,15 +278,308 @@ public:
         auto currentLambda = lambdaBegin;
 
         // Efficient iterator pointing to the n-th element of the dataset.
-        auto currentData = utils::DataIteratorUtils::createEfficientIterator(data, "Current data");
+        auto currentData = DataIteratorUtils<S>::createEfficientIterator(data, "Current data");
         // Efficient iterator pointing to the first element of the dataset
         auto dataBegin =
-                utils::DataIteratorUtils::createEfficientIterator(data, "First element of data");
+                DataIteratorUtils<S>::createEfficientIterator(data, "First element of data");
+
+        // Restore the state saved in the checkpoint, if any
+        std::size_t firstSample = 0;
+        if (checkpoint != nullptr) {
+            if constexpr (M != ExecutionModes::STAGED) {
+                throw std::invalid_argument("Checkpoints are supported only by the staged mode");
+            }
+            if constexpr (C == DistanceComputers::AVX_INTERLEAVED_NO_SQUARE_ROOT) {
+                throw std::invalid_argument(
+                        "Checkpoints are not supported by the interleaved distance computer");
+            }
+            firstSample = checkpoint->restore<P, L>(
+                    dataSamplesCount,
+                    dimension,
+                    static_cast<std::uint32_t>(C),
+                    MT::IDENTIFIER,
+                    ParallelClustering::isTransformDeferred<C, MT>(),
+                    piBegin,
+                    lambdaBegin);
+        }
+
+        // Array containing the part-row values. If the distances are computed for a whole block of
+        // data samples at a time, then it is extended until the end of the last block. It is
+        // allocated after the checkpoint has been restored, and released automatically, so that
+        // it is never leaked if an exception is thrown
+        const std::unique_ptr<S[]> mOwner{
+                new S[(C == DistanceComputers::AVX_INTERLEAVED_NO_SQUARE_ROOT)
+                              ? ParallelClustering::computeAvxDimension<S>(dataSamplesCount)
+                              : dataSamplesCount]};
+        S *const __restrict__ m = mOwner.get();
+        // Array containing the inverses of the norms of the data samples, if the metric requires
+        // them
+        const std::unique_ptr<S[]> inverseNormsOwner{
+                (MT::REQUIRES_NORMS) ? new S[dataSamplesCount] : nullptr};
+        S *const __restrict__ inverseNorms = inverseNormsOwner.get();
 
         Timer::stop<0>();
 
-        // Check the alignment of the first data sample, if requested
-        checkAlignment<C>(0, utils::DataIteratorUtils::getCurrentSample<D>(currentData));
+        if constexpr (MT::REQUIRES_NORMS) {
+            Timer::start<2>();
+            // Compute the inverses of the norms of all the data samples once
+            computeInverseNorms<C, MT, D>(dataBegin,
+                                          dataSamplesCount,
+                                          stride,
+                                          inverseNorms,
+                                          distanceComputationThreadsCount);
+            Timer::stop<2>();
+        }
+
+        if constexpr (M == ExecutionModes::PERSISTENT_TEAM) {
+            // Execute all the iterations using a unique team of threads
+            clusterUsingPersistentTeam<C, MT, D, P, L>(dataBegin,
+                                                       dataSamplesCount,
+                                                       stride,
+                                                       piBegin,
+                                                       lambdaBegin,
+                                                       m,
+                                                       inverseNorms,
+                                                       distanceComputationThreadsCount);
+        } else if constexpr (M == ExecutionModes::PIPELINED) {
+            // Execute all the iterations using a unique team of threads, overlapping them
+            clusterUsingPipeline<C, MT, D, P, L>(dataBegin,
+                                                 dataSamplesCount,
+                                                 stride,
+                                                 piBegin,
+                                                 lambdaBegin,
+                                                 m,
+                                                 inverseNorms,
+                                                 distanceComputationThreadsCount);
+        } else if constexpr (M == ExecutionModes::BLOCKED) {
+            // Execute the iterations in blocks, computing the distances of a block in one sweep
+            clusterUsingBlocks<C, MT, D, P, L>(data,
+                                               dataBegin,
+                                               dataSamplesCount,
+                                               stride,
+                                               piBegin,
+                                               lambdaBegin,
+                                               m,
+                                               inverseNorms,
+                                               distanceComputationThreadsCount,
+                                               structuralFixThreadsCount);
+        } else if constexpr (C == DistanceComputers::AVX_INTERLEAVED_NO_SQUARE_ROOT) {
+            // Execute the iterations computing the distances from whole blocks of data samples
+            clusterUsingInterleavedData<C, D, P, L>(dataBegin,
+                                                    dataSamplesCount,
+                                                    stride,
+                                                    piBegin,
+                                                    lambdaBegin,
+                                                    m,
+                                                    distanceComputationThreadsCount,
+                                                    structuralFixThreadsCount);
+        } else {
+            // Check the alignment of the first data sample, if requested
+            checkAlignment<C>(0,
+                              DataIteratorUtils<S>::template getCurrentSample<D>(currentData));
+
+            // Log the initial progress
+            Logger::startLoggingProgress<0, 1, 2, 3, 4, 5>(dataSamplesCount);
+
+            if (firstSample == 0) {
+                Timer::start<1>();
+                // **** 1) Set pi(1) to 0, lambda(1) to infinity ****
+                initializeNewPoint<P, L>(currentPi, currentLambda, 0);
+                Timer::stop<1>();
+
+                Timer::start<0>();
+                // No more operations need to be performed for the first data sample, so move to
+                // the second
+                DataIteratorUtils<S>::template moveNext<D>(currentData, stride);
+                firstSample = 1;
+            } else {
+                Timer::start<0>();
+                // Skip the data samples whose state has been restored from the checkpoint
+                for (std::size_t n = 0; n < firstSample; n++) {
+                    PiLambdaIteratorUtils::moveNext<utils::PiElement<P>, P>(currentPi);
+                    PiLambdaIteratorUtils::moveNext<double, L>(currentLambda);
+                    DataIteratorUtils<S>::template moveNext<D>(currentData, stride);
+                }
+            }
+
+            // Useful pointer pointing to the element following the last element of m containing a
+            // valid distance
+            const S *distanceEnd = &(m[firstSample]);
+
+            // Perform the clustering algorithm for all the remaining data samples
+            for (std::size_t n = firstSample; n < dataSamplesCount; n++) {
+                Timer::stop<0>();
+                // Check the alignment of the data sample, if requested
+                checkAlignment<C>(
+                        n, DataIteratorUtils<S>::template getCurrentSample<D>(currentData));
+
+                // Log the progress every 1000 samples
+                Logger::updateProgress<1000, 0, 1, 2, 3, 4, 5>(n, dataSamplesCount);
+
+                Timer::start<1>();
+                // **** 1) Set pi(n + 1) to n + 1, lambda(n + 1) to infinity ****
+                initializeNewPoint<P, L>(currentPi, currentLambda, n);
+                Timer::stop<1>();
+
+                Timer::start<2>();
+                // Pointer to the n-th data sample of the dataset
+                const S *__restrict__ const currentDataN =
+                        DataIteratorUtils<S>::template getCurrentSample<D>(currentData);
+                // Pointer to the first byte after the n-th data sample of the dataset
+                const S *__restrict__ const currentDataNEnd = currentDataN + stride;
+
+                // **** 2) Set M(i) to d(i, n + 1) for i = 1,..,n ****
+                computeDistances<C, MT, D>(n,
+                                           dataBegin,
+                                           stride,
+                                           currentDataN,
+                                           currentDataNEnd,
+                                           m,
+                                           inverseNorms,
+                                           distanceComputationThreadsCount);
+                // Let out-of-core datasets release the data samples they cannot keep in memory
+                releaseSweptSamples<D>(data, n);
+                Timer::stop<2>();
+
+                Timer::start<3>();
+                // **** 3) For i from 1 to n ****
+                addNewPoint<P, L>(piBegin, lambdaBegin, m, distanceEnd, n);
+                Timer::stop<3>();
+
+                Timer::start<4>();
+                //***  4) For i from 1 to n ****
+                fixStructure<P, L>(piBegin, lambdaBegin, n, structuralFixThreadsCount);
+                Timer::stop<4>();
+
+                Timer::start<0>();
+                // Move to the next data sample
+                DataIteratorUtils<S>::template moveNext<D>(currentData, stride);
+                ++distanceEnd;
+
+                // Save the state of the clustering, if enough time has elapsed since the last save
+                // or if the clustering must be stopped
+                if (checkpoint != nullptr &&
+                    (checkpoint->isDue() || checkpoint->isStopDue(n + 1))) {
+                    checkpoint->save<P, L>(n + 1,
+                                           dataSamplesCount,
+                                           dimension,
+                                           static_cast<std::uint32_t>(C),
+                                           MT::IDENTIFIER,
+                                           ParallelClustering::isTransformDeferred<C, MT>(),
+                                           piBegin,
+                                           lambdaBegin);
+                    if (checkpoint->isInterrupted()) {
+                        break;
+                    }
+                }
+            }
+            Timer::stop<6>();
+        }
+
+        // Leave pi and lambda as saved in the checkpoint if the clustering has been stopped, so
+        // that it can be resumed
+        if (checkpoint != nullptr && checkpoint->isInterrupted()) {
+            Timer::stop<0>();
+            return;
+        }
+
+        // Compute the square roots, if until now the algorithm has used the squares of the
+        // distances, or in general the transformation the metric has deferred
+        Timer::start<5>();
+        if constexpr (ParallelClustering::isTransformDeferred<C, MT>()) {
+
+            // Compute the square root, or the transformation, of all the values in lambda
+#pragma omp parallel for default(none) shared(lambdaBegin, dataSamplesCount) \
+        num_threads(squareRootThreadsCount) if (PS)
+            for (std::size_t i = 0; i < dataSamplesCount - 1; i++) {
+                double &lambdaToModify =
+                        utils::PiLambdaIteratorUtils::getElementAt<double, L>(lambdaBegin, i);
+                lambdaToModify = MT::transform(lambdaToModify);
+            }
+        }
+        Timer::stop<5>();
+
+        // Log the final progress
+        Logger::updateProgress<1, 0, 1, 2, 3, 4, 5>(dataSamplesCount, dataSamplesCount);
+    }
+
+    /**
+     * Parallel implementation of the clustering algorithm that reads the distances between the
+     * data samples from a condensed distance matrix, instead of computing them from the
+     * attributes of the data samples. In this way, any dissimilarity can be used, even if it
+     * cannot be computed by a distance computer.<br>
+     * The condensed distance matrix is the upper triangle of the matrix of the distances between
+     * all the pairs of data samples, without the diagonal, stored row by row, as the one
+     * computed by <code>scipy.spatial.distance.pdist</code>. The position of each distance is
+     * given by <code>computeCondensedIndex</code>.<br>
+     * At the n-th iteration, the part-row is filled with the n-th column of the matrix, which is
+     * strided: the distance from the i-th data sample is <code>dataSamplesCount - i - 1</code>
+     * positions after the one from the (i - 1)-th data sample. Every distance is read exactly
+     * once, and the distance read from a row at the next iteration follows the current one, so the
+     * cache lines read at an iteration are reused at the following ones only while the
+     * <code>n</code> lines touched by an iteration fit in the cache. The matrix can be stored in
+     * memory, or mapped from a file, e.g., by an <code>utils::OutOfCoreDataset</code> with a
+     * stride of <code>1</code> and a resident set as large as the matrix.<br>
+     * The iterations are executed as in the <code>ExecutionModes::STAGED</code> execution mode.
+     *
+     * @tparam S Type of the distances. It must be either <code>double</code>, which is the
+     * default, or <code>float</code>.
+     * @tparam P Type of the data structure/iterator holding the <code>pi</code> values.
+     * @tparam L Type of the data structure/iterator holding the <code>lambda</code> values.
+     * @param distances Pointer to the first distance of the condensed distance matrix, which
+     * <b>MUST BE</b> made of <code>dataSamplesCount * (dataSamplesCount - 1) / 2</code>
+     * distances.
+     * @param dataSamplesCount Number of data samples.
+     * @param pi Data structure/iterator holding the <code>pi</code> values. This data structure
+     * <b>MUST BE</b> big enough to contain all the <code>pi</code> values, which are exactly
+     * <code>dataSamplesCount</code>.<br>
+     * Its elements can be either <code>std::size_t</code> or <code>std::uint32_t</code>.
+     * @param lambda Data structure/iterator holding the <code>lambda</code> values. This data
+     * structure <b>MUST BE</b> big enough to contain all the <code>lambda</code> values, which are
+     * exactly <code>dataSamplesCount</code>.
+     * @param distanceReadingThreadsCount Number of threads to use to copy the distances into the
+     * part-row in parallel. If not specified, or if <code>0</code> is specified, then this method
+     * uses the default number of threads computed by OpenMP.<br> This parameter takes effect only
+     * if <code>PD</code> is <code>true</code>.
+     * @param structuralFixThreadsCount Number of threads to use to parallelize the computation of
+     * structural fix after a new data sample is added to the dendrogram. If not specified, or if
+     * <code>0</code> is specified, then this method uses the default number of threads computed by
+     * OpenMP.<br> This parameter takes effect only if <code>PF</code> is <code>true</code>.
+     * @throws std::invalid_argument If the elements of <code>pi</code> cannot store the index of
+     * the last data sample.
+     */
+    template <typename S = double, utils::PiIterator P, utils::LambdaIterator L>
+    static void clusterDistanceMatrix(const S *const distances,
+                                      const std::size_t dataSamplesCount,
+                                      P &pi,
+                                      L &lambda,
+                                      const std::size_t distanceReadingThreadsCount = 0,
+                                      const std::size_t structuralFixThreadsCount = 0) {
+
+        static_assert(std::is_same_v<S, double> || std::is_same_v<S, float>,
+                      "The distances must be either doubles or floats.");
+        static_assert(M == ExecutionModes::STAGED,
+                      "The distance matrix is supported only by the staged mode.");
+
+        // Check that pi can store the indices of all the data samples
+        PiLambdaIteratorUtils::requirePiCapacity<P>(dataSamplesCount);
+
+        Timer::start<0>();
+        // Array containing the part-row values
+        auto *const __restrict__ m = new S[dataSamplesCount];
+
+        // Efficient iterator pointing to the first element of pi
+        const auto piBegin = PiLambdaIteratorUtils::createEfficientIterator<utils::PiElement<P>, P>(
+                pi, "First element of pi");
+        // Efficient iterator pointing to the first element of lambda
+        const auto lambdaBegin = PiLambdaIteratorUtils::createEfficientIterator<double, L>(
+                lambda, "First element of lambda");
+
+        // Efficient iterator pointing to the n-th element of pi
+        auto currentPi = piBegin;
+        // Efficient iterator pointing to the n-th element of lambda
+        auto currentLambda = lambdaBegin;
+        Timer::stop<0>();
 
         // Log the initial progress
         Logger::startLoggingProgress<0, 1, 2, 3, 4, 5>(dataSamplesCount);
@@ -172,20 +589,12 @@ public:
         initializeNewPoint<P, L>(currentPi, currentLambda, 0);
         Timer::stop<1>();
 
-        Timer::start<0>();
-        // No more operations need to be performed for the first data sample, so move to the second
-        utils::DataIteratorUtils::moveNext<D>(currentData, stride);
-
-        // Useful pointer pointing to the element following the last element of m containing a valid
-        // distance
-        const double *distanceEnd = &(m[1]);
+        // Useful pointer pointing to the element following the last element of m containing a
+        // valid distance
+        const S *distanceEnd = &(m[1]);
 
         // Perform the clustering algorithm for all the remaining data samples
         for (std::size_t n = 1; n < dataSamplesCount; n++) {
-            Timer::stop<0>();
-            // Check the alignment of the data sample, if requested
-            checkAlignment<C>(n, utils::DataIteratorUtils::getCurrentSample<D>(currentData));
-
             // Log the progress every 1000 samples
             Logger::updateProgress<1000, 0, 1, 2, 3, 4, 5>(n, dataSamplesCount);
 
@@ -195,20 +604,8 @@ public:
             Timer::stop<1>();
 
             Timer::start<2>();
-            // Pointer to the n-th data sample of the dataset
-            const double *__restrict__ const currentDataN =
-                    utils::DataIteratorUtils::getCurrentSample<D>(currentData);
-            // Pointer to the first byte after the n-th data sample of the dataset
-            const double *__restrict__ const currentDataNEnd = currentDataN + stride;
-
             // **** 2) Set M(i) to d(i, n + 1) for i = 1,..,n ****
-            computeDistances<C, D>(n,
-                                   dataBegin,
-                                   stride,
-                                   currentDataN,
-                                   currentDataNEnd,
-                                   m,
-                                   distanceComputationThreadsCount);
+            readDistances(n, distances, dataSamplesCount, m, distanceReadingThreadsCount);
             Timer::stop<2>();
 
             Timer::start<3>();
@@ -221,29 +618,8 @@ public:
             fixStructure<P, L>(piBegin, lambdaBegin, n, structuralFixThreadsCount);
             Timer::stop<4>();
 
-            Timer::start<0>();
-            // Move to the next data sample
-            utils::DataIteratorUtils::moveNext<D>(currentData, stride);
             ++distanceEnd;
         }
-        Timer::stop<6>();
-
-        // Compute the square roots, if until now the algorithm has used the squares of the
-        // distances
-        Timer::start<5>();
-        if constexpr (C == DistanceComputers::SSE_OPTIMIZED_NO_SQUARE_ROOT ||
-                      C == DistanceComputers::AVX_OPTIMIZED_NO_SQUARE_ROOT) {
-
-            // Compute the square root of all the values in lambda
-#pragma omp parallel for default(none) shared(lambdaBegin, dataSamplesCount) \
-        num_threads(squareRootThreadsCount) if (PS)
-            for (std::size_t i = 0; i < dataSamplesCount - 1; i++) {
-                double &lambdaToModify =
-                        utils::PiLambdaIteratorUtils::getElementAt<double, L>(lambdaBegin, i);
-                lambdaToModify = sqrt(lambdaToModify);
-            }
-        }
-        Timer::stop<5>();
 
         Timer::start<0>();
         // Deallocate m, since it is not needed anymore
@@ -254,54 +630,265 @@ public:
         Logger::updateProgress<1, 0, 1, 2, 3, 4, 5>(dataSamplesCount, dataSamplesCount);
     }
 
+    /**
+     * Computes the position of the distance between two data samples in a condensed distance
+     * matrix.
+     *
+     * @param first Index of the first data sample.
+     * @param second Index of the second data sample. It <b>MUST BE</b> greater than
+     * <code>first</code>.
+     * @param dataSamplesCount Number of data samples.
+     * @return The position of the distance between the two data samples.
+     */
+    static inline std::size_t computeCondensedIndex(const std::size_t first,
+                                                    const std::size_t second,
+                                                    const std::size_t dataSamplesCount) {
+
+        return dataSamplesCount * first - first * (first + 1) / 2 + (second - first - 1);
+    }
+
     /**
      * Computes the dimension the data sample must have if the distance computer uses SSE
      * instructions.
      *
+     * @tparam S Type of the attributes of the data sample.
      * @param dimension Dimension of the data sample.
      * @return The computed dimension.
      */
+    template <typename S = double>
     static inline std::size_t computeSseDimension(const std::size_t dimension) {
 
-        return (1 + (((dimension - 1) / SSE_PACK_SIZE))) * SSE_PACK_SIZE;
+        const constexpr std::size_t packSize = ParallelClustering::getSsePackSize<S>();
+        return (1 + (((dimension - 1) / packSize))) * packSize;
     }
 
     /**
      * Computes the dimension the data sample must have if the distance computer uses AVX
      * instructions.
      *
+     * @tparam S Type of the attributes of the data sample.
      * @param dimension Dimension of the data sample.
      * @return The computed dimension.
      */
+    template <typename S = double>
     static inline std::size_t computeAvxDimension(const std::size_t dimension) {
 
-        return (1 + (((dimension - 1) / AVX_PACK_SIZE))) * AVX_PACK_SIZE;
+        const constexpr std::size_t packSize = ParallelClustering::getAvxPackSize<S>();
+        return (1 + (((dimension - 1) / packSize))) * packSize;
+    }
+
+    /**
+     * Computes the number of attributes of the data structure holding the data samples if the
+     * distance computer is <code>DistanceComputers::AVX_INTERLEAVED_NO_SQUARE_ROOT</code>, and if
+     * the blocks of data samples are contiguous in memory.
+     *
+     * @tparam S Type of the attributes of the data samples.
+     * @param dataSamplesCount Number of data samples.
+     * @param dimension Dimension of the data samples.
+     * @return The computed number of attributes, including the padding of the last block.
+     */
+    template <typename S = double>
+    static inline std::size_t computeAvxInterleavedSize(const std::size_t dataSamplesCount,
+                                                        const std::size_t dimension) {
+
+        return ParallelClustering::computeAvxDimension<S>(dataSamplesCount) * dimension;
     }
 
 private:
+    /**
+     * Allows the other parallel implementations of the clustering algorithm to reuse the distance
+     * computers and the alignment checks.
+     */
+    template <bool, bool, bool>
+    friend class PrimClustering;
+    template <DistanceComputers, typename, bool, bool, typename, typename>
+    friend class IncrementalClustering;
+
+    /**
+     * Computes the stride of the data samples, i.e., the number of attributes between the first
+     * attribute of a data sample and the first attribute of the following sample if they are
+     * contiguous in memory.
+     *
+     * @tparam C Distance computer that will compute the distances between the data samples.
+     * @tparam S Type of the attributes of the data samples.
+     * @param dimension Number of attributes of each sample.
+     * @return The stride of the data samples.
+     */
+    template <DistanceComputers C, typename S>
+    static inline std::size_t computeStride(const std::size_t dimension) {
+
+        if constexpr (C == DistanceComputers::AVX || C == DistanceComputers::AVX_OPTIMIZED ||
+                      C == DistanceComputers::AVX_OPTIMIZED_NO_SQUARE_ROOT ||
+                      C == DistanceComputers::AVX_FMA ||
+                      C == DistanceComputers::AVX_FMA_NO_SQUARE_ROOT ||
+                      C == DistanceComputers::NORM_EXPANSION) {
+            return ParallelClustering::computeAvxDimension<S>(dimension);
+        } else if constexpr (C == DistanceComputers::AVX_INTERLEAVED_NO_SQUARE_ROOT) {
+            // The stride is the one between two consecutive blocks
+            return ParallelClustering::getAvxPackSize<S>() * dimension;
+        } else if constexpr (C == DistanceComputers::SSE || C == DistanceComputers::SSE_OPTIMIZED ||
+                             C == DistanceComputers::SSE_OPTIMIZED_NO_SQUARE_ROOT) {
+            return ParallelClustering::computeSseDimension<S>(dimension);
+        } else {
+            return dimension;
+        }
+    }
+
+    /**
+     * Returns the number of attributes of the specified type an SSE register can hold.
+     *
+     * @tparam S Type of the attributes.
+     * @return The size of the SSE pack.
+     */
+    template <typename S>
+    static constexpr std::size_t getSsePackSize() {
+
+        return (std::is_same_v<S, float>) ? SSE_FLOAT_PACK_SIZE : SSE_PACK_SIZE;
+    }
+
+    /**
+     * Returns the number of attributes of the specified type an AVX register can hold.
+     *
+     * @tparam S Type of the attributes.
+     * @return The size of the AVX pack.
+     */
+    template <typename S>
+    static constexpr std::size_t getAvxPackSize() {
+
+        return (std::is_same_v<S, float>) ? AVX_FLOAT_PACK_SIZE : AVX_PACK_SIZE;
+    }
+
+    /**
+     * Checks whether the specified distance computer can compute the distances between data
+     * samples having <code>float</code> attributes.
+     *
+     * @param distanceComputer Distance computer to check.
+     * @return <code>true</code> if the distance computer supports <code>float</code> attributes,
+     * <code>false</code> otherwise.
+     */
+    static constexpr bool isSinglePrecisionSupported(const DistanceComputers distanceComputer) {
+
+        return distanceComputer != DistanceComputers::SSE &&
+               distanceComputer != DistanceComputers::AVX &&
+               distanceComputer != DistanceComputers::AUTO &&
+               distanceComputer != DistanceComputers::NORM_EXPANSION;
+    }
+
+    /**
+     * Checks whether the specified distance computer requires the data samples to be aligned in
+     * memory.
+     *
+     * @param distanceComputer Distance computer to check.
+     * @return <code>true</code> if the distance computer requires the data samples to be aligned,
+     * <code>false</code> otherwise.
+     */
+    static constexpr bool isAlignmentRequired(const DistanceComputers distanceComputer) {
+
+        return distanceComputer != DistanceComputers::CLASSICAL &&
+               distanceComputer != DistanceComputers::AVX512 &&
+               distanceComputer != DistanceComputers::AVX512_NO_SQUARE_ROOT &&
+               distanceComputer != DistanceComputers::AUTO;
+    }
+
+    /**
+     * Checks whether the specified distance computer computes the squares of the distances, so
+     * that the square roots must be computed at the end of the algorithm.
+     *
+     * @param distanceComputer Distance computer to check.
+     * @return <code>true</code> if the distance computer computes the squares of the distances,
+     * <code>false</code> otherwise.
+     */
+    static constexpr bool isSquareRootDeferred(const DistanceComputers distanceComputer) {
+
+        return distanceComputer == DistanceComputers::SSE_OPTIMIZED_NO_SQUARE_ROOT ||
+               distanceComputer == DistanceComputers::AVX_OPTIMIZED_NO_SQUARE_ROOT ||
+               distanceComputer == DistanceComputers::AVX_FMA_NO_SQUARE_ROOT ||
+               distanceComputer == DistanceComputers::AVX_INTERLEAVED_NO_SQUARE_ROOT ||
+               distanceComputer == DistanceComputers::AVX512_NO_SQUARE_ROOT ||
+               distanceComputer == DistanceComputers::AUTO ||
+               distanceComputer == DistanceComputers::NORM_EXPANSION;
+    }
+
+    /**
+     * Checks whether the specified distance computer can compute the distances using metrics other
+     * than the Euclidean one.
+     *
+     * @param distanceComputer Distance computer to check.
+     * @return <code>true</code> if the distance computer supports any metric, <code>false</code>
+     * if it supports only the Euclidean metric.
+     */
+    static constexpr bool isMetricSupported(const DistanceComputers distanceComputer) {
+
+        return distanceComputer == DistanceComputers::CLASSICAL ||
+               distanceComputer == DistanceComputers::SSE ||
+               distanceComputer == DistanceComputers::SSE_OPTIMIZED ||
+               distanceComputer == DistanceComputers::SSE_OPTIMIZED_NO_SQUARE_ROOT ||
+               distanceComputer == DistanceComputers::AVX ||
+               distanceComputer == DistanceComputers::AVX_OPTIMIZED ||
+               distanceComputer == DistanceComputers::AVX_OPTIMIZED_NO_SQUARE_ROOT ||
+               distanceComputer == DistanceComputers::AVX_FMA ||
+               distanceComputer == DistanceComputers::AVX_FMA_NO_SQUARE_ROOT;
+    }
+
+    /**
+     * Checks whether the values computed by the specified distance computer with the specified
+     * metric are not the distances, but a monotonically increasing function of them, so that the
+     * transformation of the metric must be applied at the end of the algorithm. For the
+     * Euclidean metric, this is the case if the distance computer defers the square roots.
+     *
+     * @tparam C Distance computer to check.
+     * @tparam MT Policy describing the metric.
+     * @return <code>true</code> if the transformation of the metric is deferred to the end of the
+     * algorithm, <code>false</code> otherwise.
+     */
+    template <DistanceComputers C, typename MT>
+    static constexpr bool isTransformDeferred() {
+
+        return ParallelClustering::isSquareRootDeferred(C) && MT::IS_TRANSFORMED;
+    }
+
+    /**
+     * Utility method that lets the data structure holding the data samples release the ones that
+     * have been read in the current iteration, if it supports it, as
+     * <code>utils::OutOfCoreDataset</code> does. For all the other data structures, this method
+     * does nothing.
+     *
+     * @tparam D Type of the data structure/iterator holding the data samples.
+     * @param data Data structure/iterator holding the data samples.
+     * @param n Index of the last data sample read in the current iteration.
+     */
+    template <typename D>
+    static inline void releaseSweptSamples(const D &data, const std::size_t n) {
+
+        if constexpr (requires { data.releaseSweptSamples(n); }) {
+            data.releaseSweptSamples(n);
+        }
+    }
+
     /**
      * Utility method that checks if the specified data sample is correctly aligned. If it is not,
      * then an exception is thrown.<br>
      * This method takes effect only if <code>A</code> is <code>true</code> and only if the
-     * specified distance computer is not <code>DistanceComputers::CLASSICAL</code>.
+     * specified distance computer requires the data samples to be aligned.
      *
      * @tparam C Distance computer to use to compute the distances between the data samples. Based
      * on this parameter, this method computes the correct alignment the data samples must have.
+     * @tparam S Type of the attributes of the data sample.
      * @param n Index of the sample to check.
      * @param currentDataSample Data of the sample to check.
      * @throws std::invalid_argument If the sample is not correctly aligned.
      */
-    template <DistanceComputers C>
-    static inline void checkAlignment(const std::size_t n, const double *const currentDataSample) {
+    template <DistanceComputers C, typename S>
+    static inline void checkAlignment(const std::size_t n, const S *const currentDataSample) {
 
-        if constexpr (A && C != DistanceComputers::CLASSICAL) {
+        if constexpr (A && ParallelClustering::isAlignmentRequired(C)) {
             // Compute the alignment
             const constexpr std::size_t packSize =
                     (C == DistanceComputers::SSE || C == DistanceComputers::SSE_OPTIMIZED ||
                      C == DistanceComputers::SSE_OPTIMIZED_NO_SQUARE_ROOT)
-                            ? SSE_PACK_SIZE
-                            : AVX_PACK_SIZE;
-            const constexpr std::size_t alignment = packSize * sizeof(double);
+                            ? ParallelClustering::getSsePackSize<S>()
+                            : ParallelClustering::getAvxPackSize<S>();
+            const constexpr std::size_t alignment = packSize * sizeof(S);
 
             // Check the pointer alignment
             // NOLINTNEXTLINE(cppcoreguidelines-pro-type-reinterpret-cast)
@@ -322,196 +909,2166 @@ private:
     }
 
     /**
-     * Initialize the value of <code>pi</code> and <code>lambda</code> for a new point.<br>
-     * This method takes care of advancing the specified efficient iterators to the next element of
-     * <code>pi</code> and <code>lambda</code>.
-     *
-     * @tparam P Type of the data structure/iterator holding <code>pi</code>.
-     * @tparam L Type of the data structure/iterator holding <code>lambda</code>.
-     * @tparam EP Type of the efficient iterator iterating over <code>pi</code>.
-     * @tparam EL Type of the efficient iterator iterating over <code>lambda</code>.
-     * @param currentPi Efficient iterator pointing to the current element of <code>pi</code>.
-     * @param currentLambda Efficient iterator pointing to the current element of
-     * <code>lambda</code>.
-     * @param n Index of the new point to add.
-     */
-    template <typename P, typename L, typename EP, typename EL>
-    static inline void initializeNewPoint(EP &currentPi, EL &currentLambda, const std::size_t n) {
-
-        // **** Set pi[n] to n ****
-        PiLambdaIteratorUtils::getCurrentElement<std::size_t, P>(currentPi) = n;
-        PiLambdaIteratorUtils::moveNext<std::size_t, P>(currentPi);
-
-        // **** Set lambda[n] to infinity ****
-        PiLambdaIteratorUtils::getCurrentElement<double, L>(currentLambda) =
-                std::numeric_limits<double>::infinity();
-        PiLambdaIteratorUtils::moveNext<double, L>(currentLambda);
-    }
-
-    /**
-     * Computes the distances between the point to add and all the points that have already
-     * been added to the dendrogram.
+     * Computes the inverses of the norms of all the data samples, as required by the metrics
+     * whose accumulated value must be divided by the norms of the two data samples.<br>
+     * The norms are computed with the same instruction set of the distance computer, by
+     * accumulating the metric between each data sample and itself.
      *
-     * @tparam C Distance computer to use to compute the distances.
+     * @tparam C Distance computer to use to compute the norms.
+     * @tparam MT Policy describing the metric.
      * @tparam D Type of the data structure/iterator holding the data samples to cluster.
      * @tparam ED Type of the efficient iterator iterating over the data structure holding the data
      * samples to cluster.
-     * @param n Index of the point to add.
+     * @tparam S Type of the attributes of the data samples.
      * @param dataBegin Efficient iterator pointing to the first data sample.
-     * @param stride Number of <code>double</code>s between the first attribute of a data samples
+     * @param dataSamplesCount Number of data samples.
+     * @param stride Number of attributes between the first attribute of a data samples
      * and the first attribute of the following sample. This parameter is ignored if the data
      * samples are not contiguous in memory.
-     * @param currentDataN Pointer to the first attribute of the point to add.
-     * @param currentDataNEnd Pointer to the attribute following the last attribute of the point to
-     * add. This value acts as a placeholder, and it is used to identify the end of the data sample.
-     * @param m Array containing the part row values this method will initialize.
-     * @param distanceComputationThreadsCount Number of threads to use to compute the distances in
+     * @param inverseNorms Array where the inverses of the norms will be stored.
+     * @param distanceComputationThreadsCount Number of threads to use to compute the norms in
      * parallel. This parameter is ignored if <code>PD</code> is <code>false</code>.
+     * @throws std::invalid_argument If the data samples alignment check has been requested and one
+     * of the data samples in not correctly aligned.
      */
-    template <DistanceComputers C, typename D, typename ED>
-    static inline void computeDistances(const std::size_t n,
-                                        const ED &dataBegin,
-                                        const std::size_t stride,
-                                        const double *const __restrict__ currentDataN,
-                                        const double *const __restrict__ currentDataNEnd,
-                                        double *__restrict__ const m,
-                                        const std::size_t distanceComputationThreadsCount) {
+    template <DistanceComputers C, typename MT, typename D, typename ED, typename S>
+    static inline void computeInverseNorms(const ED &dataBegin,
+                                           const std::size_t dataSamplesCount,
+                                           const std::size_t stride,
+                                           S *__restrict__ const inverseNorms,
+                                           const std::size_t distanceComputationThreadsCount) {
+
+        // Check the alignment of all the data samples, if requested. This must be done before
+        // entering the parallel region, since no exception can escape from it
+        if constexpr (A && ParallelClustering::isAlignmentRequired(C)) {
+            for (std::size_t n = 0; n < dataSamplesCount; n++) {
+                checkAlignment<C>(
+                        n, DataIteratorUtils<S>::template getSampleAt<D>(dataBegin, n, stride));
+            }
+        }
 
-        // Compute the distance between the n-th element of the dataset and all the
-// already-processed ones
-#pragma omp parallel for default(none)                                 \
-        shared(n, m, dataBegin, currentDataN, currentDataNEnd, stride) \
-                num_threads(distanceComputationThreadsCount) if (PD)
-        for (std::size_t i = 0; i <= n - 1; i++) {
+#pragma omp parallel for default(none) shared(dataBegin, dataSamplesCount, stride, inverseNorms) \
+        num_threads(distanceComputationThreadsCount) if (PD)
+        for (std::size_t i = 0; i < dataSamplesCount; i++) {
             // Extract the i-th data sample
-            const double *const __restrict__ dataSample =
-                    utils::DataIteratorUtils::getSampleAt<D>(dataBegin, i, stride);
+            const S *const __restrict__ dataSample =
+                    DataIteratorUtils<S>::template getSampleAt<D>(dataBegin, i, stride);
 
-            // Compute the distance between the newly added point and the extracted data sample by
-            // using the requested algorithm
-            if constexpr (C == DistanceComputers::CLASSICAL) {
-                m[i] = ParallelClustering::distance(currentDataN, currentDataNEnd, dataSample);
-            } else if constexpr (C == DistanceComputers::SSE) {
-                m[i] = ParallelClustering::distanceSse(currentDataN, currentDataNEnd, dataSample);
-            } else if constexpr (C == DistanceComputers::AVX) {
-                m[i] = ParallelClustering::distanceAvx(currentDataN, currentDataNEnd, dataSample);
-            } else if constexpr (C == DistanceComputers::SSE_OPTIMIZED) {
-                m[i] = ParallelClustering::distanceSseOptimized(
-                        currentDataN, currentDataNEnd, dataSample);
-            } else if constexpr (C == DistanceComputers::AVX_OPTIMIZED) {
-                m[i] = ParallelClustering::distanceAvxOptimized(
-                        currentDataN, currentDataNEnd, dataSample);
-            } else if constexpr (C == DistanceComputers::SSE_OPTIMIZED_NO_SQUARE_ROOT) {
-                m[i] = ParallelClustering::distanceSseOptimizedNoSquareRoot(
-                        currentDataN, currentDataNEnd, dataSample);
-            } else if constexpr (C == DistanceComputers::AVX_OPTIMIZED_NO_SQUARE_ROOT) {
-                m[i] = ParallelClustering::distanceAvxOptimizedNoSquareRoot(
-                        currentDataN, currentDataNEnd, dataSample);
-            } else {
-                static_assert(always_false<ED>,
-                              "The specified distance computer is not supported.");
-            }
+            inverseNorms[i] = MT::computeInverseNorm(
+                    computeMetricValue<C, MT>(dataSample, dataSample + stride, dataSample));
         }
     }
 
     /**
-     * Adds to the dendrogram the new point.
+     * Executes all the iterations of the clustering algorithm using a unique team of threads,
+     * which is created once and kept alive until the last data sample has been added to the
+     * dendrogram.<br>
+     * Within each iteration, the threads share the computation of the distances (if
+     * <code>PD</code> is <code>true</code>) and of the structural fix (if <code>PF</code> is
+     * <code>true</code>), while the master thread initializes the new point and adds it to the
+     * dendrogram. Only two barriers per iteration are needed, since the structural fix of an
+     * iteration can overlap with the computation of the distances of the following one.<br>
+     * Since the timers are updated by the master thread only, the time the other threads spend
+     * finishing the structural fix is accounted to the computation of the distances.
      *
+     * @tparam C Distance computer to use to compute the distances between the data samples.
+     * @tparam MT Policy describing the metric.
+     * @tparam D Type of the data structure/iterator holding the data samples to cluster.
      * @tparam P Type of the data structure/iterator holding <code>pi</code>.
      * @tparam L Type of the data structure/iterator holding <code>lambda</code>.
+     * @tparam ED Type of the efficient iterator iterating over the data structure holding the data
+     * samples to cluster.
      * @tparam EP Type of the efficient iterator iterating over <code>pi</code>.
      * @tparam EL Type of the efficient iterator iterating over <code>lambda</code>.
+     * @tparam S Type of the attributes of the data samples.
+     * @param dataBegin Efficient iterator pointing to the first data sample.
+     * @param dataSamplesCount Number of data samples.
+     * @param stride Number of attributes between the first attribute of a data samples
+     * and the first attribute of the following sample. This parameter is ignored if the data
+     * samples are not contiguous in memory.
      * @param piBegin Efficient iterator pointing to the first element of <code>pi</code>.
      * @param lambdaBegin Efficient iterator pointing to the first element of <code>lambda</code>.
-     * @param mBegin Pointer pointing to the first element of <code>m</code>.
-     * @param mEnd Pointer pointing to the element <code>m[n]</code>. This value acts as a
-     * placeholder, and it is used to identify the last element of <code>m</code> that contains a
-     * valid distance.
-     * @param n Index of the point to add.
+     * @param m Array containing the part row values.
+     * @param inverseNorms Array containing the inverses of the norms of the data samples, if the
+     * metric requires them.
+     * @param threadsCount Number of threads of the team.
+     * @throws std::invalid_argument If the data samples alignment check has been requested and one
+     * of the data samples in not correctly aligned.
+     */
+    template <DistanceComputers C,
+              typename MT,
+              typename D,
+              typename P,
+              typename L,
+              typename ED,
+              typename EP,
+              typename EL,
+              typename S>
+    static inline void clusterUsingPersistentTeam(const ED &dataBegin,
+                                                  const std::size_t dataSamplesCount,
+                                                  const std::size_t stride,
+                                                  const EP &piBegin,
+                                                  const EL &lambdaBegin,
+                                                  S *__restrict__ const m,
+                                                  const S *__restrict__ const inverseNorms,
+                                                  const std::size_t threadsCount) {
+
+        // Check the alignment of all the data samples, if requested. This must be done before
+        // entering the parallel region, since no exception can escape from it
+        if constexpr (A && ParallelClustering::isAlignmentRequired(C)) {
+            for (std::size_t n = 0; n < dataSamplesCount; n++) {
+                checkAlignment<C>(
+                        n, DataIteratorUtils<S>::template getSampleAt<D>(dataBegin, n, stride));
+            }
+        }
+
+        // Log the initial progress
+        Logger::startLoggingProgress<0, 1, 2, 3, 4, 5>(dataSamplesCount);
+
+        // Efficient iterator pointing to the n-th element of pi, used only by the master thread
+        auto currentPi = piBegin;
+        // Efficient iterator pointing to the n-th element of lambda, used only by the master thread
+        auto currentLambda = lambdaBegin;
+
+        Timer::start<1>();
+        // **** 1) Set pi(1) to 0, lambda(1) to infinity ****
+        initializeNewPoint<P, L>(currentPi, currentLambda, 0);
+        Timer::stop<1>();
+
+#pragma omp parallel default(none)                                                        \
+        shared(dataBegin, dataSamplesCount, stride, piBegin, lambdaBegin, m, inverseNorms, \
+                       currentPi, currentLambda) num_threads(threadsCount) if (PD || PF)
+        {
+            // Perform the clustering algorithm for all the remaining data samples
+            for (std::size_t n = 1; n < dataSamplesCount; n++) {
+                // Pointer to the n-th data sample of the dataset
+                const S *__restrict__ const currentDataN =
+                        DataIteratorUtils<S>::template getSampleAt<D>(dataBegin, n, stride);
+                // Pointer to the first byte after the n-th data sample of the dataset
+                const S *__restrict__ const currentDataNEnd = currentDataN + stride;
+
+#pragma omp master
+                {
+                    // Log the progress every 1000 samples
+                    Logger::updateProgress<1000, 0, 1, 2, 3, 4, 5>(n, dataSamplesCount);
+                    Timer::start<2>();
+                }
+
+                // **** 2) Set M(i) to d(i, n + 1) for i = 1,..,n ****
+                if constexpr (PD) {
+                    // Share the distances among the threads, and wait for all of them to be ready
+#pragma omp for schedule(static)
+                    for (std::size_t i = 0; i <= n - 1; i++) {
+                        m[i] = computeMetricDistance<C, MT>(
+                                currentDataN,
+                                currentDataNEnd,
+                                DataIteratorUtils<S>::template getSampleAt<D>(
+                                        dataBegin, i, stride),
+                                inverseNorms,
+                                n,
+                                i);
+                    }
+                }
+
+#pragma omp master
+                {
+                    if constexpr (!PD) {
+                        for (std::size_t i = 0; i <= n - 1; i++) {
+                            m[i] = computeMetricDistance<C, MT>(
+                                    currentDataN,
+                                    currentDataNEnd,
+                                    DataIteratorUtils<S>::template getSampleAt<D>(
+                                            dataBegin, i, stride),
+                                    inverseNorms,
+                                    n,
+                                    i);
+                        }
+                    }
+                    Timer::stop<2>();
+
+                    Timer::start<1>();
+                    // **** 1) Set pi(n + 1) to n + 1, lambda(n + 1) to infinity ****
+                    initializeNewPoint<P, L>(currentPi, currentLambda, n);
+                    Timer::stop<1>();
+
+                    Timer::start<3>();
+                    // **** 3) For i from 1 to n ****
+                    addNewPoint<P, L>(piBegin, lambdaBegin, m, &(m[n]), n);
+                    Timer::stop<3>();
+
+                    if constexpr (!PF) {
+                        Timer::start<4>();
+                        //***  4) For i from 1 to n ****
+                        for (std::size_t i = 0; i <= n - 1; i++) {
+                            fixRepresentative<P, L>(piBegin, lambdaBegin, i, n);
+                        }
+                        Timer::stop<4>();
+                    }
+                }
+                // Wait for the new point to be added to the dendrogram
+#pragma omp barrier
+
+                if constexpr (PF) {
+#pragma omp master
+                    Timer::start<4>();
+
+                    //***  4) For i from 1 to n ****
+                    if constexpr (PD) {
+                        // The following computation of the distances does not access pi and
+                        // lambda, and ends with a barrier, so the threads do not need to wait here
+#pragma omp for schedule(static) nowait
+                        for (std::size_t i = 0; i <= n - 1; i++) {
+                            fixRepresentative<P, L>(piBegin, lambdaBegin, i, n);
+                        }
+                    } else {
+                        // The master thread will access pi and lambda as soon as it completes the
+                        // computation of the distances, so all the threads must wait here
+#pragma omp for schedule(static)
+                        for (std::size_t i = 0; i <= n - 1; i++) {
+                            fixRepresentative<P, L>(piBegin, lambdaBegin, i, n);
+                        }
+                    }
+
+#pragma omp master
+                    Timer::stop<4>();
+                }
+            }
+        }
+    }
+
+    /**
+     * Executes all the iterations of the clustering algorithm using a unique team of threads,
+     * overlapping the computation of the distances required by a data sample with the addition of
+     * the previous data sample to the dendrogram.<br>
+     * Since the distances do not depend on <code>pi</code> and <code>lambda</code>, they are
+     * stored into two part-row arrays that are used alternately: while the master thread adds the
+     * n-th data sample to the dendrogram using one array, the other threads of the team fill the
+     * other array with the distances required by the (n + 1)-th data sample. Such distances are
+     * distributed dynamically, so that the master thread can take the remaining ones as soon as
+     * it completes its work. Only one barrier per iteration is needed, or two if <code>PF</code>
+     * is <code>true</code>, since the structural fix must be completed before the following data
+     * sample is added to the dendrogram.<br>
+     * Since the timers are updated by the master thread only, the time the master thread spends
+     * waiting for the other threads to complete the distances is not accounted to any stage.
+     *
+     * @tparam C Distance computer to use to compute the distances between the data samples.
+     * @tparam MT Policy describing the metric.
+     * @tparam D Type of the data structure/iterator holding the data samples to cluster.
+     * @tparam P Type of the data structure/iterator holding <code>pi</code>.
+     * @tparam L Type of the data structure/iterator holding <code>lambda</code>.
+     * @tparam ED Type of the efficient iterator iterating over the data structure holding the data
+     * samples to cluster.
+     * @tparam EP Type of the efficient iterator iterating over <code>pi</code>.
+     * @tparam EL Type of the efficient iterator iterating over <code>lambda</code>.
+     * @tparam S Type of the attributes of the data samples.
+     * @param dataBegin Efficient iterator pointing to the first data sample.
+     * @param dataSamplesCount Number of data samples.
+     * @param stride Number of attributes between the first attribute of a data samples
+     * and the first attribute of the following sample. This parameter is ignored if the data
+     * samples are not contiguous in memory.
+     * @param piBegin Efficient iterator pointing to the first element of <code>pi</code>.
+     * @param lambdaBegin Efficient iterator pointing to the first element of <code>lambda</code>.
+     * @param m Array containing the part row values of the data samples having an odd index.
+     * @param inverseNorms Array containing the inverses of the norms of the data samples, if the
+     * metric requires them.
+     * @param threadsCount Number of threads of the team.
+     * @throws std::invalid_argument If the data samples alignment check has been requested and one
+     * of the data samples in not correctly aligned.
+     */
+    template <DistanceComputers C,
+              typename MT,
+              typename D,
+              typename P,
+              typename L,
+              typename ED,
+              typename EP,
+              typename EL,
+              typename S>
+    static inline void clusterUsingPipeline(const ED &dataBegin,
+                                            const std::size_t dataSamplesCount,
+                                            const std::size_t stride,
+                                            const EP &piBegin,
+                                            const EL &lambdaBegin,
+                                            S *__restrict__ const m,
+                                            const S *__restrict__ const inverseNorms,
+                                            const std::size_t threadsCount) {
+
+        // Check the alignment of all the data samples, if requested. This must be done before
+        // entering the parallel region, since no exception can escape from it
+        if constexpr (A && ParallelClustering::isAlignmentRequired(C)) {
+            for (std::size_t n = 0; n < dataSamplesCount; n++) {
+                checkAlignment<C>(
+                        n, DataIteratorUtils<S>::template getSampleAt<D>(dataBegin, n, stride));
+            }
+        }
+
+        Timer::start<0>();
+        // Array containing the part-row values of the data samples having an even index
+        auto *const __restrict__ evenM = new S[dataSamplesCount];
+        Timer::stop<0>();
+
+        // Log the initial progress
+        Logger::startLoggingProgress<0, 1, 2, 3, 4, 5>(dataSamplesCount);
+
+        // Efficient iterator pointing to the n-th element of pi, used only by the master thread
+        auto currentPi = piBegin;
+        // Efficient iterator pointing to the n-th element of lambda, used only by the master thread
+        auto currentLambda = lambdaBegin;
+
+        Timer::start<1>();
+        // **** 1) Set pi(1) to 0, lambda(1) to infinity ****
+        initializeNewPoint<P, L>(currentPi, currentLambda, 0);
+        Timer::stop<1>();
+
+#pragma omp parallel default(none)                                                         \
+        shared(dataBegin, dataSamplesCount, stride, piBegin, lambdaBegin, m, evenM, inverseNorms, \
+                       currentPi, currentLambda) num_threads(threadsCount) if (PD || PF)
+        {
+            // Fill the part-row array of the second data sample before starting the pipeline
+            if (dataSamplesCount > 1) {
+#pragma omp master
+                Timer::start<2>();
+
+                // **** 2) Set M(i) to d(i, n + 1) for i = 1,..,n ****
+                computeNextDistances<C, MT, D>(1, dataBegin, stride, m, inverseNorms);
+#pragma omp barrier
+
+#pragma omp master
+                Timer::stop<2>();
+            }
+
+            // Perform the clustering algorithm for all the remaining data samples
+            for (std::size_t n = 1; n < dataSamplesCount; n++) {
+                // Part-row array holding the distances required by the n-th data sample
+                S *__restrict__ const currentM = (n % 2 == 1) ? m : evenM;
+                // Part-row array to fill with the distances required by the following data sample
+                S *__restrict__ const nextM = (n % 2 == 1) ? evenM : m;
+
+#pragma omp master
+                {
+                    // Log the progress every 1000 samples
+                    Logger::updateProgress<1000, 0, 1, 2, 3, 4, 5>(n, dataSamplesCount);
+
+                    Timer::start<1>();
+                    // **** 1) Set pi(n + 1) to n + 1, lambda(n + 1) to infinity ****
+                    initializeNewPoint<P, L>(currentPi, currentLambda, n);
+                    Timer::stop<1>();
+
+                    Timer::start<3>();
+                    // **** 3) For i from 1 to n ****
+                    addNewPoint<P, L>(piBegin, lambdaBegin, currentM, &(currentM[n]), n);
+                    Timer::stop<3>();
+
+                    if constexpr (!PF) {
+                        Timer::start<4>();
+                        //***  4) For i from 1 to n ****
+                        for (std::size_t i = 0; i <= n - 1; i++) {
+                            fixRepresentative<P, L>(piBegin, lambdaBegin, i, n);
+                        }
+                        Timer::stop<4>();
+                    }
+
+                    Timer::start<2>();
+                }
+
+                // In the meanwhile, compute the distances required by the following data sample.
+                // The master thread joins the other threads as soon as it completes its work
+                if (n + 1 < dataSamplesCount) {
+                    // **** 2) Set M(i) to d(i, n + 1) for i = 1,..,n ****
+                    computeNextDistances<C, MT, D>(n + 1, dataBegin, stride, nextM, inverseNorms);
+                }
+
+                // Wait for the new point to be added to the dendrogram, and for all the distances
+                // to be computed
+#pragma omp barrier
+
+#pragma omp master
+                Timer::stop<2>();
+
+                if constexpr (PF) {
+#pragma omp master
+                    Timer::start<4>();
+
+                    //***  4) For i from 1 to n ****
+                    // The following data sample cannot be added until the fix is complete, so all
+                    // the threads must wait here
+#pragma omp for schedule(static)
+                    for (std::size_t i = 0; i <= n - 1; i++) {
+                        fixRepresentative<P, L>(piBegin, lambdaBegin, i, n);
+                    }
+
+#pragma omp master
+                    Timer::stop<4>();
+                }
+            }
+        }
+
+        Timer::start<0>();
+        // Deallocate the second part-row array, since it is not needed anymore
+        delete[] evenM;
+        Timer::stop<0>();
+    }
+
+    /**
+     * Computes the distances between the specified data sample and all the previous ones, by
+     * sharing them dynamically among the threads of the team executing this method. This method
+     * <b>MUST BE</b> called by all the threads of the team, and it does not wait for them to
+     * complete.<br>
+     * If <code>PD</code> is <code>false</code>, then all the distances are computed by the master
+     * thread.
+     *
+     * @tparam C Distance computer to use to compute the distances.
+     * @tparam MT Policy describing the metric.
+     * @tparam D Type of the data structure/iterator holding the data samples to cluster.
+     * @tparam ED Type of the efficient iterator iterating over the data structure holding the data
+     * samples to cluster.
+     * @tparam S Type of the attributes of the data samples.
+     * @param n Index of the data sample whose distances must be computed.
+     * @param dataBegin Efficient iterator pointing to the first data sample.
+     * @param stride Number of attributes between the first attribute of a data samples
+     * and the first attribute of the following sample. This parameter is ignored if the data
+     * samples are not contiguous in memory.
+     * @param m Array containing the part row values this method will initialize.
+     * @param inverseNorms Array containing the inverses of the norms of the data samples, if the
+     * metric requires them.
+     */
+    template <DistanceComputers C, typename MT, typename D, typename ED, typename S>
+    static inline void computeNextDistances(const std::size_t n,
+                                            const ED &dataBegin,
+                                            const std::size_t stride,
+                                            S *__restrict__ const m,
+                                            const S *__restrict__ const inverseNorms) {
+
+        // Pointer to the n-th data sample of the dataset
+        const S *__restrict__ const currentDataN =
+                DataIteratorUtils<S>::template getSampleAt<D>(dataBegin, n, stride);
+        // Pointer to the first byte after the n-th data sample of the dataset
+        const S *__restrict__ const currentDataNEnd = currentDataN + stride;
+
+        if constexpr (PD) {
+#pragma omp for schedule(dynamic, PIPELINE_CHUNK_SIZE) nowait
+            for (std::size_t i = 0; i <= n - 1; i++) {
+                m[i] = computeMetricDistance<C, MT>(
+                        currentDataN,
+                        currentDataNEnd,
+                        DataIteratorUtils<S>::template getSampleAt<D>(dataBegin, i, stride),
+                        inverseNorms,
+                        n,
+                        i);
+            }
+        } else {
+#pragma omp master
+            for (std::size_t i = 0; i <= n - 1; i++) {
+                m[i] = computeMetricDistance<C, MT>(
+                        currentDataN,
+                        currentDataNEnd,
+                        DataIteratorUtils<S>::template getSampleAt<D>(dataBegin, i, stride),
+                        inverseNorms,
+                        n,
+                        i);
+            }
+        }
+    }
+
+    /**
+     * Executes all the iterations of the clustering algorithm processing the data samples in
+     * blocks of <code>BLOCK_SIZE</code> consecutive ones.<br>
+     * At every iteration, the staged mode reads all the previous data samples to compute a single
+     * part-row, so the computation of the distances is bound by the memory bandwidth as soon as
+     * the dataset does not fit in the cache. Since the distances do not depend on
+     * <code>pi</code> and <code>lambda</code>, this method computes the part-rows of all the data
+     * samples of a block in a unique sweep over the previous data samples, reusing each of them
+     * for all the data samples of the block while it is still in the cache. Then, it adds the data
+     * samples of the block to the dendrogram one after the other, exactly as the staged mode
+     * does, so the result is the same.<br>
+     * The part-rows of all the data samples of a block are kept at the same time, so this method
+     * holds <code>BLOCK_SIZE * n</code> part-row values, instead of the <code>n</code> held by the
+     * staged and the persistent team modes and the <code>2 * n</code> held by the pipelined one.
+     *
+     * @tparam C Distance computer to use to compute the distances between the data samples.
+     * @tparam MT Policy describing the metric.
+     * @tparam D Type of the data structure/iterator holding the data samples to cluster.
+     * @tparam P Type of the data structure/iterator holding <code>pi</code>.
+     * @tparam L Type of the data structure/iterator holding <code>lambda</code>.
+     * @tparam ED Type of the efficient iterator iterating over the data structure holding the data
+     * samples to cluster.
+     * @tparam EP Type of the efficient iterator iterating over <code>pi</code>.
+     * @tparam EL Type of the efficient iterator iterating over <code>lambda</code>.
+     * @tparam S Type of the attributes of the data samples.
+     * @param data Data structure/iterator holding the data samples to cluster.
+     * @param dataBegin Efficient iterator pointing to the first data sample.
+     * @param dataSamplesCount Number of data samples.
+     * @param stride Number of attributes between the first attribute of a data samples
+     * and the first attribute of the following sample. This parameter is ignored if the data
+     * samples are not contiguous in memory.
+     * @param piBegin Efficient iterator pointing to the first element of <code>pi</code>.
+     * @param lambdaBegin Efficient iterator pointing to the first element of <code>lambda</code>.
+     * @param m Array containing the part row values of the first data sample of each block.
+     * @param inverseNorms Array containing the inverses of the norms of the data samples, if the
+     * metric requires them.
+     * @param distanceComputationThreadsCount Number of threads to use to compute the distances in
+     * parallel. This parameter is ignored if <code>PD</code> is <code>false</code>.
+     * @param structuralFixThreadsCount Number of threads to use to execute the structural fix in
+     * parallel. This parameter is ignored if <code>PF</code> is <code>false</code>.
+     * @throws std::invalid_argument If the data samples alignment check has been requested and one
+     * of the data samples in not correctly aligned.
+     */
+    template <DistanceComputers C,
+              typename MT,
+              typename D,
+              typename P,
+              typename L,
+              typename ED,
+              typename EP,
+              typename EL,
+              typename S>
+    static inline void clusterUsingBlocks(const D &data,
+                                          const ED &dataBegin,
+                                          const std::size_t dataSamplesCount,
+                                          const std::size_t stride,
+                                          const EP &piBegin,
+                                          const EL &lambdaBegin,
+                                          S *__restrict__ const m,
+                                          const S *__restrict__ const inverseNorms,
+                                          const std::size_t distanceComputationThreadsCount,
+                                          const std::size_t structuralFixThreadsCount) {
+
+        Timer::start<0>();
+        // Arrays containing the part-row values of the data samples of a block, the first of which
+        // is m. They are released automatically, so that they are never leaked if an exception is
+        // thrown
+        const std::unique_ptr<S[]> blockMOwner{new S[(BLOCK_SIZE - 1) * dataSamplesCount]};
+        S *const __restrict__ blockM = blockMOwner.get();
+        std::array<S *, BLOCK_SIZE> rows{};
+        rows[0] = m;
+        for (std::size_t k = 1; k < BLOCK_SIZE; k++) {
+            rows[k] = &(blockM[(k - 1) * dataSamplesCount]);
+        }
+        // Array containing the squared norms of the data samples, if the distances are computed
+        // by expanding them
+        const std::unique_ptr<S[]> normsOwner{
+                (C == DistanceComputers::NORM_EXPANSION) ? new S[dataSamplesCount] : nullptr};
+        S *__restrict__ const norms = normsOwner.get();
+        Timer::stop<0>();
+
+        // Check the alignment of the first data sample, if requested
+        checkAlignment<C>(0, DataIteratorUtils<S>::template getSampleAt<D>(dataBegin, 0, stride));
+
+        // Log the initial progress
+        Logger::startLoggingProgress<0, 1, 2, 3, 4, 5>(dataSamplesCount);
+
+        // Efficient iterator pointing to the n-th element of pi
+        auto currentPi = piBegin;
+        // Efficient iterator pointing to the n-th element of lambda
+        auto currentLambda = lambdaBegin;
+
+        Timer::start<1>();
+        // **** 1) Set pi(1) to 0, lambda(1) to infinity ****
+        initializeNewPoint<P, L>(currentPi, currentLambda, 0);
+        Timer::stop<1>();
+
+        if constexpr (C == DistanceComputers::NORM_EXPANSION) {
+            Timer::start<2>();
+            // Compute the squared norm of the first data sample. The ones of the other data
+            // samples are computed together with their block
+            const S *const firstDataSample =
+                    DataIteratorUtils<S>::template getSampleAt<D>(dataBegin, 0, stride);
+            norms[0] = dotProductAvxFma(firstDataSample, firstDataSample + stride, firstDataSample);
+            Timer::stop<2>();
+        }
+
+        // Perform the clustering algorithm for all the remaining data samples, one block at a time
+        for (std::size_t blockBegin = 1; blockBegin < dataSamplesCount; blockBegin += BLOCK_SIZE) {
+            // Index of the data sample following the last one of the block
+            const std::size_t blockEnd = std::min(blockBegin + BLOCK_SIZE, dataSamplesCount);
+
+            // Check the alignment of the data samples of the block, if requested
+            for (std::size_t n = blockBegin; n < blockEnd; n++) {
+                checkAlignment<C>(
+                        n, DataIteratorUtils<S>::template getSampleAt<D>(dataBegin, n, stride));
+            }
+
+            Timer::start<2>();
+            // **** 2) Set M(i) to d(i, n + 1) for i = 1,..,n, for all the samples of the block ****
+            computeBlockDistances<C, MT, D>(blockBegin,
+                                            blockEnd,
+                                            dataBegin,
+                                            stride,
+                                            rows,
+                                            norms,
+                                            inverseNorms,
+                                            distanceComputationThreadsCount);
+            // Let out-of-core datasets release the data samples they cannot keep in memory
+            releaseSweptSamples<D>(data, blockEnd - 1);
+            Timer::stop<2>();
+
+            // Add the data samples of the block to the dendrogram, one after the other
+            for (std::size_t n = blockBegin; n < blockEnd; n++) {
+                // Part-row array holding the distances required by the n-th data sample
+                S *__restrict__ const currentM = rows[n - blockBegin];
+
+                // Log the progress every 1000 samples
+                Logger::updateProgress<1000, 0, 1, 2, 3, 4, 5>(n, dataSamplesCount);
+
+                Timer::start<1>();
+                // **** 1) Set pi(n + 1) to n + 1, lambda(n + 1) to infinity ****
+                initializeNewPoint<P, L>(currentPi, currentLambda, n);
+                Timer::stop<1>();
+
+                Timer::start<3>();
+                // **** 3) For i from 1 to n ****
+                addNewPoint<P, L>(piBegin, lambdaBegin, currentM, &(currentM[n]), n);
+                Timer::stop<3>();
+
+                Timer::start<4>();
+                //***  4) For i from 1 to n ****
+                fixStructure<P, L>(piBegin, lambdaBegin, n, structuralFixThreadsCount);
+                Timer::stop<4>();
+            }
+        }
+    }
+
+    /**
+     * Computes the distances between the data samples of the specified block and all the data
+     * samples preceding each of them.<br>
+     * Every data sample preceding the block is read once, and its distances from all the data
+     * samples of the block are computed while it is still in the cache. The distances among the
+     * data samples of the block are computed separately. The distances are computed with the same
+     * order of the operands used by the staged mode, so they are exactly the same.<br>
+     * If <code>C</code> is <code>DistanceComputers::NORM_EXPANSION</code>, then this method also
+     * computes the squared norms of the data samples of the block, and the dot products between
+     * each data sample preceding the block and all the data samples of the block are computed
+     * together, keeping the partial sums in the registers.
+     *
+     * @tparam C Distance computer to use to compute the distances.
+     * @tparam MT Policy describing the metric.
+     * @tparam D Type of the data structure/iterator holding the data samples to cluster.
+     * @tparam ED Type of the efficient iterator iterating over the data structure holding the data
+     * samples to cluster.
+     * @tparam S Type of the attributes of the data samples.
+     * @param blockBegin Index of the first data sample of the block.
+     * @param blockEnd Index of the data sample following the last one of the block.
+     * @param dataBegin Efficient iterator pointing to the first data sample.
+     * @param stride Number of attributes between the first attribute of a data samples
+     * and the first attribute of the following sample. This parameter is ignored if the data
+     * samples are not contiguous in memory.
+     * @param rows Arrays containing the part row values this method will initialize. The array
+     * <code>rows[k]</code> is filled with the distances required by the data sample
+     * <code>blockBegin + k</code>.
+     * @param norms Array containing the squared norms of the data samples preceding the block,
+     * where this method will store the ones of the data samples of the block. This parameter is
+     * ignored if <code>C</code> is not <code>DistanceComputers::NORM_EXPANSION</code>.
+     * @param inverseNorms Array containing the inverses of the norms of the data samples, if the
+     * metric requires them.
+     * @param distanceComputationThreadsCount Number of threads to use to compute the distances in
+     * parallel. This parameter is ignored if <code>PD</code> is <code>false</code>.
+     */
+    template <DistanceComputers C, typename MT, typename D, typename ED, typename S>
+    static inline void computeBlockDistances(const std::size_t blockBegin,
+                                             const std::size_t blockEnd,
+                                             const ED &dataBegin,
+                                             const std::size_t stride,
+                                             const std::array<S *, BLOCK_SIZE> &rows,
+                                             S *__restrict__ const norms,
+                                             const S *__restrict__ const inverseNorms,
+                                             const std::size_t distanceComputationThreadsCount) {
+
+        // Number of data samples of the block
+        const std::size_t blockSize = blockEnd - blockBegin;
+        // Pointers to the data samples of the block
+        std::array<const S *, BLOCK_SIZE> blockSamples{};
+        for (std::size_t k = 0; k < blockSize; k++) {
+            blockSamples[k] = DataIteratorUtils<S>::template getSampleAt<D>(
+                    dataBegin, blockBegin + k, stride);
+        }
+
+        if constexpr (C == DistanceComputers::NORM_EXPANSION) {
+            // Compute the squared norms of the data samples of the block
+            for (std::size_t k = 0; k < blockSize; k++) {
+                norms[blockBegin + k] = dotProductAvxFma(
+                        blockSamples[k], blockSamples[k] + stride, blockSamples[k]);
+            }
+            // Fill the last block with copies of its last data sample, so that the dot products
+            // are always computed for a whole block
+            for (std::size_t k = blockSize; k < BLOCK_SIZE; k++) {
+                blockSamples[k] = blockSamples[blockSize - 1];
+            }
+
+            // Compute the distances between the data samples of the block and all the data
+            // samples preceding the block
+#pragma omp parallel for default(none) shared(blockBegin, blockSize, dataBegin, stride, rows, \
+                                                      norms, blockSamples) \
+        num_threads(distanceComputationThreadsCount) if (PD)
+            for (std::size_t i = 0; i < blockBegin; i++) {
+                // Extract the i-th data sample
+                const S *const __restrict__ dataSample =
+                        DataIteratorUtils<S>::template getSampleAt<D>(dataBegin, i, stride);
+
+                // Compute the dot products with all the data samples of the block at once
+                std::array<S, BLOCK_SIZE> dotProducts{};
+                dotProductsAvxFma(blockSamples, dataSample, dataSample + stride, dotProducts);
+
+                for (std::size_t k = 0; k < blockSize; k++) {
+                    rows[k][i] = expandSquaredDistance(blockSamples[k],
+                                                       blockSamples[k] + stride,
+                                                       dataSample,
+                                                       norms[blockBegin + k],
+                                                       norms[i],
+                                                       dotProducts[k]);
+                }
+            }
+
+            // Compute the distances among the data samples of the block
+            for (std::size_t k = 1; k < blockSize; k++) {
+                for (std::size_t i = 0; i < k; i++) {
+                    rows[k][blockBegin + i] = expandSquaredDistance(
+                            blockSamples[k],
+                            blockSamples[k] + stride,
+                            blockSamples[i],
+                            norms[blockBegin + k],
+                            norms[blockBegin + i],
+                            dotProductAvxFma(
+                                    blockSamples[k], blockSamples[k] + stride, blockSamples[i]));
+                }
+            }
+        } else {
+            // Compute the distances between the data samples of the block and all the data
+            // samples preceding the block
+#pragma omp parallel for default(none) shared(blockBegin, blockSize, dataBegin, stride, rows, \
+                                                      inverseNorms, blockSamples) \
+        num_threads(distanceComputationThreadsCount) if (PD)
+            for (std::size_t i = 0; i < blockBegin; i++) {
+                // Extract the i-th data sample
+                const S *const __restrict__ dataSample =
+                        DataIteratorUtils<S>::template getSampleAt<D>(dataBegin, i, stride);
+
+                for (std::size_t k = 0; k < blockSize; k++) {
+                    rows[k][i] = computeMetricDistance<C, MT>(blockSamples[k],
+                                                              blockSamples[k] + stride,
+                                                              dataSample,
+                                                              inverseNorms,
+                                                              blockBegin + k,
+                                                              i);
+                }
+            }
+
+            // Compute the distances among the data samples of the block
+            for (std::size_t k = 1; k < blockSize; k++) {
+                for (std::size_t i = 0; i < k; i++) {
+                    rows[k][blockBegin + i] =
+                            computeMetricDistance<C, MT>(blockSamples[k],
+                                                         blockSamples[k] + stride,
+                                                         blockSamples[i],
+                                                         inverseNorms,
+                                                         blockBegin + k,
+                                                         blockBegin + i);
+                }
+            }
+        }
+    }
+
+    /**
+     * Executes all the iterations of the clustering algorithm using data samples stored in blocks
+     * whose attributes are interleaved, as required by
+     * <code>DistanceComputers::AVX_INTERLEAVED_NO_SQUARE_ROOT</code>.<br>
+     * The iterations are the same as the ones of the staged mode, but the distances between the
+     * n-th data sample and the previous ones are computed one block at a time. The distances from
+     * the data samples of the last block that do not precede the n-th one are computed as well,
+     * and they are stored after the valid part of the part-row array, where they are ignored.
+     *
+     * @tparam C Distance computer to use to compute the distances between the data samples.
+     * @tparam D Type of the data structure/iterator holding the blocks of data samples.
+     * @tparam P Type of the data structure/iterator holding <code>pi</code>.
+     * @tparam L Type of the data structure/iterator holding <code>lambda</code>.
+     * @tparam ED Type of the efficient iterator iterating over the data structure holding the
+     * blocks of data samples.
+     * @tparam EP Type of the efficient iterator iterating over <code>pi</code>.
+     * @tparam EL Type of the efficient iterator iterating over <code>lambda</code>.
+     * @tparam S Type of the attributes of the data samples.
+     * @param dataBegin Efficient iterator pointing to the first block of data samples.
+     * @param dataSamplesCount Number of data samples.
+     * @param stride Number of attributes between the first attribute of a block and the first
+     * attribute of the following block. This parameter is ignored if the blocks are not
+     * contiguous in memory.
+     * @param piBegin Efficient iterator pointing to the first element of <code>pi</code>.
+     * @param lambdaBegin Efficient iterator pointing to the first element of <code>lambda</code>.
+     * @param m Array containing the part row values. Its size <b>MUST BE</b> a multiple of the
+     * number of data samples held by a block.
+     * @param distanceComputationThreadsCount Number of threads to use to compute the distances in
+     * parallel. This parameter is ignored if <code>PD</code> is <code>false</code>.
+     * @param structuralFixThreadsCount Number of threads to use to execute the structural fix in
+     * parallel. This parameter is ignored if <code>PF</code> is <code>false</code>.
+     * @throws std::invalid_argument If the data samples alignment check has been requested and one
+     * of the blocks in not correctly aligned.
+     */
+    template <DistanceComputers C,
+              typename D,
+              typename P,
+              typename L,
+              typename ED,
+              typename EP,
+              typename EL,
+              typename S>
+    static inline void clusterUsingInterleavedData(
+            const ED &dataBegin,
+            const std::size_t dataSamplesCount,
+            const std::size_t stride,
+            const EP &piBegin,
+            const EL &lambdaBegin,
+            S *__restrict__ const m,
+            const std::size_t distanceComputationThreadsCount,
+            const std::size_t structuralFixThreadsCount) {
+
+        // Check the alignment of all the blocks, if requested
+        const constexpr std::size_t packSize = ParallelClustering::getAvxPackSize<S>();
+        const std::size_t blocksCount = (dataSamplesCount + packSize - 1) / packSize;
+        for (std::size_t b = 0; b < blocksCount; b++) {
+            checkAlignment<C>(b,
+                              DataIteratorUtils<S>::template getSampleAt<D>(dataBegin, b, stride));
+        }
+
+        // Log the initial progress
+        Logger::startLoggingProgress<0, 1, 2, 3, 4, 5>(dataSamplesCount);
+
+        // Efficient iterator pointing to the n-th element of pi
+        auto currentPi = piBegin;
+        // Efficient iterator pointing to the n-th element of lambda
+        auto currentLambda = lambdaBegin;
+
+        Timer::start<1>();
+        // **** 1) Set pi(1) to 0, lambda(1) to infinity ****
+        initializeNewPoint<P, L>(currentPi, currentLambda, 0);
+        Timer::stop<1>();
+
+        // Perform the clustering algorithm for all the remaining data samples
+        for (std::size_t n = 1; n < dataSamplesCount; n++) {
+            // Log the progress every 1000 samples
+            Logger::updateProgress<1000, 0, 1, 2, 3, 4, 5>(n, dataSamplesCount);
+
+            Timer::start<1>();
+            // **** 1) Set pi(n + 1) to n + 1, lambda(n + 1) to infinity ****
+            initializeNewPoint<P, L>(currentPi, currentLambda, n);
+            Timer::stop<1>();
+
+            Timer::start<2>();
+            // **** 2) Set M(i) to d(i, n + 1) for i = 1,..,n ****
+            computeInterleavedDistances<D>(
+                    n, dataBegin, stride, m, distanceComputationThreadsCount);
+            Timer::stop<2>();
+
+            Timer::start<3>();
+            // **** 3) For i from 1 to n ****
+            addNewPoint<P, L>(piBegin, lambdaBegin, m, &(m[n]), n);
+            Timer::stop<3>();
+
+            Timer::start<4>();
+            //***  4) For i from 1 to n ****
+            fixStructure<P, L>(piBegin, lambdaBegin, n, structuralFixThreadsCount);
+            Timer::stop<4>();
+        }
+    }
+
+    /**
+     * Computes the distances between the specified data sample and all the blocks holding the
+     * previous data samples, whose attributes are interleaved.
+     *
+     * @tparam D Type of the data structure/iterator holding the blocks of data samples.
+     * @tparam ED Type of the efficient iterator iterating over the data structure holding the
+     * blocks of data samples.
+     * @tparam S Type of the attributes of the data samples.
+     * @param n Index of the data sample whose distances must be computed.
+     * @param dataBegin Efficient iterator pointing to the first block of data samples.
+     * @param stride Number of attributes between the first attribute of a block and the first
+     * attribute of the following block. This parameter is ignored if the blocks are not
+     * contiguous in memory.
+     * @param m Array containing the part row values this method will initialize.
+     * @param distanceComputationThreadsCount Number of threads to use to compute the distances in
+     * parallel. This parameter is ignored if <code>PD</code> is <code>false</code>.
+     */
+    template <typename D, typename ED, typename S>
+    static inline void computeInterleavedDistances(
+            const std::size_t n,
+            const ED &dataBegin,
+            const std::size_t stride,
+            S *__restrict__ const m,
+            const std::size_t distanceComputationThreadsCount) {
+
+        const constexpr std::size_t packSize = ParallelClustering::getAvxPackSize<S>();
+        // Pointer to the first attribute of the n-th data sample, inside its block
+        const S *__restrict__ const currentDataN =
+                DataIteratorUtils<S>::template getSampleAt<D>(dataBegin, n / packSize, stride) +
+                n % packSize;
+        // Number of blocks holding the data samples preceding the n-th one
+        const std::size_t blocksCount = (n + packSize - 1) / packSize;
+
+#pragma omp parallel for default(none) \
+        shared(n, m, dataBegin, currentDataN, stride, blocksCount) \
+                num_threads(distanceComputationThreadsCount) if (PD)
+        for (std::size_t b = 0; b < blocksCount; b++) {
+            // Extract the b-th block
+            const S *const __restrict__ block =
+                    DataIteratorUtils<S>::template getSampleAt<D>(dataBegin, b, stride);
+
+            // Compute the distances between the n-th data sample and the data samples of the block
+            ParallelClustering::distancesAvxInterleavedNoSquareRoot(
+                    block, block + stride, currentDataN, &(m[b * packSize]));
+        }
+    }
+
+    /**
+     * Initialize the value of <code>pi</code> and <code>lambda</code> for a new point.<br>
+     * This method takes care of advancing the specified efficient iterators to the next element of
+     * <code>pi</code> and <code>lambda</code>.
+     *
+     * @tparam P Type of the data structure/iterator holding <code>pi</code>.
+     * @tparam L Type of the data structure/iterator holding <code>lambda</code>.
+     * @tparam EP Type of the efficient iterator iterating over <code>pi</code>.
+     * @tparam EL Type of the efficient iterator iterating over <code>lambda</code>.
+     * @param currentPi Efficient iterator pointing to the current element of <code>pi</code>.
+     * @param currentLambda Efficient iterator pointing to the current element of
+     * <code>lambda</code>.
+     * @param n Index of the new point to add.
+     */
+    template <typename P, typename L, typename EP, typename EL>
+    static inline void initializeNewPoint(EP &currentPi, EL &currentLambda, const std::size_t n) {
+
+        // **** Set pi[n] to n ****
+        PiLambdaIteratorUtils::getCurrentElement<utils::PiElement<P>, P>(currentPi) =
+                static_cast<utils::PiElement<P>>(n);
+        PiLambdaIteratorUtils::moveNext<utils::PiElement<P>, P>(currentPi);
+
+        // **** Set lambda[n] to infinity ****
+        PiLambdaIteratorUtils::getCurrentElement<double, L>(currentLambda) =
+                std::numeric_limits<double>::infinity();
+        PiLambdaIteratorUtils::moveNext<double, L>(currentLambda);
+    }
+
+    /**
+     * Copies into the part-row the distances between the specified data sample and all the
+     * previous ones, gathering them from the n-th column of a condensed distance matrix, i.e.,
+     * reading one distance from each of the first <code>n</code> rows.
+     *
+     * @tparam S Type of the distances.
+     * @param n Index of the point to add.
+     * @param distances Pointer to the first distance of the condensed distance matrix.
+     * @param dataSamplesCount Number of data samples.
+     * @param m Array containing the part row values this method will initialize.
+     * @param distanceReadingThreadsCount Number of threads to use to copy the distances in
+     * parallel. This parameter is ignored if <code>PD</code> is <code>false</code>.
+     */
+    template <typename S>
+    static inline void readDistances(const std::size_t n,
+                                     const S *__restrict__ const distances,
+                                     const std::size_t dataSamplesCount,
+                                     S *__restrict__ const m,
+                                     const std::size_t distanceReadingThreadsCount) {
+
+        // Read the distance between the n-th data sample and all the previous ones. The distance
+        // from the i-th data sample follows the one read from the same row at the previous
+        // iteration
+#pragma omp parallel for default(none) shared(n, distances, dataSamplesCount, m) \
+        num_threads(distanceReadingThreadsCount) if (PD)
+        for (std::size_t i = 0; i <= n - 1; i++) {
+            m[i] = distances[computeCondensedIndex(i, n, dataSamplesCount)];
+        }
+    }
+
+    /**
+     * Computes the distances between the point to add and all the points that have already
+     * been added to the dendrogram.
+     *
+     * @tparam C Distance computer to use to compute the distances.
+     * @tparam MT Policy describing the metric.
+     * @tparam D Type of the data structure/iterator holding the data samples to cluster.
+     * @tparam ED Type of the efficient iterator iterating over the data structure holding the data
+     * samples to cluster.
+     * @tparam S Type of the attributes of the data samples.
+     * @param n Index of the point to add.
+     * @param dataBegin Efficient iterator pointing to the first data sample.
+     * @param stride Number of attributes between the first attribute of a data samples
+     * and the first attribute of the following sample. This parameter is ignored if the data
+     * samples are not contiguous in memory.
+     * @param currentDataN Pointer to the first attribute of the point to add.
+     * @param currentDataNEnd Pointer to the attribute following the last attribute of the point to
+     * add. This value acts as a placeholder, and it is used to identify the end of the data sample.
+     * @param m Array containing the part row values this method will initialize.
+     * @param inverseNorms Array containing the inverses of the norms of the data samples, if the
+     * metric requires them.
+     * @param distanceComputationThreadsCount Number of threads to use to compute the distances in
+     * parallel. This parameter is ignored if <code>PD</code> is <code>false</code>.
+     */
+    template <DistanceComputers C, typename MT, typename D, typename ED, typename S>
+    static inline void computeDistances(const std::size_t n,
+                                        const ED &dataBegin,
+                                        const std::size_t stride,
+                                        const S *const __restrict__ currentDataN,
+                                        const S *const __restrict__ currentDataNEnd,
+                                        S *__restrict__ const m,
+                                        const S *__restrict__ const inverseNorms,
+                                        const std::size_t distanceComputationThreadsCount) {
+
+        // Compute the distance between the n-th element of the dataset and all the
+// already-processed ones
+#pragma omp parallel for default(none)                                               \
+        shared(n, m, dataBegin, currentDataN, currentDataNEnd, stride, inverseNorms) \
+                num_threads(distanceComputationThreadsCount) if (PD)
+        for (std::size_t i = 0; i <= n - 1; i++) {
+            // Extract the i-th data sample
+            const S *const __restrict__ dataSample =
+                    DataIteratorUtils<S>::template getSampleAt<D>(dataBegin, i, stride);
+
+            // Compute the distance between the newly added point and the extracted data sample by
+            // using the requested algorithm
+            m[i] = computeMetricDistance<C, MT>(
+                    currentDataN, currentDataNEnd, dataSample, inverseNorms, n, i);
+        }
+    }
+
+    /**
+     * Computes the distance between two data samples using the specified distance computer.
+     *
+     * @tparam C Distance computer to use to compute the distance.
+     * @tparam S Type of the attributes of the data samples.
+     * @param firstPointBegin Pointer to the first attribute of the first data sample.
+     * @param firstPointEnd Pointer to the attribute following the last attribute of the first
+     * data sample. This value acts as a placeholder, and it is used to identify the end of the
+     * first point.
+     * @param secondPointBegin Pointer to the first attribute of the second data sample.
+     * @return The distance between the two points, or its square if the distance computer avoids
+     * the computation of the square roots.
+     */
+    template <DistanceComputers C, typename S>
+    static inline S computeDistance(const S *__restrict__ const firstPointBegin,
+                                    const S *__restrict__ const firstPointEnd,
+                                    const S *__restrict__ const secondPointBegin) noexcept {
+
+        if constexpr (C == DistanceComputers::CLASSICAL) {
+            return ParallelClustering::distance(firstPointBegin, firstPointEnd, secondPointBegin);
+        } else if constexpr (C == DistanceComputers::SSE) {
+            return ParallelClustering::distanceSse(
+                    firstPointBegin, firstPointEnd, secondPointBegin);
+        } else if constexpr (C == DistanceComputers::AVX) {
+            return ParallelClustering::distanceAvx(
+                    firstPointBegin, firstPointEnd, secondPointBegin);
+        } else if constexpr (C == DistanceComputers::SSE_OPTIMIZED) {
+            return ParallelClustering::distanceSseOptimized(
+                    firstPointBegin, firstPointEnd, secondPointBegin);
+        } else if constexpr (C == DistanceComputers::AVX_OPTIMIZED) {
+            return ParallelClustering::distanceAvxOptimized(
+                    firstPointBegin, firstPointEnd, secondPointBegin);
+        } else if constexpr (C == DistanceComputers::SSE_OPTIMIZED_NO_SQUARE_ROOT) {
+            return ParallelClustering::distanceSseOptimizedNoSquareRoot(
+                    firstPointBegin, firstPointEnd, secondPointBegin);
+        } else if constexpr (C == DistanceComputers::AVX_OPTIMIZED_NO_SQUARE_ROOT) {
+            return ParallelClustering::distanceAvxOptimizedNoSquareRoot(
+                    firstPointBegin, firstPointEnd, secondPointBegin);
+        } else if constexpr (C == DistanceComputers::AVX_FMA) {
+            return ParallelClustering::distanceAvxFma(
+                    firstPointBegin, firstPointEnd, secondPointBegin);
+        } else if constexpr (C == DistanceComputers::AVX_FMA_NO_SQUARE_ROOT) {
+            return ParallelClustering::distanceAvxFmaNoSquareRoot(
+                    firstPointBegin, firstPointEnd, secondPointBegin);
+        } else if constexpr (C == DistanceComputers::AVX512) {
+            return ParallelClustering::distanceAvx512(
+                    firstPointBegin, firstPointEnd, secondPointBegin);
+        } else if constexpr (C == DistanceComputers::AVX512_NO_SQUARE_ROOT) {
+            return ParallelClustering::distanceAvx512NoSquareRoot(
+                    firstPointBegin, firstPointEnd, secondPointBegin);
+        } else if constexpr (C == DistanceComputers::AUTO) {
+            return DistanceKernelDispatcher::computeSquaredDistance(
+                    firstPointBegin,
+                    secondPointBegin,
+                    static_cast<std::size_t>(firstPointEnd - firstPointBegin));
+        } else {
+            static_assert(always_false<std::integral_constant<DistanceComputers, C>>,
+                          "The specified distance computer is not supported.");
+        }
+    }
+
+    /**
+     * Computes the distance between two data samples using the specified distance computer and
+     * the specified metric.<br>
+     * The Euclidean metric is computed by the kernels of the distance computer. Any other metric
+     * is accumulated using the instruction set of the distance computer, then it is divided by the
+     * norms of the data samples, if the metric requires them, and it is transformed into the
+     * distance, unless the distance computer defers the square roots.
+     *
+     * @tparam C Distance computer to use to compute the distance.
+     * @tparam MT Policy describing the metric.
+     * @tparam S Type of the attributes of the data samples.
+     * @param firstPointBegin Pointer to the first attribute of the first data sample.
+     * @param firstPointEnd Pointer to the attribute following the last attribute of the first
+     * data sample. This value acts as a placeholder, and it is used to identify the end of the
+     * first point.
+     * @param secondPointBegin Pointer to the first attribute of the second data sample.
+     * @param inverseNorms Array containing the inverses of the norms of the data samples, if the
+     * metric requires them.
+     * @param firstIndex Index of the first data sample.
+     * @param secondIndex Index of the second data sample.
+     * @return The distance between the two points, or its monotonically increasing function
+     * defined by the metric if the distance computer avoids the computation of the square roots.
+     */
+    template <DistanceComputers C, typename MT, typename S>
+    static inline S computeMetricDistance(const S *__restrict__ const firstPointBegin,
+                                          const S *__restrict__ const firstPointEnd,
+                                          const S *__restrict__ const secondPointBegin,
+                                          const S *__restrict__ const inverseNorms,
+                                          const std::size_t firstIndex,
+                                          const std::size_t secondIndex) noexcept {
+
+        if constexpr (std::is_same_v<MT, utils::EuclideanMetric>) {
+            return computeDistance<C>(firstPointBegin, firstPointEnd, secondPointBegin);
+        } else {
+            S value = computeMetricValue<C, MT>(firstPointBegin, firstPointEnd, secondPointBegin);
+            if constexpr (MT::REQUIRES_NORMS) {
+                value = MT::normalize(value, inverseNorms[firstIndex], inverseNorms[secondIndex]);
+            }
+            if constexpr (MT::IS_TRANSFORMED && !ParallelClustering::isSquareRootDeferred(C)) {
+                value = static_cast<S>(MT::transform(value));
+            }
+            return value;
+        }
+    }
+
+    /**
+     * Accumulates the specified metric over the attributes of two data samples, using the
+     * instruction set of the specified distance computer.
+     *
+     * @tparam C Distance computer whose instruction set is used.
+     * @tparam MT Policy describing the metric.
+     * @tparam S Type of the attributes of the data samples.
+     * @param firstPointBegin Pointer to the first attribute of the first data sample.
+     * @param firstPointEnd Pointer to the attribute following the last attribute of the first
+     * data sample. This value acts as a placeholder, and it is used to identify the end of the
+     * first point.
+     * @param secondPointBegin Pointer to the first attribute of the second data sample.
+     * @return The accumulated value of the metric.
+     */
+    template <DistanceComputers C, typename MT, typename S>
+    static inline S computeMetricValue(const S *__restrict__ const firstPointBegin,
+                                       const S *__restrict__ const firstPointEnd,
+                                       const S *__restrict__ const secondPointBegin) noexcept {
+
+        if constexpr (C == DistanceComputers::CLASSICAL) {
+            return ParallelClustering::accumulateMetric<MT>(
+                    firstPointBegin, firstPointEnd, secondPointBegin);
+        } else if constexpr (C == DistanceComputers::SSE || C == DistanceComputers::SSE_OPTIMIZED ||
+                             C == DistanceComputers::SSE_OPTIMIZED_NO_SQUARE_ROOT) {
+            return ParallelClustering::accumulateMetricSse<MT>(
+                    firstPointBegin, firstPointEnd, secondPointBegin);
+        } else if constexpr (C == DistanceComputers::AVX || C == DistanceComputers::AVX_OPTIMIZED ||
+                             C == DistanceComputers::AVX_OPTIMIZED_NO_SQUARE_ROOT ||
+                             C == DistanceComputers::AVX_FMA ||
+                             C == DistanceComputers::AVX_FMA_NO_SQUARE_ROOT) {
+            return ParallelClustering::accumulateMetricAvx<MT>(
+                    firstPointBegin, firstPointEnd, secondPointBegin);
+        } else {
+            static_assert(always_false<std::integral_constant<DistanceComputers, C>>,
+                          "The specified distance computer supports only the Euclidean metric.");
+        }
+    }
+
+    /**
+     * Accumulates the specified metric over the attributes of two data samples, one attribute at
+     * a time.
+     *
+     * @tparam MT Policy describing the metric.
+     * @tparam S Type of the attributes of the data samples.
+     * @param firstPointBegin Pointer to the first attribute of the first data sample.
+     * @param firstPointEnd Pointer to the attribute following the last attribute of the first
+     * data sample. This value acts as a placeholder, and it is used to identify the end of the
+     * first point.
+     * @param secondPointBegin Pointer to the first attribute of the second data sample.
+     * @return The accumulated value of the metric.
+     */
+    template <typename MT, typename S>
+    static inline S accumulateMetric(const S *__restrict__ const firstPointBegin,
+                                     const S *__restrict__ const firstPointEnd,
+                                     const S *__restrict__ const secondPointBegin) noexcept {
+
+        S accumulator = 0;
+        const S *__restrict__ firstPoint = firstPointBegin;
+        const S *__restrict__ secondPoint = secondPointBegin;
+
+        while (firstPoint != firstPointEnd) {
+            accumulator = MT::accumulate(accumulator, *firstPoint, *secondPoint);
+            firstPoint++;
+            secondPoint++;
+        }
+
+        return accumulator;
+    }
+
+    /**
+     * Accumulates the specified metric over the attributes of two data samples using SSE
+     * instructions, keeping the partial values in the registers.
+     *
+     * @tparam MT Policy describing the metric.
+     * @param firstPointBegin Pointer to the first attribute of the first data sample.
+     * @param firstPointEnd Pointer to the attribute following the last attribute of the first
+     * data sample. This value acts as a placeholder, and it is used to identify the end of the
+     * first point.
+     * @param secondPointBegin Pointer to the first attribute of the second data sample.
+     * @return The accumulated value of the metric.
+     */
+    template <typename MT>
+    __attribute__((target("sse3"))) static inline double accumulateMetricSse(
+            const double *__restrict__ const firstPointBegin,
+            const double *__restrict__ const firstPointEnd,
+            const double *__restrict__ const secondPointBegin) noexcept {
+
+        // Initialize the register that accumulates the partial values
+        __m128d accumulator = _mm_setzero_pd();
+
+        const double *__restrict__ firstPoint = firstPointBegin;
+        const double *__restrict__ secondPoint = secondPointBegin;
+
+        while (firstPoint != firstPointEnd) {
+            // Accumulate the next 2 coordinates of the two points
+            accumulator = MT::accumulate(
+                    accumulator, _mm_load_pd(firstPoint), _mm_load_pd(secondPoint));
+
+            firstPoint += SSE_PACK_SIZE;
+            secondPoint += SSE_PACK_SIZE;
+        }
+
+        // Combine the partial values
+        return MT::reduce(accumulator);
+    }
+
+    /**
+     * Accumulates the specified metric over the attributes of two data samples using SSE
+     * instructions, keeping the partial values in the registers.
+     *
+     * @tparam MT Policy describing the metric.
+     * @param firstPointBegin Pointer to the first attribute of the first data sample.
+     * @param firstPointEnd Pointer to the attribute following the last attribute of the first
+     * data sample. This value acts as a placeholder, and it is used to identify the end of the
+     * first point.
+     * @param secondPointBegin Pointer to the first attribute of the second data sample.
+     * @return The accumulated value of the metric.
+     */
+    template <typename MT>
+    __attribute__((target("sse3"))) static inline float accumulateMetricSse(
+            const float *__restrict__ const firstPointBegin,
+            const float *__restrict__ const firstPointEnd,
+            const float *__restrict__ const secondPointBegin) noexcept {
+
+        // Initialize the register that accumulates the partial values
+        __m128 accumulator = _mm_setzero_ps();
+
+        const float *__restrict__ firstPoint = firstPointBegin;
+        const float *__restrict__ secondPoint = secondPointBegin;
+
+        while (firstPoint != firstPointEnd) {
+            // Accumulate the next 4 coordinates of the two points
+            accumulator = MT::accumulate(
+                    accumulator, _mm_load_ps(firstPoint), _mm_load_ps(secondPoint));
+
+            firstPoint += SSE_FLOAT_PACK_SIZE;
+            secondPoint += SSE_FLOAT_PACK_SIZE;
+        }
+
+        // Combine the partial values
+        return MT::reduce(accumulator);
+    }
+
+    /**
+     * Accumulates the specified metric over the attributes of two data samples using AVX
+     * instructions, keeping the partial values in the registers.
+     *
+     * @tparam MT Policy describing the metric.
+     * @param firstPointBegin Pointer to the first attribute of the first data sample.
+     * @param firstPointEnd Pointer to the attribute following the last attribute of the first
+     * data sample. This value acts as a placeholder, and it is used to identify the end of the
+     * first point.
+     * @param secondPointBegin Pointer to the first attribute of the second data sample.
+     * @return The accumulated value of the metric.
+     */
+    template <typename MT>
+    __attribute__((target("avx"))) static inline double accumulateMetricAvx(
+            const double *__restrict__ const firstPointBegin,
+            const double *__restrict__ const firstPointEnd,
+            const double *__restrict__ const secondPointBegin) noexcept {
+
+        // Initialize the register that accumulates the partial values
+        __m256d accumulator = _mm256_setzero_pd();
+
+        const double *__restrict__ firstPoint = firstPointBegin;
+        const double *__restrict__ secondPoint = secondPointBegin;
+
+        while (firstPoint != firstPointEnd) {
+            // Accumulate the next 4 coordinates of the two points
+            accumulator = MT::accumulate(
+                    accumulator, _mm256_load_pd(firstPoint), _mm256_load_pd(secondPoint));
+
+            firstPoint += AVX_PACK_SIZE;
+            secondPoint += AVX_PACK_SIZE;
+        }
+
+        // Combine the partial values
+        return MT::reduce(accumulator);
+    }
+
+    /**
+     * Accumulates the specified metric over the attributes of two data samples using AVX
+     * instructions, keeping the partial values in the registers.
+     *
+     * @tparam MT Policy describing the metric.
+     * @param firstPointBegin Pointer to the first attribute of the first data sample.
+     * @param firstPointEnd Pointer to the attribute following the last attribute of the first
+     * data sample. This value acts as a placeholder, and it is used to identify the end of the
+     * first point.
+     * @param secondPointBegin Pointer to the first attribute of the second data sample.
+     * @return The accumulated value of the metric.
+     */
+    template <typename MT>
+    __attribute__((target("avx"))) static inline float accumulateMetricAvx(
+            const float *__restrict__ const firstPointBegin,
+            const float *__restrict__ const firstPointEnd,
+            const float *__restrict__ const secondPointBegin) noexcept {
+
+        // Initialize the register that accumulates the partial values
+        __m256 accumulator = _mm256_setzero_ps();
+
+        const float *__restrict__ firstPoint = firstPointBegin;
+        const float *__restrict__ secondPoint = secondPointBegin;
+
+        while (firstPoint != firstPointEnd) {
+            // Accumulate the next 8 coordinates of the two points
+            accumulator = MT::accumulate(
+                    accumulator, _mm256_load_ps(firstPoint), _mm256_load_ps(secondPoint));
+
+            firstPoint += AVX_FLOAT_PACK_SIZE;
+            secondPoint += AVX_FLOAT_PACK_SIZE;
+        }
+
+        // Combine the partial values
+        return MT::reduce(accumulator);
+    }
+
+    /**
+     * Adds to the dendrogram the new point.
+     *
+     * @tparam P Type of the data structure/iterator holding <code>pi</code>.
+     * @tparam L Type of the data structure/iterator holding <code>lambda</code>.
+     * @tparam EP Type of the efficient iterator iterating over <code>pi</code>.
+     * @tparam EL Type of the efficient iterator iterating over <code>lambda</code>.
+     * @tparam S Type of the values held by <code>m</code>.
+     * @param piBegin Efficient iterator pointing to the first element of <code>pi</code>.
+     * @param lambdaBegin Efficient iterator pointing to the first element of <code>lambda</code>.
+     * @param mBegin Pointer pointing to the first element of <code>m</code>.
+     * @param mEnd Pointer pointing to the element <code>m[n]</code>. This value acts as a
+     * placeholder, and it is used to identify the last element of <code>m</code> that contains a
+     * valid distance.
+     * @param n Index of the point to add.
+     */
+    template <typename P, typename L, typename EP, typename EL, typename S>
+    static inline void addNewPoint(EP piBegin,
+                                   EL lambdaBegin,
+                                   S *__restrict__ const mBegin,
+                                   const S *__restrict__ const mEnd,
+                                   const std::size_t n) {
+
+        // Pointer used as iterator to iterate over m
+        const S *distanceIterator = mBegin;
+
+        // Iterate all the valid distances in m
+        while (distanceIterator != mEnd) {
+            // Reference to pi[i]
+            utils::PiElement<P> &piI =
+                    PiLambdaIteratorUtils::getCurrentElement<utils::PiElement<P>, P>(piBegin);
+            // Reference to lambda[i]
+            double &lambdaI = PiLambdaIteratorUtils::getCurrentElement<double, L>(lambdaBegin);
+            // Value of m[i]
+            const S currentDistance = *distanceIterator;
+            // Reference to m[pi[i]]
+            S &mPiI = mBegin[piI];
+
+            // **** if lambda(i) >= M(i) ****
+            if (lambdaI >= static_cast<double>(currentDistance)) {
+                // **** set M(pi(i)) to min { M(pi(i)), lambda(i) } ****
+                // lambda(i) has been copied from m, so it is exactly representable as an S
+                mPiI = std::min(mPiI, static_cast<S>(lambdaI));
+                // **** set lambda(i) to M(i) ****
+                lambdaI = static_cast<double>(currentDistance);
+
+                // **** set pi(i) to n + 1 ****
+                piI = static_cast<utils::PiElement<P>>(n);
+            } else {  // **** if lambda(i) < M(i) ****
+                // **** set M(pi(i)) to min { M(pi(i)), M(i) } ****
+                mPiI = std::min(mPiI, currentDistance);
+            }
+            // Move to the next element
+            PiLambdaIteratorUtils::moveNext<utils::PiElement<P>, P>(piBegin);
+            PiLambdaIteratorUtils::moveNext<double, L>(lambdaBegin);
+            ++distanceIterator;
+        }
+    }
+
+    /**
+     * Fixes the structure of the dendrogram by updating the representative of a point if its
+     * representative connects to the newly added point before connecting to the point.
+     *
+     * @tparam P Type of the data structure/iterator holding <code>pi</code>.
+     * @tparam L Type of the data structure/iterator holding <code>lambda</code>.
+     * @tparam EP Type of the efficient iterator iterating over <code>pi</code>.
+     * @tparam EL Type of the efficient iterator iterating over <code>lambda</code>.
+     * @param piBegin Efficient iterator pointing to the first element of <code>pi</code>.
+     * @param lambdaBegin Efficient iterator pointing to the first element of <code>lambda</code>.
+     * @param n Index of the newly added point.
+     * @param structuralFixThreadsCount Number of threads to use to execute the structural fix in
+     * parallel.
+     */
+    template <typename P, typename L, typename EP, typename EL>
+    static inline void fixStructure(const EP &piBegin,
+                                    const EL &lambdaBegin,
+                                    const std::size_t n,
+                                    const std::size_t structuralFixThreadsCount) {
+
+        // Loop over all the previously added points
+#pragma omp parallel for default(none) shared(n, piBegin, lambdaBegin) \
+        num_threads(structuralFixThreadsCount) if (PF)
+        for (std::size_t i = 0; i <= n - 1; i++) {
+            fixRepresentative<P, L>(piBegin, lambdaBegin, i, n);
+        }
+    }
+
+    /**
+     * Updates the representative of the specified point if its current representative connects
+     * to the newly added point before connecting to the point.
+     *
+     * @tparam P Type of the data structure/iterator holding <code>pi</code>.
+     * @tparam L Type of the data structure/iterator holding <code>lambda</code>.
+     * @tparam EP Type of the efficient iterator iterating over <code>pi</code>.
+     * @tparam EL Type of the efficient iterator iterating over <code>lambda</code>.
+     * @param piBegin Efficient iterator pointing to the first element of <code>pi</code>.
+     * @param lambdaBegin Efficient iterator pointing to the first element of <code>lambda</code>.
+     * @param i Index of the point whose representative may be updated.
+     * @param n Index of the newly added point.
+     */
+    template <typename P, typename L, typename EP, typename EL>
+    static inline void fixRepresentative(const EP &piBegin,
+                                         const EL &lambdaBegin,
+                                         const std::size_t i,
+                                         const std::size_t n) {
+
+        // Reference to pi[i]
+        utils::PiElement<P> &piI =
+                PiLambdaIteratorUtils::getElementAt<utils::PiElement<P>, P>(piBegin, i);
+        // Value of lambda[i]
+        const double lambdaI = PiLambdaIteratorUtils::getElementAt<double, L>(lambdaBegin, i);
+        // Value of lambda[pi[i]]
+        const double lambdaPiI = PiLambdaIteratorUtils::getElementAt<double, L>(lambdaBegin, piI);
+
+        // **** if lambda(i) >= lambda(pi(i)) ****
+        if (lambdaI >= lambdaPiI) {
+            // **** set pi(i) to n + 1 ****
+            piI = static_cast<utils::PiElement<P>>(n);
+        }
+    }
+
+    /**
+     * Computes the Euclidean distance between two points.
+     *
+     * @param firstPointBegin Pointer to the first attribute of the first data sample.
+     * @param firstPointEnd Pointer to the attribute following the last attribute of the first
+     * data sample. This value acts as a placeholder, and it is used to identify the end of the
+     * first point.
+     * @param secondPointBegin Pointer to the first attribute of the second data sample.
+     * @return The distance between the two points.
+     */
+    static inline double distance(const double *__restrict__ const firstPointBegin,
+                                  const double *__restrict__ const firstPointEnd,
+                                  const double *__restrict__ const secondPointBegin) noexcept {
+
+        double sum = 0;
+        const double *__restrict__ firstPoint = firstPointBegin;
+        const double *__restrict__ secondPoint = secondPointBegin;
+
+        while (firstPoint != firstPointEnd) {
+            sum += pow(*firstPoint - *secondPoint, 2.0);
+            firstPoint++;
+            secondPoint++;
+        }
+
+        return sqrt(sum);
+    }
+
+    /**
+     * Computes the distance between two points using SSE instructions.
+     *
+     * @param firstPointBegin Pointer to the first attribute of the first data sample.
+     * @param firstPointEnd Pointer to the attribute following the last attribute of the first
+     * data sample. This value acts as a placeholder, and it is used to identify the end of the
+     * first point.
+     * @param secondPointBegin Pointer to the first attribute of the second data sample.
+     * @return The distance between the two points.
+     */
+    __attribute__((target("sse3"))) static inline double distanceSse(
+            const double *__restrict__ const firstPointBegin,
+            const double *__restrict__ const firstPointEnd,
+            const double *__restrict__ const secondPointBegin) noexcept {
+
+        // Initialize the partial sum of squares
+        double sum = 0;
+
+        const double *__restrict__ firstPoint = firstPointBegin;
+        const double *__restrict__ secondPoint = secondPointBegin;
+
+        while (firstPoint != firstPointEnd) {
+            // Load the next 2 coordinates of the first point into an SSE register
+            __m128d dataI = _mm_load_pd(firstPoint);
+            // Load the next 2 coordinates of the second point into an SSE register
+            __m128d dataN = _mm_load_pd(secondPoint);
+
+            // Compute the pairwise differences
+            __m128d difference = _mm_sub_pd(dataI, dataN);
+            // Compute the square of two differences
+            __m128d square = _mm_mul_pd(difference, difference);
+
+            // Update the partial sum
+            sum += _mm_hadd_pd(square, square)[0];
+
+            firstPoint += SSE_PACK_SIZE;
+            secondPoint += SSE_PACK_SIZE;
+        }
+
+        // Compute the square root of the partial sum
+        return sqrt(sum);
+    }
+
+    /**
+     * Computes the distance between two points using SSE instructions. This implementation keeps
+     * the partial sum in the registers instead of storing it into memory.
+     *
+     * @param firstPointBegin Pointer to the first attribute of the first data sample.
+     * @param firstPointEnd Pointer to the attribute following the last attribute of the first
+     * data sample. This value acts as a placeholder, and it is used to identify the end of the
+     * first point.
+     * @param secondPointBegin Pointer to the first attribute of the second data sample.
+     * @return The distance between the two points.
+     */
+    __attribute__((target("sse3"))) static inline double distanceSseOptimized(
+            const double *__restrict__ const firstPointBegin,
+            const double *__restrict__ const firstPointEnd,
+            const double *__restrict__ const secondPointBegin) noexcept {
+
+        // Initialize the register that accumulates the partial sum of squares
+        __m128d accumulator = _mm_setzero_pd();
+
+        const double *__restrict__ firstPoint = firstPointBegin;
+        const double *__restrict__ secondPoint = secondPointBegin;
+
+        while (firstPoint != firstPointEnd) {
+            // Load the next 2 coordinates of the first point into an SSE register
+            __m128d dataI = _mm_load_pd(firstPoint);
+            // Load the next 2 coordinates of the second point into an SSE register
+            __m128d dataN = _mm_load_pd(secondPoint);
+
+            // Compute the pairwise differences
+            __m128d difference = _mm_sub_pd(dataI, dataN);
+            // Compute the square of two differences
+            __m128d square = _mm_mul_pd(difference, difference);
+
+            // Update the partial sum
+            accumulator = _mm_add_pd(accumulator, square);
+
+            firstPoint += SSE_PACK_SIZE;
+            secondPoint += SSE_PACK_SIZE;
+        }
+
+        // Compute the final partial sum
+        __m128d horizontalSum = _mm_hadd_pd(accumulator, accumulator);
+
+        // Compute the square root of the final partial sum
+        return sqrt(horizontalSum[0]);
+    }
+
+    /**
+     * Computes the square of the distance between two points using SSE instructions. This
+     * implementation keeps the partial sum in the registers instead of storing it into memory.
+     *
+     * @param firstPointBegin Pointer to the first attribute of the first data sample.
+     * @param firstPointEnd Pointer to the attribute following the last attribute of the first
+     * data sample. This value acts as a placeholder, and it is used to identify the end of the
+     * first point.
+     * @param secondPointBegin Pointer to the first attribute of the second data sample.
+     * @return The distance between the two points.
+     */
+    __attribute__((target("sse3"))) static inline double distanceSseOptimizedNoSquareRoot(
+            const double *__restrict__ const firstPointBegin,
+            const double *__restrict__ const firstPointEnd,
+            const double *__restrict__ const secondPointBegin) noexcept {
+
+        // Initialize the register that accumulates the partial sum of squares
+        __m128d accumulator = _mm_setzero_pd();
+
+        const double *__restrict__ firstPoint = firstPointBegin;
+        const double *__restrict__ secondPoint = secondPointBegin;
+
+        while (firstPoint != firstPointEnd) {
+            // Load the next 2 coordinates of the first point into an SSE register
+            __m128d dataI = _mm_load_pd(firstPoint);
+            // Load the next 2 coordinates of the second point into an SSE register
+            __m128d dataN = _mm_load_pd(secondPoint);
+
+            // Compute the pairwise differences
+            __m128d difference = _mm_sub_pd(dataI, dataN);
+            // Compute the square of two differences
+            __m128d square = _mm_mul_pd(difference, difference);
+
+            // Update the partial sum
+            accumulator = _mm_add_pd(accumulator, square);
+
+            firstPoint += SSE_PACK_SIZE;
+            secondPoint += SSE_PACK_SIZE;
+        }
+
+        // Compute the final partial sum
+        __m128d horizontalSum = _mm_hadd_pd(accumulator, accumulator);
+
+        // Return the partial sum of squares
+        return horizontalSum[0];
+    }
+
+    /**
+     * Computes the distance between two points using AVX instructions.
+     *
+     * @param firstPointBegin Pointer to the first attribute of the first data sample.
+     * @param firstPointEnd Pointer to the attribute following the last attribute of the first
+     * data sample. This value acts as a placeholder, and it is used to identify the end of the
+     * first point.
+     * @param secondPointBegin Pointer to the first attribute of the second data sample.
+     * @return The distance between the two points.
+     */
+    __attribute__((target("avx"))) static inline double distanceAvx(
+            const double *__restrict__ const firstPointBegin,
+            const double *__restrict__ const firstPointEnd,
+            const double *__restrict__ const secondPointBegin) noexcept {
+
+        // Initialize the partial sum of squares
+        double sum = 0;
+
+        const double *__restrict__ firstPoint = firstPointBegin;
+        const double *__restrict__ secondPoint = secondPointBegin;
+
+        while (firstPoint != firstPointEnd) {
+            // Load the next 4 coordinates of the first point into an AVX register
+            __m256d dataI = _mm256_load_pd(firstPoint);
+            // Load the next 4 coordinates of the second point into an AVX register
+            __m256d dataN = _mm256_load_pd(secondPoint);
+
+            // Compute the pairwise differences
+            __m256d difference = _mm256_sub_pd(dataI, dataN);
+            // Compute the square of two differences
+            __m256d square = _mm256_mul_pd(difference, difference);
+
+            // Sum adjacent double values, i.e., it sums the first value with the second, and stores
+            // the result in the upper 128 bits of the register, and then it sums the third value
+            // with the fourth, and stores the result in the lower 128 bits of the register
+            __m256d squaresSum = _mm256_hadd_pd(square, square);
+
+            // Extract the upper 128 bits of the register
+            __m128d highBits = _mm256_extractf128_pd(squaresSum, 1);
+            // Extract the lower 128 bits of the register
+            __m128d lowBits = _mm256_castpd256_pd128(squaresSum);
+            // Sum the upper 128 bits to the lower 128 ones, and then update the partial sum
+            sum += _mm_add_pd(highBits, lowBits)[0];
+
+            firstPoint += AVX_PACK_SIZE;
+            secondPoint += AVX_PACK_SIZE;
+        }
+
+        // Compute the square root of the partial sum
+        return sqrt(sum);
+    }
+
+    /**
+     * Computes the distance between two points using AVX instructions. This implementation keeps
+     * the partial sum in the registers instead of storing it into memory.
+     *
+     * @param firstPointBegin Pointer to the first attribute of the first data sample.
+     * @param firstPointEnd Pointer to the attribute following the last attribute of the first
+     * data sample. This value acts as a placeholder, and it is used to identify the end of the
+     * first point.
+     * @param secondPointBegin Pointer to the first attribute of the second data sample.
+     * @return The distance between the two points.
      */
-    template <typename P, typename L, typename EP, typename EL>
-    static inline void addNewPoint(EP piBegin,
-                                   EL lambdaBegin,
-                                   double *__restrict__ const mBegin,
-                                   const double *__restrict__ const mEnd,
-                                   const std::size_t n) {
+    __attribute__((target("avx"))) static inline double distanceAvxOptimized(
+            const double *__restrict__ const firstPointBegin,
+            const double *__restrict__ const firstPointEnd,
+            const double *__restrict__ const secondPointBegin) noexcept {
 
-        // Pointer used as iterator to iterate over m
-        const double *distanceIterator = mBegin;
+        // Initialize the register that accumulates the partial sum of squares
+        __m256d accumulator = _mm256_setzero_pd();
 
-        // Iterate all the valid distances in m
-        while (distanceIterator != mEnd) {
-            // Reference to pi[i]
-            std::size_t &piI = PiLambdaIteratorUtils::getCurrentElement<std::size_t, P>(piBegin);
-            // Reference to lambda[i]
-            double &lambdaI = PiLambdaIteratorUtils::getCurrentElement<double, L>(lambdaBegin);
-            // Value of m[i]
-            const double currentDistance = *distanceIterator;
-            // Reference to m[pi[i]]
-            double &mPiI = mBegin[piI];
+        const double *__restrict__ firstPoint = firstPointBegin;
+        const double *__restrict__ secondPoint = secondPointBegin;
 
-            // **** if lambda(i) >= M(i) ****
-            if (lambdaI >= currentDistance) {
-                // **** set M(pi(i)) to min { M(pi(i)), lambda(i) } ****
-                mPiI = std::min(mPiI, lambdaI);
-                // **** set lambda(i) to M(i) ****
-                lambdaI = currentDistance;
+        while (firstPoint != firstPointEnd) {
+            // Load the next 4 coordinates of the first point into an AVX register
+            __m256d dataI = _mm256_load_pd(firstPoint);
+            // Load the next 4 coordinates of the second point into an AVX register
+            __m256d dataN = _mm256_load_pd(secondPoint);
 
-                // **** set pi(i) to n + 1 ****
-                piI = n;
-            } else {  // **** if lambda(i) < M(i) ****
-                // **** set M(pi(i)) to min { M(pi(i)), M(i) } ****
-                mPiI = std::min(mPiI, currentDistance);
+            // Compute the pairwise differences
+            __m256d difference = _mm256_sub_pd(dataI, dataN);
+            // Compute the square of two differences
+            __m256d square = _mm256_mul_pd(difference, difference);
+
+            // Update the partial sum
+            accumulator = _mm256_add_pd(accumulator, square);
+
+            firstPoint += AVX_PACK_SIZE;
+            secondPoint += AVX_PACK_SIZE;
+        }
+
+        // Sum adjacent double values, i.e., it sums the first value with the second, and stores
+        // the result in the upper 128 bits of the register, and then it sums the third value
+        // with the fourth, and stores the result in the lower 128 bits of the register
+        __m256d horizontalSum = _mm256_hadd_pd(accumulator, accumulator);
+
+        // Extract the upper 128 bits of the register
+        __m128d highBits = _mm256_extractf128_pd(horizontalSum, 1);
+        // Extract the lower 128 bits of the register
+        __m128d lowBits = _mm256_castpd256_pd128(horizontalSum);
+
+        // Sum the upper 128 bits to the lower 128 ones, and then return the square root of the
+        // resulting sum
+        return sqrt(_mm_add_pd(highBits, lowBits)[0]);
+    }
+
+    /**
+     * Computes the square the distance between two points using AVX instructions. This
+     * implementation keeps the partial sum in the registers instead of storing it into memory.
+     *
+     * @param firstPointBegin Pointer to the first attribute of the first data sample.
+     * @param firstPointEnd Pointer to the attribute following the last attribute of the first
+     * data sample. This value acts as a placeholder, and it is used to identify the end of the
+     * first point.
+     * @param secondPointBegin Pointer to the first attribute of the second data sample.
+     * @return The distance between the two points.
+     */
+    __attribute__((target("avx"))) static inline double distanceAvxOptimizedNoSquareRoot(
+            const double *__restrict__ const firstPointBegin,
+            const double *__restrict__ const firstPointEnd,
+            const double *__restrict__ const secondPointBegin) noexcept {
+
+        // Initialize the register that accumulates the partial sum of squares
+        __m256d accumulator = _mm256_setzero_pd();
+
+        const double *__restrict__ firstPoint = firstPointBegin;
+        const double *__restrict__ secondPoint = secondPointBegin;
+
+        while (firstPoint != firstPointEnd) {
+            // Load the next 4 coordinates of the first point into an AVX register
+            __m256d dataI = _mm256_load_pd(firstPoint);
+            // Load the next 4 coordinates of the second point into an AVX register
+            __m256d dataN = _mm256_load_pd(secondPoint);
+
+            // Compute the pairwise differences
+            __m256d difference = _mm256_sub_pd(dataI, dataN);
+            // Compute the square of two differences
+            __m256d square = _mm256_mul_pd(difference, difference);
+
+            // Update the partial sum
+            accumulator = _mm256_add_pd(accumulator, square);
+
+            firstPoint += AVX_PACK_SIZE;
+            secondPoint += AVX_PACK_SIZE;
+        }
+
+        // Sum adjacent double values, i.e., it sums the first value with the second, and stores
+        // the result in the upper 128 bits of the register, and then it sums the third value
+        // with the fourth, and stores the result in the lower 128 bits of the register
+        __m256d horizontalSum = _mm256_hadd_pd(accumulator, accumulator);
+
+        // Extract the upper 128 bits of the register
+        __m128d highBits = _mm256_extractf128_pd(horizontalSum, 1);
+        // Extract the lower 128 bits of the register
+        __m128d lowBits = _mm256_castpd256_pd128(horizontalSum);
+
+        // Sum the upper 128 bits to the lower 128 ones, and then return the resulting sum
+        return _mm_add_pd(highBits, lowBits)[0];
+    }
+
+    /**
+     * Computes the distance between two points using AVX and FMA instructions. This
+     * implementation keeps <code>FMA_ACCUMULATORS_COUNT</code> independent partial sums in the
+     * registers, and updates them using fused multiply-add instructions.<br>
+     * This method is always compiled with the AVX and FMA instructions enabled, regardless of the
+     * options given to the compiler.
+     *
+     * @param firstPointBegin Pointer to the first attribute of the first data sample.
+     * @param firstPointEnd Pointer to the attribute following the last attribute of the first
+     * data sample. This value acts as a placeholder, and it is used to identify the end of the
+     * first point.
+     * @param secondPointBegin Pointer to the first attribute of the second data sample.
+     * @return The distance between the two points.
+     */
+    __attribute__((target("avx,fma"))) static inline double distanceAvxFma(
+            const double *__restrict__ const firstPointBegin,
+            const double *__restrict__ const firstPointEnd,
+            const double *__restrict__ const secondPointBegin) noexcept {
+
+        // Compute the square root of the sum of squares
+        return sqrt(ParallelClustering::distanceAvxFmaNoSquareRoot(
+                firstPointBegin, firstPointEnd, secondPointBegin));
+    }
+
+    /**
+     * Computes the square of the distance between two points using AVX and FMA instructions.<br>
+     * Since each fused multiply-add instruction must wait for the previous one that updates the
+     * same partial sum, this implementation processes <code>FMA_ACCUMULATORS_COUNT</code> packs
+     * at a time, each of them updating a different partial sum. The remaining packs are
+     * accumulated into the first partial sum, and all the partial sums are added at the end.<br>
+     * This method is always compiled with the AVX and FMA instructions enabled, regardless of the
+     * options given to the compiler.
+     *
+     * @param firstPointBegin Pointer to the first attribute of the first data sample.
+     * @param firstPointEnd Pointer to the attribute following the last attribute of the first
+     * data sample. This value acts as a placeholder, and it is used to identify the end of the
+     * first point.
+     * @param secondPointBegin Pointer to the first attribute of the second data sample.
+     * @return The square of the distance between the two points.
+     */
+    __attribute__((target("avx,fma"))) static inline double distanceAvxFmaNoSquareRoot(
+            const double *__restrict__ const firstPointBegin,
+            const double *__restrict__ const firstPointEnd,
+            const double *__restrict__ const secondPointBegin) noexcept {
+
+        const constexpr std::size_t unrolledSize = FMA_ACCUMULATORS_COUNT * AVX_PACK_SIZE;
+
+        // Initialize the registers that accumulate the partial sums of squares
+        __m256d firstAccumulator = _mm256_setzero_pd();
+        __m256d secondAccumulator = _mm256_setzero_pd();
+        __m256d thirdAccumulator = _mm256_setzero_pd();
+        __m256d fourthAccumulator = _mm256_setzero_pd();
+
+        const double *__restrict__ firstPoint = firstPointBegin;
+        const double *__restrict__ secondPoint = secondPointBegin;
+        // Pointer to the first attribute of the first point that does not fill a whole group of
+        // packs
+        const double *const unrolledEnd =
+                firstPointBegin +
+                static_cast<std::size_t>(firstPointEnd - firstPointBegin) / unrolledSize *
+                        unrolledSize;
+
+        while (firstPoint != unrolledEnd) {
+            // Compute the pairwise differences of the next 16 coordinates
+            const __m256d firstDifference =
+                    _mm256_sub_pd(_mm256_load_pd(firstPoint), _mm256_load_pd(secondPoint));
+            const __m256d secondDifference =
+                    _mm256_sub_pd(_mm256_load_pd(firstPoint + AVX_PACK_SIZE),
+                                  _mm256_load_pd(secondPoint + AVX_PACK_SIZE));
+            const __m256d thirdDifference =
+                    _mm256_sub_pd(_mm256_load_pd(firstPoint + 2 * AVX_PACK_SIZE),
+                                  _mm256_load_pd(secondPoint + 2 * AVX_PACK_SIZE));
+            const __m256d fourthDifference =
+                    _mm256_sub_pd(_mm256_load_pd(firstPoint + 3 * AVX_PACK_SIZE),
+                                  _mm256_load_pd(secondPoint + 3 * AVX_PACK_SIZE));
+
+            // Square them and update the partial sums
+            firstAccumulator = _mm256_fmadd_pd(firstDifference, firstDifference, firstAccumulator);
+            secondAccumulator =
+                    _mm256_fmadd_pd(secondDifference, secondDifference, secondAccumulator);
+            thirdAccumulator = _mm256_fmadd_pd(thirdDifference, thirdDifference, thirdAccumulator);
+            fourthAccumulator =
+                    _mm256_fmadd_pd(fourthDifference, fourthDifference, fourthAccumulator);
+
+            firstPoint += unrolledSize;
+            secondPoint += unrolledSize;
+        }
+
+        // Process the remaining packs
+        while (firstPoint != firstPointEnd) {
+            const __m256d difference =
+                    _mm256_sub_pd(_mm256_load_pd(firstPoint), _mm256_load_pd(secondPoint));
+            firstAccumulator = _mm256_fmadd_pd(difference, difference, firstAccumulator);
+
+            firstPoint += AVX_PACK_SIZE;
+            secondPoint += AVX_PACK_SIZE;
+        }
+
+        // Add the partial sums
+        const __m256d accumulator =
+                _mm256_add_pd(_mm256_add_pd(firstAccumulator, secondAccumulator),
+                              _mm256_add_pd(thirdAccumulator, fourthAccumulator));
+
+        // Sum the 4 values in the register, and then return the resulting sum
+        __m256d horizontalSum = _mm256_hadd_pd(accumulator, accumulator);
+        return _mm_add_pd(_mm256_extractf128_pd(horizontalSum, 1),
+                          _mm256_castpd256_pd128(horizontalSum))[0];
+    }
+
+    /**
+     * Computes the squares of the distances between a point and
+     * <code>AVX_PACK_SIZE</code> points stored in a block whose attributes are interleaved, using
+     * AVX instructions.<br>
+     * Each attribute of the point is broadcast to all the lanes of an AVX register, and it is
+     * subtracted from the same attribute of all the points of the block at once. Hence, each lane
+     * accumulates the square of the distance from a different point, and no horizontal sum is
+     * needed.
+     *
+     * @param blockBegin Pointer to the first attribute of the block.
+     * @param blockEnd Pointer to the attribute following the last attribute of the block. This
+     * value acts as a placeholder, and it is used to identify the end of the block.
+     * @param point Pointer to the first attribute of the point. The following attributes of the
+     * point are <code>AVX_PACK_SIZE</code> positions apart from each other.
+     * @param distances Array where the square of the distance between the point and the
+     * <code>k</code>-th point of the block will be stored in <code>distances[k]</code>.
+     */
+    __attribute__((target("avx"))) static inline void distancesAvxInterleavedNoSquareRoot(
+            const double *__restrict__ const blockBegin,
+            const double *__restrict__ const blockEnd,
+            const double *__restrict__ const point,
+            double *__restrict__ const distances) noexcept {
+
+        // Initialize the register that accumulates the partial sums of squares
+        __m256d accumulator = _mm256_setzero_pd();
+
+        const double *__restrict__ attribute = point;
+        for (const double *block = blockBegin; block != blockEnd; block += AVX_PACK_SIZE) {
+            // Subtract the next attribute of the point from the same attribute of all the points
+            // of the block
+            __m256d difference =
+                    _mm256_sub_pd(_mm256_broadcast_sd(attribute), _mm256_load_pd(block));
+            // Compute the square of the differences and update the partial sums
+            accumulator = _mm256_add_pd(accumulator, _mm256_mul_pd(difference, difference));
+
+            attribute += AVX_PACK_SIZE;
+        }
+
+        // Store the partial sums of squares
+        _mm256_storeu_pd(distances, accumulator);
+    }
+
+    /**
+     * Computes the distance between two points using AVX-512 instructions. This implementation
+     * keeps the partial sum in the registers, and handles the last attributes of the points,
+     * which may not fill a whole pack, using a mask. Therefore, the points need neither to be
+     * aligned nor to be padded.<br>
+     * This method is always compiled with the AVX-512 instructions enabled, regardless of the
+     * options given to the compiler.
+     *
+     * @param firstPointBegin Pointer to the first attribute of the first data sample.
+     * @param firstPointEnd Pointer to the attribute following the last attribute of the first
+     * data sample. This value acts as a placeholder, and it is used to identify the end of the
+     * first point.
+     * @param secondPointBegin Pointer to the first attribute of the second data sample.
+     * @return The distance between the two points.
+     */
+    __attribute__((target("avx512f"))) static inline double distanceAvx512(
+            const double *__restrict__ const firstPointBegin,
+            const double *__restrict__ const firstPointEnd,
+            const double *__restrict__ const secondPointBegin) noexcept {
+
+        // Compute the square root of the sum of squares
+        return sqrt(ParallelClustering::distanceAvx512NoSquareRoot(
+                firstPointBegin, firstPointEnd, secondPointBegin));
+    }
+
+    /**
+     * Computes the square of the distance between two points using AVX-512 instructions. This
+     * implementation keeps the partial sum in the registers, and handles the last attributes of
+     * the points, which may not fill a whole pack, using a mask. Therefore, the points need
+     * neither to be aligned nor to be padded.<br>
+     * This method is always compiled with the AVX-512 instructions enabled, regardless of the
+     * options given to the compiler.
+     *
+     * @param firstPointBegin Pointer to the first attribute of the first data sample.
+     * @param firstPointEnd Pointer to the attribute following the last attribute of the first
+     * data sample. This value acts as a placeholder, and it is used to identify the end of the
+     * first point.
+     * @param secondPointBegin Pointer to the first attribute of the second data sample.
+     * @return The distance between the two points.
+     */
+    __attribute__((target("avx512f"))) static inline double distanceAvx512NoSquareRoot(
+            const double *__restrict__ const firstPointBegin,
+            const double *__restrict__ const firstPointEnd,
+            const double *__restrict__ const secondPointBegin) noexcept {
+
+        // Initialize the register that accumulates the partial sum of squares
+        __m512d accumulator = _mm512_setzero_pd();
+
+        const double *__restrict__ firstPoint = firstPointBegin;
+        const double *__restrict__ secondPoint = secondPointBegin;
+
+        // Process all the complete packs
+        while (firstPointEnd - firstPoint >= static_cast<std::ptrdiff_t>(AVX512_PACK_SIZE)) {
+            // Load the next 8 coordinates of the first point into an AVX-512 register
+            __m512d dataI = _mm512_loadu_pd(firstPoint);
+            // Load the next 8 coordinates of the second point into an AVX-512 register
+            __m512d dataN = _mm512_loadu_pd(secondPoint);
+
+            // Compute the pairwise differences
+            __m512d difference = _mm512_sub_pd(dataI, dataN);
+            // Compute the square of the differences and update the partial sum
+            accumulator = _mm512_add_pd(accumulator, _mm512_mul_pd(difference, difference));
+
+            firstPoint += AVX512_PACK_SIZE;
+            secondPoint += AVX512_PACK_SIZE;
+        }
+
+        // Process the remaining coordinates, if any
+        const auto remainingCoordinates = static_cast<unsigned int>(firstPointEnd - firstPoint);
+        if (remainingCoordinates != 0) {
+            // Mask selecting only the remaining coordinates. The masked-out coordinates are not
+            // read from memory, and are set to 0
+            const auto mask = static_cast<__mmask8>((1U << remainingCoordinates) - 1U);
+
+            // Load the remaining coordinates of the first point into an AVX-512 register
+            __m512d dataI = _mm512_maskz_loadu_pd(mask, firstPoint);
+            // Load the remaining coordinates of the second point into an AVX-512 register
+            __m512d dataN = _mm512_maskz_loadu_pd(mask, secondPoint);
+
+            // Compute the pairwise differences
+            __m512d difference = _mm512_sub_pd(dataI, dataN);
+            // Compute the square of the differences and update the partial sum
+            accumulator = _mm512_add_pd(accumulator, _mm512_mul_pd(difference, difference));
+        }
+
+        // Sum the upper 256 bits of the register to the lower 256 ones. The halves are extracted
+        // with a mask selecting all the lanes, since the unmasked extraction merges them into an
+        // undefined register
+        const auto allLanes = static_cast<__mmask8>(0xFFU);
+        const __m256d halvesSum =
+                _mm256_add_pd(_mm512_maskz_extractf64x4_pd(allLanes, accumulator, 1),
+                              _mm512_maskz_extractf64x4_pd(allLanes, accumulator, 0));
+
+        // Sum adjacent double values, and then the upper 128 bits to the lower 128 ones
+        const __m256d horizontalSum = _mm256_hadd_pd(halvesSum, halvesSum);
+        return _mm_cvtsd_f64(_mm_add_pd(_mm256_extractf128_pd(horizontalSum, 1),
+                                        _mm256_castpd256_pd128(horizontalSum)));
+    }
+
+    /**
+     * Computes the dot product between two points using AVX and FMA instructions. This
+     * implementation keeps the partial sum in the registers instead of storing it into memory.<br>
+     * This method is always compiled with the AVX and FMA instructions enabled, regardless of the
+     * options given to the compiler.
+     *
+     * @param firstPointBegin Pointer to the first attribute of the first data sample.
+     * @param firstPointEnd Pointer to the attribute following the last attribute of the first
+     * data sample. This value acts as a placeholder, and it is used to identify the end of the
+     * first point.
+     * @param secondPointBegin Pointer to the first attribute of the second data sample.
+     * @return The dot product between the two points.
+     */
+    __attribute__((target("avx,fma"))) static inline double dotProductAvxFma(
+            const double *__restrict__ const firstPointBegin,
+            const double *__restrict__ const firstPointEnd,
+            const double *__restrict__ const secondPointBegin) noexcept {
+
+        // Initialize the register that accumulates the partial sum of products
+        __m256d accumulator = _mm256_setzero_pd();
+
+        const double *__restrict__ firstPoint = firstPointBegin;
+        const double *__restrict__ secondPoint = secondPointBegin;
+
+        while (firstPoint != firstPointEnd) {
+            // Multiply the next 4 coordinates of the points, and update the partial sum
+            accumulator = _mm256_fmadd_pd(
+                    _mm256_load_pd(firstPoint), _mm256_load_pd(secondPoint), accumulator);
+
+            firstPoint += AVX_PACK_SIZE;
+            secondPoint += AVX_PACK_SIZE;
+        }
+
+        // Sum the 4 values in the register, and then return the resulting sum
+        __m256d horizontalSum = _mm256_hadd_pd(accumulator, accumulator);
+        return _mm_add_pd(_mm256_extractf128_pd(horizontalSum, 1),
+                          _mm256_castpd256_pd128(horizontalSum))[0];
+    }
+
+    /**
+     * Computes the dot products between a point and <code>BLOCK_SIZE</code> other points using
+     * AVX and FMA instructions.<br>
+     * Each group of coordinates of the point is loaded only once, and it is multiplied by the
+     * corresponding coordinates of all the other points, keeping one partial sum per point in the
+     * registers, like the micro-kernel of a matrix product.<br>
+     * This method is always compiled with the AVX and FMA instructions enabled, regardless of the
+     * options given to the compiler.
+     *
+     * @param blockPoints Pointers to the first attribute of each of the other points.
+     * @param pointBegin Pointer to the first attribute of the point.
+     * @param pointEnd Pointer to the attribute following the last attribute of the point. This
+     * value acts as a placeholder, and it is used to identify the end of the point.
+     * @param dotProducts Array where the dot product between the point and
+     * <code>blockPoints[k]</code> will be stored in <code>dotProducts[k]</code>.
+     */
+    __attribute__((target("avx,fma"))) static inline void dotProductsAvxFma(
+            const std::array<const double *, BLOCK_SIZE> &blockPoints,
+            const double *__restrict__ const pointBegin,
+            const double *__restrict__ const pointEnd,
+            std::array<double, BLOCK_SIZE> &dotProducts) noexcept {
+
+        // Initialize the registers that accumulate the partial sums of products
+        // NOLINTNEXTLINE(cppcoreguidelines-avoid-c-arrays, modernize-avoid-c-arrays)
+        __m256d accumulators[BLOCK_SIZE];
+        for (std::size_t k = 0; k < BLOCK_SIZE; k++) {
+            accumulators[k] = _mm256_setzero_pd();
+        }
+
+        for (const double *point = pointBegin; point != pointEnd; point += AVX_PACK_SIZE) {
+            // Load the next 4 coordinates of the point into an AVX register
+            const __m256d data = _mm256_load_pd(point);
+            // Offset of the coordinates from the beginning of the point
+            const std::ptrdiff_t offset = point - pointBegin;
+
+            // Multiply them by the corresponding coordinates of the other points, and update the
+            // partial sums
+            for (std::size_t k = 0; k < BLOCK_SIZE; k++) {
+                accumulators[k] = _mm256_fmadd_pd(
+                        _mm256_load_pd(blockPoints[k] + offset), data, accumulators[k]);
             }
-            // Move to the next element
-            PiLambdaIteratorUtils::moveNext<std::size_t, P>(piBegin);
-            PiLambdaIteratorUtils::moveNext<double, L>(lambdaBegin);
-            ++distanceIterator;
+        }
+
+        // Sum the 4 values in each register
+        for (std::size_t k = 0; k < BLOCK_SIZE; k++) {
+            __m256d horizontalSum = _mm256_hadd_pd(accumulators[k], accumulators[k]);
+            dotProducts[k] = _mm_add_pd(_mm256_extractf128_pd(horizontalSum, 1),
+                                        _mm256_castpd256_pd128(horizontalSum))[0];
         }
     }
 
     /**
-     * Fixes the structure of the dendrogram by updating the representative of a point if its
-     * representative connects to the newly added point before connecting to the point.
+     * Computes the square of the distance between two points from their squared norms and their
+     * dot product.<br>
+     * If the result is below <code>NORM_EXPANSION_REFINEMENT_THRESHOLD</code> times the sum of
+     * the squared norms, then most of its digits have been lost by the subtraction, and it may
+     * even be negative. In this case, the square of the distance is computed again from the
+     * differences of the coordinates, so that close points are merged at the right height.
      *
-     * @tparam P Type of the data structure/iterator holding <code>pi</code>.
-     * @tparam L Type of the data structure/iterator holding <code>lambda</code>.
-     * @tparam EP Type of the efficient iterator iterating over <code>pi</code>.
-     * @tparam EL Type of the efficient iterator iterating over <code>lambda</code>.
-     * @param piBegin Efficient iterator pointing to the first element of <code>pi</code>.
-     * @param lambdaBegin Efficient iterator pointing to the first element of <code>lambda</code>.
-     * @param n Index of the newly added point.
-     * @param structuralFixThreadsCount Number of threads to use to execute the structural fix in
-     * parallel.
+     * @param firstPointBegin Pointer to the first attribute of the first data sample.
+     * @param firstPointEnd Pointer to the attribute following the last attribute of the first
+     * data sample. This value acts as a placeholder, and it is used to identify the end of the
+     * first point.
+     * @param secondPointBegin Pointer to the first attribute of the second data sample.
+     * @param firstNorm Squared norm of the first data sample.
+     * @param secondNorm Squared norm of the second data sample.
+     * @param dotProduct Dot product between the two data samples.
+     * @return The square of the distance between the two points.
      */
-    template <typename P, typename L, typename EP, typename EL>
-    static inline void fixStructure(const EP &piBegin,
-                                    const EL &lambdaBegin,
-                                    const std::size_t n,
-                                    const std::size_t structuralFixThreadsCount) {
-
-        // Loop over all the previously added points
-#pragma omp parallel for default(none) shared(n, piBegin, lambdaBegin) \
-        num_threads(structuralFixThreadsCount) if (PF)
-        for (std::size_t i = 0; i <= n - 1; i++) {
-            // Reference to pi[i]
-            std::size_t &piI = PiLambdaIteratorUtils::getElementAt<std::size_t, P>(piBegin, i);
-            // Value of lambda[i]
-            const double lambdaI = PiLambdaIteratorUtils::getElementAt<double, L>(lambdaBegin, i);
-            // Value of lambda[pi[i]]
-            const double lambdaPiI =
-                    PiLambdaIteratorUtils::getElementAt<double, L>(lambdaBegin, piI);
-
-            // **** if lambda(i) >= lambda(pi(i)) ****
-            if (lambdaI >= lambdaPiI) {
-                // **** set pi(i) to n + 1 ****
-                piI = n;
-            }
+    static inline double expandSquaredDistance(const double *__restrict__ const firstPointBegin,
+                                               const double *__restrict__ const firstPointEnd,
+                                               const double *__restrict__ const secondPointBegin,
+                                               const double firstNorm,
+                                               const double secondNorm,
+                                               const double dotProduct) noexcept {
+
+        const double normsSum = firstNorm + secondNorm;
+        const double squaredDistance = normsSum - 2 * dotProduct;
+        if (squaredDistance < NORM_EXPANSION_REFINEMENT_THRESHOLD * normsSum) {
+            return ParallelClustering::distanceAvxOptimizedNoSquareRoot(
+                    firstPointBegin, firstPointEnd, secondPointBegin);
         }
+        return squaredDistance;
     }
 
     /**
-     * Computes the Euclidean distance between two points.
+     * Computes the Euclidean distance between two points having <code>float</code> attributes.
      *
      * @param firstPointBegin Pointer to the first attribute of the first data sample.
      * @param firstPointEnd Pointer to the attribute following the last attribute of the first
@@ -520,25 +3077,28 @@ private:
      * @param secondPointBegin Pointer to the first attribute of the second data sample.
      * @return The distance between the two points.
      */
-    static inline double distance(const double *__restrict__ const firstPointBegin,
-                                  const double *__restrict__ const firstPointEnd,
-                                  const double *__restrict__ const secondPointBegin) noexcept {
+    static inline float distance(const float *__restrict__ const firstPointBegin,
+                                 const float *__restrict__ const firstPointEnd,
+                                 const float *__restrict__ const secondPointBegin) noexcept {
 
-        double sum = 0;
-        const double *__restrict__ firstPoint = firstPointBegin;
-        const double *__restrict__ secondPoint = secondPointBegin;
+        float sum = 0;
+        const float *__restrict__ firstPoint = firstPointBegin;
+        const float *__restrict__ secondPoint = secondPointBegin;
 
         while (firstPoint != firstPointEnd) {
-            sum += pow(*firstPoint - *secondPoint, 2.0);
+            const float difference = *firstPoint - *secondPoint;
+            sum += difference * difference;
             firstPoint++;
             secondPoint++;
         }
 
-        return sqrt(sum);
+        return std::sqrt(sum);
     }
 
     /**
-     * Computes the distance between two points using SSE instructions.
+     * Computes the distance between two points having <code>float</code> attributes using SSE
+     * instructions. This implementation keeps the partial sum in the registers instead of storing
+     * it into memory.
      *
      * @param firstPointBegin Pointer to the first attribute of the first data sample.
      * @param firstPointEnd Pointer to the attribute following the last attribute of the first
@@ -547,41 +3107,20 @@ private:
      * @param secondPointBegin Pointer to the first attribute of the second data sample.
      * @return The distance between the two points.
      */
-    static inline double distanceSse(const double *__restrict__ const firstPointBegin,
-                                     const double *__restrict__ const firstPointEnd,
-                                     const double *__restrict__ const secondPointBegin) noexcept {
-
-        // Initialize the partial sum of squares
-        double sum = 0;
-
-        const double *__restrict__ firstPoint = firstPointBegin;
-        const double *__restrict__ secondPoint = secondPointBegin;
-
-        while (firstPoint != firstPointEnd) {
-            // Load the next 2 coordinates of the first point into an SSE register
-            __m128d dataI = _mm_load_pd(firstPoint);
-            // Load the next 2 coordinates of the second point into an SSE register
-            __m128d dataN = _mm_load_pd(secondPoint);
-
-            // Compute the pairwise differences
-            __m128d difference = _mm_sub_pd(dataI, dataN);
-            // Compute the square of two differences
-            __m128d square = _mm_mul_pd(difference, difference);
-
-            // Update the partial sum
-            sum += _mm_hadd_pd(square, square)[0];
-
-            firstPoint += SSE_PACK_SIZE;
-            secondPoint += SSE_PACK_SIZE;
-        }
-
-        // Compute the square root of the partial sum
-        return sqrt(sum);
+    __attribute__((target("sse3"))) static inline float distanceSseOptimized(
+            const float *__restrict__ const firstPointBegin,
+            const float *__restrict__ const firstPointEnd,
+            const float *__restrict__ const secondPointBegin) noexcept {
+
+        // Compute the square root of the sum of squares
+        return std::sqrt(ParallelClustering::distanceSseOptimizedNoSquareRoot(
+                firstPointBegin, firstPointEnd, secondPointBegin));
     }
 
     /**
-     * Computes the distance between two points using SSE instructions. This implementation keeps
-     * the partial sum in the registers instead of storing it into memory.
+     * Computes the square of the distance between two points having <code>float</code>
+     * attributes using SSE instructions. This implementation keeps the partial sum in the
+     * registers instead of storing it into memory.
      *
      * @param firstPointBegin Pointer to the first attribute of the first data sample.
      * @param firstPointEnd Pointer to the attribute following the last attribute of the first
@@ -590,45 +3129,44 @@ private:
      * @param secondPointBegin Pointer to the first attribute of the second data sample.
      * @return The distance between the two points.
      */
-    static inline double distanceSseOptimized(
-            const double *__restrict__ const firstPointBegin,
-            const double *__restrict__ const firstPointEnd,
-            const double *__restrict__ const secondPointBegin) noexcept {
+    __attribute__((target("sse3"))) static inline float distanceSseOptimizedNoSquareRoot(
+            const float *__restrict__ const firstPointBegin,
+            const float *__restrict__ const firstPointEnd,
+            const float *__restrict__ const secondPointBegin) noexcept {
 
         // Initialize the register that accumulates the partial sum of squares
-        __m128d accumulator = _mm_setzero_pd();
+        __m128 accumulator = _mm_setzero_ps();
 
-        const double *__restrict__ firstPoint = firstPointBegin;
-        const double *__restrict__ secondPoint = secondPointBegin;
+        const float *__restrict__ firstPoint = firstPointBegin;
+        const float *__restrict__ secondPoint = secondPointBegin;
 
         while (firstPoint != firstPointEnd) {
-            // Load the next 2 coordinates of the first point into an SSE register
-            __m128d dataI = _mm_load_pd(firstPoint);
-            // Load the next 2 coordinates of the second point into an SSE register
-            __m128d dataN = _mm_load_pd(secondPoint);
+            // Load the next 4 coordinates of the first point into an SSE register
+            __m128 dataI = _mm_load_ps(firstPoint);
+            // Load the next 4 coordinates of the second point into an SSE register
+            __m128 dataN = _mm_load_ps(secondPoint);
 
             // Compute the pairwise differences
-            __m128d difference = _mm_sub_pd(dataI, dataN);
-            // Compute the square of two differences
-            __m128d square = _mm_mul_pd(difference, difference);
-
-            // Update the partial sum
-            accumulator = _mm_add_pd(accumulator, square);
+            __m128 difference = _mm_sub_ps(dataI, dataN);
+            // Compute the square of the differences and update the partial sum
+            accumulator = _mm_add_ps(accumulator, _mm_mul_ps(difference, difference));
 
-            firstPoint += SSE_PACK_SIZE;
-            secondPoint += SSE_PACK_SIZE;
+            firstPoint += SSE_FLOAT_PACK_SIZE;
+            secondPoint += SSE_FLOAT_PACK_SIZE;
         }
 
-        // Compute the final partial sum
-        __m128d horizontalSum = _mm_hadd_pd(accumulator, accumulator);
+        // Sum adjacent values twice, so that the first value holds the sum of all the four
+        __m128 horizontalSum = _mm_hadd_ps(accumulator, accumulator);
+        horizontalSum = _mm_hadd_ps(horizontalSum, horizontalSum);
 
-        // Compute the square root of the final partial sum
-        return sqrt(horizontalSum[0]);
+        // Return the partial sum of squares
+        return _mm_cvtss_f32(horizontalSum);
     }
 
     /**
-     * Computes the square of the distance between two points using SSE instructions. This
-     * implementation keeps the partial sum in the registers instead of storing it into memory.
+     * Computes the distance between two points having <code>float</code> attributes using AVX
+     * instructions. This implementation keeps the partial sum in the registers instead of storing
+     * it into memory.
      *
      * @param firstPointBegin Pointer to the first attribute of the first data sample.
      * @param firstPointEnd Pointer to the attribute following the last attribute of the first
@@ -637,44 +3175,71 @@ private:
      * @param secondPointBegin Pointer to the first attribute of the second data sample.
      * @return The distance between the two points.
      */
-    static inline double distanceSseOptimizedNoSquareRoot(
-            const double *__restrict__ const firstPointBegin,
-            const double *__restrict__ const firstPointEnd,
-            const double *__restrict__ const secondPointBegin) noexcept {
+    __attribute__((target("avx"))) static inline float distanceAvxOptimized(
+            const float *__restrict__ const firstPointBegin,
+            const float *__restrict__ const firstPointEnd,
+            const float *__restrict__ const secondPointBegin) noexcept {
+
+        // Compute the square root of the sum of squares
+        return std::sqrt(ParallelClustering::distanceAvxOptimizedNoSquareRoot(
+                firstPointBegin, firstPointEnd, secondPointBegin));
+    }
+
+    /**
+     * Computes the square of the distance between two points having <code>float</code>
+     * attributes using AVX instructions. This implementation keeps the partial sum in the
+     * registers instead of storing it into memory.
+     *
+     * @param firstPointBegin Pointer to the first attribute of the first data sample.
+     * @param firstPointEnd Pointer to the attribute following the last attribute of the first
+     * data sample. This value acts as a placeholder, and it is used to identify the end of the
+     * first point.
+     * @param secondPointBegin Pointer to the first attribute of the second data sample.
+     * @return The distance between the two points.
+     */
+    __attribute__((target("avx"))) static inline float distanceAvxOptimizedNoSquareRoot(
+            const float *__restrict__ const firstPointBegin,
+            const float *__restrict__ const firstPointEnd,
+            const float *__restrict__ const secondPointBegin) noexcept {
 
         // Initialize the register that accumulates the partial sum of squares
-        __m128d accumulator = _mm_setzero_pd();
+        __m256 accumulator = _mm256_setzero_ps();
 
-        const double *__restrict__ firstPoint = firstPointBegin;
-        const double *__restrict__ secondPoint = secondPointBegin;
+        const float *__restrict__ firstPoint = firstPointBegin;
+        const float *__restrict__ secondPoint = secondPointBegin;
 
         while (firstPoint != firstPointEnd) {
-            // Load the next 2 coordinates of the first point into an SSE register
-            __m128d dataI = _mm_load_pd(firstPoint);
-            // Load the next 2 coordinates of the second point into an SSE register
-            __m128d dataN = _mm_load_pd(secondPoint);
+            // Load the next 8 coordinates of the first point into an AVX register
+            __m256 dataI = _mm256_load_ps(firstPoint);
+            // Load the next 8 coordinates of the second point into an AVX register
+            __m256 dataN = _mm256_load_ps(secondPoint);
 
             // Compute the pairwise differences
-            __m128d difference = _mm_sub_pd(dataI, dataN);
-            // Compute the square of two differences
-            __m128d square = _mm_mul_pd(difference, difference);
-
-            // Update the partial sum
-            accumulator = _mm_add_pd(accumulator, square);
+            __m256 difference = _mm256_sub_ps(dataI, dataN);
+            // Compute the square of the differences and update the partial sum
+            accumulator = _mm256_add_ps(accumulator, _mm256_mul_ps(difference, difference));
 
-            firstPoint += SSE_PACK_SIZE;
-            secondPoint += SSE_PACK_SIZE;
+            firstPoint += AVX_FLOAT_PACK_SIZE;
+            secondPoint += AVX_FLOAT_PACK_SIZE;
         }
 
-        // Compute the final partial sum
-        __m128d horizontalSum = _mm_hadd_pd(accumulator, accumulator);
+        // Sum the upper 128 bits of the register to the lower 128 ones
+        __m128 partialSum = _mm_add_ps(_mm256_extractf128_ps(accumulator, 1),
+                                       _mm256_castps256_ps128(accumulator));
+
+        // Sum adjacent values twice, so that the first value holds the sum of all the four
+        partialSum = _mm_hadd_ps(partialSum, partialSum);
+        partialSum = _mm_hadd_ps(partialSum, partialSum);
 
         // Return the partial sum of squares
-        return horizontalSum[0];
+        return _mm_cvtss_f32(partialSum);
     }
 
     /**
-     * Computes the distance between two points using AVX instructions.
+     * Computes the distance between two points having <code>float</code> attributes using AVX
+     * and FMA instructions. This implementation keeps <code>FMA_ACCUMULATORS_COUNT</code>
+     * independent partial sums in the registers, and updates them using fused multiply-add
+     * instructions.
      *
      * @param firstPointBegin Pointer to the first attribute of the first data sample.
      * @param firstPointEnd Pointer to the attribute following the last attribute of the first
@@ -683,50 +3248,147 @@ private:
      * @param secondPointBegin Pointer to the first attribute of the second data sample.
      * @return The distance between the two points.
      */
-    static inline double distanceAvx(const double *__restrict__ const firstPointBegin,
-                                     const double *__restrict__ const firstPointEnd,
-                                     const double *__restrict__ const secondPointBegin) noexcept {
-
-        // Initialize the partial sum of squares
-        double sum = 0;
+    __attribute__((target("avx,fma"))) static inline float distanceAvxFma(
+            const float *__restrict__ const firstPointBegin,
+            const float *__restrict__ const firstPointEnd,
+            const float *__restrict__ const secondPointBegin) noexcept {
+
+        // Compute the square root of the sum of squares
+        return std::sqrt(ParallelClustering::distanceAvxFmaNoSquareRoot(
+                firstPointBegin, firstPointEnd, secondPointBegin));
+    }
 
-        const double *__restrict__ firstPoint = firstPointBegin;
-        const double *__restrict__ secondPoint = secondPointBegin;
+    /**
+     * Computes the square of the distance between two points having <code>float</code>
+     * attributes using AVX and FMA instructions. This implementation processes
+     * <code>FMA_ACCUMULATORS_COUNT</code> packs at a time, each of them updating a different
+     * partial sum.
+     *
+     * @param firstPointBegin Pointer to the first attribute of the first data sample.
+     * @param firstPointEnd Pointer to the attribute following the last attribute of the first
+     * data sample. This value acts as a placeholder, and it is used to identify the end of the
+     * first point.
+     * @param secondPointBegin Pointer to the first attribute of the second data sample.
+     * @return The square of the distance between the two points.
+     */
+    __attribute__((target("avx,fma"))) static inline float distanceAvxFmaNoSquareRoot(
+            const float *__restrict__ const firstPointBegin,
+            const float *__restrict__ const firstPointEnd,
+            const float *__restrict__ const secondPointBegin) noexcept {
+
+        const constexpr std::size_t unrolledSize = FMA_ACCUMULATORS_COUNT * AVX_FLOAT_PACK_SIZE;
+
+        // Initialize the registers that accumulate the partial sums of squares
+        __m256 firstAccumulator = _mm256_setzero_ps();
+        __m256 secondAccumulator = _mm256_setzero_ps();
+        __m256 thirdAccumulator = _mm256_setzero_ps();
+        __m256 fourthAccumulator = _mm256_setzero_ps();
+
+        const float *__restrict__ firstPoint = firstPointBegin;
+        const float *__restrict__ secondPoint = secondPointBegin;
+        // Pointer to the first attribute of the first point that does not fill a whole group of
+        // packs
+        const float *const unrolledEnd =
+                firstPointBegin +
+                static_cast<std::size_t>(firstPointEnd - firstPointBegin) / unrolledSize *
+                        unrolledSize;
+
+        while (firstPoint != unrolledEnd) {
+            // Compute the pairwise differences of the next 32 coordinates
+            const __m256 firstDifference =
+                    _mm256_sub_ps(_mm256_load_ps(firstPoint), _mm256_load_ps(secondPoint));
+            const __m256 secondDifference =
+                    _mm256_sub_ps(_mm256_load_ps(firstPoint + AVX_FLOAT_PACK_SIZE),
+                                  _mm256_load_ps(secondPoint + AVX_FLOAT_PACK_SIZE));
+            const __m256 thirdDifference =
+                    _mm256_sub_ps(_mm256_load_ps(firstPoint + 2 * AVX_FLOAT_PACK_SIZE),
+                                  _mm256_load_ps(secondPoint + 2 * AVX_FLOAT_PACK_SIZE));
+            const __m256 fourthDifference =
+                    _mm256_sub_ps(_mm256_load_ps(firstPoint + 3 * AVX_FLOAT_PACK_SIZE),
+                                  _mm256_load_ps(secondPoint + 3 * AVX_FLOAT_PACK_SIZE));
+
+            // Square them and update the partial sums
+            firstAccumulator = _mm256_fmadd_ps(firstDifference, firstDifference, firstAccumulator);
+            secondAccumulator =
+                    _mm256_fmadd_ps(secondDifference, secondDifference, secondAccumulator);
+            thirdAccumulator = _mm256_fmadd_ps(thirdDifference, thirdDifference, thirdAccumulator);
+            fourthAccumulator =
+                    _mm256_fmadd_ps(fourthDifference, fourthDifference, fourthAccumulator);
+
+            firstPoint += unrolledSize;
+            secondPoint += unrolledSize;
+        }
 
+        // Process the remaining packs
         while (firstPoint != firstPointEnd) {
-            // Load the next 4 coordinates of the first point into an AVX register
-            __m256d dataI = _mm256_load_pd(firstPoint);
-            // Load the next 4 coordinates of the second point into an AVX register
-            __m256d dataN = _mm256_load_pd(secondPoint);
+            const __m256 difference =
+                    _mm256_sub_ps(_mm256_load_ps(firstPoint), _mm256_load_ps(secondPoint));
+            firstAccumulator = _mm256_fmadd_ps(difference, difference, firstAccumulator);
 
-            // Compute the pairwise differences
-            __m256d difference = _mm256_sub_pd(dataI, dataN);
-            // Compute the square of two differences
-            __m256d square = _mm256_mul_pd(difference, difference);
+            firstPoint += AVX_FLOAT_PACK_SIZE;
+            secondPoint += AVX_FLOAT_PACK_SIZE;
+        }
 
-            // Sum adjacent double values, i.e., it sums the first value with the second, and stores
-            // the result in the upper 128 bits of the register, and then it sums the third value
-            // with the fourth, and stores the result in the lower 128 bits of the register
-            __m256d squaresSum = _mm256_hadd_pd(square, square);
+        // Add the partial sums
+        const __m256 accumulator =
+                _mm256_add_ps(_mm256_add_ps(firstAccumulator, secondAccumulator),
+                              _mm256_add_ps(thirdAccumulator, fourthAccumulator));
 
-            // Extract the upper 128 bits of the register
-            __m128d highBits = _mm256_extractf128_pd(squaresSum, 1);
-            // Extract the lower 128 bits of the register
-            __m128d lowBits = _mm256_castpd256_pd128(squaresSum);
-            // Sum the upper 128 bits to the lower 128 ones, and then update the partial sum
-            sum += _mm_add_pd(highBits, lowBits)[0];
+        // Sum the upper 128 bits of the register to the lower 128 ones
+        __m128 partialSum = _mm_add_ps(_mm256_extractf128_ps(accumulator, 1),
+                                       _mm256_castps256_ps128(accumulator));
 
-            firstPoint += AVX_PACK_SIZE;
-            secondPoint += AVX_PACK_SIZE;
+        // Sum adjacent values twice, so that the first value holds the sum of all the four
+        partialSum = _mm_hadd_ps(partialSum, partialSum);
+        partialSum = _mm_hadd_ps(partialSum, partialSum);
+
+        // Return the partial sum of squares
+        return _mm_cvtss_f32(partialSum);
+    }
+
+    /**
+     * Computes the squares of the distances between a point and
+     * <code>AVX_FLOAT_PACK_SIZE</code> points having <code>float</code> attributes stored in a
+     * block whose attributes are interleaved, using AVX instructions.
+     *
+     * @param blockBegin Pointer to the first attribute of the block.
+     * @param blockEnd Pointer to the attribute following the last attribute of the block. This
+     * value acts as a placeholder, and it is used to identify the end of the block.
+     * @param point Pointer to the first attribute of the point. The following attributes of the
+     * point are <code>AVX_FLOAT_PACK_SIZE</code> positions apart from each other.
+     * @param distances Array where the square of the distance between the point and the
+     * <code>k</code>-th point of the block will be stored in <code>distances[k]</code>.
+     */
+    __attribute__((target("avx"))) static inline void distancesAvxInterleavedNoSquareRoot(
+            const float *__restrict__ const blockBegin,
+            const float *__restrict__ const blockEnd,
+            const float *__restrict__ const point,
+            float *__restrict__ const distances) noexcept {
+
+        // Initialize the register that accumulates the partial sums of squares
+        __m256 accumulator = _mm256_setzero_ps();
+
+        const float *__restrict__ attribute = point;
+        for (const float *block = blockBegin; block != blockEnd; block += AVX_FLOAT_PACK_SIZE) {
+            // Subtract the next attribute of the point from the same attribute of all the points
+            // of the block
+            __m256 difference =
+                    _mm256_sub_ps(_mm256_broadcast_ss(attribute), _mm256_load_ps(block));
+            // Compute the square of the differences and update the partial sums
+            accumulator = _mm256_add_ps(accumulator, _mm256_mul_ps(difference, difference));
+
+            attribute += AVX_FLOAT_PACK_SIZE;
         }
 
-        // Compute the square root of the partial sum
-        return sqrt(sum);
+        // Store the partial sums of squares
+        _mm256_storeu_ps(distances, accumulator);
     }
 
     /**
-     * Computes the distance between two points using AVX instructions. This implementation keeps
-     * the partial sum in the registers instead of storing it into memory.
+     * Computes the distance between two points having <code>float</code> attributes using
+     * AVX-512 instructions. This implementation handles the last attributes of the points, which
+     * may not fill a whole pack, using a mask. Therefore, the points need neither to be aligned
+     * nor to be padded.
      *
      * @param firstPointBegin Pointer to the first attribute of the first data sample.
      * @param firstPointEnd Pointer to the attribute following the last attribute of the first
@@ -735,53 +3397,21 @@ private:
      * @param secondPointBegin Pointer to the first attribute of the second data sample.
      * @return The distance between the two points.
      */
-    static inline double distanceAvxOptimized(
-            const double *__restrict__ const firstPointBegin,
-            const double *__restrict__ const firstPointEnd,
-            const double *__restrict__ const secondPointBegin) noexcept {
-
-        // Initialize the register that accumulates the partial sum of squares
-        __m256d accumulator = _mm256_setzero_pd();
-
-        const double *__restrict__ firstPoint = firstPointBegin;
-        const double *__restrict__ secondPoint = secondPointBegin;
-
-        while (firstPoint != firstPointEnd) {
-            // Load the next 4 coordinates of the first point into an AVX register
-            __m256d dataI = _mm256_load_pd(firstPoint);
-            // Load the next 4 coordinates of the second point into an AVX register
-            __m256d dataN = _mm256_load_pd(secondPoint);
-
-            // Compute the pairwise differences
-            __m256d difference = _mm256_sub_pd(dataI, dataN);
-            // Compute the square of two differences
-            __m256d square = _mm256_mul_pd(difference, difference);
-
-            // Update the partial sum
-            accumulator = _mm256_add_pd(accumulator, square);
-
-            firstPoint += AVX_PACK_SIZE;
-            secondPoint += AVX_PACK_SIZE;
-        }
-
-        // Sum adjacent double values, i.e., it sums the first value with the second, and stores
-        // the result in the upper 128 bits of the register, and then it sums the third value
-        // with the fourth, and stores the result in the lower 128 bits of the register
-        __m256d horizontalSum = _mm256_hadd_pd(accumulator, accumulator);
-
-        // Extract the upper 128 bits of the register
-        __m128d highBits = _mm256_extractf128_pd(horizontalSum, 1);
-        // Extract the lower 128 bits of the register
-        __m128d lowBits = _mm256_castpd256_pd128(horizontalSum);
-
-        // Sum the upper 128 bits to the lower 128 ones, and then return the square root of the
-        // resulting sum
-        return sqrt(_mm_add_pd(highBits, lowBits)[0]);
+    __attribute__((target("avx512f"))) static inline float distanceAvx512(
+            const float *__restrict__ const firstPointBegin,
+            const float *__restrict__ const firstPointEnd,
+            const float *__restrict__ const secondPointBegin) noexcept {
+
+        // Compute the square root of the sum of squares
+        return std::sqrt(ParallelClustering::distanceAvx512NoSquareRoot(
+                firstPointBegin, firstPointEnd, secondPointBegin));
     }
 
     /**
-     * Computes the square the distance between two points using AVX instructions. This
-     * implementation keeps the partial sum in the registers instead of storing it into memory.
+     * Computes the square of the distance between two points having <code>float</code>
+     * attributes using AVX-512 instructions. This implementation handles the last attributes of
+     * the points, which may not fill a whole pack, using a mask. Therefore, the points need
+     * neither to be aligned nor to be padded.
      *
      * @param firstPointBegin Pointer to the first attribute of the first data sample.
      * @param firstPointEnd Pointer to the attribute following the last attribute of the first
@@ -790,47 +3420,69 @@ private:
      * @param secondPointBegin Pointer to the first attribute of the second data sample.
      * @return The distance between the two points.
      */
-    static inline double distanceAvxOptimizedNoSquareRoot(
-            const double *__restrict__ const firstPointBegin,
-            const double *__restrict__ const firstPointEnd,
-            const double *__restrict__ const secondPointBegin) noexcept {
+    __attribute__((target("avx512f"))) static inline float distanceAvx512NoSquareRoot(
+            const float *__restrict__ const firstPointBegin,
+            const float *__restrict__ const firstPointEnd,
+            const float *__restrict__ const secondPointBegin) noexcept {
 
         // Initialize the register that accumulates the partial sum of squares
-        __m256d accumulator = _mm256_setzero_pd();
+        __m512 accumulator = _mm512_setzero_ps();
 
-        const double *__restrict__ firstPoint = firstPointBegin;
-        const double *__restrict__ secondPoint = secondPointBegin;
+        const float *__restrict__ firstPoint = firstPointBegin;
+        const float *__restrict__ secondPoint = secondPointBegin;
 
-        while (firstPoint != firstPointEnd) {
-            // Load the next 4 coordinates of the first point into an AVX register
-            __m256d dataI = _mm256_load_pd(firstPoint);
-            // Load the next 4 coordinates of the second point into an AVX register
-            __m256d dataN = _mm256_load_pd(secondPoint);
+        // Process all the complete packs
+        while (firstPointEnd - firstPoint >= static_cast<std::ptrdiff_t>(AVX512_FLOAT_PACK_SIZE)) {
+            // Load the next 16 coordinates of the first point into an AVX-512 register
+            __m512 dataI = _mm512_loadu_ps(firstPoint);
+            // Load the next 16 coordinates of the second point into an AVX-512 register
+            __m512 dataN = _mm512_loadu_ps(secondPoint);
 
             // Compute the pairwise differences
-            __m256d difference = _mm256_sub_pd(dataI, dataN);
-            // Compute the square of two differences
-            __m256d square = _mm256_mul_pd(difference, difference);
-
-            // Update the partial sum
-            accumulator = _mm256_add_pd(accumulator, square);
+            __m512 difference = _mm512_sub_ps(dataI, dataN);
+            // Compute the square of the differences and update the partial sum
+            accumulator = _mm512_add_ps(accumulator, _mm512_mul_ps(difference, difference));
 
-            firstPoint += AVX_PACK_SIZE;
-            secondPoint += AVX_PACK_SIZE;
+            firstPoint += AVX512_FLOAT_PACK_SIZE;
+            secondPoint += AVX512_FLOAT_PACK_SIZE;
         }
 
-        // Sum adjacent double values, i.e., it sums the first value with the second, and stores
-        // the result in the upper 128 bits of the register, and then it sums the third value
-        // with the fourth, and stores the result in the lower 128 bits of the register
-        __m256d horizontalSum = _mm256_hadd_pd(accumulator, accumulator);
+        // Process the remaining coordinates, if any
+        const auto remainingCoordinates = static_cast<unsigned int>(firstPointEnd - firstPoint);
+        if (remainingCoordinates != 0) {
+            // Mask selecting only the remaining coordinates. The masked-out coordinates are not
+            // read from memory, and are set to 0
+            const auto mask = static_cast<__mmask16>((1U << remainingCoordinates) - 1U);
 
-        // Extract the upper 128 bits of the register
-        __m128d highBits = _mm256_extractf128_pd(horizontalSum, 1);
-        // Extract the lower 128 bits of the register
-        __m128d lowBits = _mm256_castpd256_pd128(horizontalSum);
+            // Load the remaining coordinates of the first point into an AVX-512 register
+            __m512 dataI = _mm512_maskz_loadu_ps(mask, firstPoint);
+            // Load the remaining coordinates of the second point into an AVX-512 register
+            __m512 dataN = _mm512_maskz_loadu_ps(mask, secondPoint);
 
-        // Sum the upper 128 bits to the lower 128 ones, and then return the resulting sum
-        return _mm_add_pd(highBits, lowBits)[0];
+            // Compute the pairwise differences
+            __m512 difference = _mm512_sub_ps(dataI, dataN);
+            // Compute the square of the differences and update the partial sum
+            accumulator = _mm512_add_ps(accumulator, _mm512_mul_ps(difference, difference));
+        }
+
+        // Sum the upper 256 bits of the register to the lower 256 ones. As for the double
+        // kernel, the halves are extracted with a mask selecting all the lanes, since the
+        // unmasked extraction merges them into an undefined register. The 32-bit lanes
+        // extraction requires AVX-512DQ, so the halves are extracted as 64-bit lanes, which
+        // preserves their bits
+        const auto allLanes = static_cast<__mmask8>(0xFFU);
+        const __m512d accumulatorBits = _mm512_castps_pd(accumulator);
+        const __m256 halvesSum = _mm256_add_ps(
+                _mm256_castpd_ps(_mm512_maskz_extractf64x4_pd(allLanes, accumulatorBits, 1)),
+                _mm256_castpd_ps(_mm512_maskz_extractf64x4_pd(allLanes, accumulatorBits, 0)));
+
+        // Sum the upper 128 bits to the lower 128 ones, and then adjacent values twice, so that
+        // the first value holds the sum of all the four
+        __m128 partialSum = _mm_add_ps(_mm256_extractf128_ps(halvesSum, 1),
+                                       _mm256_castps256_ps128(halvesSum));
+        partialSum = _mm_hadd_ps(partialSum, partialSum);
+        partialSum = _mm_hadd_ps(partialSum, partialSum);
+        return _mm_cvtss_f32(partialSum);
     }
 };
 }  // namespace cluster::parallel
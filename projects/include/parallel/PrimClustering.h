@@ -0,0 +1,325 @@
+#ifndef FINAL_PROJECT_HPC_PRIMCLUSTERING_H
+#define FINAL_PROJECT_HPC_PRIMCLUSTERING_H
+
+#include "../utils/DataIteratorUtils.h"
+#include "../utils/Types.h"
+#include "DistanceComputers.h"
+#include "Logger.h"
+#include "ParallelClustering.h"
+#include "PiLambdaIteratorUtils.h"
+#include "SpanningTreeConverter.h"
+#include "Timer.h"
+#include <cmath>
+#include <limits>
+#include <memory>
+#include <omp.h>
+#include <vector>
+
+namespace cluster::parallel {
+
+/**
+ * Class providing a parallel implementation of the clustering algorithm that computes the minimum
+ * spanning tree of the data samples using the Prim's algorithm, and then converts it into the
+ * pointer representation.<br>
+ * Unlike the SLINK algorithm, whose insertion of a new point into the dendrogram is inherently
+ * sequential, every iteration of the Prim's algorithm is fully parallel: the distances between the
+ * last vertex added to the tree and all the remaining vertices are computed in parallel, together
+ * with the closest distance of each vertex to the tree and the vertex that must be added next.
+ * The memory required is linear in the number of data samples, since the distances are never
+ * stored.<br>
+ * Moreover, the only method of this class uses the first 6 timers offered by the
+ * <code>Timer</code> class to measure the time taken by each step of the algorithm.
+ *
+ * @tparam PD <code>true</code> if the clustering method should parallelize the Prim's algorithm
+ * using threads, <code>false</code> otherwise.
+ * @tparam PS <code>true</code> if the clustering method should parallelize the computation of the
+ * square roots using threads, <code>false</code> otherwise. This template argument take effect
+ * only if the distance computer does not compute the square roots.
+ * @tparam A <code>true</code> if the clustering method should check for the memory alignment of the
+ * data samples, <code>false</code> otherwise. This template argument take effect only if the
+ * distance computer requires the data samples to be aligned.
+ *
+ * @author DeB
+ * @author Jonathan
+ * @version 1.2 2022-10-15
+ * @since 1.0
+ */
+template <bool PD = true, bool PS = false, bool A = false>
+class PrimClustering {
+
+    // Imports
+    using Logger = utils::Logger;
+    using Timer = utils::Timer;
+    using PiLambdaIteratorUtils = utils::PiLambdaIteratorUtils;
+    template <typename S>
+    using DataIteratorUtils = utils::DataIteratorUtils<S>;
+    using Kernels = ParallelClustering<PD, false, PS, A>;
+
+public:
+    /**
+     * Parallel implementation of the clustering algorithm based on the minimum spanning tree.
+     *
+     * @tparam C Enumeration constant specifying the algorithm to use to compute the distance
+     * between two data samples. The same restrictions of
+     * <code>ParallelClustering::cluster</code> apply.
+     * @tparam S Type of the attributes of the data samples. It must be either <code>double</code>,
+     * which is the default, or <code>float</code>.
+     * @tparam D Type of the data structure/iterator holding the data samples to cluster.
+     * @tparam P Type of the data structure/iterator holding the <code>pi</code> values.
+     * @tparam L Type of the data structure/iterator holding the <code>lambda</code> values.
+     * @param data Data structure/iterator holding the data samples to cluster.
+     * @param dataSamplesCount Number of data samples.
+     * @param dimension Number of attributes of each sample.
+     * @param pi Data structure/iterator holding the <code>pi</code> values. This data structure
+     * <b>MUST BE</b> big enough to contain all the <code>pi</code> values, which are exactly
+     * <code>dataSamplesCount</code>.
+     * @param lambda Data structure/iterator holding the <code>lambda</code> values. This data
+     * structure <b>MUST BE</b> big enough to contain all the <code>lambda</code> values, which are
+     * exactly <code>dataSamplesCount</code>.
+     * @param distanceComputationThreadsCount Number of threads to use to parallelize the Prim's
+     * algorithm. If not specified, or if <code>0</code> is specified, then this method uses the
+     * default number of threads computed by OpenMP.<br>
+     * This parameter takes effect only if <code>PD</code> is <code>true</code>.
+     * @param squareRootThreadsCount Number of threads to use to parallelize the computation of
+     * square roots of the distances. If not specified, or if <code>0</code> is specified, then this
+     * method uses the default number of threads computed by OpenMP.<br> This parameter takes effect
+     * only if <code>PS</code> is <code>true</code>, and if the distance computer does not compute
+     * the square roots.
+     * @throws std::invalid_argument If the data samples alignment check has been requested and one
+     * of the data samples in not correctly aligned, or if the elements of <code>pi</code> cannot
+     * store the index of the last data sample.
+     */
+    template <DistanceComputers C,
+              typename S = double,
+              utils::ParallelDataIterator<S> D,
+              utils::PiIterator P,
+              utils::LambdaIterator L>
+    static void cluster(const D &data,
+                        const std::size_t dataSamplesCount,
+                        const std::size_t dimension,
+                        P &pi,
+                        L &lambda,
+                        const std::size_t distanceComputationThreadsCount = 0,
+                        const std::size_t squareRootThreadsCount = 0) {
+
+        static_assert(std::is_same_v<S, double> || std::is_same_v<S, float>,
+                      "The attributes of the data samples must be either doubles or floats.");
+        static_assert(std::is_same_v<S, double> || Kernels::isSinglePrecisionSupported(C),
+                      "The specified distance computer does not support float attributes.");
+
+        // Check that pi can store the indices of all the data samples
+        PiLambdaIteratorUtils::requirePiCapacity<P>(dataSamplesCount);
+
+        Timer::start<0>();
+
+        // Number of attributes between the first attribute of a data sample and the first
+        // attribute of the following sample if they are contiguous in memory
+        const std::size_t stride = Kernels::template computeStride<C, S>(dimension);
+
+        // Closest distance between each vertex not yet in the tree and the tree, released
+        // automatically, so that it is never leaked if an exception is thrown
+        const std::unique_ptr<S[]> closestDistancesOwner{new S[dataSamplesCount]};
+        S *const __restrict__ closestDistances = closestDistancesOwner.get();
+        // Vertex of the tree closest to each vertex not yet in the tree
+        const std::unique_ptr<std::size_t[]> closestVerticesOwner{
+                new std::size_t[dataSamplesCount]};
+        std::size_t *const __restrict__ closestVertices = closestVerticesOwner.get();
+        // Vertices not yet in the tree, kept contiguous so to not iterate over the other ones
+        const std::unique_ptr<std::size_t[]> remainingVerticesOwner{
+                new std::size_t[dataSamplesCount]};
+        std::size_t *const __restrict__ remainingVertices = remainingVerticesOwner.get();
+        // Edges of the minimum spanning tree
+        std::vector<SpanningTreeEdge> edges{};
+        edges.reserve(dataSamplesCount);
+
+        // Efficient iterator pointing to the first element of pi
+        const auto piBegin = PiLambdaIteratorUtils::createEfficientIterator<utils::PiElement<P>, P>(
+                pi, "First element of pi");
+        // Efficient iterator pointing to the first element of lambda
+        const auto lambdaBegin = PiLambdaIteratorUtils::createEfficientIterator<double, L>(
+                lambda, "First element of lambda");
+
+        // Efficient iterator pointing to the first element of the dataset
+        auto dataBegin =
+                DataIteratorUtils<S>::createEfficientIterator(data, "First element of data");
+        Timer::stop<0>();
+
+        // Check the alignment of all the data samples, if requested. This must be done before
+        // entering the parallel region, since no exception can escape from it
+        if constexpr (A && Kernels::isAlignmentRequired(C)) {
+            for (std::size_t n = 0; n < dataSamplesCount; n++) {
+                Kernels::template checkAlignment<C>(
+                        n, DataIteratorUtils<S>::template getSampleAt<D>(dataBegin, n, stride));
+            }
+        }
+
+        // Log the initial progress
+        Logger::startLoggingProgress<0, 1, 2, 3, 4, 5>(dataSamplesCount);
+
+        Timer::start<1>();
+        // **** 1) Add the first vertex to the tree ****
+        for (std::size_t i = 1; i < dataSamplesCount; i++) {
+            closestDistances[i] = std::numeric_limits<S>::infinity();
+            remainingVertices[i - 1] = i;
+        }
+        // Number of vertices not yet in the tree
+        std::size_t remainingVerticesCount = dataSamplesCount - 1;
+        // Last vertex added to the tree
+        std::size_t lastVertex = 0;
+        // Closest distance between the vertices not yet in the tree and the tree
+        S bestDistance = std::numeric_limits<S>::infinity();
+        // Position in remainingVertices of the vertex closest to the tree, if any has been found
+        std::size_t bestPosition = remainingVerticesCount;
+        Timer::stop<1>();
+
+#pragma omp parallel default(none)                                                       \
+        shared(dataBegin, dataSamplesCount, stride, closestDistances, closestVertices, \
+                       remainingVertices, edges, remainingVerticesCount, lastVertex,   \
+                       bestDistance, bestPosition)                                     \
+                num_threads(distanceComputationThreadsCount) if (PD)
+        {
+            while (remainingVerticesCount > 0) {
+#pragma omp master
+                {
+                    // Log the progress every 1000 samples
+                    Logger::updateProgress<1000, 0, 1, 2, 3, 4, 5>(edges.size() + 1,
+                                                                    dataSamplesCount);
+                    Timer::start<2>();
+                }
+
+                // Pointer to the last vertex added to the tree
+                const S *__restrict__ const lastSample =
+                        DataIteratorUtils<S>::template getSampleAt<D>(
+                                dataBegin, lastVertex, stride);
+                // Pointer to the first byte after the last vertex added to the tree
+                const S *__restrict__ const lastSampleEnd = lastSample + stride;
+
+                // Closest vertex to the tree found by this thread, and its position
+                S threadBestDistance = std::numeric_limits<S>::infinity();
+                std::size_t threadBestPosition = remainingVerticesCount;
+
+                // **** 2) Update the closest distance of each vertex to the tree ****
+#pragma omp for schedule(static) nowait
+                for (std::size_t k = 0; k < remainingVerticesCount; k++) {
+                    const std::size_t vertex = remainingVertices[k];
+                    const S distance = Kernels::template computeDistance<C>(
+                            lastSample,
+                            lastSampleEnd,
+                            DataIteratorUtils<S>::template getSampleAt<D>(
+                                    dataBegin, vertex, stride));
+                    if (distance < closestDistances[vertex]) {
+                        closestDistances[vertex] = distance;
+                        closestVertices[vertex] = lastVertex;
+                    }
+                    if (isCloser(closestDistances[vertex],
+                                 vertex,
+                                 threadBestDistance,
+                                 threadBestPosition,
+                                 remainingVertices,
+                                 remainingVerticesCount)) {
+                        threadBestDistance = closestDistances[vertex];
+                        threadBestPosition = k;
+                    }
+                }
+
+                // Combine the closest vertices found by all the threads
+#pragma omp critical(prim_clustering_best_vertex)
+                {
+                    if (threadBestPosition != remainingVerticesCount &&
+                        isCloser(threadBestDistance,
+                                 remainingVertices[threadBestPosition],
+                                 bestDistance,
+                                 bestPosition,
+                                 remainingVertices,
+                                 remainingVerticesCount)) {
+                        bestDistance = threadBestDistance;
+                        bestPosition = threadBestPosition;
+                    }
+                }
+                // Wait for all the threads to contribute
+#pragma omp barrier
+
+#pragma omp master
+                {
+                    Timer::stop<2>();
+
+                    Timer::start<3>();
+                    // **** 3) Add the closest vertex to the tree ****
+                    const std::size_t vertex = remainingVertices[bestPosition];
+                    edges.push_back({closestVertices[vertex],
+                                     vertex,
+                                     static_cast<double>(closestDistances[vertex])});
+                    lastVertex = vertex;
+                    remainingVerticesCount--;
+                    remainingVertices[bestPosition] = remainingVertices[remainingVerticesCount];
+                    bestDistance = std::numeric_limits<S>::infinity();
+                    bestPosition = remainingVerticesCount;
+                    Timer::stop<3>();
+                }
+                // Wait for the vertex to be added before starting the next iteration
+#pragma omp barrier
+            }
+        }
+
+        Timer::start<4>();
+        // **** 4) Convert the minimum spanning tree into the pointer representation ****
+        SpanningTreeConverter::toPointerRepresentation<P, L>(
+                edges, dataSamplesCount, piBegin, lambdaBegin);
+        Timer::stop<4>();
+
+        // Compute the square roots, if until now the algorithm has used the squares of the
+        // distances
+        Timer::start<5>();
+        if constexpr (Kernels::isSquareRootDeferred(C)) {
+
+            // Compute the square root of all the values in lambda
+#pragma omp parallel for default(none) shared(lambdaBegin, dataSamplesCount) \
+        num_threads(squareRootThreadsCount) if (PS)
+            for (std::size_t i = 0; i < dataSamplesCount - 1; i++) {
+                double &lambdaToModify =
+                        utils::PiLambdaIteratorUtils::getElementAt<double, L>(lambdaBegin, i);
+                lambdaToModify = sqrt(lambdaToModify);
+            }
+        }
+        Timer::stop<5>();
+
+        // Log the final progress
+        Logger::updateProgress<1, 0, 1, 2, 3, 4, 5>(dataSamplesCount, dataSamplesCount);
+    }
+
+private:
+    /**
+     * Checks if a vertex is closer to the tree than the closest vertex found so far. If the two
+     * vertices are at the same distance from the tree, then the one with the lower index is
+     * considered closer, so that the result does not depend on the number of threads.
+     *
+     * @tparam S Type of the distances.
+     * @param distance Distance between the vertex and the tree.
+     * @param vertex Index of the vertex.
+     * @param bestDistance Distance between the closest vertex found so far and the tree.
+     * @param bestPosition Position in <code>remainingVertices</code> of the closest vertex found so
+     * far. If it is equal to <code>remainingVerticesCount</code>, then no vertex has been found
+     * yet.
+     * @param remainingVertices Vertices not yet in the tree.
+     * @param remainingVerticesCount Number of vertices not yet in the tree.
+     * @return <code>true</code> if the vertex is closer to the tree than the closest vertex found
+     * so far, <code>false</code> otherwise.
+     */
+    template <typename S>
+    static inline bool isCloser(const S distance,
+                                const std::size_t vertex,
+                                const S bestDistance,
+                                const std::size_t bestPosition,
+                                const std::size_t *__restrict__ const remainingVertices,
+                                const std::size_t remainingVerticesCount) {
+
+        if (bestPosition == remainingVerticesCount) {
+            return true;
+        }
+        return distance < bestDistance ||
+               (!(bestDistance < distance) && vertex < remainingVertices[bestPosition]);
+    }
+};
+}  // namespace cluster::parallel
+
+#endif  // FINAL_PROJECT_HPC_PRIMCLUSTERING_H
@@ -0,0 +1,174 @@
+#ifndef FINAL_PROJECT_HPC_SPANNINGTREECONVERTER_H
+#define FINAL_PROJECT_HPC_SPANNINGTREECONVERTER_H
+
+#include "PiLambdaIteratorUtils.h"
+#include <algorithm>
+#include <limits>
+#include <vector>
+
+namespace cluster::parallel {
+
+/**
+ * Edge of the minimum spanning tree of the data samples, where each data sample is a vertex and
+ * the weight of each edge is the distance between the two data samples it connects.
+ *
+ * @author DeB
+ * @author Jonathan
+ * @version 1.0 2022-09-26
+ * @since 1.0
+ */
+struct SpanningTreeEdge {
+
+    /**
+     * Index of the first data sample connected by the edge.
+     */
+    std::size_t firstSample;
+
+    /**
+     * Index of the second data sample connected by the edge.
+     */
+    std::size_t secondSample;
+
+    /**
+     * Distance between the two data samples, or its square if the square roots are deferred.
+     */
+    double weight;
+};
+
+/**
+ * Class converting the minimum spanning tree of the data samples into the pointer representation
+ * of the single-linkage dendrogram, i.e., into the <code>pi</code> and <code>lambda</code> values
+ * the other implementations of the clustering algorithm compute.<br>
+ * The edges are merged in increasing order of weight using a union-find structure that keeps
+ * track of the greatest index of each cluster. When two clusters merge at a distance
+ * <code>d</code>, the greatest index of the cluster that does not hold the overall greatest index
+ * is connected to it at distance <code>d</code>. All the edges having the same weight are merged
+ * together, so that the result is the same regardless of the minimum spanning tree that has been
+ * found when some distances are equal.
+ *
+ * @author DeB
+ * @author Jonathan
+ * @version 1.1 2022-10-15
+ * @since 1.0
+ */
+class SpanningTreeConverter {
+
+    // Imports
+    using PiLambdaIteratorUtils = utils::PiLambdaIteratorUtils;
+
+public:
+    /**
+     * Converts the specified minimum spanning tree into the pointer representation.
+     *
+     * @tparam P Type of the data structure/iterator holding <code>pi</code>.
+     * @tparam L Type of the data structure/iterator holding <code>lambda</code>.
+     * @tparam EP Type of the efficient iterator iterating over <code>pi</code>.
+     * @tparam EL Type of the efficient iterator iterating over <code>lambda</code>.
+     * @param edges Edges of the minimum spanning tree, which <b>MUST BE</b> exactly
+     * <code>dataSamplesCount - 1</code>. This method sorts them by weight.
+     * @param dataSamplesCount Number of data samples.
+     * @param piBegin Efficient iterator pointing to the first element of <code>pi</code>.
+     * @param lambdaBegin Efficient iterator pointing to the first element of <code>lambda</code>.
+     */
+    template <typename P, typename L, typename EP, typename EL>
+    static void toPointerRepresentation(std::vector<SpanningTreeEdge> &edges,
+                                        const std::size_t dataSamplesCount,
+                                        const EP &piBegin,
+                                        const EL &lambdaBegin) {
+
+        // Sort the edges by weight
+        std::sort(edges.begin(),
+                  edges.end(),
+                  [](const SpanningTreeEdge &first, const SpanningTreeEdge &second) noexcept {
+                      return first.weight < second.weight;
+                  });
+
+        // Parent of each data sample in the union-find structure
+        std::vector<std::size_t> parents{};
+        parents.resize(dataSamplesCount);
+        // Size of the cluster each root represents
+        std::vector<std::size_t> sizes{};
+        sizes.resize(dataSamplesCount, 1);
+        // Greatest index of the cluster each root represents
+        std::vector<std::size_t> greatestIndices{};
+        greatestIndices.resize(dataSamplesCount);
+
+        // Initially, every data sample is a cluster on its own, and it is not connected to any
+        // greater data sample
+        for (std::size_t i = 0; i < dataSamplesCount; i++) {
+            parents[i] = i;
+            greatestIndices[i] = i;
+            PiLambdaIteratorUtils::getElementAt<utils::PiElement<P>, P>(piBegin, i) =
+                    static_cast<utils::PiElement<P>>(i);
+            PiLambdaIteratorUtils::getElementAt<double, L>(lambdaBegin, i) =
+                    std::numeric_limits<double>::infinity();
+        }
+
+        // Greatest indices of the clusters merged at the current distance
+        std::vector<std::size_t> mergedIndices{};
+
+        auto groupBegin = edges.cbegin();
+        while (groupBegin != edges.cend()) {
+            // Distance at which the clusters are merged
+            const double weight = groupBegin->weight;
+
+            // Merge all the clusters connected by an edge having the current weight. Since the
+            // edges are sorted, an edge has the current weight if its weight is not greater
+            mergedIndices.clear();
+            auto groupEnd = groupBegin;
+            while (groupEnd != edges.cend() && !(weight < groupEnd->weight)) {
+                std::size_t firstRoot = findRoot(parents, groupEnd->firstSample);
+                std::size_t secondRoot = findRoot(parents, groupEnd->secondSample);
+                if (firstRoot != secondRoot) {
+                    mergedIndices.push_back(greatestIndices[firstRoot]);
+                    mergedIndices.push_back(greatestIndices[secondRoot]);
+
+                    // Attach the smaller cluster to the bigger one
+                    if (sizes[firstRoot] < sizes[secondRoot]) {
+                        std::swap(firstRoot, secondRoot);
+                    }
+                    parents[secondRoot] = firstRoot;
+                    sizes[firstRoot] += sizes[secondRoot];
+                    greatestIndices[firstRoot] =
+                            std::max(greatestIndices[firstRoot], greatestIndices[secondRoot]);
+                }
+                ++groupEnd;
+            }
+
+            // Connect the greatest index of every merged cluster to the greatest index of the
+            // cluster it now belongs to
+            for (const std::size_t mergedIndex : mergedIndices) {
+                const std::size_t greatestIndex =
+                        greatestIndices[findRoot(parents, mergedIndex)];
+                if (mergedIndex != greatestIndex) {
+                    PiLambdaIteratorUtils::getElementAt<utils::PiElement<P>, P>(
+                            piBegin, mergedIndex) = static_cast<utils::PiElement<P>>(greatestIndex);
+                    PiLambdaIteratorUtils::getElementAt<double, L>(lambdaBegin, mergedIndex) =
+                            weight;
+                }
+            }
+
+            groupBegin = groupEnd;
+        }
+    }
+
+private:
+    /**
+     * Finds the root of the cluster the specified data sample belongs to, halving the path to it.
+     *
+     * @param parents Parent of each data sample in the union-find structure.
+     * @param index Index of the data sample.
+     * @return The index of the root of the cluster.
+     */
+    static inline std::size_t findRoot(std::vector<std::size_t> &parents, std::size_t index) {
+
+        while (parents[index] != index) {
+            parents[index] = parents[parents[index]];
+            index = parents[index];
+        }
+        return index;
+    }
+};
+}  // namespace cluster::parallel
+
+#endif  // FINAL_PROJECT_HPC_SPANNINGTREECONVERTER_H
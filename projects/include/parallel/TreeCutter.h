@@ -0,0 +1,280 @@
+#ifndef FINAL_PROJECT_HPC_TREECUTTER_H
+#define FINAL_PROJECT_HPC_TREECUTTER_H
+
+#include "../utils/Types.h"
+#include "PiLambdaIteratorUtils.h"
+#include <algorithm>
+#include <cstddef>
+#include <limits>
+#include <omp.h>
+#include <utility>
+#include <vector>
+
+namespace cluster::parallel {
+
+/**
+ * Class extracting flat clusters from the single-linkage dendrogram, by cutting it either at a
+ * height or so to obtain a number of clusters.<br>
+ * In the pointer representation, the <code>i</code>-th data sample joins the cluster whose
+ * greatest data sample is <code>pi[i] &gt; i</code> at distance <code>lambda[i]</code>, and until
+ * then it is the greatest data sample of its own cluster. Therefore, a cut is extracted with a
+ * single pass over the data samples in decreasing order of index: if the <code>i</code>-th data
+ * sample has joined its cluster below the cut, it takes the label of the <code>pi[i]</code>-th
+ * one, which has already been labelled, otherwise it starts a new cluster. Cutting at a height
+ * does not need any sort, while the rank of every merge, needed to cut into a number of clusters,
+ * is computed only once, when the cutter is created, so that every following cut takes linear
+ * time.<br>
+ * The clusters of a cut are labelled from <code>0</code>, in decreasing order of their greatest
+ * data sample, so the cluster holding the last data sample is always labelled with
+ * <code>0</code>. Several cuts can be extracted together, splitting them among the threads. The
+ * labels are stored cut by cut, so that every thread writes only the contiguous labels of its own
+ * cuts, and the threads never share a cache line, but at the boundaries of their ranges.
+ *
+ * @tparam PC <code>true</code> if the cutter should parallelize the extraction of several cuts
+ * using threads, <code>false</code> otherwise.
+ *
+ * @author DeB
+ * @author Jonathan
+ * @version 1.2 2022-10-16
+ * @since 1.0
+ */
+template <bool PC = true>
+class TreeCutter {
+
+    // Imports
+    using PiLambdaIteratorUtils = utils::PiLambdaIteratorUtils;
+
+public:
+    /**
+     * Creates a new cutter of the dendrogram described by the specified pointer representation,
+     * computing the rank of every merge.
+     *
+     * @tparam P Type of the data structure/iterator holding <code>pi</code>.
+     * @tparam L Type of the data structure/iterator holding <code>lambda</code>.
+     * @param pi Data structure/iterator holding the <code>pi</code> values, as computed by the
+     * clustering algorithm. The values are copied, so the data structure can be modified
+     * afterwards.
+     * @param lambda Data structure/iterator holding the <code>lambda</code> values, as computed by
+     * the clustering algorithm. The values are copied, so the data structure can be modified
+     * afterwards.
+     * @param dataSamplesCount Number of data samples that have been clustered.
+     */
+    template <utils::PiIterator P, utils::LambdaIterator L>
+    TreeCutter(P &pi, L &lambda, const std::size_t dataSamplesCount) :
+        pi(),
+        lambda(),
+        ranks() {
+
+        if (dataSamplesCount == 0) {
+            return;
+        }
+
+        // Efficient iterator pointing to the first element of pi
+        const auto piBegin = PiLambdaIteratorUtils::createEfficientIterator<utils::PiElement<P>, P>(
+                pi, "First element of pi");
+        // Efficient iterator pointing to the first element of lambda
+        const auto lambdaBegin = PiLambdaIteratorUtils::createEfficientIterator<double, L>(
+                lambda, "First element of lambda");
+
+        // Copy the pointer representation
+        this->pi.resize(dataSamplesCount);
+        this->lambda.resize(dataSamplesCount);
+        for (std::size_t i = 0; i < dataSamplesCount; i++) {
+            this->pi[i] = PiLambdaIteratorUtils::getElementAt<utils::PiElement<P>, P>(piBegin, i);
+            this->lambda[i] = PiLambdaIteratorUtils::getElementAt<double, L>(lambdaBegin, i);
+        }
+
+        // Sort the merges by height, breaking the ties by index, and store the 1-based rank of
+        // every merge. The last data sample never joins any cluster, so it has the greatest rank
+        std::vector<std::pair<double, std::size_t>> merges{};
+        merges.resize(dataSamplesCount - 1);
+        for (std::size_t i = 0; i < merges.size(); i++) {
+            merges[i] = {this->lambda[i], i};
+        }
+        std::sort(merges.begin(), merges.end());
+        this->ranks.resize(dataSamplesCount);
+        for (std::size_t k = 0; k < merges.size(); k++) {
+            this->ranks[merges[k].second] = k + 1;
+        }
+        this->ranks[dataSamplesCount - 1] = std::numeric_limits<std::size_t>::max();
+    }
+
+    /**
+     * Cuts the dendrogram at the specified height, so that two data samples belong to the same
+     * cluster if and only if they are merged at a distance not greater than <code>height</code>.
+     *
+     * @param height Height of the cut.
+     * @param labels Vector where the label of the cluster of every data sample will be placed. It
+     * is resized to the number of data samples.
+     * @return The number of clusters.
+     */
+    std::size_t cutTree(const double height, std::vector<std::size_t> &labels) const {
+
+        std::vector<std::size_t> clustersCounts = this->cutTree(std::vector{height}, labels, 1);
+        return (clustersCounts.empty()) ? 0 : clustersCounts[0];
+    }
+
+    /**
+     * Cuts the dendrogram at each of the specified heights.
+     *
+     * @param heights Heights of the cuts, in any order.
+     * @param labels Vector where the labels of the clusters will be placed. It is resized to the
+     * number of data samples times the number of cuts, and the label of the <code>i</code>-th data
+     * sample in the <code>j</code>-th cut is placed at <code>j * dataSamplesCount + i</code>.
+     * @param threadsCount Number of threads to use to parallelize the cuts. If not specified, or if
+     * <code>0</code> is specified, then this method uses the default number of threads computed by
+     * OpenMP.<br>
+     * This parameter takes effect only if <code>PC</code> is <code>true</code>.
+     * @return The number of clusters of every cut.
+     */
+    std::vector<std::size_t> cutTree(const std::vector<double> &heights,
+                                     std::vector<std::size_t> &labels,
+                                     const std::size_t threadsCount = 0) const {
+
+        // A data sample is below the cut if it joins its cluster at a distance not greater than
+        // the height
+        return this->cut(this->lambda, heights, labels, threadsCount);
+    }
+
+    /**
+     * Cuts the dendrogram so to obtain the specified number of clusters, by applying the merges
+     * in increasing order of height until the number of clusters is reached. The merges at the
+     * same height are applied in increasing order of the index of the data sample that joins
+     * another cluster.
+     *
+     * @param clustersCount Number of clusters. If it is <code>0</code>, one cluster is obtained,
+     * while if it is greater than the number of data samples, every data sample is a cluster on
+     * its own.
+     * @param labels Vector where the label of the cluster of every data sample will be placed. It
+     * is resized to the number of data samples.
+     * @return The number of clusters.
+     */
+    std::size_t cutTreeIntoClusters(const std::size_t clustersCount,
+                                    std::vector<std::size_t> &labels) const {
+
+        std::vector<std::size_t> clustersCounts =
+                this->cutTreeIntoClusters(std::vector{clustersCount}, labels, 1);
+        return (clustersCounts.empty()) ? 0 : clustersCounts[0];
+    }
+
+    /**
+     * Cuts the dendrogram so to obtain each of the specified numbers of clusters.
+     *
+     * @param clustersCounts Numbers of clusters of the cuts, in any order. The values are handled
+     * like <code>cutTreeIntoClusters</code> does.
+     * @param labels Vector where the labels of the clusters will be placed. It is resized to the
+     * number of data samples times the number of cuts, and the label of the <code>i</code>-th data
+     * sample in the <code>j</code>-th cut is placed at <code>j * dataSamplesCount + i</code>.
+     * @param threadsCount Number of threads to use to parallelize the cuts. If not specified, or if
+     * <code>0</code> is specified, then this method uses the default number of threads computed by
+     * OpenMP.<br>
+     * This parameter takes effect only if <code>PC</code> is <code>true</code>.
+     * @return The number of clusters of every cut.
+     */
+    std::vector<std::size_t> cutTreeIntoClusters(const std::vector<std::size_t> &clustersCounts,
+                                                 std::vector<std::size_t> &labels,
+                                                 const std::size_t threadsCount = 0) const {
+
+        // Obtaining k clusters requires to apply the first n - k merges, i.e., those whose rank
+        // is not greater than n - k
+        const std::size_t dataSamplesCount = this->pi.size();
+        if (dataSamplesCount == 0) {
+            labels.clear();
+            return std::vector<std::size_t>(clustersCounts.size(), 0);
+        }
+        std::vector<std::size_t> maximumRanks{};
+        maximumRanks.reserve(clustersCounts.size());
+        for (const std::size_t clustersCount : clustersCounts) {
+            maximumRanks.push_back(dataSamplesCount -
+                                   std::clamp<std::size_t>(clustersCount, 1, dataSamplesCount));
+        }
+        return this->cut(this->ranks, maximumRanks, labels, threadsCount);
+    }
+
+    /**
+     * Returns the number of data samples of the dendrogram.
+     *
+     * @return The number of data samples of the dendrogram.
+     */
+    std::size_t getDataSamplesCount() const noexcept {
+
+        return this->pi.size();
+    }
+
+private:
+    /**
+     * Values of <code>pi</code>.
+     */
+    std::vector<std::size_t> pi;
+
+    /**
+     * Values of <code>lambda</code>.
+     */
+    std::vector<double> lambda;
+
+    /**
+     * 1-based rank of the merge of every data sample in increasing order of height, or the
+     * greatest <code>std::size_t</code> for the last data sample.
+     */
+    std::vector<std::size_t> ranks;
+
+    /**
+     * Extracts the specified cuts. The <code>i</code>-th data sample is below the
+     * <code>j</code>-th cut if <code>keys[i]</code> is not greater than <code>bounds[j]</code>.
+     *
+     * @tparam K Type of the keys and of the bounds.
+     * @param keys Key of every data sample.
+     * @param bounds Bound of every cut.
+     * @param labels Vector where the labels of the clusters will be placed, with the label of the
+     * <code>i</code>-th data sample in the <code>j</code>-th cut at
+     * <code>j * dataSamplesCount + i</code>.
+     * @param threadsCount Number of threads to use to parallelize the cuts.
+     * @return The number of clusters of every cut.
+     */
+    template <typename K>
+    std::vector<std::size_t> cut(const std::vector<K> &keys,
+                                 const std::vector<K> &bounds,
+                                 std::vector<std::size_t> &labels,
+                                 const std::size_t threadsCount) const {
+
+        const std::size_t dataSamplesCount = this->pi.size();
+        const std::size_t cutsCount = bounds.size();
+        std::vector<std::size_t> clustersCounts{};
+        clustersCounts.resize(cutsCount, 0);
+        labels.resize(dataSamplesCount * cutsCount);
+        if (dataSamplesCount == 0 || cutsCount == 0) {
+            return clustersCounts;
+        }
+
+#pragma omp parallel default(none) shared(keys, bounds, labels, clustersCounts) \
+        firstprivate(dataSamplesCount, cutsCount) num_threads(threadsCount) if (PC)
+        {
+            // Compute the cuts extracted by the current thread
+            const auto threadsNumber = static_cast<std::size_t>(omp_get_num_threads());
+            const auto threadNumber = static_cast<std::size_t>(omp_get_thread_num());
+            const std::size_t firstCut = cutsCount * threadNumber / threadsNumber;
+            const std::size_t lastCut = cutsCount * (threadNumber + 1) / threadsNumber;
+
+            for (std::size_t j = firstCut; j < lastCut; j++) {
+                const K bound = bounds[j];
+                std::size_t *const cutLabels = &(labels[j * dataSamplesCount]);
+                // Number of clusters found so far
+                std::size_t count = 0;
+
+                // The last data sample starts a new cluster
+                cutLabels[dataSamplesCount - 1] = count++;
+                // Label the other data samples, whose pi has already been labelled
+                for (std::size_t i = dataSamplesCount - 1; i-- > 0;) {
+                    cutLabels[i] = (keys[i] <= bound) ? cutLabels[this->pi[i]] : count++;
+                }
+
+                clustersCounts[j] = count;
+            }
+        }
+
+        return clustersCounts;
+    }
+};
+}  // namespace cluster::parallel
+
+#endif  // FINAL_PROJECT_HPC_TREECUTTER_H
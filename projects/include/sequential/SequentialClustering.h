@@ -1,6 +1,7 @@
 #ifndef FINAL_PROJECT_HPC_SEQUENTIALCLUSTERING_H
 #define FINAL_PROJECT_HPC_SEQUENTIALCLUSTERING_H
 
+#include "../../include/utils/DistanceMetrics.h"
 #include "../../include/utils/Types.h"
 #include "Logger.h"
 #include "Timer.h"
@@ -8,11 +9,13 @@
 namespace cluster::sequential {
 
 /**
- * Class providing a sequential implementation of the clustering algorithm.
+ * Class providing a sequential implementation of the clustering algorithm.<br>
+ * The distances are Euclidean by default, but any of the metrics of <code>utils</code> can be
+ * used instead. The metrics are computed without using any SIMD instructions.
  *
  * @author DeB
  * @author Jonathan
- * @version 1.3 2022-08-16
+ * @version 1.6 2022-10-15
  * @since 1.0
  */
 class SequentialClustering {
@@ -25,6 +28,8 @@ public:
     /**
      * Sequential implementation of the clustering algorithm.
      *
+     * @tparam MT Policy describing the metric used to measure the distance between two data
+     * samples. It defaults to <code>utils::EuclideanMetric</code>.
      * @tparam D Type of the data structure/iterator holding the data samples to cluster.
      * @tparam P Type of the data structure/iterator holding the <code>pi</code> values.
      * @tparam L Type of the data structure/iterator holding the <code>lambda</code> values.
@@ -33,24 +38,33 @@ public:
      * @param dimension Number of attributes of each sample.
      * @param pi Data structure/iterator holding the <code>pi</code> values. This data structure
      * <b>MUST BE</b> big enough to contain all the <code>pi</code> values, which are exactly
-     * <code>dataSamplesCount</code>.
+     * <code>dataSamplesCount</code>.<br>
+     * Its elements can be either <code>std::size_t</code> or <code>std::uint32_t</code>.
      * @param lambda Data structure/iterator holding the <code>lambda</code> values. This data
      * structure <b>MUST BE</b> big enough to contain all the <code>pi</code> values, which are
      * exactly <code>dataSamplesCount</code>.
+     * @throws std::invalid_argument If the elements of <code>pi</code> cannot store the index of
+     * the last data sample.
      */
-    template <utils::SequentialDataIterator D, utils::PiIterator P, utils::LambdaIterator L>
+    template <typename MT = utils::EuclideanMetric,
+              utils::SequentialDataIterator D,
+              utils::PiIterator P,
+              utils::LambdaIterator L>
     static void cluster(const D &data,
                         const std::size_t dataSamplesCount,
                         const std::size_t dimension,
                         P &pi,
                         L &lambda) {
 
+        // Check that pi can store the indices of all the data samples
+        PiLambdaIteratorUtils::requirePiCapacity<P>(dataSamplesCount);
+
         Timer::start<0>();
         // Array containing the part-row values
         auto *__restrict__ const m = new double[dataSamplesCount];
 
         // Efficient iterator pointing to the first element of pi
-        const auto piBegin = PiLambdaIteratorUtils::createEfficientIterator<std::size_t, P>(
+        const auto piBegin = PiLambdaIteratorUtils::createEfficientIterator<utils::PiElement<P>, P>(
                 pi, "First element of pi");
         // Efficient iterator pointing to the first element of lambda
         const auto lambdaBegin = PiLambdaIteratorUtils::createEfficientIterator<double, L>(
@@ -62,12 +76,24 @@ public:
         auto currentLambda = lambdaBegin;
 
         // Efficient iterator pointing to the n-th element of the dataset.
-        auto currentData = utils::DataIteratorUtils::createEfficientIterator(data, "Current data");
+        auto currentData =
+                utils::DataIteratorUtils<>::createEfficientIterator(data, "Current data");
         auto dataBegin =
-                utils::DataIteratorUtils::createEfficientIterator(data, "First element of data");
+                utils::DataIteratorUtils<>::createEfficientIterator(data, "First element of data");
 
+        // Array containing the inverses of the norms of the data samples, if the metric requires
+        // them
+        auto *__restrict__ const inverseNorms =
+                (MT::REQUIRES_NORMS) ? new double[dataSamplesCount] : nullptr;
         Timer::stop<0>();
 
+        if constexpr (MT::REQUIRES_NORMS) {
+            Timer::start<2>();
+            // Compute the inverses of the norms of all the data samples once
+            computeInverseNorms<MT, D>(dataBegin, dataSamplesCount, dimension, inverseNorms);
+            Timer::stop<2>();
+        }
+
         // Log the initial progress
         Logger::startLoggingProgress<0, 1, 2, 3, 4>(dataSamplesCount);
 
@@ -78,7 +104,7 @@ public:
 
         Timer::start<9>();
         // No more operations need to be performed for the first point, so move to the second
-        utils::DataIteratorUtils::moveNext<D>(currentData, dimension);
+        utils::DataIteratorUtils<>::moveNext<D>(currentData, dimension);
 
         // Useful pointer pointing to the element following the last element of m containing a valid
         // distance
@@ -100,12 +126,18 @@ public:
             Timer::start<2>();
             // Pointer to the n-th data sample of the dataset
             const double *__restrict__ const currentDataN =
-                    utils::DataIteratorUtils::getCurrentSample<D>(currentData);
+                    utils::DataIteratorUtils<>::getCurrentSample<D>(currentData);
             // Pointer to the first byte after the n-th data sample of the dataset
             const double *__restrict__ const currentDataNEnd = currentDataN + dimension;
             // **** 2) Set M(i) to d(i, n + 1) for i = 1,..,n ****
-            computeDistances<D>(
-                    dataBegin, dimension, currentDataN, currentDataNEnd, m, distanceEnd);
+            computeDistances<MT, D>(dataBegin,
+                                    dimension,
+                                    currentDataN,
+                                    currentDataNEnd,
+                                    m,
+                                    distanceEnd,
+                                    inverseNorms,
+                                    n);
             Timer::stop<2>();
 
             Timer::start<3>();
@@ -120,12 +152,13 @@ public:
 
             Timer::start<0>();
             // Move to the next data sample
-            utils::DataIteratorUtils::moveNext<D>(currentData, dimension);
+            utils::DataIteratorUtils<>::moveNext<D>(currentData, dimension);
             ++distanceEnd;
         }
 
-        // Deallocate m, since it is not needed anymore
+        // Deallocate m and the norms, since they are not needed anymore
         delete[] m;
+        delete[] inverseNorms;
         Timer::stop<0>();
 
         // Log the final progress
@@ -151,8 +184,9 @@ private:
     static inline void initializeNewPoint(EP &currentPi, EL &currentLambda, const std::size_t n) {
 
         // **** Set pi[n] to n ****
-        PiLambdaIteratorUtils::getCurrentElement<std::size_t, P>(currentPi) = n;
-        PiLambdaIteratorUtils::moveNext<std::size_t, P>(currentPi);
+        PiLambdaIteratorUtils::getCurrentElement<utils::PiElement<P>, P>(currentPi) =
+                static_cast<utils::PiElement<P>>(n);
+        PiLambdaIteratorUtils::moveNext<utils::PiElement<P>, P>(currentPi);
 
         // **** Set lambda[n] to infinity ****
         PiLambdaIteratorUtils::getCurrentElement<double, L>(currentLambda) =
@@ -160,10 +194,45 @@ private:
         PiLambdaIteratorUtils::moveNext<double, L>(currentLambda);
     }
 
+    /**
+     * Computes the inverses of the norms of all the data samples, as required by the metrics
+     * whose accumulated value must be divided by the norms of the two data samples.
+     *
+     * @tparam MT Policy describing the metric.
+     * @tparam D Type of the data structure/iterator holding the data samples to cluster.
+     * @tparam ED Type of the efficient iterator iterating over the data structure holding the data
+     * samples to cluster.
+     * @param dataBegin Efficient iterator pointing to the first data sample.
+     * @param dataSamplesCount Number of data samples.
+     * @param dimension Dimension of the data samples.
+     * @param inverseNorms Array where the inverses of the norms will be stored.
+     */
+    template <typename MT, typename D, typename ED>
+    static inline void computeInverseNorms(ED dataBegin,
+                                           const std::size_t dataSamplesCount,
+                                           const std::size_t dimension,
+                                           double *__restrict__ const inverseNorms) {
+
+        for (std::size_t i = 0; i < dataSamplesCount; i++) {
+            // Extract the data sample
+            const double *const __restrict__ dataSample =
+                    utils::DataIteratorUtils<>::getCurrentSample<D>(dataBegin);
+            // Accumulate the metric between the data sample and itself
+            double squaredNorm = 0;
+            for (std::size_t j = 0; j < dimension; j++) {
+                squaredNorm = MT::accumulate(squaredNorm, dataSample[j], dataSample[j]);
+            }
+            inverseNorms[i] = MT::computeInverseNorm(squaredNorm);
+            // Move to the next data sample
+            utils::DataIteratorUtils<>::moveNext<D>(dataBegin, dimension);
+        }
+    }
+
     /**
      * Computes the distances between the point to add and all the points that have already
      * been added to the dendrogram.
      *
+     * @tparam MT Policy describing the metric.
      * @tparam D Type of the data structure/iterator holding the data samples to cluster.
      * @tparam ED Type of the efficient iterator iterating over the data structure holding the data
      * samples to cluster.
@@ -176,14 +245,19 @@ private:
      * @param mEnd Pointer to the element following the last valid element of <code>m</code>. This
      * value acts as a placeholder, and it is used to identify the last element of <code>m</code>
      * that will be filled with valid distances.
+     * @param inverseNorms Array containing the inverses of the norms of the data samples, if the
+     * metric requires them.
+     * @param n Index of the point to add.
      */
-    template <typename D, typename ED>
+    template <typename MT, typename D, typename ED>
     static inline void computeDistances(ED dataBegin,
                                         const std::size_t dimension,
                                         const double *__restrict__ const currentDataN,
                                         const double *__restrict__ const currentDataNEnd,
                                         double *__restrict__ const mBegin,
-                                        const double *__restrict__ const mEnd) {
+                                        const double *__restrict__ const mEnd,
+                                        const double *__restrict__ const inverseNorms,
+                                        const std::size_t n) {
 
         // Iterator over all the m[i] with 0 <= i < n
         auto *__restrict__ mIterator = mBegin;
@@ -193,12 +267,23 @@ private:
         while (mIterator != mEnd) {
             // Extract the data sample
             const double *const __restrict__ dataSample =
-                    utils::DataIteratorUtils::getCurrentSample<D>(dataBegin);
+                    utils::DataIteratorUtils<>::getCurrentSample<D>(dataBegin);
             // Compute the distance
-            *mIterator = SequentialClustering::distance(currentDataN, currentDataNEnd, dataSample);
+            if constexpr (std::is_same_v<MT, utils::EuclideanMetric>) {
+                *mIterator =
+                        SequentialClustering::distance(currentDataN, currentDataNEnd, dataSample);
+            } else {
+                *mIterator = SequentialClustering::distance<MT>(currentDataN,
+                                                                currentDataNEnd,
+                                                                dataSample,
+                                                                inverseNorms,
+                                                                n,
+                                                                static_cast<std::size_t>(
+                                                                        mIterator - mBegin));
+            }
             // Move to the next element
             ++mIterator;
-            utils::DataIteratorUtils::moveNext<D>(dataBegin, dimension);
+            utils::DataIteratorUtils<>::moveNext<D>(dataBegin, dimension);
         }
     }
 
@@ -229,7 +314,8 @@ private:
 
         while (distanceIterator != mEnd) {
             // Reference to pi[i]
-            std::size_t &piI = PiLambdaIteratorUtils::getCurrentElement<std::size_t, P>(piBegin);
+            utils::PiElement<P> &piI =
+                    PiLambdaIteratorUtils::getCurrentElement<utils::PiElement<P>, P>(piBegin);
             // Reference to lambda[i]
             double &lambdaI = PiLambdaIteratorUtils::getCurrentElement<double, L>(lambdaBegin);
             // Value of m[i]
@@ -244,13 +330,13 @@ private:
                 // **** set lambda(i) to M(i) ****
                 lambdaI = currentDistance;
                 // **** set pi(i) to n + 1 ****
-                piI = n;
+                piI = static_cast<utils::PiElement<P>>(n);
             } else {  // **** if lambda(i) < M(i) ****
                 // **** set M(pi(i)) to min { M(pi(i)), M(i) } ****
                 mPiI = std::min(mPiI, currentDistance);
             }
             // Move to the next element
-            utils::PiLambdaIteratorUtils::moveNext<std::size_t, P>(piBegin);
+            utils::PiLambdaIteratorUtils::moveNext<utils::PiElement<P>, P>(piBegin);
             utils::PiLambdaIteratorUtils::moveNext<double, L>(lambdaBegin);
             ++distanceIterator;
         }
@@ -279,7 +365,8 @@ private:
         // Loop over all the previously added points
         for (std::size_t i = 0; i <= n - 1; i++) {
             // Reference to pi[i]
-            std::size_t &piI = PiLambdaIteratorUtils::getCurrentElement<std::size_t, P>(currentPi);
+            utils::PiElement<P> &piI =
+                    PiLambdaIteratorUtils::getCurrentElement<utils::PiElement<P>, P>(currentPi);
             // Value of lambda[i]
             const double lambdaI =
                     PiLambdaIteratorUtils::getCurrentElement<double, L>(currentLambda);
@@ -290,10 +377,10 @@ private:
             // **** if lambda(i) >= lambda(pi(i)) ****
             if (lambdaI >= lambdaPiI) {
                 // **** set pi(i) to n + 1 ****
-                piI = n;
+                piI = static_cast<utils::PiElement<P>>(n);
             }
             // Move to the next element of pi and lambda
-            utils::PiLambdaIteratorUtils::moveNext<std::size_t, P>(currentPi);
+            utils::PiLambdaIteratorUtils::moveNext<utils::PiElement<P>, P>(currentPi);
             utils::PiLambdaIteratorUtils::moveNext<double, L>(currentLambda);
         }
     }
@@ -324,6 +411,45 @@ private:
 
         return sqrt(sum);
     }
+
+    /**
+     * Computes the distance between two points using the specified metric.
+     *
+     * @tparam MT Policy describing the metric.
+     * @param firstPointBegin Pointer to the first attribute of the first data sample.
+     * @param firstPointEnd Pointer to the attribute following the last attribute of the first
+     * data sample. This value acts as a placeholder, and it is used to identify the end of the
+     * first point.
+     * @param secondPointBegin Pointer to the first attribute of the second data sample.
+     * @param inverseNorms Array containing the inverses of the norms of the data samples, if the
+     * metric requires them.
+     * @param firstIndex Index of the first data sample.
+     * @param secondIndex Index of the second data sample.
+     * @return The distance between the two points.
+     */
+    template <typename MT>
+    static inline double distance(const double *__restrict__ const firstPointBegin,
+                                  const double *__restrict__ const firstPointEnd,
+                                  const double *__restrict__ const secondPointBegin,
+                                  const double *__restrict__ const inverseNorms,
+                                  const std::size_t firstIndex,
+                                  const std::size_t secondIndex) noexcept {
+
+        double value = 0;
+        const double *__restrict__ firstPoint = firstPointBegin;
+        const double *__restrict__ secondPoint = secondPointBegin;
+
+        while (firstPoint != firstPointEnd) {
+            value = MT::accumulate(value, *firstPoint, *secondPoint);
+            firstPoint++;
+            secondPoint++;
+        }
+
+        if constexpr (MT::REQUIRES_NORMS) {
+            value = MT::normalize(value, inverseNorms[firstIndex], inverseNorms[secondIndex]);
+        }
+        return MT::transform(value);
+    }
 };
 }  // namespace cluster::sequential
 #endif  // FINAL_PROJECT_HPC_SEQUENTIALCLUSTERING_H
@@ -21,13 +21,17 @@ namespace cluster::utils {
  * <code>DataIteratorUtils::lastFirstLevelDataType</code> and
  * <code>DataIteratorUtils::lastSecondLevelDataType</code> to retrieve the type of the argument
  * supplied to the <code>DataIteratorUtils::createEfficientIterator</code> method. This is again
- * useful for test purposes.
+ * useful for test purposes.<br>
+ * The class is parametrized on the type of the attributes of the data samples. Its static fields
+ * are defined only for <code>double</code> and <code>float</code> attributes.
  *
+ * @tparam S Type of the attributes of the data samples.
  * @author DeB
  * @author Jonathan
- * @version 1.2 2022-08-16
+ * @version 1.3 2022-09-24
  * @since 1.0
  */
+template <typename S = double>
 class DataIteratorUtils {
 
 public:
@@ -71,8 +75,8 @@ public:
      * purposes.
      * @return The created iterator.
      */
-    template <typename D, std::enable_if_t<ContiguousIterator<D, const double>, bool> = true>
-    static inline const double *createEfficientIterator(const D &iterator, const char *const name) {
+    template <typename D, std::enable_if_t<ContiguousIterator<D, const S>, bool> = true>
+    static inline const S *createEfficientIterator(const D &iterator, const char *const name) {
 
         printSummary(name, DataType::CONTIGUOUS, DataLevelType::ITERATOR, DataLevelType::NONE);
         return &(iterator[0]);
@@ -90,12 +94,12 @@ public:
      * @return The created iterator.
      */
     template <typename D,
-              std::enable_if_t<ContiguousIterable<D, const double> ||
-                                       ContiguousConstIterable<D, const double>,
+              std::enable_if_t<ContiguousIterable<D, const S> ||
+                                       ContiguousConstIterable<D, const S>,
                                bool> = true>
-    static inline const double *createEfficientIterator(const D &data, const char *const name) {
+    static inline const S *createEfficientIterator(const D &data, const char *const name) {
 
-        if constexpr (ContiguousConstIterable<D, const double>) {
+        if constexpr (ContiguousConstIterable<D, const S>) {
             printSummary(
                     name, DataType::CONTIGUOUS, DataLevelType::CONST_ITERABLE, DataLevelType::NONE);
             return &(data.cbegin()[0]);
@@ -118,12 +122,12 @@ public:
      * efficient iterator.
      */
     template <typename D,
-              typename I = const double *,
-              std::enable_if_t<ContiguousIterator<D, const double> ||
-                                       ContiguousIterable<D, const double> ||
-                                       ContiguousConstIterable<D, const double>,
+              typename I = const S *,
+              std::enable_if_t<ContiguousIterator<D, const S> ||
+                                       ContiguousIterable<D, const S> ||
+                                       ContiguousConstIterable<D, const S>,
                                bool> = true>
-    static inline const double *getCurrentSample(const double *const currentElement) {
+    static inline const S *getCurrentSample(const S *const currentElement) {
 
         return currentElement;
     }
@@ -139,20 +143,20 @@ public:
      * @param startElement Efficient iterator pointing to the first element of the data structure it
      * is iterating over.
      * @param index Index of the element to return.
-     * @param stride Number of <code>double</code> values between the first attribute of a data
+     * @param stride Number of <code>S</code> values between the first attribute of a data
      * sample and the first attribute of the following one. This is, therefore, the dimension of the
      * data samples, taking also into account possible paddings.
      * @return A pointer to the first attribute of the <code>index</code>-th data sample of the data
      * structure the specified efficient iterator is iterating over.
      */
     template <typename D,
-              typename I = const double *,
-              std::enable_if_t<ContiguousIterator<D, const double> ||
-                                       ContiguousIterable<D, const double> ||
-                                       ContiguousConstIterable<D, const double>,
+              typename I = const S *,
+              std::enable_if_t<ContiguousIterator<D, const S> ||
+                                       ContiguousIterable<D, const S> ||
+                                       ContiguousConstIterable<D, const S>,
                                bool> = true>
-    static inline const double *getSampleAt(
-            const double *const startElement, const std::size_t index, const std::size_t stride) {
+    static inline const S *getSampleAt(
+            const S *const startElement, const std::size_t index, const std::size_t stride) {
 
         return &(startElement[index * stride]);
     }
@@ -166,17 +170,17 @@ public:
      * @tparam I This type parameter is ignored. It is defined just to make all the overloads
      * uniform.
      * @param currentElement Efficient iterator pointing to the current element.
-     * @param stride Number of <code>double</code> values between the first attribute of a data
+     * @param stride Number of <code>S</code> values between the first attribute of a data
      * sample and the first attribute of the following one. This is, therefore, the dimension of the
      * data samples, taking also into account possible paddings.
      */
     template <typename D,
-              typename I = const double *,
-              std::enable_if_t<ContiguousIterator<D, const double> ||
-                                       ContiguousIterable<D, const double> ||
-                                       ContiguousConstIterable<D, const double>,
+              typename I = const S *,
+              std::enable_if_t<ContiguousIterator<D, const S> ||
+                                       ContiguousIterable<D, const S> ||
+                                       ContiguousConstIterable<D, const S>,
                                bool> = true>
-    static inline void moveNext(const double *&currentElement, const std::size_t stride) {
+    static inline void moveNext(const S *&currentElement, const std::size_t stride) {
 
         currentElement += stride;
     }
@@ -198,7 +202,7 @@ public:
      * @return The created iterator.
      */
     template <typename D,
-              std::enable_if_t<ContiguousIteratorOfIterators<D, const double>, bool> = true>
+              std::enable_if_t<ContiguousIteratorOfIterators<D, const S>, bool> = true>
     static inline auto *createEfficientIterator(const D &iterator, const char *const name) {
 
         printSummary(name, DataType::CONTIGUOUS, DataLevelType::ITERATOR, DataLevelType::ITERATOR);
@@ -219,8 +223,8 @@ public:
      */
     template <typename D,
               typename I,
-              std::enable_if_t<ContiguousIteratorOfIterators<D, const double>, bool> = true>
-    static inline const double *getCurrentSample(const I &currentElement) {
+              std::enable_if_t<ContiguousIteratorOfIterators<D, const S>, bool> = true>
+    static inline const S *getCurrentSample(const I &currentElement) {
 
         return &((*currentElement)[0]);
     }
@@ -243,8 +247,8 @@ public:
      */
     template <typename D,
               typename I,
-              std::enable_if_t<ContiguousIteratorOfIterators<D, const double>, bool> = true>
-    static inline const double *getSampleAt(const I &startElement,
+              std::enable_if_t<ContiguousIteratorOfIterators<D, const S>, bool> = true>
+    static inline const S *getSampleAt(const I &startElement,
                                             const std::size_t index,
                                             [[maybe_unused]] const std::size_t stride) {
 
@@ -265,7 +269,7 @@ public:
      */
     template <typename D,
               typename I,
-              std::enable_if_t<ContiguousIteratorOfIterators<D, const double>, bool> = true>
+              std::enable_if_t<ContiguousIteratorOfIterators<D, const S>, bool> = true>
     static inline void moveNext(I &currentElement, [[maybe_unused]] const std::size_t stride) {
 
         ++currentElement;
@@ -289,12 +293,12 @@ public:
      * @return The created iterator.
      */
     template <typename D,
-              std::enable_if_t<ContiguousIteratorOfIterables<D, const double> ||
-                                       ContiguousIteratorOfConstIterables<D, const double>,
+              std::enable_if_t<ContiguousIteratorOfIterables<D, const S> ||
+                                       ContiguousIteratorOfConstIterables<D, const S>,
                                bool> = true>
     static inline auto *createEfficientIterator(const D &iterator, const char *const name) {
 
-        if constexpr (ContiguousIteratorOfConstIterables<D, const double>) {
+        if constexpr (ContiguousIteratorOfConstIterables<D, const S>) {
             printSummary(name,
                          DataType::CONTIGUOUS,
                          DataLevelType::ITERATOR,
@@ -320,12 +324,12 @@ public:
      */
     template <typename D,
               typename I,
-              std::enable_if_t<ContiguousIteratorOfIterables<D, const double> ||
-                                       ContiguousIteratorOfConstIterables<D, const double>,
+              std::enable_if_t<ContiguousIteratorOfIterables<D, const S> ||
+                                       ContiguousIteratorOfConstIterables<D, const S>,
                                bool> = true>
-    static inline const double *getCurrentSample(const I &currentElementIterator) {
+    static inline const S *getCurrentSample(const I &currentElementIterator) {
 
-        if constexpr (ContiguousIteratorOfConstIterables<D, const double>) {
+        if constexpr (ContiguousIteratorOfConstIterables<D, const S>) {
             return &(((*currentElementIterator).cbegin())[0]);
         } else {
             return &(((*currentElementIterator).begin())[0]);
@@ -350,14 +354,14 @@ public:
      */
     template <typename D,
               typename I,
-              std::enable_if_t<ContiguousIteratorOfIterables<D, const double> ||
-                                       ContiguousIteratorOfConstIterables<D, const double>,
+              std::enable_if_t<ContiguousIteratorOfIterables<D, const S> ||
+                                       ContiguousIteratorOfConstIterables<D, const S>,
                                bool> = true>
-    static inline const double *getSampleAt(const I &startElementIterator,
+    static inline const S *getSampleAt(const I &startElementIterator,
                                             const std::size_t index,
                                             [[maybe_unused]] const std::size_t stride) {
 
-        if constexpr (ContiguousIteratorOfConstIterables<D, const double>) {
+        if constexpr (ContiguousIteratorOfConstIterables<D, const S>) {
             return &((startElementIterator[index].cbegin())[0]);
         } else {
             return &((startElementIterator[index].begin())[0]);
@@ -378,8 +382,8 @@ public:
      */
     template <typename D,
               typename I,
-              std::enable_if_t<ContiguousIteratorOfIterables<D, const double> ||
-                                       ContiguousIteratorOfConstIterables<D, const double>,
+              std::enable_if_t<ContiguousIteratorOfIterables<D, const S> ||
+                                       ContiguousIteratorOfConstIterables<D, const S>,
                                bool> = true>
     static inline void moveNext(I &currentElementIterator,
                                 [[maybe_unused]] const std::size_t stride) {
@@ -406,12 +410,12 @@ public:
      * @return The created iterator.
      */
     template <typename D,
-              std::enable_if_t<ContiguousIterableOfIterators<D, const double> ||
-                                       ContiguousConstIterableOfIterators<D, const double>,
+              std::enable_if_t<ContiguousIterableOfIterators<D, const S> ||
+                                       ContiguousConstIterableOfIterators<D, const S>,
                                bool> = true>
     static inline auto *createEfficientIterator(const D &data, const char *const name) {
 
-        if constexpr (ContiguousConstIterableOfIterators<D, const double>) {
+        if constexpr (ContiguousConstIterableOfIterators<D, const S>) {
             printSummary(name,
                          DataType::CONTIGUOUS,
                          DataLevelType::CONST_ITERABLE,
@@ -438,10 +442,10 @@ public:
      */
     template <typename D,
               typename I,
-              std::enable_if_t<ContiguousIterableOfIterators<D, const double> ||
-                                       ContiguousConstIterableOfIterators<D, const double>,
+              std::enable_if_t<ContiguousIterableOfIterators<D, const S> ||
+                                       ContiguousConstIterableOfIterators<D, const S>,
                                bool> = true>
-    static inline const double *getCurrentSample(const I &currentElementIterator) {
+    static inline const S *getCurrentSample(const I &currentElementIterator) {
 
         return &((*currentElementIterator)[0]);
     }
@@ -464,10 +468,10 @@ public:
      */
     template <typename D,
               typename I,
-              std::enable_if_t<ContiguousIterableOfIterators<D, const double> ||
-                                       ContiguousConstIterableOfIterators<D, const double>,
+              std::enable_if_t<ContiguousIterableOfIterators<D, const S> ||
+                                       ContiguousConstIterableOfIterators<D, const S>,
                                bool> = true>
-    static inline const double *getSampleAt(const I &startElementIterator,
+    static inline const S *getSampleAt(const I &startElementIterator,
                                             const std::size_t index,
                                             [[maybe_unused]] const std::size_t stride) {
 
@@ -488,8 +492,8 @@ public:
      */
     template <typename D,
               typename I,
-              std::enable_if_t<ContiguousIterableOfIterators<D, const double> ||
-                                       ContiguousConstIterableOfIterators<D, const double>,
+              std::enable_if_t<ContiguousIterableOfIterators<D, const S> ||
+                                       ContiguousConstIterableOfIterators<D, const S>,
                                bool> = true>
     static inline void moveNext(I &currentElementIterator,
                                 [[maybe_unused]] const std::size_t stride) {
@@ -517,17 +521,17 @@ public:
      * @return The created iterator.
      */
     template <typename D,
-              std::enable_if_t<ContiguousIterableOfIterables<D, const double> ||
-                                       ContiguousIterableOfConstIterables<D, const double> ||
-                                       ContiguousConstIterableOfIterables<D, const double> ||
-                                       ContiguousConstIterableOfConstIterables<D, const double>,
+              std::enable_if_t<ContiguousIterableOfIterables<D, const S> ||
+                                       ContiguousIterableOfConstIterables<D, const S> ||
+                                       ContiguousConstIterableOfIterables<D, const S> ||
+                                       ContiguousConstIterableOfConstIterables<D, const S>,
                                bool> = true>
     static inline auto *createEfficientIterator(const D &data, const char *const name) {
 
-        if constexpr (ContiguousConstIterableOfIterables<D, const double> ||
-                      ContiguousConstIterableOfConstIterables<D, const double>) {
+        if constexpr (ContiguousConstIterableOfIterables<D, const S> ||
+                      ContiguousConstIterableOfConstIterables<D, const S>) {
 
-            if constexpr (ContiguousConstIterableOfConstIterables<D, const double>) {
+            if constexpr (ContiguousConstIterableOfConstIterables<D, const S>) {
                 printSummary(name,
                              DataType::CONTIGUOUS,
                              DataLevelType::CONST_ITERABLE,
@@ -540,7 +544,7 @@ public:
             }
             return &((data.cbegin())[0]);
         } else {
-            if constexpr (ContiguousIterableOfConstIterables<D, const double>) {
+            if constexpr (ContiguousIterableOfConstIterables<D, const S>) {
                 printSummary(name,
                              DataType::CONTIGUOUS,
                              DataLevelType::ITERABLE,
@@ -570,15 +574,15 @@ public:
      */
     template <typename D,
               typename I,
-              std::enable_if_t<ContiguousIterableOfIterables<D, const double> ||
-                                       ContiguousIterableOfConstIterables<D, const double> ||
-                                       ContiguousConstIterableOfIterables<D, const double> ||
-                                       ContiguousConstIterableOfConstIterables<D, const double>,
+              std::enable_if_t<ContiguousIterableOfIterables<D, const S> ||
+                                       ContiguousIterableOfConstIterables<D, const S> ||
+                                       ContiguousConstIterableOfIterables<D, const S> ||
+                                       ContiguousConstIterableOfConstIterables<D, const S>,
                                bool> = true>
-    static inline const double *getCurrentSample(const I &currentElementIterator) {
+    static inline const S *getCurrentSample(const I &currentElementIterator) {
 
-        if constexpr (ContiguousIterableOfConstIterables<D, const double> ||
-                      ContiguousConstIterableOfConstIterables<D, const double>) {
+        if constexpr (ContiguousIterableOfConstIterables<D, const S> ||
+                      ContiguousConstIterableOfConstIterables<D, const S>) {
             return &(((*currentElementIterator).cbegin())[0]);
         } else {
             return &(((*currentElementIterator).begin())[0]);
@@ -603,17 +607,17 @@ public:
      */
     template <typename D,
               typename I,
-              std::enable_if_t<ContiguousIterableOfIterables<D, const double> ||
-                                       ContiguousIterableOfConstIterables<D, const double> ||
-                                       ContiguousConstIterableOfIterables<D, const double> ||
-                                       ContiguousConstIterableOfConstIterables<D, const double>,
+              std::enable_if_t<ContiguousIterableOfIterables<D, const S> ||
+                                       ContiguousIterableOfConstIterables<D, const S> ||
+                                       ContiguousConstIterableOfIterables<D, const S> ||
+                                       ContiguousConstIterableOfConstIterables<D, const S>,
                                bool> = true>
-    static inline const double *getSampleAt(const I &startElementIterator,
+    static inline const S *getSampleAt(const I &startElementIterator,
                                             const std::size_t index,
                                             [[maybe_unused]] const std::size_t stride) {
 
-        if constexpr (ContiguousIterableOfConstIterables<D, const double> ||
-                      ContiguousConstIterableOfConstIterables<D, const double>) {
+        if constexpr (ContiguousIterableOfConstIterables<D, const S> ||
+                      ContiguousConstIterableOfConstIterables<D, const S>) {
             return &((startElementIterator[index].cbegin())[0]);
         } else {
             return &((startElementIterator[index].begin())[0]);
@@ -634,10 +638,10 @@ public:
      */
     template <typename D,
               typename I,
-              std::enable_if_t<ContiguousIterableOfIterables<D, const double> ||
-                                       ContiguousIterableOfConstIterables<D, const double> ||
-                                       ContiguousConstIterableOfIterables<D, const double> ||
-                                       ContiguousConstIterableOfConstIterables<D, const double>,
+              std::enable_if_t<ContiguousIterableOfIterables<D, const S> ||
+                                       ContiguousIterableOfConstIterables<D, const S> ||
+                                       ContiguousConstIterableOfIterables<D, const S> ||
+                                       ContiguousConstIterableOfConstIterables<D, const S>,
                                bool> = true>
     static inline void moveNext(I &currentElementIterator,
                                 [[maybe_unused]] const std::size_t stride) {
@@ -661,7 +665,7 @@ public:
      * purposes.
      * @return The created iterator.
      */
-    template <typename D, std::enable_if_t<RandomIteratorOfIterators<D, const double>, bool> = true>
+    template <typename D, std::enable_if_t<RandomIteratorOfIterators<D, const S>, bool> = true>
     static inline D createEfficientIterator(const D &iterator, const char *const name) {
 
         printSummary(name, DataType::RANDOM, DataLevelType::ITERATOR, DataLevelType::ITERATOR);
@@ -682,8 +686,8 @@ public:
      */
     template <typename D,
               typename I,
-              std::enable_if_t<RandomIteratorOfIterators<D, const double>, bool> = true>
-    static inline const double *getCurrentSample(const I &currentElementIterator) {
+              std::enable_if_t<RandomIteratorOfIterators<D, const S>, bool> = true>
+    static inline const S *getCurrentSample(const I &currentElementIterator) {
 
         return &((*currentElementIterator)[0]);
     }
@@ -706,8 +710,8 @@ public:
      */
     template <typename D,
               typename I,
-              std::enable_if_t<RandomIteratorOfIterators<D, const double>, bool> = true>
-    static inline const double *getSampleAt(const I &startElementIterator,
+              std::enable_if_t<RandomIteratorOfIterators<D, const S>, bool> = true>
+    static inline const S *getSampleAt(const I &startElementIterator,
                                             const std::size_t index,
                                             [[maybe_unused]] const std::size_t stride) {
 
@@ -728,7 +732,7 @@ public:
      */
     template <typename D,
               typename I,
-              std::enable_if_t<RandomIteratorOfIterators<D, const double>, bool> = true>
+              std::enable_if_t<RandomIteratorOfIterators<D, const S>, bool> = true>
     static inline void moveNext(I &currentElementIterator,
                                 [[maybe_unused]] const std::size_t stride) {
 
@@ -752,12 +756,12 @@ public:
      * @return The created iterator.
      */
     template <typename D,
-              std::enable_if_t<RandomIteratorOfIterables<D, const double> ||
-                                       RandomIteratorOfConstIterables<D, const double>,
+              std::enable_if_t<RandomIteratorOfIterables<D, const S> ||
+                                       RandomIteratorOfConstIterables<D, const S>,
                                bool> = true>
     static inline D createEfficientIterator(const D &iterator, const char *const name) {
 
-        if constexpr (RandomIteratorOfConstIterables<D, const double>) {
+        if constexpr (RandomIteratorOfConstIterables<D, const S>) {
             printSummary(
                     name, DataType::RANDOM, DataLevelType::ITERATOR, DataLevelType::CONST_ITERABLE);
         } else {
@@ -780,12 +784,12 @@ public:
      */
     template <typename D,
               typename I,
-              std::enable_if_t<RandomIteratorOfIterables<D, const double> ||
-                                       RandomIteratorOfConstIterables<D, const double>,
+              std::enable_if_t<RandomIteratorOfIterables<D, const S> ||
+                                       RandomIteratorOfConstIterables<D, const S>,
                                bool> = true>
-    static inline const double *getCurrentSample(const I &currentElementIterator) {
+    static inline const S *getCurrentSample(const I &currentElementIterator) {
 
-        if constexpr (RandomIteratorOfConstIterables<D, const double>) {
+        if constexpr (RandomIteratorOfConstIterables<D, const S>) {
             return &(((*currentElementIterator).cbegin())[0]);
         } else {
             return &(((*currentElementIterator).begin())[0]);
@@ -810,14 +814,14 @@ public:
      */
     template <typename D,
               typename I,
-              std::enable_if_t<RandomIteratorOfIterables<D, const double> ||
-                                       RandomIteratorOfConstIterables<D, const double>,
+              std::enable_if_t<RandomIteratorOfIterables<D, const S> ||
+                                       RandomIteratorOfConstIterables<D, const S>,
                                bool> = true>
-    static inline const double *getSampleAt(const I &startElementIterator,
+    static inline const S *getSampleAt(const I &startElementIterator,
                                             const std::size_t index,
                                             [[maybe_unused]] const std::size_t stride) {
 
-        if constexpr (RandomIteratorOfConstIterables<D, const double>) {
+        if constexpr (RandomIteratorOfConstIterables<D, const S>) {
             return &((startElementIterator[index].cbegin())[0]);
         } else {
             return &((startElementIterator[index].begin())[0]);
@@ -838,8 +842,8 @@ public:
      */
     template <typename D,
               typename I,
-              std::enable_if_t<RandomIteratorOfIterables<D, const double> ||
-                                       RandomIteratorOfConstIterables<D, const double>,
+              std::enable_if_t<RandomIteratorOfIterables<D, const S> ||
+                                       RandomIteratorOfConstIterables<D, const S>,
                                bool> = true>
     static inline void moveNext(I &currentElementIterator,
                                 [[maybe_unused]] const std::size_t stride) {
@@ -865,12 +869,12 @@ public:
      * @return The created iterator.
      */
     template <typename D,
-              std::enable_if_t<RandomIterableOfIterators<D, const double> ||
-                                       RandomConstIterableOfIterators<D, const double>,
+              std::enable_if_t<RandomIterableOfIterators<D, const S> ||
+                                       RandomConstIterableOfIterators<D, const S>,
                                bool> = true>
     static inline auto createEfficientIterator(const D &data, const char *const name) {
 
-        if constexpr (RandomConstIterableOfIterators<D, const double>) {
+        if constexpr (RandomConstIterableOfIterators<D, const S>) {
             printSummary(
                     name, DataType::RANDOM, DataLevelType::CONST_ITERABLE, DataLevelType::ITERATOR);
             return data.cbegin();
@@ -894,10 +898,10 @@ public:
      */
     template <typename D,
               typename I,
-              std::enable_if_t<RandomIterableOfIterators<D, const double> ||
-                                       RandomConstIterableOfIterators<D, const double>,
+              std::enable_if_t<RandomIterableOfIterators<D, const S> ||
+                                       RandomConstIterableOfIterators<D, const S>,
                                bool> = true>
-    static inline const double *getCurrentSample(const I &currentElementIterator) {
+    static inline const S *getCurrentSample(const I &currentElementIterator) {
 
         return &((*currentElementIterator)[0]);
     }
@@ -920,10 +924,10 @@ public:
      */
     template <typename D,
               typename I,
-              std::enable_if_t<RandomIterableOfIterators<D, const double> ||
-                                       RandomConstIterableOfIterators<D, const double>,
+              std::enable_if_t<RandomIterableOfIterators<D, const S> ||
+                                       RandomConstIterableOfIterators<D, const S>,
                                bool> = true>
-    static inline const double *getSampleAt(const I &startElementIterator,
+    static inline const S *getSampleAt(const I &startElementIterator,
                                             const std::size_t index,
                                             [[maybe_unused]] const std::size_t stride) {
 
@@ -944,8 +948,8 @@ public:
      */
     template <typename D,
               typename I,
-              std::enable_if_t<RandomIterableOfIterators<D, const double> ||
-                                       RandomConstIterableOfIterators<D, const double>,
+              std::enable_if_t<RandomIterableOfIterators<D, const S> ||
+                                       RandomConstIterableOfIterators<D, const S>,
                                bool> = true>
     static inline void moveNext(I &currentElementIterator,
                                 [[maybe_unused]] const std::size_t stride) {
@@ -973,16 +977,16 @@ public:
      * @return The created iterator.
      */
     template <typename D,
-              std::enable_if_t<RandomIterableOfIterables<D, const double> ||
-                                       RandomIterableOfConstIterables<D, const double> ||
-                                       RandomConstIterableOfIterables<D, const double> ||
-                                       RandomConstIterableOfConstIterables<D, const double>,
+              std::enable_if_t<RandomIterableOfIterables<D, const S> ||
+                                       RandomIterableOfConstIterables<D, const S> ||
+                                       RandomConstIterableOfIterables<D, const S> ||
+                                       RandomConstIterableOfConstIterables<D, const S>,
                                bool> = true>
     static inline auto createEfficientIterator(const D &data, const char *const name) {
 
-        if constexpr (RandomConstIterableOfIterables<D, const double> ||
-                      RandomConstIterableOfConstIterables<D, const double>) {
-            if constexpr (RandomConstIterableOfConstIterables<D, const double>) {
+        if constexpr (RandomConstIterableOfIterables<D, const S> ||
+                      RandomConstIterableOfConstIterables<D, const S>) {
+            if constexpr (RandomConstIterableOfConstIterables<D, const S>) {
                 printSummary(name,
                              DataType::RANDOM,
                              DataLevelType::CONST_ITERABLE,
@@ -995,7 +999,7 @@ public:
             }
             return data.cbegin();
         } else {
-            if constexpr (RandomIterableOfConstIterables<D, const double>) {
+            if constexpr (RandomIterableOfConstIterables<D, const S>) {
                 printSummary(name,
                              DataType::RANDOM,
                              DataLevelType::ITERABLE,
@@ -1022,15 +1026,15 @@ public:
      */
     template <typename D,
               typename I,
-              std::enable_if_t<RandomIterableOfIterables<D, const double> ||
-                                       RandomIterableOfConstIterables<D, const double> ||
-                                       RandomConstIterableOfIterables<D, const double> ||
-                                       RandomConstIterableOfConstIterables<D, const double>,
+              std::enable_if_t<RandomIterableOfIterables<D, const S> ||
+                                       RandomIterableOfConstIterables<D, const S> ||
+                                       RandomConstIterableOfIterables<D, const S> ||
+                                       RandomConstIterableOfConstIterables<D, const S>,
                                bool> = true>
-    static inline const double *getCurrentSample(const I &currentElementIterator) {
+    static inline const S *getCurrentSample(const I &currentElementIterator) {
 
-        if constexpr (RandomIterableOfConstIterables<D, const double> ||
-                      RandomConstIterableOfConstIterables<D, const double>) {
+        if constexpr (RandomIterableOfConstIterables<D, const S> ||
+                      RandomConstIterableOfConstIterables<D, const S>) {
             return &(((*currentElementIterator).cbegin())[0]);
         } else {
             return &(((*currentElementIterator).begin())[0]);
@@ -1055,17 +1059,17 @@ public:
      */
     template <typename D,
               typename I,
-              std::enable_if_t<RandomIterableOfIterables<D, const double> ||
-                                       RandomIterableOfConstIterables<D, const double> ||
-                                       RandomConstIterableOfIterables<D, const double> ||
-                                       RandomConstIterableOfConstIterables<D, const double>,
+              std::enable_if_t<RandomIterableOfIterables<D, const S> ||
+                                       RandomIterableOfConstIterables<D, const S> ||
+                                       RandomConstIterableOfIterables<D, const S> ||
+                                       RandomConstIterableOfConstIterables<D, const S>,
                                bool> = true>
-    static inline const double *getSampleAt(const I &startElementIterator,
+    static inline const S *getSampleAt(const I &startElementIterator,
                                             const std::size_t index,
                                             [[maybe_unused]] const std::size_t stride) {
 
-        if constexpr (RandomIterableOfConstIterables<D, const double> ||
-                      RandomConstIterableOfConstIterables<D, const double>) {
+        if constexpr (RandomIterableOfConstIterables<D, const S> ||
+                      RandomConstIterableOfConstIterables<D, const S>) {
             return &((startElementIterator[index].cbegin())[0]);
         } else {
             return &((startElementIterator[index].begin())[0]);
@@ -1086,10 +1090,10 @@ public:
      */
     template <typename D,
               typename I,
-              std::enable_if_t<RandomIterableOfIterables<D, const double> ||
-                                       RandomIterableOfConstIterables<D, const double> ||
-                                       RandomConstIterableOfIterables<D, const double> ||
-                                       RandomConstIterableOfConstIterables<D, const double>,
+              std::enable_if_t<RandomIterableOfIterables<D, const S> ||
+                                       RandomIterableOfConstIterables<D, const S> ||
+                                       RandomConstIterableOfIterables<D, const S> ||
+                                       RandomConstIterableOfConstIterables<D, const S>,
                                bool> = true>
     static inline void moveNext(I &currentElementIterator,
                                 [[maybe_unused]] const std::size_t stride) {
@@ -1113,7 +1117,7 @@ public:
      * purposes.
      * @return The created iterator.
      */
-    template <typename D, std::enable_if_t<InputIteratorOfIterators<D, const double>, bool> = true>
+    template <typename D, std::enable_if_t<InputIteratorOfIterators<D, const S>, bool> = true>
     static inline D createEfficientIterator(const D &iterator, const char *const name) {
 
         printSummary(name, DataType::INPUT, DataLevelType::ITERATOR, DataLevelType::ITERATOR);
@@ -1134,8 +1138,8 @@ public:
      */
     template <typename D,
               typename I,
-              std::enable_if_t<InputIteratorOfIterators<D, const double>, bool> = true>
-    static inline const double *getCurrentSample(const I &currentElementIterator) {
+              std::enable_if_t<InputIteratorOfIterators<D, const S>, bool> = true>
+    static inline const S *getCurrentSample(const I &currentElementIterator) {
 
         return &((*currentElementIterator)[0]);
     }
@@ -1154,7 +1158,7 @@ public:
      */
     template <typename D,
               typename I,
-              std::enable_if_t<InputIteratorOfIterators<D, const double>, bool> = true>
+              std::enable_if_t<InputIteratorOfIterators<D, const S>, bool> = true>
     static inline void moveNext(I &currentElementIterator,
                                 [[maybe_unused]] const std::size_t stride) {
 
@@ -1178,12 +1182,12 @@ public:
      * @return The created iterator.
      */
     template <typename D,
-              std::enable_if_t<InputIteratorOfIterables<D, const double> ||
-                                       InputIteratorOfConstIterables<D, const double>,
+              std::enable_if_t<InputIteratorOfIterables<D, const S> ||
+                                       InputIteratorOfConstIterables<D, const S>,
                                bool> = true>
     static inline D createEfficientIterator(const D &iterator, const char *const name) {
 
-        if constexpr (InputIteratorOfConstIterables<D, const double>) {
+        if constexpr (InputIteratorOfConstIterables<D, const S>) {
             printSummary(
                     name, DataType::INPUT, DataLevelType::ITERATOR, DataLevelType::CONST_ITERABLE);
         } else {
@@ -1206,12 +1210,12 @@ public:
      */
     template <typename D,
               typename I,
-              std::enable_if_t<InputIteratorOfIterables<D, const double> ||
-                                       InputIteratorOfConstIterables<D, const double>,
+              std::enable_if_t<InputIteratorOfIterables<D, const S> ||
+                                       InputIteratorOfConstIterables<D, const S>,
                                bool> = true>
-    static inline const double *getCurrentSample(const I &currentElementIterator) {
+    static inline const S *getCurrentSample(const I &currentElementIterator) {
 
-        if constexpr (InputIteratorOfConstIterables<D, const double>) {
+        if constexpr (InputIteratorOfConstIterables<D, const S>) {
             return &(((*currentElementIterator).cbegin())[0]);
         } else {
             return &(((*currentElementIterator).begin())[0]);
@@ -1232,8 +1236,8 @@ public:
      */
     template <typename D,
               typename I,
-              std::enable_if_t<InputIteratorOfIterables<D, const double> ||
-                                       InputIteratorOfConstIterables<D, const double>,
+              std::enable_if_t<InputIteratorOfIterables<D, const S> ||
+                                       InputIteratorOfConstIterables<D, const S>,
                                bool> = true>
     static inline void moveNext(I &currentElementIterator,
                                 [[maybe_unused]] const std::size_t stride) {
@@ -1259,12 +1263,12 @@ public:
      * @return The created iterator.
      */
     template <typename D,
-              std::enable_if_t<InputIterableOfIterators<D, const double> ||
-                                       InputConstIterableOfIterators<D, const double>,
+              std::enable_if_t<InputIterableOfIterators<D, const S> ||
+                                       InputConstIterableOfIterators<D, const S>,
                                bool> = true>
     static inline auto createEfficientIterator(const D &data, const char *const name) {
 
-        if constexpr (InputConstIterableOfIterators<D, const double>) {
+        if constexpr (InputConstIterableOfIterators<D, const S>) {
             printSummary(
                     name, DataType::INPUT, DataLevelType::CONST_ITERABLE, DataLevelType::ITERATOR);
             return data.cbegin();
@@ -1288,10 +1292,10 @@ public:
      */
     template <typename D,
               typename I,
-              std::enable_if_t<InputIterableOfIterators<D, const double> ||
-                                       InputConstIterableOfIterators<D, const double>,
+              std::enable_if_t<InputIterableOfIterators<D, const S> ||
+                                       InputConstIterableOfIterators<D, const S>,
                                bool> = true>
-    static inline const double *getCurrentSample(const I &currentElementIterator) {
+    static inline const S *getCurrentSample(const I &currentElementIterator) {
 
         return &((*currentElementIterator)[0]);
     }
@@ -1310,8 +1314,8 @@ public:
      */
     template <typename D,
               typename I,
-              std::enable_if_t<InputIterableOfIterators<D, const double> ||
-                                       InputConstIterableOfIterators<D, const double>,
+              std::enable_if_t<InputIterableOfIterators<D, const S> ||
+                                       InputConstIterableOfIterators<D, const S>,
                                bool> = true>
     static inline void moveNext(I &currentElementIterator,
                                 [[maybe_unused]] const std::size_t stride) {
@@ -1339,16 +1343,16 @@ public:
      * @return The created iterator.
      */
     template <typename D,
-              std::enable_if_t<InputIterableOfIterables<D, const double> ||
-                                       InputIterableOfConstIterables<D, const double> ||
-                                       InputConstIterableOfIterables<D, const double> ||
-                                       InputConstIterableOfConstIterables<D, const double>,
+              std::enable_if_t<InputIterableOfIterables<D, const S> ||
+                                       InputIterableOfConstIterables<D, const S> ||
+                                       InputConstIterableOfIterables<D, const S> ||
+                                       InputConstIterableOfConstIterables<D, const S>,
                                bool> = true>
     static inline auto createEfficientIterator(const D &data, const char *const name) {
 
-        if constexpr (InputConstIterableOfIterables<D, const double> ||
-                      InputConstIterableOfConstIterables<D, const double>) {
-            if constexpr (InputConstIterableOfConstIterables<D, const double>) {
+        if constexpr (InputConstIterableOfIterables<D, const S> ||
+                      InputConstIterableOfConstIterables<D, const S>) {
+            if constexpr (InputConstIterableOfConstIterables<D, const S>) {
                 printSummary(name,
                              DataType::INPUT,
                              DataLevelType::CONST_ITERABLE,
@@ -1361,7 +1365,7 @@ public:
             }
             return data.cbegin();
         } else {
-            if constexpr (InputIterableOfConstIterables<D, const double>) {
+            if constexpr (InputIterableOfConstIterables<D, const S>) {
                 printSummary(name,
                              DataType::INPUT,
                              DataLevelType::ITERABLE,
@@ -1388,15 +1392,15 @@ public:
      */
     template <typename D,
               typename I,
-              std::enable_if_t<InputIterableOfIterables<D, const double> ||
-                                       InputIterableOfConstIterables<D, const double> ||
-                                       InputConstIterableOfIterables<D, const double> ||
-                                       InputConstIterableOfConstIterables<D, const double>,
+              std::enable_if_t<InputIterableOfIterables<D, const S> ||
+                                       InputIterableOfConstIterables<D, const S> ||
+                                       InputConstIterableOfIterables<D, const S> ||
+                                       InputConstIterableOfConstIterables<D, const S>,
                                bool> = true>
-    static inline const double *getCurrentSample(const I &currentElementIterator) {
+    static inline const S *getCurrentSample(const I &currentElementIterator) {
 
-        if constexpr (InputIterableOfConstIterables<D, const double> ||
-                      InputConstIterableOfConstIterables<D, const double>) {
+        if constexpr (InputIterableOfConstIterables<D, const S> ||
+                      InputConstIterableOfConstIterables<D, const S>) {
             return &(((*currentElementIterator).cbegin())[0]);
         } else {
             return &(((*currentElementIterator).begin())[0]);
@@ -1417,10 +1421,10 @@ public:
      */
     template <typename D,
               typename I,
-              std::enable_if_t<InputIterableOfIterables<D, const double> ||
-                                       InputIterableOfConstIterables<D, const double> ||
-                                       InputConstIterableOfIterables<D, const double> ||
-                                       InputConstIterableOfConstIterables<D, const double>,
+              std::enable_if_t<InputIterableOfIterables<D, const S> ||
+                                       InputIterableOfConstIterables<D, const S> ||
+                                       InputConstIterableOfIterables<D, const S> ||
+                                       InputConstIterableOfConstIterables<D, const S>,
                                bool> = true>
     static inline void moveNext(I &currentElementIterator,
                                 [[maybe_unused]] const std::size_t stride) {
@@ -1473,6 +1477,9 @@ private:
     }
 };
 
+// The static fields are defined, once, in the implementation file
+extern template class DataIteratorUtils<double>;
+extern template class DataIteratorUtils<float>;
 }  // namespace cluster::utils
 
 #endif  // FINAL_PROJECT_HPC_DATAITERATORUTILS_H
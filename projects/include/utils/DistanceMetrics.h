@@ -0,0 +1,804 @@
+/*
+ * File containing the policies describing the metrics that can be used to measure the distance
+ * between two data samples.<br>
+ * A metric policy does not compute the distance by itself: it describes how the attributes of two
+ * data samples are accumulated, both one at a time and one SSE or AVX pack at a time, and how the
+ * accumulated value is turned into the distance. In this way, the same loops over the attributes
+ * can be used with all the metrics, and the value of each metric can be accumulated in the
+ * registers.<br>
+ * Every metric policy provides:
+ * <ul>
+ *      <li><code>IDENTIFIER</code>, that identifies the metric, e.g., in the files where the state
+ *      of a clustering is saved;</li>
+ *      <li><code>REQUIRES_NORMS</code>, that is <code>true</code> if the accumulated value must be
+ *      divided by the norms of the two data samples, which are computed once before the
+ *      clustering starts;</li>
+ *      <li><code>IS_TRANSFORMED</code>, that is <code>true</code> if the accumulated value is not
+ *      the distance, but a monotonically increasing function of it, so that it can be used in
+ *      place of the distance by the clustering algorithm, and the distances are obtained by
+ *      calling <code>transform</code> only on the final values of <code>lambda</code>;</li>
+ *      <li><code>accumulate</code>, that adds to the accumulated value the contribution of an
+ *      attribute, or of a pack of attributes, of the two data samples;</li>
+ *      <li><code>reduce</code>, that combines the lanes of an SSE or AVX accumulator;</li>
+ *      <li><code>transform</code>, that turns the accumulated value into the distance.</li>
+ * </ul>
+ * The policies that require the norms also provide <code>computeInverseNorm</code>, that computes
+ * the inverse of the norm of a data sample from the value accumulated between the data sample and
+ * itself, and <code>normalize</code>, that divides the accumulated value by the norms.<br>
+ * The accumulated value of all the metrics is <code>0</code> if the data samples have no
+ * attributes, so the data samples can be padded with <code>0</code> as the SSE and AVX distance
+ * computers require.
+ *
+ * @author DeB
+ * @author Jonathan
+ * @version 1.1 2022-10-16
+ * @since 1.0
+ */
+#ifndef FINAL_PROJECT_HPC_DISTANCEMETRICS_H
+#define FINAL_PROJECT_HPC_DISTANCEMETRICS_H
+
+#include <algorithm>
+#include <cmath>
+#include <cstddef>
+#include <cstdint>
+#include <immintrin.h>
+
+namespace cluster::utils {
+
+/**
+ * Base of the metric policies whose accumulated value is the sum of the contributions of the
+ * attributes, providing the horizontal sums of the SSE and AVX accumulators.
+ */
+struct SummingMetric {
+
+    /**
+     * Sums the 2 lanes of the specified SSE accumulator.
+     *
+     * @param accumulator Accumulator to reduce.
+     * @return The sum of the lanes of the accumulator.
+     */
+    __attribute__((target("sse3"))) static inline double reduce(const __m128d accumulator) {
+
+        return _mm_hadd_pd(accumulator, accumulator)[0];
+    }
+
+    /**
+     * Sums the 4 lanes of the specified SSE accumulator.
+     *
+     * @param accumulator Accumulator to reduce.
+     * @return The sum of the lanes of the accumulator.
+     */
+    __attribute__((target("sse3"))) static inline float reduce(const __m128 accumulator) {
+
+        const __m128 pairs = _mm_hadd_ps(accumulator, accumulator);
+        return _mm_hadd_ps(pairs, pairs)[0];
+    }
+
+    /**
+     * Sums the 4 lanes of the specified AVX accumulator.
+     *
+     * @param accumulator Accumulator to reduce.
+     * @return The sum of the lanes of the accumulator.
+     */
+    __attribute__((target("avx"))) static inline double reduce(const __m256d accumulator) {
+
+        return reduce(_mm_add_pd(_mm256_castpd256_pd128(accumulator),
+                                 _mm256_extractf128_pd(accumulator, 1)));
+    }
+
+    /**
+     * Sums the 8 lanes of the specified AVX accumulator.
+     *
+     * @param accumulator Accumulator to reduce.
+     * @return The sum of the lanes of the accumulator.
+     */
+    __attribute__((target("avx"))) static inline float reduce(const __m256 accumulator) {
+
+        return reduce(_mm_add_ps(_mm256_castps256_ps128(accumulator),
+                                 _mm256_extractf128_ps(accumulator, 1)));
+    }
+};
+
+/**
+ * Euclidean metric, i.e., the square root of the sum of the squares of the differences between
+ * the attributes. The accumulated value is the square of the distance.
+ */
+struct EuclideanMetric : SummingMetric {
+
+    /**
+     * Identifier of the metric.
+     */
+    static const constexpr std::uint32_t IDENTIFIER = 1;
+
+    /**
+     * The accumulated value does not need the norms of the data samples.
+     */
+    static const constexpr bool REQUIRES_NORMS = false;
+
+    /**
+     * The accumulated value is the square of the distance.
+     */
+    static const constexpr bool IS_TRANSFORMED = true;
+
+    /**
+     * Adds the square of the difference between two attributes to the accumulated value.
+     *
+     * @tparam S Type of the attributes.
+     * @param accumulator Accumulated value.
+     * @param first Attribute of the first data sample.
+     * @param second Attribute of the second data sample.
+     * @return The updated accumulated value.
+     */
+    template <typename S>
+    static inline S accumulate(const S accumulator, const S first, const S second) {
+
+        const S difference = first - second;
+        return accumulator + difference * difference;
+    }
+
+    /**
+     * Adds the squares of the differences between two packs of attributes to the accumulator.
+     *
+     * @param accumulator Accumulator.
+     * @param first Pack of attributes of the first data sample.
+     * @param second Pack of attributes of the second data sample.
+     * @return The updated accumulator.
+     */
+    __attribute__((target("sse3"))) static inline __m128d accumulate(const __m128d accumulator,
+                                                                     const __m128d first,
+                                                                     const __m128d second) {
+
+        const __m128d difference = _mm_sub_pd(first, second);
+        return _mm_add_pd(accumulator, _mm_mul_pd(difference, difference));
+    }
+
+    /**
+     * Adds the squares of the differences between two packs of attributes to the accumulator.
+     *
+     * @param accumulator Accumulator.
+     * @param first Pack of attributes of the first data sample.
+     * @param second Pack of attributes of the second data sample.
+     * @return The updated accumulator.
+     */
+    __attribute__((target("sse3"))) static inline __m128 accumulate(const __m128 accumulator,
+                                                                    const __m128 first,
+                                                                    const __m128 second) {
+
+        const __m128 difference = _mm_sub_ps(first, second);
+        return _mm_add_ps(accumulator, _mm_mul_ps(difference, difference));
+    }
+
+    /**
+     * Adds the squares of the differences between two packs of attributes to the accumulator.
+     *
+     * @param accumulator Accumulator.
+     * @param first Pack of attributes of the first data sample.
+     * @param second Pack of attributes of the second data sample.
+     * @return The updated accumulator.
+     */
+    __attribute__((target("avx"))) static inline __m256d accumulate(const __m256d accumulator,
+                                                                    const __m256d first,
+                                                                    const __m256d second) {
+
+        const __m256d difference = _mm256_sub_pd(first, second);
+        return _mm256_add_pd(accumulator, _mm256_mul_pd(difference, difference));
+    }
+
+    /**
+     * Adds the squares of the differences between two packs of attributes to the accumulator.
+     *
+     * @param accumulator Accumulator.
+     * @param first Pack of attributes of the first data sample.
+     * @param second Pack of attributes of the second data sample.
+     * @return The updated accumulator.
+     */
+    __attribute__((target("avx"))) static inline __m256 accumulate(const __m256 accumulator,
+                                                                   const __m256 first,
+                                                                   const __m256 second) {
+
+        const __m256 difference = _mm256_sub_ps(first, second);
+        return _mm256_add_ps(accumulator, _mm256_mul_ps(difference, difference));
+    }
+
+    /**
+     * Computes the distance from the accumulated value.
+     *
+     * @param value Accumulated value.
+     * @return The square root of the accumulated value.
+     */
+    static inline double transform(const double value) {
+
+        return sqrt(value);
+    }
+};
+
+/**
+ * Manhattan metric, i.e., the sum of the absolute values of the differences between the
+ * attributes. The accumulated value is the distance itself.
+ */
+struct ManhattanMetric : SummingMetric {
+
+    /**
+     * Identifier of the metric.
+     */
+    static const constexpr std::uint32_t IDENTIFIER = 2;
+
+    /**
+     * The accumulated value does not need the norms of the data samples.
+     */
+    static const constexpr bool REQUIRES_NORMS = false;
+
+    /**
+     * The accumulated value is the distance itself.
+     */
+    static const constexpr bool IS_TRANSFORMED = false;
+
+    /**
+     * Adds the absolute value of the difference between two attributes to the accumulated value.
+     *
+     * @tparam S Type of the attributes.
+     * @param accumulator Accumulated value.
+     * @param first Attribute of the first data sample.
+     * @param second Attribute of the second data sample.
+     * @return The updated accumulated value.
+     */
+    template <typename S>
+    static inline S accumulate(const S accumulator, const S first, const S second) {
+
+        return accumulator + std::abs(first - second);
+    }
+
+    /**
+     * Adds the absolute values of the differences between two packs of attributes to the
+     * accumulator.
+     *
+     * @param accumulator Accumulator.
+     * @param first Pack of attributes of the first data sample.
+     * @param second Pack of attributes of the second data sample.
+     * @return The updated accumulator.
+     */
+    __attribute__((target("sse3"))) static inline __m128d accumulate(const __m128d accumulator,
+                                                                     const __m128d first,
+                                                                     const __m128d second) {
+
+        // Clear the sign bits of the differences
+        return _mm_add_pd(accumulator,
+                          _mm_andnot_pd(_mm_set1_pd(-0.0), _mm_sub_pd(first, second)));
+    }
+
+    /**
+     * Adds the absolute values of the differences between two packs of attributes to the
+     * accumulator.
+     *
+     * @param accumulator Accumulator.
+     * @param first Pack of attributes of the first data sample.
+     * @param second Pack of attributes of the second data sample.
+     * @return The updated accumulator.
+     */
+    __attribute__((target("sse3"))) static inline __m128 accumulate(const __m128 accumulator,
+                                                                    const __m128 first,
+                                                                    const __m128 second) {
+
+        // Clear the sign bits of the differences
+        return _mm_add_ps(accumulator,
+                          _mm_andnot_ps(_mm_set1_ps(-0.0F), _mm_sub_ps(first, second)));
+    }
+
+    /**
+     * Adds the absolute values of the differences between two packs of attributes to the
+     * accumulator.
+     *
+     * @param accumulator Accumulator.
+     * @param first Pack of attributes of the first data sample.
+     * @param second Pack of attributes of the second data sample.
+     * @return The updated accumulator.
+     */
+    __attribute__((target("avx"))) static inline __m256d accumulate(const __m256d accumulator,
+                                                                    const __m256d first,
+                                                                    const __m256d second) {
+
+        // Clear the sign bits of the differences
+        return _mm256_add_pd(accumulator,
+                             _mm256_andnot_pd(_mm256_set1_pd(-0.0), _mm256_sub_pd(first, second)));
+    }
+
+    /**
+     * Adds the absolute values of the differences between two packs of attributes to the
+     * accumulator.
+     *
+     * @param accumulator Accumulator.
+     * @param first Pack of attributes of the first data sample.
+     * @param second Pack of attributes of the second data sample.
+     * @return The updated accumulator.
+     */
+    __attribute__((target("avx"))) static inline __m256 accumulate(const __m256 accumulator,
+                                                                   const __m256 first,
+                                                                   const __m256 second) {
+
+        // Clear the sign bits of the differences
+        return _mm256_add_ps(
+                accumulator, _mm256_andnot_ps(_mm256_set1_ps(-0.0F), _mm256_sub_ps(first, second)));
+    }
+
+    /**
+     * Computes the distance from the accumulated value.
+     *
+     * @param value Accumulated value.
+     * @return The accumulated value.
+     */
+    static inline double transform(const double value) {
+
+        return value;
+    }
+};
+
+/**
+ * Chebyshev metric, i.e., the maximum of the absolute values of the differences between the
+ * attributes. The accumulated value is the distance itself.
+ */
+struct ChebyshevMetric {
+
+    /**
+     * Identifier of the metric.
+     */
+    static const constexpr std::uint32_t IDENTIFIER = 3;
+
+    /**
+     * The accumulated value does not need the norms of the data samples.
+     */
+    static const constexpr bool REQUIRES_NORMS = false;
+
+    /**
+     * The accumulated value is the distance itself.
+     */
+    static const constexpr bool IS_TRANSFORMED = false;
+
+    /**
+     * Replaces the accumulated value with the absolute value of the difference between two
+     * attributes, if the latter is greater.
+     *
+     * @tparam S Type of the attributes.
+     * @param accumulator Accumulated value.
+     * @param first Attribute of the first data sample.
+     * @param second Attribute of the second data sample.
+     * @return The updated accumulated value.
+     */
+    template <typename S>
+    static inline S accumulate(const S accumulator, const S first, const S second) {
+
+        return std::max(accumulator, std::abs(first - second));
+    }
+
+    /**
+     * Replaces each lane of the accumulator with the absolute value of the corresponding
+     * difference between two packs of attributes, if the latter is greater.
+     *
+     * @param accumulator Accumulator.
+     * @param first Pack of attributes of the first data sample.
+     * @param second Pack of attributes of the second data sample.
+     * @return The updated accumulator.
+     */
+    __attribute__((target("sse3"))) static inline __m128d accumulate(const __m128d accumulator,
+                                                                     const __m128d first,
+                                                                     const __m128d second) {
+
+        // Clear the sign bits of the differences
+        return _mm_max_pd(accumulator,
+                          _mm_andnot_pd(_mm_set1_pd(-0.0), _mm_sub_pd(first, second)));
+    }
+
+    /**
+     * Replaces each lane of the accumulator with the absolute value of the corresponding
+     * difference between two packs of attributes, if the latter is greater.
+     *
+     * @param accumulator Accumulator.
+     * @param first Pack of attributes of the first data sample.
+     * @param second Pack of attributes of the second data sample.
+     * @return The updated accumulator.
+     */
+    __attribute__((target("sse3"))) static inline __m128 accumulate(const __m128 accumulator,
+                                                                    const __m128 first,
+                                                                    const __m128 second) {
+
+        // Clear the sign bits of the differences
+        return _mm_max_ps(accumulator,
+                          _mm_andnot_ps(_mm_set1_ps(-0.0F), _mm_sub_ps(first, second)));
+    }
+
+    /**
+     * Replaces each lane of the accumulator with the absolute value of the corresponding
+     * difference between two packs of attributes, if the latter is greater.
+     *
+     * @param accumulator Accumulator.
+     * @param first Pack of attributes of the first data sample.
+     * @param second Pack of attributes of the second data sample.
+     * @return The updated accumulator.
+     */
+    __attribute__((target("avx"))) static inline __m256d accumulate(const __m256d accumulator,
+                                                                    const __m256d first,
+                                                                    const __m256d second) {
+
+        // Clear the sign bits of the differences
+        return _mm256_max_pd(accumulator,
+                             _mm256_andnot_pd(_mm256_set1_pd(-0.0), _mm256_sub_pd(first, second)));
+    }
+
+    /**
+     * Replaces each lane of the accumulator with the absolute value of the corresponding
+     * difference between two packs of attributes, if the latter is greater.
+     *
+     * @param accumulator Accumulator.
+     * @param first Pack of attributes of the first data sample.
+     * @param second Pack of attributes of the second data sample.
+     * @return The updated accumulator.
+     */
+    __attribute__((target("avx"))) static inline __m256 accumulate(const __m256 accumulator,
+                                                                   const __m256 first,
+                                                                   const __m256 second) {
+
+        // Clear the sign bits of the differences
+        return _mm256_max_ps(
+                accumulator, _mm256_andnot_ps(_mm256_set1_ps(-0.0F), _mm256_sub_ps(first, second)));
+    }
+
+    /**
+     * Computes the maximum of the 2 lanes of the specified SSE accumulator.
+     *
+     * @param accumulator Accumulator to reduce.
+     * @return The maximum of the lanes of the accumulator.
+     */
+    __attribute__((target("sse3"))) static inline double reduce(const __m128d accumulator) {
+
+        return _mm_max_sd(accumulator, _mm_unpackhi_pd(accumulator, accumulator))[0];
+    }
+
+    /**
+     * Computes the maximum of the 4 lanes of the specified SSE accumulator.
+     *
+     * @param accumulator Accumulator to reduce.
+     * @return The maximum of the lanes of the accumulator.
+     */
+    __attribute__((target("sse3"))) static inline float reduce(const __m128 accumulator) {
+
+        const __m128 pairs = _mm_max_ps(accumulator, _mm_movehl_ps(accumulator, accumulator));
+        return _mm_max_ss(pairs, _mm_movehdup_ps(pairs))[0];
+    }
+
+    /**
+     * Computes the maximum of the 4 lanes of the specified AVX accumulator.
+     *
+     * @param accumulator Accumulator to reduce.
+     * @return The maximum of the lanes of the accumulator.
+     */
+    __attribute__((target("avx"))) static inline double reduce(const __m256d accumulator) {
+
+        return reduce(_mm_max_pd(_mm256_castpd256_pd128(accumulator),
+                                 _mm256_extractf128_pd(accumulator, 1)));
+    }
+
+    /**
+     * Computes the maximum of the 8 lanes of the specified AVX accumulator.
+     *
+     * @param accumulator Accumulator to reduce.
+     * @return The maximum of the lanes of the accumulator.
+     */
+    __attribute__((target("avx"))) static inline float reduce(const __m256 accumulator) {
+
+        return reduce(_mm_max_ps(_mm256_castps256_ps128(accumulator),
+                                 _mm256_extractf128_ps(accumulator, 1)));
+    }
+
+    /**
+     * Computes the distance from the accumulated value.
+     *
+     * @param value Accumulated value.
+     * @return The accumulated value.
+     */
+    static inline double transform(const double value) {
+
+        return value;
+    }
+};
+
+/**
+ * Minkowski metric of order <code>O</code>, i.e., the <code>O</code>-th root of the sum of the
+ * <code>O</code>-th powers of the absolute values of the differences between the attributes. The
+ * accumulated value is the <code>O</code>-th power of the distance.<br>
+ * The powers are computed by repeated multiplications, so the order is a compile-time integer.
+ * The orders <code>1</code> and <code>2</code> give the same distances as
+ * <code>ManhattanMetric</code> and <code>EuclideanMetric</code>.
+ *
+ * @tparam O Order of the metric. It <b>MUST BE</b> at least <code>1</code>.
+ */
+template <std::size_t O>
+struct MinkowskiMetric : SummingMetric {
+
+    static_assert(O >= 1, "The order of the Minkowski metric must be at least 1.");
+    static_assert(O < 0x04000000U, "The order of the Minkowski metric is too large.");
+
+    /**
+     * Identifier of the metric, that includes the order.
+     */
+    static const constexpr std::uint32_t IDENTIFIER = 0x04000000U + static_cast<std::uint32_t>(O);
+
+    /**
+     * The accumulated value does not need the norms of the data samples.
+     */
+    static const constexpr bool REQUIRES_NORMS = false;
+
+    /**
+     * The accumulated value is the <code>O</code>-th power of the distance, unless the order is
+     * <code>1</code>.
+     */
+    static const constexpr bool IS_TRANSFORMED = (O > 1);
+
+    /**
+     * Adds the <code>O</code>-th power of the absolute value of the difference between two
+     * attributes to the accumulated value.
+     *
+     * @tparam S Type of the attributes.
+     * @param accumulator Accumulated value.
+     * @param first Attribute of the first data sample.
+     * @param second Attribute of the second data sample.
+     * @return The updated accumulated value.
+     */
+    template <typename S>
+    static inline S accumulate(const S accumulator, const S first, const S second) {
+
+        const S difference = std::abs(first - second);
+        S power = difference;
+        for (std::size_t k = 1; k < O; k++) {
+            power *= difference;
+        }
+        return accumulator + power;
+    }
+
+    /**
+     * Adds the <code>O</code>-th powers of the absolute values of the differences between two
+     * packs of attributes to the accumulator.
+     *
+     * @param accumulator Accumulator.
+     * @param first Pack of attributes of the first data sample.
+     * @param second Pack of attributes of the second data sample.
+     * @return The updated accumulator.
+     */
+    __attribute__((target("sse3"))) static inline __m128d accumulate(const __m128d accumulator,
+                                                                     const __m128d first,
+                                                                     const __m128d second) {
+
+        const __m128d difference = _mm_andnot_pd(_mm_set1_pd(-0.0), _mm_sub_pd(first, second));
+        __m128d power = difference;
+        for (std::size_t k = 1; k < O; k++) {
+            power = _mm_mul_pd(power, difference);
+        }
+        return _mm_add_pd(accumulator, power);
+    }
+
+    /**
+     * Adds the <code>O</code>-th powers of the absolute values of the differences between two
+     * packs of attributes to the accumulator.
+     *
+     * @param accumulator Accumulator.
+     * @param first Pack of attributes of the first data sample.
+     * @param second Pack of attributes of the second data sample.
+     * @return The updated accumulator.
+     */
+    __attribute__((target("sse3"))) static inline __m128 accumulate(const __m128 accumulator,
+                                                                    const __m128 first,
+                                                                    const __m128 second) {
+
+        const __m128 difference = _mm_andnot_ps(_mm_set1_ps(-0.0F), _mm_sub_ps(first, second));
+        __m128 power = difference;
+        for (std::size_t k = 1; k < O; k++) {
+            power = _mm_mul_ps(power, difference);
+        }
+        return _mm_add_ps(accumulator, power);
+    }
+
+    /**
+     * Adds the <code>O</code>-th powers of the absolute values of the differences between two
+     * packs of attributes to the accumulator.
+     *
+     * @param accumulator Accumulator.
+     * @param first Pack of attributes of the first data sample.
+     * @param second Pack of attributes of the second data sample.
+     * @return The updated accumulator.
+     */
+    __attribute__((target("avx"))) static inline __m256d accumulate(const __m256d accumulator,
+                                                                    const __m256d first,
+                                                                    const __m256d second) {
+
+        const __m256d difference =
+                _mm256_andnot_pd(_mm256_set1_pd(-0.0), _mm256_sub_pd(first, second));
+        __m256d power = difference;
+        for (std::size_t k = 1; k < O; k++) {
+            power = _mm256_mul_pd(power, difference);
+        }
+        return _mm256_add_pd(accumulator, power);
+    }
+
+    /**
+     * Adds the <code>O</code>-th powers of the absolute values of the differences between two
+     * packs of attributes to the accumulator.
+     *
+     * @param accumulator Accumulator.
+     * @param first Pack of attributes of the first data sample.
+     * @param second Pack of attributes of the second data sample.
+     * @return The updated accumulator.
+     */
+    __attribute__((target("avx"))) static inline __m256 accumulate(const __m256 accumulator,
+                                                                   const __m256 first,
+                                                                   const __m256 second) {
+
+        const __m256 difference =
+                _mm256_andnot_ps(_mm256_set1_ps(-0.0F), _mm256_sub_ps(first, second));
+        __m256 power = difference;
+        for (std::size_t k = 1; k < O; k++) {
+            power = _mm256_mul_ps(power, difference);
+        }
+        return _mm256_add_ps(accumulator, power);
+    }
+
+    /**
+     * Computes the distance from the accumulated value.
+     *
+     * @param value Accumulated value.
+     * @return The <code>O</code>-th root of the accumulated value.
+     */
+    static inline double transform(const double value) {
+
+        if constexpr (O == 1) {
+            return value;
+        } else if constexpr (O == 2) {
+            return sqrt(value);
+        } else {
+            return pow(value, 1.0 / static_cast<double>(O));
+        }
+    }
+};
+
+/**
+ * Cosine metric, i.e., <code>1</code> minus the cosine of the angle between the two data samples.
+ * The accumulated value is the dot product of the data samples, which is then divided by their
+ * norms.<br>
+ * The distance between a data sample whose attributes are all <code>0</code> and any other data
+ * sample is <code>1</code>.
+ */
+struct CosineMetric : SummingMetric {
+
+    /**
+     * Identifier of the metric.
+     */
+    static const constexpr std::uint32_t IDENTIFIER = 5;
+
+    /**
+     * The dot product must be divided by the norms of the data samples.
+     */
+    static const constexpr bool REQUIRES_NORMS = true;
+
+    /**
+     * Once divided by the norms, the accumulated value gives the distance.
+     */
+    static const constexpr bool IS_TRANSFORMED = false;
+
+    /**
+     * Adds the product of two attributes to the accumulated value.
+     *
+     * @tparam S Type of the attributes.
+     * @param accumulator Accumulated value.
+     * @param first Attribute of the first data sample.
+     * @param second Attribute of the second data sample.
+     * @return The updated accumulated value.
+     */
+    template <typename S>
+    static inline S accumulate(const S accumulator, const S first, const S second) {
+
+        return accumulator + first * second;
+    }
+
+    /**
+     * Adds the products of two packs of attributes to the accumulator.
+     *
+     * @param accumulator Accumulator.
+     * @param first Pack of attributes of the first data sample.
+     * @param second Pack of attributes of the second data sample.
+     * @return The updated accumulator.
+     */
+    __attribute__((target("sse3"))) static inline __m128d accumulate(const __m128d accumulator,
+                                                                     const __m128d first,
+                                                                     const __m128d second) {
+
+        return _mm_add_pd(accumulator, _mm_mul_pd(first, second));
+    }
+
+    /**
+     * Adds the products of two packs of attributes to the accumulator.
+     *
+     * @param accumulator Accumulator.
+     * @param first Pack of attributes of the first data sample.
+     * @param second Pack of attributes of the second data sample.
+     * @return The updated accumulator.
+     */
+    __attribute__((target("sse3"))) static inline __m128 accumulate(const __m128 accumulator,
+                                                                    const __m128 first,
+                                                                    const __m128 second) {
+
+        return _mm_add_ps(accumulator, _mm_mul_ps(first, second));
+    }
+
+    /**
+     * Adds the products of two packs of attributes to the accumulator.
+     *
+     * @param accumulator Accumulator.
+     * @param first Pack of attributes of the first data sample.
+     * @param second Pack of attributes of the second data sample.
+     * @return The updated accumulator.
+     */
+    __attribute__((target("avx"))) static inline __m256d accumulate(const __m256d accumulator,
+                                                                    const __m256d first,
+                                                                    const __m256d second) {
+
+        return _mm256_add_pd(accumulator, _mm256_mul_pd(first, second));
+    }
+
+    /**
+     * Adds the products of two packs of attributes to the accumulator.
+     *
+     * @param accumulator Accumulator.
+     * @param first Pack of attributes of the first data sample.
+     * @param second Pack of attributes of the second data sample.
+     * @return The updated accumulator.
+     */
+    __attribute__((target("avx"))) static inline __m256 accumulate(const __m256 accumulator,
+                                                                   const __m256 first,
+                                                                   const __m256 second) {
+
+        return _mm256_add_ps(accumulator, _mm256_mul_ps(first, second));
+    }
+
+    /**
+     * Computes the inverse of the norm of a data sample, from the dot product of the data sample
+     * with itself.
+     *
+     * @tparam S Type of the attributes.
+     * @param squaredNorm Dot product of the data sample with itself.
+     * @return The inverse of the norm of the data sample, or <code>0</code> if all its attributes
+     * are <code>0</code>.
+     */
+    template <typename S>
+    static inline S computeInverseNorm(const S squaredNorm) {
+
+        return (squaredNorm > 0) ? static_cast<S>(1 / sqrt(squaredNorm)) : static_cast<S>(0);
+    }
+
+    /**
+     * Divides the dot product of two data samples by their norms.
+     *
+     * @tparam S Type of the attributes.
+     * @param value Dot product of the two data samples.
+     * @param firstInverseNorm Inverse of the norm of the first data sample.
+     * @param secondInverseNorm Inverse of the norm of the second data sample.
+     * @return <code>1</code> minus the cosine of the angle between the two data samples. Since
+     * the rounding errors can make the cosine slightly greater than <code>1</code>, the result is
+     * never less than <code>0</code>.
+     */
+    template <typename S>
+    static inline S normalize(const S value, const S firstInverseNorm, const S secondInverseNorm) {
+
+        return std::max(static_cast<S>(0),
+                        static_cast<S>(1) - value * firstInverseNorm * secondInverseNorm);
+    }
+
+    /**
+     * Computes the distance from the normalized value.
+     *
+     * @param value Normalized value.
+     * @return The normalized value.
+     */
+    static inline double transform(const double value) {
+
+        return value;
+    }
+};
+}  // namespace cluster::utils
+#endif  // FINAL_PROJECT_HPC_DISTANCEMETRICS_H
@@ -0,0 +1,292 @@
+#ifndef FINAL_PROJECT_HPC_OUTOFCOREDATASET_H
+#define FINAL_PROJECT_HPC_OUTOFCOREDATASET_H
+
+#ifdef _WIN32
+#error "utils::OutOfCoreDataset requires the POSIX memory mapping API"
+#endif
+
+#include <algorithm>
+#include <cerrno>
+#include <cstddef>
+#include <cstring>
+#include <fcntl.h>
+#include <filesystem>
+#include <stdexcept>
+#include <string>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <type_traits>
+#include <unistd.h>
+
+namespace cluster::utils {
+
+/**
+ * Read-only dataset stored in a file that can be larger than the available memory.<br>
+ * The data samples are mapped in memory and exposed as a contiguous const iterable, so that the
+ * dataset can be given directly to the clustering algorithm. Since, at the <code>n</code>-th
+ * iteration, the clustering algorithm reads again all the data samples from the first to the
+ * <code>n</code>-th, any replacement policy based on recency evicts each page just before it is
+ * needed again once the dataset exceeds the memory. Therefore, the dataset advises the kernel to
+ * keep a prefix of the data samples, whose size is specified when it is created, and streams the
+ * rest: the remaining pages are read ahead sequentially and, after every iteration, they are
+ * released both from the mapping and from the page cache, prefetching the beginning of the
+ * streamed part for the next iteration.<br>
+ * These are only advices, so they do not bound the memory used by the dataset: the prefix is not
+ * locked, and may be evicted under memory pressure, while the streamed pages swept by an iteration
+ * stay mapped until the iteration ends, so the last iterations may still map most of the dataset.
+ * What they avoid is that the streamed pages accumulate across the iterations, evicting the
+ * prefix, so that every iteration reads from the disk mostly what does not fit in the prefix.<br>
+ * The pages are released only by the <code>ExecutionModes::STAGED</code> and
+ * <code>ExecutionModes::BLOCKED</code> execution modes of <code>ParallelClustering</code>, which
+ * call <code>releaseSweptSamples</code> after every sweep over the data samples. With the other
+ * modes the dataset still works, relying only on the kernel read-ahead.<br>
+ * The dataset is available only on POSIX systems. The page cache is released only where
+ * <code>posix_fadvise</code> is available.
+ *
+ * @tparam S Type of the attributes of the data samples.
+ * @author DeB
+ * @author Jonathan
+ * @version 1.2 2022-10-16
+ * @since 1.0
+ */
+template <typename S = double>
+class OutOfCoreDataset {
+
+    static_assert(std::is_same_v<S, double> || std::is_same_v<S, float>,
+                  "The attributes of the data samples must be either doubles or floats.");
+
+public:
+    /**
+     * Size, in bytes, of the streamed part of the dataset that is prefetched at the end of every
+     * iteration, so that the next iteration finds it in memory after it has swept the resident
+     * prefix.
+     */
+    static const constexpr std::size_t READ_AHEAD_SIZE = 16 * 1024 * 1024;
+
+    /**
+     * Maps in memory the data samples stored in the specified file.
+     *
+     * @param filePath Path of the file holding the data samples.
+     * @param dataOffset Offset, in bytes, of the first attribute of the first data sample from the
+     * beginning of the file.
+     * @param dataSamplesCount Number of data samples stored in the file.
+     * @param stride Number of attributes between the first attribute of a data sample and the
+     * first attribute of the following one.
+     * @param residentSetSize Maximum size, in bytes, of the prefix of the dataset that is never
+     * released, rounded down to a multiple of the page size. If it is larger than the dataset, no
+     * data sample is released. If <code>0</code> is specified, all the data samples are streamed.
+     * @throws std::runtime_error If the file cannot be opened or mapped.
+     * @throws std::invalid_argument If the file is too small to hold the specified data samples.
+     */
+    OutOfCoreDataset(const std::filesystem::path &filePath,
+                     const std::size_t dataOffset,
+                     const std::size_t dataSamplesCount,
+                     const std::size_t stride,
+                     const std::size_t residentSetSize) :
+        fileDescriptor(-1),
+        mapping(nullptr),
+        mappingSize(0),
+        mappingOffset(0),
+        dataBegin(nullptr),
+        dataSamplesCount(dataSamplesCount),
+        stride(stride),
+        residentEnd(0),
+        fileResidentEnd(0) {
+
+        using namespace std::literals::string_literals;
+
+        // Open the file
+        // NOLINTNEXTLINE(cppcoreguidelines-pro-type-vararg)
+        this->fileDescriptor = open(filePath.c_str(), O_RDONLY | O_CLOEXEC);
+        if (this->fileDescriptor < 0) {
+            throw std::runtime_error("Error while opening the file"s + ' ' + filePath.string() +
+                                     ": " + std::strerror(errno));
+        }
+
+        // Check that the file holds all the data samples
+        struct stat fileStatus {};
+        const std::size_t dataSize = dataSamplesCount * stride * sizeof(S);
+        if (fstat(this->fileDescriptor, &fileStatus) != 0) {
+            const std::string reason{std::strerror(errno)};
+            close(this->fileDescriptor);
+            throw std::runtime_error("Error while reading the file"s + ' ' + filePath.string() +
+                                     ": " + reason);
+        }
+        if (static_cast<std::size_t>(fileStatus.st_size) < dataOffset + dataSize) {
+            close(this->fileDescriptor);
+            throw std::invalid_argument("The file"s + ' ' + filePath.string() +
+                                        " is too small to hold the specified data samples");
+        }
+
+        // Map the data samples, starting from the beginning of the page that holds the first one
+        const auto pageSize = static_cast<std::size_t>(sysconf(_SC_PAGESIZE));
+        this->mappingOffset = dataOffset % pageSize;
+        this->mappingSize = this->mappingOffset + dataSize;
+        if (this->mappingSize > 0) {
+            this->mapping = mmap(nullptr,
+                                 this->mappingSize,
+                                 PROT_READ,
+                                 MAP_SHARED,
+                                 this->fileDescriptor,
+                                 static_cast<off_t>(dataOffset - this->mappingOffset));
+            if (this->mapping == MAP_FAILED) {
+                const std::string reason{std::strerror(errno)};
+                close(this->fileDescriptor);
+                throw std::runtime_error("Error while mapping the file"s + ' ' +
+                                         filePath.string() + ": " + reason);
+            }
+            this->dataBegin = static_cast<const S *>(
+                    static_cast<const void *>(static_cast<const char *>(this->mapping) +
+                                              this->mappingOffset));
+        }
+
+        // Split the mapping into the resident prefix and the streamed part. The advices are only
+        // hints, so their failure is not an error
+        this->residentEnd = std::min(residentSetSize / pageSize * pageSize, this->mappingSize);
+        this->fileResidentEnd = dataOffset - this->mappingOffset + this->residentEnd;
+        if (this->residentEnd < this->mappingSize) {
+            madvise(static_cast<char *>(this->mapping) + this->residentEnd,
+                    this->mappingSize - this->residentEnd,
+                    MADV_SEQUENTIAL);
+#ifdef POSIX_FADV_SEQUENTIAL
+            posix_fadvise(this->fileDescriptor,
+                          static_cast<off_t>(this->fileResidentEnd),
+                          static_cast<off_t>(this->mappingSize - this->residentEnd),
+                          POSIX_FADV_SEQUENTIAL);
+#endif
+        }
+    }
+
+    OutOfCoreDataset(const OutOfCoreDataset &) = delete;
+    OutOfCoreDataset(OutOfCoreDataset &&) = delete;
+    OutOfCoreDataset &operator=(const OutOfCoreDataset &) = delete;
+    OutOfCoreDataset &operator=(OutOfCoreDataset &&) = delete;
+
+    /**
+     * Unmaps the data samples and closes the file.
+     */
+    ~OutOfCoreDataset() {
+
+        if (this->mapping != nullptr) {
+            munmap(this->mapping, this->mappingSize);
+        }
+        close(this->fileDescriptor);
+    }
+
+    /**
+     * Returns a pointer to the first attribute of the first data sample.
+     *
+     * @return A pointer to the first attribute of the first data sample.
+     */
+    const S *cbegin() const noexcept {
+
+        return this->dataBegin;
+    }
+
+    /**
+     * Returns a pointer to the attribute following the last one of the last data sample.
+     *
+     * @return A pointer to the attribute following the last one of the last data sample.
+     */
+    const S *cend() const noexcept {
+
+        return this->dataBegin + this->dataSamplesCount * this->stride;
+    }
+
+    /**
+     * Returns the number of data samples of the dataset.
+     *
+     * @return The number of data samples of the dataset.
+     */
+    std::size_t size() const noexcept {
+
+        return this->dataSamplesCount;
+    }
+
+    /**
+     * Releases the pages of the streamed part of the dataset holding the data samples from the
+     * first to the <code>n</code>-th, since they will not be read again before the next iteration
+     * of the clustering algorithm, and prefetches the beginning of the streamed part, that the
+     * next iteration will read first.<br>
+     * The pages that also hold the <code>(n + 1)</code>-th data sample are not released. This
+     * method <b>MUST NOT</b> be called while another thread is reading the data samples.
+     *
+     * @param n Index of the last data sample read by the current iteration.
+     */
+    void releaseSweptSamples(const std::size_t n) const noexcept {
+
+        // Compute the end of the last page holding only swept data samples
+        const auto pageSize = static_cast<std::size_t>(sysconf(_SC_PAGESIZE));
+        const std::size_t sweptEnd =
+                std::min(this->mappingOffset + (n + 1) * this->stride * sizeof(S),
+                         this->mappingSize) /
+                pageSize * pageSize;
+        if (sweptEnd <= this->residentEnd) {
+            return;
+        }
+
+        // Release the pages, both from the mapping and from the page cache
+        char *const streamedBegin = static_cast<char *>(this->mapping) + this->residentEnd;
+        const std::size_t sweptSize = sweptEnd - this->residentEnd;
+        madvise(streamedBegin, sweptSize, MADV_DONTNEED);
+#ifdef POSIX_FADV_DONTNEED
+        posix_fadvise(this->fileDescriptor,
+                      static_cast<off_t>(this->fileResidentEnd),
+                      static_cast<off_t>(sweptSize),
+                      POSIX_FADV_DONTNEED);
+#endif
+
+        // Prefetch the beginning of the streamed part for the next iteration
+        madvise(streamedBegin, std::min(sweptSize, READ_AHEAD_SIZE), MADV_WILLNEED);
+    }
+
+private:
+    /**
+     * Descriptor of the file holding the data samples.
+     */
+    int fileDescriptor;
+
+    /**
+     * Beginning of the mapping, or <code>nullptr</code> if the dataset is empty.
+     */
+    void *mapping;
+
+    /**
+     * Size, in bytes, of the mapping.
+     */
+    std::size_t mappingSize;
+
+    /**
+     * Offset, in bytes, of the first data sample from the beginning of the mapping.
+     */
+    std::size_t mappingOffset;
+
+    /**
+     * Pointer to the first attribute of the first data sample.
+     */
+    const S *dataBegin;
+
+    /**
+     * Number of data samples of the dataset.
+     */
+    std::size_t dataSamplesCount;
+
+    /**
+     * Number of attributes between the first attribute of a data sample and the first attribute
+     * of the following one.
+     */
+    std::size_t stride;
+
+    /**
+     * Offset, in bytes, of the end of the resident prefix from the beginning of the mapping. It
+     * is a multiple of the page size, unless it is the end of the mapping.
+     */
+    std::size_t residentEnd;
+
+    /**
+     * Offset, in bytes, of the end of the resident prefix from the beginning of the file.
+     */
+    std::size_t fileResidentEnd;
+};
+}  // namespace cluster::utils
+#endif  // FINAL_PROJECT_HPC_OUTOFCOREDATASET_H
@@ -3,6 +3,9 @@
 
 #include "IteratorType.h"
 #include "Types.h"
+#include <cstddef>
+#include <limits>
+#include <stdexcept>
 #include <type_traits>
 
 namespace cluster::utils {
@@ -23,7 +26,7 @@ namespace cluster::utils {
  *
  * @author DeB
  * @author Jonathan
- * @version 1.1 2022-08-16
+ * @version 1.2 2022-10-15
  * @since 1.0
  */
 class PiLambdaIteratorUtils {
@@ -44,6 +47,27 @@ public:
      */
     static bool printSummaries;
 
+    /**
+     * Checks that the elements of the specified data structure holding pi can store the indices of
+     * all the specified data samples.
+     *
+     * @tparam P Type of the data structure/iterator holding pi.
+     * @param dataSamplesCount Number of data samples to cluster.
+     * @throws std::invalid_argument If the index of the last data sample cannot be stored in an
+     * element of pi.
+     */
+    template <PiIterator P>
+    static inline void requirePiCapacity(const std::size_t dataSamplesCount) {
+
+        if constexpr (sizeof(PiElement<P>) < sizeof(std::size_t)) {
+            if (dataSamplesCount > 0 &&
+                dataSamplesCount - 1 > std::numeric_limits<PiElement<P>>::max()) {
+                throw std::invalid_argument("The data samples are too many to store their indices "
+                                            "in the data structure holding pi");
+            }
+        }
+    }
+
     /**
      * Using the specified iterator, creates an iterator that iterates over the specified data
      * structure in the most efficient way.
@@ -5,12 +5,14 @@
  *
  * @author DeB
  * @author Jonathan
- * @version 1.1 2022-08-16
+ * @version 1.3 2022-10-15
  * @since 1.0
  */
 #ifndef FINAL_PROJECT_HPC_TYPES_H
 #define FINAL_PROJECT_HPC_TYPES_H
 
+#include <cstddef>
+#include <cstdint>
 #include <iterator>
 #include <type_traits>
 
@@ -683,30 +685,31 @@ concept InputConstIterableOfConstIterables = requires(D object) {
  * the parallel implementation of the clustering algorithm.
  *
  * @tparam D Type of the data structure.
+ * @tparam S Type of the attributes of the data samples.
  */
-template <typename D>
+template <typename D, typename S = double>
 concept ParallelDataIterator =
-        ContiguousIterator<std::remove_cvref_t<D>, const double> ||
-        ContiguousIterable<std::remove_cvref_t<D>, const double> ||
-        ContiguousConstIterable<std::remove_cvref_t<D>, const double> ||
-        ContiguousIteratorOfIterators<std::remove_cvref_t<D>, const double> ||
-        ContiguousIteratorOfIterables<std::remove_cvref_t<D>, const double> ||
-        ContiguousIteratorOfConstIterables<std::remove_cvref_t<D>, const double> ||
-        ContiguousIterableOfIterators<std::remove_cvref_t<D>, const double> ||
-        ContiguousIterableOfIterables<std::remove_cvref_t<D>, const double> ||
-        ContiguousIterableOfConstIterables<std::remove_cvref_t<D>, const double> ||
-        ContiguousConstIterableOfIterators<std::remove_cvref_t<D>, const double> ||
-        ContiguousConstIterableOfIterables<std::remove_cvref_t<D>, const double> ||
-        ContiguousConstIterableOfConstIterables<std::remove_cvref_t<D>, const double> ||
-        RandomIteratorOfIterators<std::remove_cvref_t<D>, const double> ||
-        RandomIteratorOfIterables<std::remove_cvref_t<D>, const double> ||
-        RandomIteratorOfConstIterables<std::remove_cvref_t<D>, const double> ||
-        RandomIterableOfIterators<std::remove_cvref_t<D>, const double> ||
-        RandomIterableOfIterables<std::remove_cvref_t<D>, const double> ||
-        RandomIterableOfConstIterables<std::remove_cvref_t<D>, const double> ||
-        RandomConstIterableOfIterators<std::remove_cvref_t<D>, const double> ||
-        RandomConstIterableOfIterables<std::remove_cvref_t<D>, const double> ||
-        RandomConstIterableOfConstIterables<std::remove_cvref_t<D>, const double>;
+        ContiguousIterator<std::remove_cvref_t<D>, const S> ||
+        ContiguousIterable<std::remove_cvref_t<D>, const S> ||
+        ContiguousConstIterable<std::remove_cvref_t<D>, const S> ||
+        ContiguousIteratorOfIterators<std::remove_cvref_t<D>, const S> ||
+        ContiguousIteratorOfIterables<std::remove_cvref_t<D>, const S> ||
+        ContiguousIteratorOfConstIterables<std::remove_cvref_t<D>, const S> ||
+        ContiguousIterableOfIterators<std::remove_cvref_t<D>, const S> ||
+        ContiguousIterableOfIterables<std::remove_cvref_t<D>, const S> ||
+        ContiguousIterableOfConstIterables<std::remove_cvref_t<D>, const S> ||
+        ContiguousConstIterableOfIterators<std::remove_cvref_t<D>, const S> ||
+        ContiguousConstIterableOfIterables<std::remove_cvref_t<D>, const S> ||
+        ContiguousConstIterableOfConstIterables<std::remove_cvref_t<D>, const S> ||
+        RandomIteratorOfIterators<std::remove_cvref_t<D>, const S> ||
+        RandomIteratorOfIterables<std::remove_cvref_t<D>, const S> ||
+        RandomIteratorOfConstIterables<std::remove_cvref_t<D>, const S> ||
+        RandomIterableOfIterators<std::remove_cvref_t<D>, const S> ||
+        RandomIterableOfIterables<std::remove_cvref_t<D>, const S> ||
+        RandomIterableOfConstIterables<std::remove_cvref_t<D>, const S> ||
+        RandomConstIterableOfIterators<std::remove_cvref_t<D>, const S> ||
+        RandomConstIterableOfIterables<std::remove_cvref_t<D>, const S> ||
+        RandomConstIterableOfConstIterables<std::remove_cvref_t<D>, const S>;
 
 /**
  * Concept satisfied only by the data structures holding the samples to cluster that are accepted by
@@ -726,17 +729,40 @@ concept SequentialDataIterator =
         InputConstIterableOfIterables<std::remove_cvref_t<D>, const double> ||
         InputConstIterableOfConstIterables<std::remove_cvref_t<D>, const double>;
 
+/**
+ * Requires the specified type <code>D</code> to be a data structure or an iterator holding pi,
+ * whose elements are of type <code>T</code>.
+ *
+ * @tparam D Type of the data structure.
+ * @tparam T Type of the elements of pi.
+ */
+template <typename D, typename T>
+concept PiIteratorOf = (RandomIterator<std::remove_reference_t<D>, T> &&
+                        OutputIterator<std::remove_reference_t<D>, T>) ||
+                       (RandomIterable<std::remove_reference_t<D>, T> &&
+                        OutputIterable<std::remove_reference_t<D>, T>);
+
 /**
  * Concept satisfied only by the data structures holding pi accepted by the two implementations of
- * the clustering algorithm.
+ * the clustering algorithm.<br>
+ * The elements of pi can be either <code>std::size_t</code> or <code>std::uint32_t</code>. The
+ * latter halves the memory taken by pi, and so the pressure on the cache when the structure of the
+ * dendrogram is fixed, but it can be used only if there are no more than <code>2^32</code> data
+ * samples.
  *
  * @tparam D Type of the data structure.
  */
 template <typename D>
-concept PiIterator = (RandomIterator<std::remove_reference_t<D>, std::size_t> &&
-                      OutputIterator<std::remove_reference_t<D>, std::size_t>) ||
-                     (RandomIterable<std::remove_reference_t<D>, std::size_t> &&
-                      OutputIterable<std::remove_reference_t<D>, std::size_t>);
+concept PiIterator = PiIteratorOf<D, std::size_t> || PiIteratorOf<D, std::uint32_t>;
+
+/**
+ * Type of the elements of the specified data structure holding pi.
+ *
+ * @tparam D Type of the data structure.
+ */
+template <PiIterator D>
+using PiElement =
+        std::conditional_t<PiIteratorOf<D, std::size_t>, std::size_t, std::uint32_t>;
 
 /**
  * Concept satisfied only by the data structures holding lambda accepted by the two implementations
@@ -0,0 +1,199 @@
+/*
+ * Implementation of the checkpoint of a running clustering.
+ *
+ * @author DeB
+ * @author Jonathan
+ * @version 1.2 2022-10-16
+ * @since 1.0
+ */
+#include "../../include/parallel/ClusteringCheckpoint.h"
+#include <array>
+#include <fstream>
+#include <stdexcept>
+#include <string>
+#include <utility>
+
+namespace cluster::parallel {
+
+namespace {
+
+/**
+ * Magic number identifying a checkpoint file.
+ */
+const constexpr std::array<char, 8> MAGIC_NUMBER{'S', 'L', 'N', 'K', 'C', 'K', 'P', 'T'};
+
+/**
+ * Version of the format of the checkpoint file.
+ */
+const constexpr std::uint32_t FORMAT_VERSION = 2;
+
+/**
+ * Flag set if <code>lambda</code> holds the squares of the distances.
+ */
+const constexpr std::uint32_t SQUARED_LAMBDAS_FLAG = 1;
+
+/**
+ * Header of the checkpoint file.
+ */
+struct Header {
+    std::array<char, 8> magicNumber;
+    std::uint32_t formatVersion;
+    std::uint32_t flags;
+    std::uint32_t distanceComputer;
+    std::uint32_t metric;
+    std::uint64_t dataSamplesCount;
+    std::uint64_t dimension;
+    std::uint64_t processedSamplesCount;
+};
+}  // namespace
+
+/**
+ * Creates a new checkpoint stored in the specified file.
+ *
+ * @param filePath Path of the file holding the checkpoint.
+ * @param interval Minimum time between two consecutive saves of the checkpoint.
+ * @param samplesLimit Number of data samples after which the clustering is stopped, once the
+ * checkpoint has been saved. If not specified, or if <code>0</code> is specified, then the
+ * clustering is never stopped.
+ */
+ClusteringCheckpoint::ClusteringCheckpoint(std::filesystem::path filePath,
+                                           const std::chrono::milliseconds interval,
+                                           const std::size_t samplesLimit) :
+    filePath(std::move(filePath)),
+    interval(interval),
+    nextSaveTime(std::chrono::steady_clock::now() + interval),
+    samplesLimit(samplesLimit),
+    interrupted(false),
+    piBuffer(),
+    lambdaBuffer() {
+}
+
+/**
+ * Returns the path of the file holding the checkpoint.
+ *
+ * @return The path of the file holding the checkpoint.
+ */
+const std::filesystem::path &ClusteringCheckpoint::getFilePath() const noexcept {
+
+    return this->filePath;
+}
+
+/**
+ * Writes the checkpoint file, using the values held by the buffers.
+ *
+ * @param n Number of data samples already added to the dendrogram.
+ * @param dataSamplesCount Number of data samples to cluster.
+ * @param dimension Number of attributes of each data sample.
+ * @param distanceComputer Identifier of the distance computer used by the clustering.
+ * @param metric Identifier of the metric used by the clustering.
+ * @param squaredLambdas <code>true</code> if <code>lambda</code> holds the squares of the
+ * distances, <code>false</code> otherwise.
+ * @throws std::runtime_error If an I/O error occurs while writing the file.
+ */
+void ClusteringCheckpoint::writeFile(const std::size_t n,
+                                     const std::size_t dataSamplesCount,
+                                     const std::size_t dimension,
+                                     const std::uint32_t distanceComputer,
+                                     const std::uint32_t metric,
+                                     const bool squaredLambdas) {
+
+    const Header header{MAGIC_NUMBER,
+                        FORMAT_VERSION,
+                        squaredLambdas ? SQUARED_LAMBDAS_FLAG : 0,
+                        distanceComputer,
+                        metric,
+                        dataSamplesCount,
+                        dimension,
+                        n};
+
+    // Write everything to a temporary file
+    std::filesystem::path temporaryFilePath{this->filePath};
+    temporaryFilePath += ".tmp";
+    {
+        std::ofstream file{temporaryFilePath, std::ios::binary | std::ios::trunc};
+        // NOLINTBEGIN(cppcoreguidelines-pro-type-reinterpret-cast)
+        file.write(reinterpret_cast<const char *>(&header), sizeof(Header));
+        file.write(reinterpret_cast<const char *>(this->piBuffer.data()),
+                   static_cast<std::streamsize>(n * sizeof(std::uint64_t)));
+        file.write(reinterpret_cast<const char *>(this->lambdaBuffer.data()),
+                   static_cast<std::streamsize>(n * sizeof(double)));
+        // NOLINTEND(cppcoreguidelines-pro-type-reinterpret-cast)
+        file.flush();
+        if (!file) {
+            throw std::runtime_error("Unable to write the checkpoint file '" +
+                                     temporaryFilePath.string() + "'");
+        }
+    }
+
+    // Replace the previous checkpoint, so that it is never left half-written
+    std::error_code errorCode{};
+    std::filesystem::rename(temporaryFilePath, this->filePath, errorCode);
+    if (errorCode) {
+        throw std::runtime_error("Unable to replace the checkpoint file '" +
+                                 this->filePath.string() + "': " + errorCode.message());
+    }
+
+    this->nextSaveTime = std::chrono::steady_clock::now() + this->interval;
+}
+
+/**
+ * Reads the checkpoint file, if it exists, placing the values in the buffers.
+ *
+ * @param dataSamplesCount Number of data samples to cluster.
+ * @param dimension Number of attributes of each data sample.
+ * @param distanceComputer Identifier of the distance computer used by the clustering.
+ * @param metric Identifier of the metric used by the clustering.
+ * @param squaredLambdas <code>true</code> if <code>lambda</code> holds the squares of the
+ * distances, <code>false</code> otherwise.
+ * @return The number of data samples already added to the dendrogram, or <code>0</code> if the
+ * file does not exist.
+ * @throws std::runtime_error If an I/O error occurs while reading the file, or if the file is
+ * malformed.
+ * @throws std::invalid_argument If the file does not match the specified parameters.
+ */
+std::size_t ClusteringCheckpoint::readFile(const std::size_t dataSamplesCount,
+                                           const std::size_t dimension,
+                                           const std::uint32_t distanceComputer,
+                                           const std::uint32_t metric,
+                                           const bool squaredLambdas) {
+
+    // Start from scratch if no checkpoint has been saved yet
+    if (!std::filesystem::exists(this->filePath)) {
+        return 0;
+    }
+
+    // Read and check the header
+    std::ifstream file{this->filePath, std::ios::binary};
+    Header header{};
+    // NOLINTNEXTLINE(cppcoreguidelines-pro-type-reinterpret-cast)
+    file.read(reinterpret_cast<char *>(&header), sizeof(Header));
+    if (!file || header.magicNumber != MAGIC_NUMBER || header.formatVersion != FORMAT_VERSION ||
+        header.processedSamplesCount > header.dataSamplesCount) {
+        throw std::runtime_error("The file '" + this->filePath.string() +
+                                 "' is not a valid checkpoint file");
+    }
+    if (header.dataSamplesCount != dataSamplesCount || header.dimension != dimension ||
+        header.distanceComputer != distanceComputer || header.metric != metric ||
+        ((header.flags & SQUARED_LAMBDAS_FLAG) != 0) != squaredLambdas) {
+        throw std::invalid_argument("The checkpoint file '" + this->filePath.string() +
+                                    "' has been saved by a different clustering");
+    }
+
+    // Read pi and lambda
+    const std::size_t n = header.processedSamplesCount;
+    this->piBuffer.resize(n);
+    this->lambdaBuffer.resize(n);
+    // NOLINTBEGIN(cppcoreguidelines-pro-type-reinterpret-cast)
+    file.read(reinterpret_cast<char *>(this->piBuffer.data()),
+              static_cast<std::streamsize>(n * sizeof(std::uint64_t)));
+    file.read(reinterpret_cast<char *>(this->lambdaBuffer.data()),
+              static_cast<std::streamsize>(n * sizeof(double)));
+    // NOLINTEND(cppcoreguidelines-pro-type-reinterpret-cast)
+    if (!file) {
+        throw std::runtime_error("The checkpoint file '" + this->filePath.string() +
+                                 "' is truncated");
+    }
+
+    return n;
+}
+}  // namespace cluster::parallel
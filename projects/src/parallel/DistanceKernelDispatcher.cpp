@@ -0,0 +1,307 @@
+/*
+ * Implementation of the dispatcher of the distance kernels.
+ *
+ * @author DeB
+ * @author Jonathan
+ * @version 1.1 2022-10-16
+ * @since 1.0
+ */
+#include "../../include/parallel/DistanceKernelDispatcher.h"
+#include <immintrin.h>
+
+namespace cluster::parallel {
+
+namespace {
+
+/**
+ * Computes the square of the distance between two data samples using SSE2 instructions.
+ *
+ * @param firstPoint Pointer to the first attribute of the first data sample.
+ * @param secondPoint Pointer to the first attribute of the second data sample.
+ * @param dimension Number of attributes of the two data samples.
+ * @return The square of the distance between the two data samples.
+ */
+__attribute__((target("sse2"))) double computeSquaredDistanceSse2(
+        const double *const firstPoint,
+        const double *const secondPoint,
+        const std::size_t dimension) noexcept {
+
+    // Initialize the register that accumulates the partial sum of squares
+    __m128d accumulator = _mm_setzero_pd();
+
+    // Process 2 attributes at a time
+    std::size_t i = 0;
+    for (; i + 2 <= dimension; i += 2) {
+        const __m128d difference =
+                _mm_sub_pd(_mm_loadu_pd(&(firstPoint[i])), _mm_loadu_pd(&(secondPoint[i])));
+        accumulator = _mm_add_pd(accumulator, _mm_mul_pd(difference, difference));
+    }
+
+    // Sum the two values in the register
+    double sum = _mm_cvtsd_f64(_mm_add_sd(accumulator, _mm_unpackhi_pd(accumulator, accumulator)));
+
+    // Process the last attribute, if any
+    if (i < dimension) {
+        const double difference = firstPoint[i] - secondPoint[i];
+        sum += difference * difference;
+    }
+
+    return sum;
+}
+
+/**
+ * Creates the mask that allows to load only the specified number of doubles into an AVX register.
+ *
+ * @param count Number of doubles to load. It must be less than 4.
+ * @return The mask.
+ */
+__attribute__((target("avx"))) inline __m256i createAvxMask(const std::size_t count) noexcept {
+
+    // Only the most significant bit of each element is considered
+    return _mm256_set_epi64x(0,
+                             (count > 2) ? -1 : 0,
+                             (count > 1) ? -1 : 0,
+                             (count > 0) ? -1 : 0);
+}
+
+/**
+ * Computes the square of the distance between two data samples using AVX instructions.
+ *
+ * @param firstPoint Pointer to the first attribute of the first data sample.
+ * @param secondPoint Pointer to the first attribute of the second data sample.
+ * @param dimension Number of attributes of the two data samples.
+ * @return The square of the distance between the two data samples.
+ */
+__attribute__((target("avx"))) double computeSquaredDistanceAvx(
+        const double *const firstPoint,
+        const double *const secondPoint,
+        const std::size_t dimension) noexcept {
+
+    // Initialize the register that accumulates the partial sum of squares
+    __m256d accumulator = _mm256_setzero_pd();
+
+    // Process 4 attributes at a time
+    std::size_t i = 0;
+    for (; i + 4 <= dimension; i += 4) {
+        const __m256d difference = _mm256_sub_pd(_mm256_loadu_pd(&(firstPoint[i])),
+                                                 _mm256_loadu_pd(&(secondPoint[i])));
+        accumulator = _mm256_add_pd(accumulator, _mm256_mul_pd(difference, difference));
+    }
+
+    // Process the remaining attributes, if any, without reading past the end of the samples
+    if (i < dimension) {
+        const __m256i mask = createAvxMask(dimension - i);
+        const __m256d difference = _mm256_sub_pd(_mm256_maskload_pd(&(firstPoint[i]), mask),
+                                                 _mm256_maskload_pd(&(secondPoint[i]), mask));
+        accumulator = _mm256_add_pd(accumulator, _mm256_mul_pd(difference, difference));
+    }
+
+    // Sum the four values in the register
+    const __m128d partialSum =
+            _mm_add_pd(_mm256_extractf128_pd(accumulator, 1), _mm256_castpd256_pd128(accumulator));
+    return _mm_cvtsd_f64(_mm_add_sd(partialSum, _mm_unpackhi_pd(partialSum, partialSum)));
+}
+
+/**
+ * Computes the square of the distance between two data samples using AVX2 and FMA instructions.
+ * Two independent accumulators are used, so to hide the latency of the fused multiply-add.
+ *
+ * @param firstPoint Pointer to the first attribute of the first data sample.
+ * @param secondPoint Pointer to the first attribute of the second data sample.
+ * @param dimension Number of attributes of the two data samples.
+ * @return The square of the distance between the two data samples.
+ */
+__attribute__((target("avx2,fma"))) double computeSquaredDistanceAvx2Fma(
+        const double *const firstPoint,
+        const double *const secondPoint,
+        const std::size_t dimension) noexcept {
+
+    // Initialize the registers that accumulate the partial sums of squares
+    __m256d firstAccumulator = _mm256_setzero_pd();
+    __m256d secondAccumulator = _mm256_setzero_pd();
+
+    // Process 8 attributes at a time
+    std::size_t i = 0;
+    for (; i + 8 <= dimension; i += 8) {
+        const __m256d firstDifference = _mm256_sub_pd(_mm256_loadu_pd(&(firstPoint[i])),
+                                                      _mm256_loadu_pd(&(secondPoint[i])));
+        const __m256d secondDifference = _mm256_sub_pd(_mm256_loadu_pd(&(firstPoint[i + 4])),
+                                                       _mm256_loadu_pd(&(secondPoint[i + 4])));
+        firstAccumulator = _mm256_fmadd_pd(firstDifference, firstDifference, firstAccumulator);
+        secondAccumulator = _mm256_fmadd_pd(secondDifference, secondDifference, secondAccumulator);
+    }
+
+    // Process the next 4 attributes, if any
+    if (i + 4 <= dimension) {
+        const __m256d difference = _mm256_sub_pd(_mm256_loadu_pd(&(firstPoint[i])),
+                                                 _mm256_loadu_pd(&(secondPoint[i])));
+        firstAccumulator = _mm256_fmadd_pd(difference, difference, firstAccumulator);
+        i += 4;
+    }
+
+    // Process the remaining attributes, if any, without reading past the end of the samples
+    if (i < dimension) {
+        const __m256i mask = createAvxMask(dimension - i);
+        const __m256d difference = _mm256_sub_pd(_mm256_maskload_pd(&(firstPoint[i]), mask),
+                                                 _mm256_maskload_pd(&(secondPoint[i]), mask));
+        secondAccumulator = _mm256_fmadd_pd(difference, difference, secondAccumulator);
+    }
+
+    // Sum the values in the two registers
+    const __m256d accumulator = _mm256_add_pd(firstAccumulator, secondAccumulator);
+    const __m128d partialSum =
+            _mm_add_pd(_mm256_extractf128_pd(accumulator, 1), _mm256_castpd256_pd128(accumulator));
+    return _mm_cvtsd_f64(_mm_add_sd(partialSum, _mm_unpackhi_pd(partialSum, partialSum)));
+}
+
+/**
+ * Computes the square of the distance between two data samples using AVX-512 instructions.
+ *
+ * @param firstPoint Pointer to the first attribute of the first data sample.
+ * @param secondPoint Pointer to the first attribute of the second data sample.
+ * @param dimension Number of attributes of the two data samples.
+ * @return The square of the distance between the two data samples.
+ */
+__attribute__((target("avx512f"))) double computeSquaredDistanceAvx512(
+        const double *const firstPoint,
+        const double *const secondPoint,
+        const std::size_t dimension) noexcept {
+
+    // Initialize the register that accumulates the partial sum of squares
+    __m512d accumulator = _mm512_setzero_pd();
+
+    // Process 8 attributes at a time
+    std::size_t i = 0;
+    for (; i + 8 <= dimension; i += 8) {
+        const __m512d difference = _mm512_sub_pd(_mm512_loadu_pd(&(firstPoint[i])),
+                                                 _mm512_loadu_pd(&(secondPoint[i])));
+        accumulator = _mm512_fmadd_pd(difference, difference, accumulator);
+    }
+
+    // Process the remaining attributes, if any, without reading past the end of the samples
+    if (i < dimension) {
+        const auto mask = static_cast<__mmask8>((1U << (dimension - i)) - 1U);
+        const __m512d difference = _mm512_sub_pd(_mm512_maskz_loadu_pd(mask, &(firstPoint[i])),
+                                                 _mm512_maskz_loadu_pd(mask, &(secondPoint[i])));
+        accumulator = _mm512_fmadd_pd(difference, difference, accumulator);
+    }
+
+    // Sum the upper 256 bits of the register to the lower 256 ones. The halves are extracted with
+    // a mask selecting all the lanes, since the unmasked extraction merges them into an undefined
+    // register
+    const auto allLanes = static_cast<__mmask8>(0xFFU);
+    const __m256d halvesSum = _mm256_add_pd(_mm512_maskz_extractf64x4_pd(allLanes, accumulator, 1),
+                                            _mm512_maskz_extractf64x4_pd(allLanes, accumulator, 0));
+
+    // Sum adjacent double values, and then the upper 128 bits to the lower 128 ones
+    const __m256d horizontalSum = _mm256_hadd_pd(halvesSum, halvesSum);
+    return _mm_cvtsd_f64(_mm_add_pd(_mm256_extractf128_pd(horizontalSum, 1),
+                                    _mm256_castpd256_pd128(horizontalSum)));
+}
+
+/**
+ * Probes the CPU to find the fastest instruction set it supports, among the ones the dispatcher
+ * can use.
+ *
+ * @return The fastest supported instruction set.
+ */
+InstructionSets probeInstructionSet() noexcept {
+
+    // Initialize the CPU information, since this may be executed before the constructors run
+    __builtin_cpu_init();
+
+    if (__builtin_cpu_supports("avx512f")) {
+        return InstructionSets::AVX512;
+    }
+    if (__builtin_cpu_supports("avx2") && __builtin_cpu_supports("fma")) {
+        return InstructionSets::AVX2_FMA;
+    }
+    if (__builtin_cpu_supports("avx")) {
+        return InstructionSets::AVX;
+    }
+    return InstructionSets::SSE2;
+}
+}  // namespace
+
+/**
+ * Kernel used to compute the distances. Initially, it points to a kernel that selects the fastest
+ * kernel, binds it, and then uses it to compute the requested distance.
+ */
+std::atomic<DistanceKernelDispatcher::DistanceKernel> DistanceKernelDispatcher::kernel{
+        &DistanceKernelDispatcher::bindKernel};
+
+/**
+ * Returns the fastest instruction set supported by the CPU the application is running on, among
+ * the ones the dispatcher can use. The CPU is probed only the first time this method is called.
+ *
+ * @return The instruction set used to compute the distances.
+ */
+InstructionSets DistanceKernelDispatcher::getSelectedInstructionSet() noexcept {
+
+    static const InstructionSets selectedInstructionSet = probeInstructionSet();
+
+    return selectedInstructionSet;
+}
+
+/**
+ * Returns a human-readable description of the specified instruction set.
+ *
+ * @param instructionSet Instruction set to describe.
+ * @return The description of the instruction set.
+ */
+const char *DistanceKernelDispatcher::getDescription(
+        const InstructionSets instructionSet) noexcept {
+
+    switch (instructionSet) {
+        case InstructionSets::SSE2:
+            return "SSE2";
+        case InstructionSets::AVX:
+            return "AVX";
+        case InstructionSets::AVX2_FMA:
+            return "AVX2 and FMA";
+        case InstructionSets::AVX512:
+            return "AVX-512";
+        default:
+            return "Unknown";
+    }
+}
+
+/**
+ * Selects the fastest kernel supported by the CPU, binds it so that it is used for all the
+ * following computations, and then uses it to compute the square of the distance between the
+ * specified data samples.
+ *
+ * @param firstPoint Pointer to the first attribute of the first data sample.
+ * @param secondPoint Pointer to the first attribute of the second data sample.
+ * @param dimension Number of attributes of the two data samples.
+ * @return The square of the distance between the two data samples.
+ */
+double DistanceKernelDispatcher::bindKernel(const double *const firstPoint,
+                                            const double *const secondPoint,
+                                            const std::size_t dimension) noexcept {
+
+    // Select the kernel
+    // NOLINTNEXTLINE(cppcoreguidelines-init-variables)
+    DistanceKernel selectedKernel;
+    switch (getSelectedInstructionSet()) {
+        case InstructionSets::AVX512:
+            selectedKernel = &computeSquaredDistanceAvx512;
+            break;
+        case InstructionSets::AVX2_FMA:
+            selectedKernel = &computeSquaredDistanceAvx2Fma;
+            break;
+        case InstructionSets::AVX:
+            selectedKernel = &computeSquaredDistanceAvx;
+            break;
+        case InstructionSets::SSE2:
+        default:
+            selectedKernel = &computeSquaredDistanceSse2;
+            break;
+    }
+
+    // Bind the kernel. If more threads get here at the same time, they all store the same kernel
+    kernel.store(selectedKernel, std::memory_order_relaxed);
+
+    return selectedKernel(firstPoint, secondPoint, dimension);
+}
+}  // namespace cluster::parallel
@@ -0,0 +1,236 @@
+/*
+ * Implementation of the kd-tree.
+ *
+ * @author DeB
+ * @author Jonathan
+ * @version 1.1 2022-10-16
+ * @since 1.0
+ */
+#include "../../include/parallel/KdTree.h"
+#include <algorithm>
+#include <numeric>
+
+namespace cluster::parallel {
+
+/**
+ * Builds a new kd-tree over the specified data samples.<br>
+ * The data samples are only read, and they can be released as soon as the tree is built.
+ *
+ * @param points Pointer to the first attribute of the first data sample. The data samples
+ * <b>MUST BE</b> stored one after the other, <code>stride</code> values apart.
+ * @param dataSamplesCount Number of data samples.
+ * @param dimension Number of attributes of each data sample.
+ * @param stride Number of values between the first attribute of a data sample and the first
+ * attribute of the following one. It <b>MUST BE</b> at least <code>dimension</code>.
+ */
+KdTree::KdTree(const double *const points,
+               const std::size_t dataSamplesCount,
+               const std::size_t dimension,
+               const std::size_t stride) :
+    dimension(dimension),
+    points(),
+    indices(dataSamplesCount),
+    begins(),
+    ends(),
+    leftChildren(),
+    rightChildren(),
+    lowerBounds(),
+    upperBounds(),
+    leaves() {
+
+    // Reserve the space for the nodes. A tree with at most LEAF_SIZE samples per leaf, split in
+    // halves, has less than 4 * dataSamplesCount / LEAF_SIZE nodes
+    const std::size_t maximumNodesCount = 4 * (dataSamplesCount / LEAF_SIZE + 1);
+    this->begins.reserve(maximumNodesCount);
+    this->ends.reserve(maximumNodesCount);
+    this->leftChildren.reserve(maximumNodesCount);
+    this->rightChildren.reserve(maximumNodesCount);
+    this->lowerBounds.reserve(maximumNodesCount * dimension);
+    this->upperBounds.reserve(maximumNodesCount * dimension);
+
+    // Build the tree, reordering only the indices of the data samples
+    std::iota(this->indices.begin(), this->indices.end(), 0);
+    if (dataSamplesCount > 0) {
+        this->buildNode(points, stride, 0, dataSamplesCount);
+    }
+
+    // Copy the data samples in the new order, so that the samples held by every node are
+    // contiguous
+    this->points.resize(dataSamplesCount * dimension);
+    for (std::size_t position = 0; position < dataSamplesCount; position++) {
+        std::copy_n(&(points[this->indices[position] * stride]),
+                    dimension,
+                    &(this->points[position * dimension]));
+    }
+}
+
+/**
+ * Destroys the tree.
+ */
+KdTree::~KdTree() = default;
+
+/**
+ * Computes the square of the minimum distance between the bounding boxes of two nodes.<br>
+ * The result is never greater than the square of the distance between any two data samples held
+ * by the nodes, computed by <code>KdTree::computeSquaredDistance</code>, even when rounding errors
+ * occur, since it performs the same operations on values that are never farther apart.
+ *
+ * @param firstNode Index of the first node.
+ * @param secondNode Index of the second node.
+ * @return The square of the minimum distance between the two bounding boxes.
+ */
+double KdTree::computeSquaredBoxDistance(const std::size_t firstNode,
+                                         const std::size_t secondNode) const noexcept {
+
+    const double *const firstLower = &(this->lowerBounds[firstNode * this->dimension]);
+    const double *const firstUpper = &(this->upperBounds[firstNode * this->dimension]);
+    const double *const secondLower = &(this->lowerBounds[secondNode * this->dimension]);
+    const double *const secondUpper = &(this->upperBounds[secondNode * this->dimension]);
+
+    double sum = 0;
+    for (std::size_t k = 0; k < this->dimension; k++) {
+        double gap = 0;
+        if (firstUpper[k] < secondLower[k]) {
+            gap = secondLower[k] - firstUpper[k];
+        } else if (secondUpper[k] < firstLower[k]) {
+            gap = firstLower[k] - secondUpper[k];
+        }
+        sum += gap * gap;
+    }
+    return sum;
+}
+
+/**
+ * Creates the node holding the specified range of data samples, together with all its
+ * descendants.
+ *
+ * @param originalPoints Pointer to the first attribute of the first data sample, in the original
+ * order.
+ * @param stride Number of values between the first attribute of a data sample and the first
+ * attribute of the following one.
+ * @param begin Position of the first data sample held by the node.
+ * @param end Position following the one of the last data sample held by the node.
+ */
+void KdTree::buildNode(const double *const originalPoints,
+                       const std::size_t stride,
+                       const std::size_t begin,
+                       const std::size_t end) {
+
+    // Create the node
+    const std::size_t node = this->begins.size();
+    this->begins.push_back(begin);
+    this->ends.push_back(end);
+    this->leftChildren.push_back(0);
+    this->rightChildren.push_back(0);
+
+    // Compute the bounding box of the data samples held by the node
+    const std::size_t boundsBegin = this->lowerBounds.size();
+    const double *const firstPoint = &(originalPoints[this->indices[begin] * stride]);
+    this->lowerBounds.insert(this->lowerBounds.end(), firstPoint, firstPoint + this->dimension);
+    this->upperBounds.insert(this->upperBounds.end(), firstPoint, firstPoint + this->dimension);
+    for (std::size_t position = begin + 1; position < end; position++) {
+        const double *const point = &(originalPoints[this->indices[position] * stride]);
+        for (std::size_t k = 0; k < this->dimension; k++) {
+            double &lowerBound = this->lowerBounds[boundsBegin + k];
+            double &upperBound = this->upperBounds[boundsBegin + k];
+            lowerBound = std::min(lowerBound, point[k]);
+            upperBound = std::max(upperBound, point[k]);
+        }
+    }
+
+    // Stop splitting if the node is small enough
+    if (end - begin <= LEAF_SIZE) {
+        this->leaves.push_back(node);
+        return;
+    }
+
+    // Find the dimension where the bounding box is the widest
+    std::size_t splitDimension = 0;
+    double widestExtent = -1;
+    for (std::size_t k = 0; k < this->dimension; k++) {
+        const double extent =
+                this->upperBounds[boundsBegin + k] - this->lowerBounds[boundsBegin + k];
+        if (extent > widestExtent) {
+            widestExtent = extent;
+            splitDimension = k;
+        }
+    }
+
+    // Split the data samples in two halves along that dimension
+    const std::size_t middle = begin + (end - begin) / 2;
+    this->selectMedian(originalPoints, stride, splitDimension, begin, middle, end);
+
+    // Create the children
+    this->leftChildren[node] = this->begins.size();
+    this->buildNode(originalPoints, stride, begin, middle);
+    this->rightChildren[node] = this->begins.size();
+    this->buildNode(originalPoints, stride, middle, end);
+}
+
+/**
+ * Reorders the specified range of data samples so that the sample at the middle position is the
+ * one that would be there if the range were sorted along the specified dimension, every sample
+ * before it is not greater, and every sample after it is not smaller.<br>
+ * The selection is performed by a quickselect using a three-way partition, so that many samples
+ * with the same value, e.g., integers, do not slow it down.
+ *
+ * @param originalPoints Pointer to the first attribute of the first data sample, in the original
+ * order.
+ * @param stride Number of values between the first attribute of a data sample and the first
+ * attribute of the following one.
+ * @param splitDimension Dimension along which the data samples are compared.
+ * @param begin Position of the first data sample of the range.
+ * @param middle Position of the data sample to select.
+ * @param end Position following the one of the last data sample of the range.
+ */
+void KdTree::selectMedian(const double *const originalPoints,
+                          const std::size_t stride,
+                          const std::size_t splitDimension,
+                          std::size_t begin,
+                          const std::size_t middle,
+                          std::size_t end) {
+
+    std::size_t *const positions = this->indices.data();
+    const auto valueAt = [positions, originalPoints, stride, splitDimension](
+                                 const std::size_t position) {
+        return originalPoints[positions[position] * stride + splitDimension];
+    };
+
+    while (end - begin > 1) {
+        // Use the median of the first, the middle and the last value as pivot
+        const double first = valueAt(begin);
+        const double center = valueAt(begin + (end - begin) / 2);
+        const double last = valueAt(end - 1);
+        const double pivot =
+                std::max(std::min(first, center), std::min(std::max(first, center), last));
+
+        // Split the range in the samples smaller than the pivot, the samples equal to it, and the
+        // samples greater than it
+        std::size_t smallerEnd = begin;
+        std::size_t greaterBegin = end;
+        std::size_t position = begin;
+        while (position < greaterBegin) {
+            const double value = valueAt(position);
+            if (value < pivot) {
+                std::swap(positions[smallerEnd], positions[position]);
+                smallerEnd++;
+                position++;
+            } else if (pivot < value) {
+                greaterBegin--;
+                std::swap(positions[position], positions[greaterBegin]);
+            } else {
+                position++;
+            }
+        }
+
+        // Continue only in the part holding the middle position
+        if (middle < smallerEnd) {
+            end = smallerEnd;
+        } else if (middle >= greaterBegin) {
+            begin = greaterBegin;
+        } else {
+            return;
+        }
+    }
+}
+}  // namespace cluster::parallel
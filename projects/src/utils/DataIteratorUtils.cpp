@@ -3,7 +3,7 @@
  *
  * @author DeB
  * @author Jonathan
- * @version 1.0 2022-08-16
+ * @version 1.1 2022-09-24
  * @since 1.0
  */
 #include "../../include/utils/DataIteratorUtils.h"
@@ -14,22 +14,30 @@ namespace cluster::utils {
  * Type of the last specified iterator or iterable holding the first level of indirection of the
  * data samples to cluster.
  */
-DataType DataIteratorUtils::lastDataType = DataType::NONE;
+template <typename S>
+DataType DataIteratorUtils<S>::lastDataType = DataType::NONE;
 
 /**
  * Type of the last specified data structure or iterator holding the first level of indirection of
  * the data samples to cluster.
  */
-DataLevelType DataIteratorUtils::lastFirstLevelDataType = DataLevelType::NONE;
+template <typename S>
+DataLevelType DataIteratorUtils<S>::lastFirstLevelDataType = DataLevelType::NONE;
 
 /**
  * Type of the last specified data structure or iterator holding the second level of indirection of
  * the data samples to cluster.
  */
-DataLevelType DataIteratorUtils::lastSecondLevelDataType = DataLevelType::NONE;
+template <typename S>
+DataLevelType DataIteratorUtils<S>::lastSecondLevelDataType = DataLevelType::NONE;
 
 /**
  * Flag allowing to enable or disable the printing of the summary.
  */
-bool DataIteratorUtils::printSummaries = false;
+template <typename S>
+bool DataIteratorUtils<S>::printSummaries = false;
+
+// Instantiate the utility class for the supported types of the attributes
+template class DataIteratorUtils<double>;
+template class DataIteratorUtils<float>;
 }  // namespace cluster::utils
@@ -64,7 +64,7 @@ int main() {
     DataReader::readPiLambda("../../../out/birm-p-11-results.txt", expectedPi, expectedLambda);
     std::cout << "End" << std::endl;
 
-    DataIteratorUtils::printSummaries = true;
+    DataIteratorUtils<>::printSummaries = true;
     PiLambdaIteratorUtils::printSummaries = false;
 
     std::list<double *> list{};
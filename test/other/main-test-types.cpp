@@ -257,7 +257,7 @@ void testParallelDataStructureTypes(
     }
     std::cout << std::endl;
 
-    DataIteratorUtils::printSummaries = true;
+    DataIteratorUtils<>::printSummaries = true;
     PiLambdaIteratorUtils::printSummaries = false;
 
     const std::size_t dataElementsCount = parsedData.size() / DIMENSION;
@@ -596,7 +596,7 @@ void testPiLambdaTypes(const std::vector<double> &parsedData,
     }
     std::cout << std::endl;
 
-    DataIteratorUtils::printSummaries = false;
+    DataIteratorUtils<>::printSummaries = false;
     PiLambdaIteratorUtils::printSummaries = true;
 
     const std::size_t dataElementsCount = parsedData.size() / DIMENSION;
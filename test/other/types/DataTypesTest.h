@@ -19,7 +19,7 @@ namespace cluster::test::types {
 class DataTypesTest {
 
     using DataReader = cluster::test::data::DataReader;
-    using DataIteratorUtils = cluster::utils::DataIteratorUtils;
+    using DataIteratorUtils = cluster::utils::DataIteratorUtils<>;
     using PiLambdaIteratorUtils = cluster::utils::PiLambdaIteratorUtils;
 
 public:
@@ -22,7 +22,7 @@ namespace cluster::test::types {
 class DataTypesTester {
     using DataIteratorType = cluster::utils::DataType;
     using DataIteratorTypeUtils = cluster::utils::DataIteratorTypeUtils;
-    using DataIteratorUtils = cluster::utils::DataIteratorUtils;
+    using DataIteratorUtils = cluster::utils::DataIteratorUtils<>;
 
 public:
     DataTypesTester(const size_t dataElementsCount,
@@ -3,16 +3,33 @@
  *
  * @author DeB
  * @author Jonathan
- * @version 1.0 2022-08-16
+ * @version 1.15 2022-10-16
  * @since 1.0
  */
 #include "ClusteringAlgorithmExecutor.h"
+#include "BoruvkaClustering.h"
+#include "IncrementalClustering.h"
 #include "ParallelClustering.h"
+#include "PrimClustering.h"
 #include "SequentialClustering.h"
+#include <algorithm>
+#include <stdexcept>
+#include <string>
+#ifndef _WIN32
+#include "OutOfCoreDataset.h"
+#endif
 
+using cluster::parallel::BoruvkaClustering;
+using cluster::parallel::ClusteringCheckpoint;
 using cluster::parallel::DistanceComputers;
+using cluster::parallel::ExecutionModes;
+using cluster::parallel::IncrementalClustering;
 using cluster::parallel::ParallelClustering;
+using cluster::parallel::PrimClustering;
 using cluster::sequential::SequentialClustering;
+#ifndef _WIN32
+using cluster::utils::OutOfCoreDataset;
+#endif
 
 namespace cluster::test::main {
 
@@ -27,18 +44,25 @@ namespace cluster::test::main {
  * the dendrogram after a new point is added.
  * @param sqrtComputationThreadsCount Number of threads to use to compute the square roots of
  * the distances stored in <code>lambda</code>.
+ * @param metric Metric used to measure the distance between two data samples.
+ * @param checkpoint Checkpoint where the state of the clustering is periodically saved, or
+ * <code>nullptr</code> if no checkpoint is saved.
  */
 ClusteringAlgorithmExecutor::ClusteringAlgorithmExecutor(
         const std::size_t dataElementsCount,
         const std::size_t dimension,
         const std::size_t distanceComputationThreadsCount,
         const std::size_t structuralFixThreadsCount,
-        const std::size_t sqrtComputationThreadsCount) :
+        const std::size_t sqrtComputationThreadsCount,
+        const Metrics metric,
+        ClusteringCheckpoint *const checkpoint) :
     dataElementsCount(dataElementsCount),
     dimension(dimension),
     distanceComputationThreadsCount(distanceComputationThreadsCount),
     structuralFixThreadsCount(structuralFixThreadsCount),
-    sqrtComputationThreadsCount(sqrtComputationThreadsCount) {
+    sqrtComputationThreadsCount(sqrtComputationThreadsCount),
+    metric(metric),
+    checkpoint(checkpoint) {
 }
 
 /**
@@ -53,8 +77,12 @@ ClusteringAlgorithmExecutor::ClusteringAlgorithmExecutor(
  * @param avxAlignedIndirectData Data samples to cluster, stored as indirect pointers and
  * aligned for AVX.
  * @param sseAlignedData Data samples to cluster, aligned for SSE.
- * @param avxAlignedData Data samples to cluster, aligned for AVX.
+ * @param avxAlignedData Data samples to cluster, aligned for AVX. If the version 23 is requested,
+ * the data samples are stored in blocks whose attributes are interleaved. If the version 24 is
+ * requested, this is the condensed matrix of the distances between the data samples.
  * @param uniqueArrayData Data samples to cluster, stored as a unique array.
+ * @param avxAlignedFloatData Data samples to cluster, converted to <code>float</code> and aligned
+ * for AVX. If the version 25 is requested, the data samples are neither aligned nor padded.
  * @param piIterator Iterator over the data structure holding <code>pi</code>.
  * @param lambdaIterator Iterator over the data structure holding <code>lambda</code>.
  */
@@ -67,6 +95,257 @@ void ClusteringAlgorithmExecutor::executeClusteringAlgorithm(
         const double *sseAlignedData,
         const double *avxAlignedData,
         const double *uniqueArrayData,
+        const float *avxAlignedFloatData,
+        std::vector<std::size_t>::iterator piIterator,
+        std::vector<double>::iterator lambdaIterator) {
+
+    // Choose the policy describing the requested metric
+    switch (this->metric) {
+        case Metrics::EUCLIDEAN:
+        default:
+            this->executeVersion<utils::EuclideanMetric>(isParallel,
+                                                         version,
+                                                         indirectData,
+                                                         sseAlignedIndirectData,
+                                                         avxAlignedIndirectData,
+                                                         sseAlignedData,
+                                                         avxAlignedData,
+                                                         uniqueArrayData,
+                                                         avxAlignedFloatData,
+                                                         piIterator,
+                                                         lambdaIterator);
+            break;
+        case Metrics::MANHATTAN:
+            this->executeVersion<utils::ManhattanMetric>(isParallel,
+                                                         version,
+                                                         indirectData,
+                                                         sseAlignedIndirectData,
+                                                         avxAlignedIndirectData,
+                                                         sseAlignedData,
+                                                         avxAlignedData,
+                                                         uniqueArrayData,
+                                                         avxAlignedFloatData,
+                                                         piIterator,
+                                                         lambdaIterator);
+            break;
+        case Metrics::CHEBYSHEV:
+            this->executeVersion<utils::ChebyshevMetric>(isParallel,
+                                                         version,
+                                                         indirectData,
+                                                         sseAlignedIndirectData,
+                                                         avxAlignedIndirectData,
+                                                         sseAlignedData,
+                                                         avxAlignedData,
+                                                         uniqueArrayData,
+                                                         avxAlignedFloatData,
+                                                         piIterator,
+                                                         lambdaIterator);
+            break;
+        case Metrics::COSINE:
+            this->executeVersion<utils::CosineMetric>(isParallel,
+                                                      version,
+                                                      indirectData,
+                                                      sseAlignedIndirectData,
+                                                      avxAlignedIndirectData,
+                                                      sseAlignedData,
+                                                      avxAlignedData,
+                                                      uniqueArrayData,
+                                                      avxAlignedFloatData,
+                                                      piIterator,
+                                                      lambdaIterator);
+            break;
+        case Metrics::MINKOWSKI:
+            this->executeVersion<utils::MinkowskiMetric<3>>(isParallel,
+                                                            version,
+                                                            indirectData,
+                                                            sseAlignedIndirectData,
+                                                            avxAlignedIndirectData,
+                                                            sseAlignedData,
+                                                            avxAlignedData,
+                                                            uniqueArrayData,
+                                                            avxAlignedFloatData,
+                                                            piIterator,
+                                                            lambdaIterator);
+            break;
+    }
+}
+
+/**
+ * Executes the requested version of the parallel clustering algorithm, reading the data samples
+ * from a file through an out-of-core dataset.
+ *
+ * @param version Version of the algorithm to execute.
+ * @param filePath Path of the file holding the data samples.
+ * @param dataOffset Offset, in bytes, of the first data sample from the beginning of the file.
+ * @param stride Number of attributes between the first attribute of a data sample and the first
+ * attribute of the following one.
+ * @param residentSetSize Size, in bytes, of the prefix of the data samples that is never released.
+ * @param piIterator Iterator over the data structure holding <code>pi</code>.
+ * @param lambdaIterator Iterator over the data structure holding <code>lambda</code>.
+ * @throws std::invalid_argument If the requested version is not supported, or if the out-of-core
+ * datasets are not supported by the platform.
+ */
+void ClusteringAlgorithmExecutor::executeOutOfCoreClusteringAlgorithm(
+        const std::size_t version,
+        const std::filesystem::path &filePath,
+        const std::size_t dataOffset,
+        const std::size_t stride,
+        const std::size_t residentSetSize,
+        std::vector<std::size_t>::iterator piIterator,
+        std::vector<double>::iterator lambdaIterator) const {
+
+#ifdef _WIN32
+    throw std::invalid_argument("The out-of-core datasets are supported only on POSIX systems");
+#else
+    // Map the data samples
+    const OutOfCoreDataset<double> data{
+            filePath, dataOffset, this->dataElementsCount, stride, residentSetSize};
+
+    // NOLINTBEGIN(cppcoreguidelines-avoid-magic-numbers, readability-magic-numbers)
+    switch (version) {
+        case 11:
+            ParallelClustering<true, true, true>::cluster<
+                    DistanceComputers::AVX_OPTIMIZED_NO_SQUARE_ROOT>(
+                    data,
+                    this->dataElementsCount,
+                    this->dimension,
+                    piIterator,
+                    lambdaIterator,
+                    this->distanceComputationThreadsCount,
+                    this->structuralFixThreadsCount,
+                    this->sqrtComputationThreadsCount,
+                    this->checkpoint);
+            break;
+        case 20:
+            ParallelClustering<true, true, true, false, ExecutionModes::BLOCKED>::cluster<
+                    DistanceComputers::AVX_OPTIMIZED_NO_SQUARE_ROOT>(
+                    data,
+                    this->dataElementsCount,
+                    this->dimension,
+                    piIterator,
+                    lambdaIterator,
+                    this->distanceComputationThreadsCount,
+                    this->structuralFixThreadsCount,
+                    this->sqrtComputationThreadsCount);
+            break;
+        default:
+            using namespace std::literals::string_literals;
+            throw std::invalid_argument("The version"s + ' ' + std::to_string(version) +
+                                        " cannot read the data samples out of core");
+    }
+    // NOLINTEND(cppcoreguidelines-avoid-magic-numbers, readability-magic-numbers)
+#endif
+}
+
+/**
+ * Executes the requested version of the parallel clustering algorithm, storing <code>pi</code> as
+ * 32-bit unsigned integers instead of <code>std::size_t</code>.
+ *
+ * @param version Version of the algorithm to execute.
+ * @param avxAlignedData Data samples to cluster, aligned for AVX.
+ * @param piIterator Iterator over the data structure holding <code>pi</code>.
+ * @param lambdaIterator Iterator over the data structure holding <code>lambda</code>.
+ * @throws std::invalid_argument If the requested version is not supported, or if the indices of
+ * the data samples do not fit in 32 bits.
+ */
+void ClusteringAlgorithmExecutor::executeCompactPiClusteringAlgorithm(
+        const std::size_t version,
+        const double *avxAlignedData,
+        std::vector<std::uint32_t>::iterator piIterator,
+        std::vector<double>::iterator lambdaIterator) const {
+
+    // NOLINTBEGIN(cppcoreguidelines-avoid-magic-numbers, readability-magic-numbers)
+    switch (version) {
+        case 11:
+            ParallelClustering<true, true, true>::cluster<
+                    DistanceComputers::AVX_OPTIMIZED_NO_SQUARE_ROOT>(
+                    avxAlignedData,
+                    this->dataElementsCount,
+                    this->dimension,
+                    piIterator,
+                    lambdaIterator,
+                    this->distanceComputationThreadsCount,
+                    this->structuralFixThreadsCount,
+                    this->sqrtComputationThreadsCount,
+                    this->checkpoint);
+            break;
+        case 12:
+            ParallelClustering<true, true, true, false, ExecutionModes::PERSISTENT_TEAM>::cluster<
+                    DistanceComputers::AVX_OPTIMIZED_NO_SQUARE_ROOT>(
+                    avxAlignedData,
+                    this->dataElementsCount,
+                    this->dimension,
+                    piIterator,
+                    lambdaIterator,
+                    this->distanceComputationThreadsCount,
+                    this->structuralFixThreadsCount,
+                    this->sqrtComputationThreadsCount);
+            break;
+        case 16:
+            ParallelClustering<true, true, true, false, ExecutionModes::PIPELINED>::cluster<
+                    DistanceComputers::AVX_OPTIMIZED_NO_SQUARE_ROOT>(
+                    avxAlignedData,
+                    this->dataElementsCount,
+                    this->dimension,
+                    piIterator,
+                    lambdaIterator,
+                    this->distanceComputationThreadsCount,
+                    this->structuralFixThreadsCount,
+                    this->sqrtComputationThreadsCount);
+            break;
+        case 20:
+            ParallelClustering<true, true, true, false, ExecutionModes::BLOCKED>::cluster<
+                    DistanceComputers::AVX_OPTIMIZED_NO_SQUARE_ROOT>(
+                    avxAlignedData,
+                    this->dataElementsCount,
+                    this->dimension,
+                    piIterator,
+                    lambdaIterator,
+                    this->distanceComputationThreadsCount,
+                    this->structuralFixThreadsCount,
+                    this->sqrtComputationThreadsCount);
+            break;
+        default:
+            using namespace std::literals::string_literals;
+            throw std::invalid_argument("The version"s + ' ' + std::to_string(version) +
+                                        " cannot store pi as 32-bit unsigned integers");
+    }
+    // NOLINTEND(cppcoreguidelines-avoid-magic-numbers, readability-magic-numbers)
+}
+
+/**
+ * Executes the requested version of the clustering algorithm, using the specified metric.
+ *
+ * @tparam MT Policy describing the metric used to measure the distance between two data samples.
+ * @param isParallel <code>true</code> if the parallel implementation of the clustering
+ * algorithm should be executed, <code>false</code> otherwise.
+ * @param version Version of the algorithm to execute.
+ * @param indirectData Data samples to cluster, stored as indirect pointers.
+ * @param sseAlignedIndirectData Data samples to cluster, stored as indirect pointers and
+ * aligned for SSE.
+ * @param avxAlignedIndirectData Data samples to cluster, stored as indirect pointers and
+ * aligned for AVX.
+ * @param sseAlignedData Data samples to cluster, aligned for SSE.
+ * @param avxAlignedData Data samples to cluster, aligned for AVX. If the version 23 is requested,
+ * the data samples are stored in blocks whose attributes are interleaved. If the version 24 is
+ * requested, this is the condensed matrix of the distances between the data samples.
+ * @param uniqueArrayData Data samples to cluster, stored as a unique array.
+ * @param avxAlignedFloatData Data samples to cluster, converted to <code>float</code> and aligned
+ * for AVX. If the version 25 is requested, the data samples are neither aligned nor padded.
+ * @param piIterator Iterator over the data structure holding <code>pi</code>.
+ * @param lambdaIterator Iterator over the data structure holding <code>lambda</code>.
+ */
+template <typename MT>
+void ClusteringAlgorithmExecutor::executeVersion(
+        const bool isParallel,
+        const std::size_t version,
+        const std::vector<double *> &indirectData,
+        const std::vector<double *> &sseAlignedIndirectData,
+        const std::vector<double *> &avxAlignedIndirectData,
+        const double *sseAlignedData,
+        const double *avxAlignedData,
+        const double *uniqueArrayData,
+        const float *avxAlignedFloatData,
         std::vector<std::size_t>::iterator piIterator,
         std::vector<double>::iterator lambdaIterator) {
 
@@ -75,37 +354,79 @@ void ClusteringAlgorithmExecutor::executeClusteringAlgorithm(
     if (isParallel) {
         switch (version) {
             case 1:
-                this->executeParallelV1(indirectData, piIterator, lambdaIterator);
+                this->executeParallelV1<MT>(indirectData, piIterator, lambdaIterator);
                 break;
             case 2:
-                this->executeParallelV2(sseAlignedIndirectData, piIterator, lambdaIterator);
+                this->executeParallelV2<MT>(sseAlignedIndirectData, piIterator, lambdaIterator);
                 break;
             case 3:
-                this->executeParallelV3(avxAlignedIndirectData, piIterator, lambdaIterator);
+                this->executeParallelV3<MT>(avxAlignedIndirectData, piIterator, lambdaIterator);
                 break;
             case 4:
-                this->executeParallelV4(avxAlignedData, piIterator, lambdaIterator);
+                this->executeParallelV4<MT>(avxAlignedData, piIterator, lambdaIterator);
                 break;
             case 5:
-                this->executeParallelV5(sseAlignedIndirectData, piIterator, lambdaIterator);
+                this->executeParallelV5<MT>(sseAlignedIndirectData, piIterator, lambdaIterator);
                 break;
             case 6:
-                this->executeParallelV6(sseAlignedIndirectData, piIterator, lambdaIterator);
+                this->executeParallelV6<MT>(sseAlignedIndirectData, piIterator, lambdaIterator);
                 break;
             case 7:
-                this->executeParallelV7(avxAlignedIndirectData, piIterator, lambdaIterator);
+                this->executeParallelV7<MT>(avxAlignedIndirectData, piIterator, lambdaIterator);
                 break;
             case 8:
-                this->executeParallelV8(sseAlignedData, piIterator, lambdaIterator);
+                this->executeParallelV8<MT>(sseAlignedData, piIterator, lambdaIterator);
                 break;
             case 9:
-                this->executeParallelV9(avxAlignedData, piIterator, lambdaIterator);
+                this->executeParallelV9<MT>(avxAlignedData, piIterator, lambdaIterator);
                 break;
             case 10:
-                this->executeParallelV10(avxAlignedData, piIterator, lambdaIterator);
+                this->executeParallelV10<MT>(avxAlignedData, piIterator, lambdaIterator);
                 break;
             case 11:
-                this->executeParallelV11(avxAlignedData, piIterator, lambdaIterator);
+                this->executeParallelV11<MT>(avxAlignedData, piIterator, lambdaIterator);
+                break;
+            case 12:
+                this->executeParallelV12(avxAlignedData, piIterator, lambdaIterator);
+                break;
+            case 13:
+                this->executeParallelV13(uniqueArrayData, piIterator, lambdaIterator);
+                break;
+            case 14:
+                this->executeParallelV14(uniqueArrayData, piIterator, lambdaIterator);
+                break;
+            case 15:
+                this->executeParallelV15(avxAlignedFloatData, piIterator, lambdaIterator);
+                break;
+            case 16:
+                this->executeParallelV16(avxAlignedData, piIterator, lambdaIterator);
+                break;
+            case 17:
+                this->executeParallelV17(avxAlignedData, piIterator, lambdaIterator);
+                break;
+            case 18:
+                this->executeParallelV18(uniqueArrayData, piIterator, lambdaIterator);
+                break;
+            case 19:
+                this->executeParallelV19(uniqueArrayData, piIterator, lambdaIterator);
+                break;
+            case 20:
+                this->executeParallelV20(avxAlignedData, piIterator, lambdaIterator);
+                break;
+            case 21:
+                this->executeParallelV21(avxAlignedData, piIterator, lambdaIterator);
+                break;
+            case 22:
+                this->executeParallelV22<MT>(avxAlignedData, piIterator, lambdaIterator);
+                break;
+            case 23:
+                this->executeParallelV23(avxAlignedData, piIterator, lambdaIterator);
+                break;
+            case 24:
+                this->executeParallelV24(avxAlignedData, piIterator, lambdaIterator);
+                break;
+            case 25:
+                this->executeParallelV25(avxAlignedFloatData, piIterator, lambdaIterator);
                 break;
             default:
                 std::cerr << "Unknown parallel version" << ' ' << version << std::endl;
@@ -114,10 +435,10 @@ void ClusteringAlgorithmExecutor::executeClusteringAlgorithm(
     } else {
         switch (version) {
             case 1:
-                this->executeSequentialV1(indirectData, piIterator, lambdaIterator);
+                this->executeSequentialV1<MT>(indirectData, piIterator, lambdaIterator);
                 break;
             case 2:
-                this->executeSequentialV2(uniqueArrayData, piIterator, lambdaIterator);
+                this->executeSequentialV2<MT>(uniqueArrayData, piIterator, lambdaIterator);
                 break;
             default:
                 std::cerr << "Unknown sequential version" << ' ' << version << std::endl;
@@ -130,272 +451,650 @@ void ClusteringAlgorithmExecutor::executeClusteringAlgorithm(
 /**
  * Executes the first version of the parallel clustering algorithm.
  *
+ * @tparam MT Policy describing the metric used to measure the distance between two data samples.
  * @param data Data to cluster.
  * @param piIterator Iterator over the data structure holding <code>pi</code>.
  * @param lambdaIterator Iterator over the data structure holding <code>lambda</code>.
  */
+template <typename MT>
 void ClusteringAlgorithmExecutor::executeParallelV1(
         const std::vector<double *> &data,
         std::vector<std::size_t>::iterator piIterator,
         std::vector<double>::iterator lambdaIterator) const {
 
-    ParallelClustering<>::cluster<DistanceComputers::CLASSICAL>(
+    ParallelClustering<>::cluster<DistanceComputers::CLASSICAL, double, MT>(
             data,
             this->dataElementsCount,
             this->dimension,
             piIterator,
             lambdaIterator,
             this->distanceComputationThreadsCount,
-            this->structuralFixThreadsCount);
+            this->structuralFixThreadsCount,
+            this->sqrtComputationThreadsCount,
+            this->checkpoint);
 }
 
 /**
  * Executes the second version of the parallel clustering algorithm.
  *
+ * @tparam MT Policy describing the metric used to measure the distance between two data samples.
  * @param sseAlignedIndirectData Data to cluster.
  * @param piIterator Iterator over the data structure holding <code>pi</code>.
  * @param lambdaIterator Iterator over the data structure holding <code>lambda</code>.
  */
+template <typename MT>
 void ClusteringAlgorithmExecutor::executeParallelV2(
         const std::vector<double *> &sseAlignedIndirectData,
         std::vector<std::size_t>::iterator piIterator,
         std::vector<double>::iterator lambdaIterator) const {
 
-    ParallelClustering<>::cluster<DistanceComputers::SSE>(sseAlignedIndirectData,
-                                                          this->dataElementsCount,
-                                                          this->dimension,
-                                                          piIterator,
-                                                          lambdaIterator,
-                                                          this->distanceComputationThreadsCount,
-                                                          this->structuralFixThreadsCount);
+    ParallelClustering<>::cluster<DistanceComputers::SSE, double, MT>(
+            sseAlignedIndirectData,
+            this->dataElementsCount,
+            this->dimension,
+            piIterator,
+            lambdaIterator,
+            this->distanceComputationThreadsCount,
+            this->structuralFixThreadsCount,
+            this->sqrtComputationThreadsCount,
+            this->checkpoint);
 }
 
 /**
  * Executes the third version of the parallel clustering algorithm.
  *
+ * @tparam MT Policy describing the metric used to measure the distance between two data samples.
  * @param avxAlignedIndirectData Data to cluster.
  * @param piIterator Iterator over the data structure holding <code>pi</code>.
  * @param lambdaIterator Iterator over the data structure holding <code>lambda</code>.
  */
+template <typename MT>
 void ClusteringAlgorithmExecutor::executeParallelV3(
         const std::vector<double *> &avxAlignedIndirectData,
         std::vector<std::size_t>::iterator piIterator,
         std::vector<double>::iterator lambdaIterator) const {
 
-    ParallelClustering<>::cluster<DistanceComputers::AVX>(avxAlignedIndirectData,
-                                                          this->dataElementsCount,
-                                                          this->dimension,
-                                                          piIterator,
-                                                          lambdaIterator,
-                                                          this->distanceComputationThreadsCount,
-                                                          this->structuralFixThreadsCount);
+    ParallelClustering<>::cluster<DistanceComputers::AVX, double, MT>(
+            avxAlignedIndirectData,
+            this->dataElementsCount,
+            this->dimension,
+            piIterator,
+            lambdaIterator,
+            this->distanceComputationThreadsCount,
+            this->structuralFixThreadsCount,
+            this->sqrtComputationThreadsCount,
+            this->checkpoint);
 }
 
 /**
  * Executes the fourth version of the parallel clustering algorithm.
  *
+ * @tparam MT Policy describing the metric used to measure the distance between two data samples.
  * @param avxAlignedData Data to cluster.
  * @param piIterator Iterator over the data structure holding <code>pi</code>.
  * @param lambdaIterator Iterator over the data structure holding <code>lambda</code>.
  */
+template <typename MT>
 void ClusteringAlgorithmExecutor::executeParallelV4(
         const double *avxAlignedData,
         std::vector<std::size_t>::iterator piIterator,
         std::vector<double>::iterator lambdaIterator) const {
 
-    ParallelClustering<>::cluster<DistanceComputers::AVX>(avxAlignedData,
-                                                          this->dataElementsCount,
-                                                          this->dimension,
-                                                          piIterator,
-                                                          lambdaIterator,
-                                                          this->distanceComputationThreadsCount,
-                                                          this->structuralFixThreadsCount);
+    ParallelClustering<>::cluster<DistanceComputers::AVX, double, MT>(
+            avxAlignedData,
+            this->dataElementsCount,
+            this->dimension,
+            piIterator,
+            lambdaIterator,
+            this->distanceComputationThreadsCount,
+            this->structuralFixThreadsCount,
+            this->sqrtComputationThreadsCount,
+            this->checkpoint);
 }
 
 /**
  * Executes the fifth version of the parallel clustering algorithm.
  *
+ * @tparam MT Policy describing the metric used to measure the distance between two data samples.
  * @param sseAlignedIndirectData Data to cluster.
  * @param piIterator Iterator over the data structure holding <code>pi</code>.
  * @param lambdaIterator Iterator over the data structure holding <code>lambda</code>.
  */
+template <typename MT>
 void ClusteringAlgorithmExecutor::executeParallelV5(
         const std::vector<double *> &sseAlignedIndirectData,
         std::vector<std::size_t>::iterator piIterator,
         std::vector<double>::iterator lambdaIterator) const {
 
-    ParallelClustering<true, true>::cluster<DistanceComputers::SSE>(
+    ParallelClustering<true, true>::cluster<DistanceComputers::SSE, double, MT>(
             sseAlignedIndirectData,
             this->dataElementsCount,
             this->dimension,
             piIterator,
             lambdaIterator,
             this->distanceComputationThreadsCount,
-            this->structuralFixThreadsCount);
+            this->structuralFixThreadsCount,
+            this->sqrtComputationThreadsCount,
+            this->checkpoint);
 }
 
 /**
  * Executes the sixth version of the parallel clustering algorithm.
  *
+ * @tparam MT Policy describing the metric used to measure the distance between two data samples.
  * @param sseAlignedIndirectData Data to cluster.
  * @param piIterator Iterator over the data structure holding <code>pi</code>.
  * @param lambdaIterator Iterator over the data structure holding <code>lambda</code>.
  */
+template <typename MT>
 void ClusteringAlgorithmExecutor::executeParallelV6(
         const std::vector<double *> &sseAlignedIndirectData,
         std::vector<std::size_t>::iterator piIterator,
         std::vector<double>::iterator lambdaIterator) const {
 
-    ParallelClustering<true, true>::cluster<DistanceComputers::SSE_OPTIMIZED>(
+    ParallelClustering<true, true>::cluster<DistanceComputers::SSE_OPTIMIZED, double, MT>(
             sseAlignedIndirectData,
             this->dataElementsCount,
             this->dimension,
             piIterator,
             lambdaIterator,
             this->distanceComputationThreadsCount,
-            this->structuralFixThreadsCount);
+            this->structuralFixThreadsCount,
+            this->sqrtComputationThreadsCount,
+            this->checkpoint);
 }
 
 /**
  * Executes the seventh version of the parallel clustering algorithm.
  *
+ * @tparam MT Policy describing the metric used to measure the distance between two data samples.
  * @param avxAlignedIndirectData Data to cluster.
  * @param piIterator Iterator over the data structure holding <code>pi</code>.
  * @param lambdaIterator Iterator over the data structure holding <code>lambda</code>.
  */
+template <typename MT>
 void ClusteringAlgorithmExecutor::executeParallelV7(
         const std::vector<double *> &avxAlignedIndirectData,
         std::vector<std::size_t>::iterator piIterator,
         std::vector<double>::iterator lambdaIterator) const {
 
-    ParallelClustering<true, true>::cluster<DistanceComputers::AVX_OPTIMIZED>(
+    ParallelClustering<true, true>::cluster<DistanceComputers::AVX_OPTIMIZED, double, MT>(
             avxAlignedIndirectData,
             this->dataElementsCount,
             this->dimension,
             piIterator,
             lambdaIterator,
             this->distanceComputationThreadsCount,
-            this->structuralFixThreadsCount);
+            this->structuralFixThreadsCount,
+            this->sqrtComputationThreadsCount,
+            this->checkpoint);
 }
 
 /**
  * Executes the eighth version of the parallel clustering algorithm.
  *
+ * @tparam MT Policy describing the metric used to measure the distance between two data samples.
  * @param sseAlignedData Data to cluster.
  * @param piIterator Iterator over the data structure holding <code>pi</code>.
  * @param lambdaIterator Iterator over the data structure holding <code>lambda</code>.
  */
+template <typename MT>
 void ClusteringAlgorithmExecutor::executeParallelV8(
         const double *sseAlignedData,
         std::vector<std::size_t>::iterator piIterator,
         std::vector<double>::iterator lambdaIterator) const {
 
-    ParallelClustering<true, true>::cluster<DistanceComputers::SSE_OPTIMIZED>(
+    ParallelClustering<true, true>::cluster<DistanceComputers::SSE_OPTIMIZED, double, MT>(
             sseAlignedData,
             this->dataElementsCount,
             this->dimension,
             piIterator,
             lambdaIterator,
             this->distanceComputationThreadsCount,
-            this->structuralFixThreadsCount);
+            this->structuralFixThreadsCount,
+            this->sqrtComputationThreadsCount,
+            this->checkpoint);
 }
 
 /**
  * Executes the ninth version of the parallel clustering algorithm.
  *
+ * @tparam MT Policy describing the metric used to measure the distance between two data samples.
  * @param avxAlignedData Data to cluster.
  * @param piIterator Iterator over the data structure holding <code>pi</code>.
  * @param lambdaIterator Iterator over the data structure holding <code>lambda</code>.
  */
+template <typename MT>
 void ClusteringAlgorithmExecutor::executeParallelV9(
         const double *avxAlignedData,
         std::vector<std::size_t>::iterator piIterator,
         std::vector<double>::iterator lambdaIterator) const {
 
-    ParallelClustering<true, true>::cluster<DistanceComputers::AVX_OPTIMIZED>(
+    ParallelClustering<true, true>::cluster<DistanceComputers::AVX_OPTIMIZED, double, MT>(
             avxAlignedData,
             this->dataElementsCount,
             this->dimension,
             piIterator,
             lambdaIterator,
             this->distanceComputationThreadsCount,
-            this->structuralFixThreadsCount);
+            this->structuralFixThreadsCount,
+            this->sqrtComputationThreadsCount,
+            this->checkpoint);
 }
 
 /**
  * Executes the tenth version of the parallel clustering algorithm.
  *
+ * @tparam MT Policy describing the metric used to measure the distance between two data samples.
  * @param avxAlignedData Data to cluster.
  * @param piIterator Iterator over the data structure holding <code>pi</code>.
  * @param lambdaIterator Iterator over the data structure holding <code>lambda</code>.
  */
+template <typename MT>
 void ClusteringAlgorithmExecutor::executeParallelV10(
         const double *avxAlignedData,
         std::vector<std::size_t>::iterator piIterator,
         std::vector<double>::iterator lambdaIterator) const {
 
-    ParallelClustering<true, true>::cluster<DistanceComputers::AVX_OPTIMIZED_NO_SQUARE_ROOT>(
-            avxAlignedData,
+    ParallelClustering<true, true>::cluster<DistanceComputers::AVX_OPTIMIZED_NO_SQUARE_ROOT,
+                                            double,
+                                            MT>(avxAlignedData,
+                                                this->dataElementsCount,
+                                                this->dimension,
+                                                piIterator,
+                                                lambdaIterator,
+                                                this->distanceComputationThreadsCount,
+                                                this->structuralFixThreadsCount,
+                                                this->sqrtComputationThreadsCount,
+                                                this->checkpoint);
+}
+
+/**
+ * Executes the eleventh version of the parallel clustering algorithm.
+ *
+ * @tparam MT Policy describing the metric used to measure the distance between two data samples.
+ * @param avxAlignedData Data to cluster.
+ * @param piIterator Iterator over the data structure holding <code>pi</code>.
+ * @param lambdaIterator Iterator over the data structure holding <code>lambda</code>.
+ */
+template <typename MT>
+void ClusteringAlgorithmExecutor::executeParallelV11(
+        const double *avxAlignedData,
+        std::vector<std::size_t>::iterator piIterator,
+        std::vector<double>::iterator lambdaIterator) const {
+
+    ParallelClustering<true, true, true>::cluster<DistanceComputers::AVX_OPTIMIZED_NO_SQUARE_ROOT,
+                                                  double,
+                                                  MT>(avxAlignedData,
+                                                      this->dataElementsCount,
+                                                      this->dimension,
+                                                      piIterator,
+                                                      lambdaIterator,
+                                                      this->distanceComputationThreadsCount,
+                                                      this->structuralFixThreadsCount,
+                                                      this->sqrtComputationThreadsCount,
+                                                      this->checkpoint);
+}
+
+/**
+ * Executes the twelfth version of the parallel clustering algorithm.
+ *
+ * @param avxAlignedData Data to cluster.
+ * @param piIterator Iterator over the data structure holding <code>pi</code>.
+ * @param lambdaIterator Iterator over the data structure holding <code>lambda</code>.
+ */
+void ClusteringAlgorithmExecutor::executeParallelV12(
+        const double *avxAlignedData,
+        std::vector<std::size_t>::iterator piIterator,
+        std::vector<double>::iterator lambdaIterator) const {
+
+    ParallelClustering<true, true, true, false, ExecutionModes::PERSISTENT_TEAM>::cluster<
+            DistanceComputers::AVX_OPTIMIZED_NO_SQUARE_ROOT>(avxAlignedData,
+                                                             this->dataElementsCount,
+                                                             this->dimension,
+                                                             piIterator,
+                                                             lambdaIterator,
+                                                             this->distanceComputationThreadsCount,
+                                                             this->structuralFixThreadsCount,
+                                                             this->sqrtComputationThreadsCount);
+}
+
+/**
+ * Executes the thirteenth version of the parallel clustering algorithm.
+ *
+ * @param uniqueArrayData Data to cluster.
+ * @param piIterator Iterator over the data structure holding <code>pi</code>.
+ * @param lambdaIterator Iterator over the data structure holding <code>lambda</code>.
+ */
+void ClusteringAlgorithmExecutor::executeParallelV13(
+        const double *uniqueArrayData,
+        std::vector<std::size_t>::iterator piIterator,
+        std::vector<double>::iterator lambdaIterator) const {
+
+    ParallelClustering<true, true, true>::cluster<DistanceComputers::AVX512_NO_SQUARE_ROOT>(
+            uniqueArrayData,
             this->dataElementsCount,
             this->dimension,
             piIterator,
             lambdaIterator,
             this->distanceComputationThreadsCount,
-            this->structuralFixThreadsCount);
+            this->structuralFixThreadsCount,
+            this->sqrtComputationThreadsCount,
+            this->checkpoint);
 }
 
 /**
- * Executes the eleventh version of the parallel clustering algorithm.
+ * Executes the fourteenth version of the parallel clustering algorithm.
+ *
+ * @param uniqueArrayData Data to cluster.
+ * @param piIterator Iterator over the data structure holding <code>pi</code>.
+ * @param lambdaIterator Iterator over the data structure holding <code>lambda</code>.
+ */
+void ClusteringAlgorithmExecutor::executeParallelV14(
+        const double *uniqueArrayData,
+        std::vector<std::size_t>::iterator piIterator,
+        std::vector<double>::iterator lambdaIterator) const {
+
+    ParallelClustering<true, true, true>::cluster<DistanceComputers::AUTO>(
+            uniqueArrayData,
+            this->dataElementsCount,
+            this->dimension,
+            piIterator,
+            lambdaIterator,
+            this->distanceComputationThreadsCount,
+            this->structuralFixThreadsCount,
+            this->sqrtComputationThreadsCount,
+            this->checkpoint);
+}
+
+/**
+ * Executes the fifteenth version of the parallel clustering algorithm.
+ *
+ * @param avxAlignedFloatData Data to cluster.
+ * @param piIterator Iterator over the data structure holding <code>pi</code>.
+ * @param lambdaIterator Iterator over the data structure holding <code>lambda</code>.
+ */
+void ClusteringAlgorithmExecutor::executeParallelV15(
+        const float *avxAlignedFloatData,
+        std::vector<std::size_t>::iterator piIterator,
+        std::vector<double>::iterator lambdaIterator) const {
+
+    ParallelClustering<true, true, true>::cluster<DistanceComputers::AVX_OPTIMIZED_NO_SQUARE_ROOT,
+                                                  float>(avxAlignedFloatData,
+                                                         this->dataElementsCount,
+                                                         this->dimension,
+                                                         piIterator,
+                                                         lambdaIterator,
+                                                         this->distanceComputationThreadsCount,
+                                                         this->structuralFixThreadsCount,
+                                                         this->sqrtComputationThreadsCount,
+                                                         this->checkpoint);
+}
+
+/**
+ * Executes the sixteenth version of the parallel clustering algorithm.
  *
  * @param avxAlignedData Data to cluster.
  * @param piIterator Iterator over the data structure holding <code>pi</code>.
  * @param lambdaIterator Iterator over the data structure holding <code>lambda</code>.
  */
-void ClusteringAlgorithmExecutor::executeParallelV11(
+void ClusteringAlgorithmExecutor::executeParallelV16(
         const double *avxAlignedData,
         std::vector<std::size_t>::iterator piIterator,
         std::vector<double>::iterator lambdaIterator) const {
 
-    ParallelClustering<true, true, true>::cluster<DistanceComputers::AVX_OPTIMIZED_NO_SQUARE_ROOT>(
+    ParallelClustering<true, true, true, false, ExecutionModes::PIPELINED>::cluster<
+            DistanceComputers::AVX_OPTIMIZED_NO_SQUARE_ROOT>(avxAlignedData,
+                                                             this->dataElementsCount,
+                                                             this->dimension,
+                                                             piIterator,
+                                                             lambdaIterator,
+                                                             this->distanceComputationThreadsCount,
+                                                             this->structuralFixThreadsCount,
+                                                             this->sqrtComputationThreadsCount);
+}
+
+/**
+ * Executes the seventeenth version of the parallel clustering algorithm.
+ *
+ * @param avxAlignedData Data to cluster.
+ * @param piIterator Iterator over the data structure holding <code>pi</code>.
+ * @param lambdaIterator Iterator over the data structure holding <code>lambda</code>.
+ */
+void ClusteringAlgorithmExecutor::executeParallelV17(
+        const double *avxAlignedData,
+        std::vector<std::size_t>::iterator piIterator,
+        std::vector<double>::iterator lambdaIterator) const {
+
+    PrimClustering<true, true>::cluster<DistanceComputers::AVX_OPTIMIZED_NO_SQUARE_ROOT>(
             avxAlignedData,
             this->dataElementsCount,
             this->dimension,
             piIterator,
             lambdaIterator,
             this->distanceComputationThreadsCount,
+            this->sqrtComputationThreadsCount);
+}
+
+/**
+ * Executes the eighteenth version of the parallel clustering algorithm.
+ *
+ * @param uniqueArrayData Data to cluster.
+ * @param piIterator Iterator over the data structure holding <code>pi</code>.
+ * @param lambdaIterator Iterator over the data structure holding <code>lambda</code>.
+ */
+void ClusteringAlgorithmExecutor::executeParallelV18(
+        const double *uniqueArrayData,
+        std::vector<std::size_t>::iterator piIterator,
+        std::vector<double>::iterator lambdaIterator) const {
+
+    BoruvkaClustering<true>::cluster(uniqueArrayData,
+                                     this->dataElementsCount,
+                                     this->dimension,
+                                     piIterator,
+                                     lambdaIterator,
+                                     this->distanceComputationThreadsCount);
+}
+
+/**
+ * Executes the nineteenth version of the parallel clustering algorithm.
+ *
+ * @param uniqueArrayData Data to cluster.
+ * @param piIterator Iterator over the data structure holding <code>pi</code>.
+ * @param lambdaIterator Iterator over the data structure holding <code>lambda</code>.
+ */
+void ClusteringAlgorithmExecutor::executeParallelV19(
+        const double *uniqueArrayData,
+        std::vector<std::size_t>::iterator piIterator,
+        std::vector<double>::iterator lambdaIterator) const {
+
+    // Append all the data samples, as if they arrived one after the other
+    IncrementalClustering<DistanceComputers::AUTO> clustering{this->dimension,
+                                                              this->distanceComputationThreadsCount,
+                                                              this->structuralFixThreadsCount};
+    clustering.appendBatch(uniqueArrayData, this->dataElementsCount);
+
+    // Copy the dendrogram
+    const std::vector<std::size_t> &pi = clustering.getPi();
+    const std::vector<double> lambda = clustering.getLambda();
+    std::copy(pi.cbegin(), pi.cend(), piIterator);
+    std::copy(lambda.cbegin(), lambda.cend(), lambdaIterator);
+}
+
+/**
+ * Executes the twentieth version of the parallel clustering algorithm.
+ *
+ * @param avxAlignedData Data to cluster.
+ * @param piIterator Iterator over the data structure holding <code>pi</code>.
+ * @param lambdaIterator Iterator over the data structure holding <code>lambda</code>.
+ */
+void ClusteringAlgorithmExecutor::executeParallelV20(
+        const double *avxAlignedData,
+        std::vector<std::size_t>::iterator piIterator,
+        std::vector<double>::iterator lambdaIterator) const {
+
+    ParallelClustering<true, true, true, false, ExecutionModes::BLOCKED>::cluster<
+            DistanceComputers::AVX_OPTIMIZED_NO_SQUARE_ROOT>(avxAlignedData,
+                                                             this->dataElementsCount,
+                                                             this->dimension,
+                                                             piIterator,
+                                                             lambdaIterator,
+                                                             this->distanceComputationThreadsCount,
+                                                             this->structuralFixThreadsCount,
+                                                             this->sqrtComputationThreadsCount);
+}
+
+/**
+ * Executes the twenty-first version of the parallel clustering algorithm.
+ *
+ * @param avxAlignedData Data to cluster.
+ * @param piIterator Iterator over the data structure holding <code>pi</code>.
+ * @param lambdaIterator Iterator over the data structure holding <code>lambda</code>.
+ */
+void ClusteringAlgorithmExecutor::executeParallelV21(
+        const double *avxAlignedData,
+        std::vector<std::size_t>::iterator piIterator,
+        std::vector<double>::iterator lambdaIterator) const {
+
+    ParallelClustering<true, true, true, false, ExecutionModes::BLOCKED>::cluster<
+            DistanceComputers::NORM_EXPANSION>(avxAlignedData,
+                                               this->dataElementsCount,
+                                               this->dimension,
+                                               piIterator,
+                                               lambdaIterator,
+                                               this->distanceComputationThreadsCount,
+                                               this->structuralFixThreadsCount,
+                                               this->sqrtComputationThreadsCount);
+}
+
+/**
+ * Executes the twenty-second version of the parallel clustering algorithm.
+ *
+ * @tparam MT Policy describing the metric used to measure the distance between two data samples.
+ * @param avxAlignedData Data to cluster.
+ * @param piIterator Iterator over the data structure holding <code>pi</code>.
+ * @param lambdaIterator Iterator over the data structure holding <code>lambda</code>.
+ */
+template <typename MT>
+void ClusteringAlgorithmExecutor::executeParallelV22(
+        const double *avxAlignedData,
+        std::vector<std::size_t>::iterator piIterator,
+        std::vector<double>::iterator lambdaIterator) const {
+
+    ParallelClustering<true, true, true>::cluster<DistanceComputers::AVX_FMA_NO_SQUARE_ROOT,
+                                                  double,
+                                                  MT>(avxAlignedData,
+                                                      this->dataElementsCount,
+                                                      this->dimension,
+                                                      piIterator,
+                                                      lambdaIterator,
+                                                      this->distanceComputationThreadsCount,
+                                                      this->structuralFixThreadsCount,
+                                                      this->sqrtComputationThreadsCount,
+                                                      this->checkpoint);
+}
+
+/**
+ * Executes the twenty-third version of the parallel clustering algorithm.
+ *
+ * @param avxInterleavedData Data to cluster, stored in blocks whose attributes are interleaved.
+ * @param piIterator Iterator over the data structure holding <code>pi</code>.
+ * @param lambdaIterator Iterator over the data structure holding <code>lambda</code>.
+ */
+void ClusteringAlgorithmExecutor::executeParallelV23(
+        const double *avxInterleavedData,
+        std::vector<std::size_t>::iterator piIterator,
+        std::vector<double>::iterator lambdaIterator) const {
+
+    ParallelClustering<true, true, true>::cluster<
+            DistanceComputers::AVX_INTERLEAVED_NO_SQUARE_ROOT>(
+            avxInterleavedData,
+            this->dataElementsCount,
+            this->dimension,
+            piIterator,
+            lambdaIterator,
+            this->distanceComputationThreadsCount,
             this->structuralFixThreadsCount,
             this->sqrtComputationThreadsCount);
 }
 
+/**
+ * Executes the twenty-fourth version of the parallel clustering algorithm.
+ *
+ * @param distanceMatrix Condensed matrix of the distances between the data samples to cluster.
+ * @param piIterator Iterator over the data structure holding <code>pi</code>.
+ * @param lambdaIterator Iterator over the data structure holding <code>lambda</code>.
+ */
+void ClusteringAlgorithmExecutor::executeParallelV24(
+        const double *distanceMatrix,
+        std::vector<std::size_t>::iterator piIterator,
+        std::vector<double>::iterator lambdaIterator) const {
+
+    ParallelClustering<true, true>::clusterDistanceMatrix(distanceMatrix,
+                                                          this->dataElementsCount,
+                                                          piIterator,
+                                                          lambdaIterator,
+                                                          this->distanceComputationThreadsCount,
+                                                          this->structuralFixThreadsCount);
+}
+
+/**
+ * Executes the twenty-fifth version of the parallel clustering algorithm.
+ *
+ * @param uniqueArrayFloatData Data to cluster.
+ * @param piIterator Iterator over the data structure holding <code>pi</code>.
+ * @param lambdaIterator Iterator over the data structure holding <code>lambda</code>.
+ */
+void ClusteringAlgorithmExecutor::executeParallelV25(
+        const float *uniqueArrayFloatData,
+        std::vector<std::size_t>::iterator piIterator,
+        std::vector<double>::iterator lambdaIterator) const {
+
+    ParallelClustering<true, true, true>::cluster<DistanceComputers::AVX512_NO_SQUARE_ROOT, float>(
+            uniqueArrayFloatData,
+            this->dataElementsCount,
+            this->dimension,
+            piIterator,
+            lambdaIterator,
+            this->distanceComputationThreadsCount,
+            this->structuralFixThreadsCount,
+            this->sqrtComputationThreadsCount,
+            this->checkpoint);
+}
+
 /**
  * Executes the first version of the sequential clustering algorithm.
  *
+ * @tparam MT Policy describing the metric used to measure the distance between two data samples.
  * @param data Data to cluster.
  * @param piIterator Iterator over the data structure holding <code>pi</code>.
  * @param lambdaIterator Iterator over the data structure holding <code>lambda</code>.
  */
+template <typename MT>
 void ClusteringAlgorithmExecutor::executeSequentialV1(
         const std::vector<double *> &data,
         std::vector<std::size_t>::iterator piIterator,
         std::vector<double>::iterator lambdaIterator) const {
 
-    SequentialClustering::cluster(
+    SequentialClustering::cluster<MT>(
             data.begin(), this->dataElementsCount, this->dimension, piIterator, lambdaIterator);
 }
 
 /**
  * Executes the second version of the sequential clustering algorithm.
  *
+ * @tparam MT Policy describing the metric used to measure the distance between two data samples.
  * @param uniqueArrayData Data to cluster.
  * @param piIterator Iterator over the data structure holding <code>pi</code>.
  * @param lambdaIterator Iterator over the data structure holding <code>lambda</code>.
  */
+template <typename MT>
 void ClusteringAlgorithmExecutor::executeSequentialV2(
         const double *uniqueArrayData,
         std::vector<std::size_t>::iterator piIterator,
         std::vector<double>::iterator lambdaIterator) const {
 
-    SequentialClustering::cluster(
+    SequentialClustering::cluster<MT>(
             uniqueArrayData, this->dataElementsCount, this->dimension, piIterator, lambdaIterator);
 }
 }  // namespace cluster::test::main
@@ -1,7 +1,11 @@
 #ifndef FINAL_PROJECT_HPC_CLUSTERINGALGORITHMEXECUTOR_H
 #define FINAL_PROJECT_HPC_CLUSTERINGALGORITHMEXECUTOR_H
 
+#include "ClusteringCheckpoint.h"
+#include "Metrics.h"
 #include <cstddef>
+#include <cstdint>
+#include <filesystem>
 #include <vector>
 
 namespace cluster::test::main {
@@ -11,7 +15,7 @@ namespace cluster::test::main {
  *
  * @author DeB
  * @author Jonathan
- * @version 1.0 2022-08-16
+ * @version 1.15 2022-10-16
  * @since 1.0
  */
 class ClusteringAlgorithmExecutor {
@@ -28,12 +32,19 @@ public:
      * the dendrogram after a new point is added.
      * @param sqrtComputationThreadsCount Number of threads to use to compute the square roots of
      * the distances stored in <code>lambda</code>.
+     * @param metric Metric used to measure the distance between two data samples. Metrics other
+     * than the Euclidean one are used only by the versions that support them.
+     * @param checkpoint Checkpoint where the state of the clustering is periodically saved, or
+     * <code>nullptr</code> if no checkpoint is saved. It is used only by the versions that support
+     * it.
      */
     ClusteringAlgorithmExecutor(std::size_t dataElementsCount,
                                 std::size_t dimension,
                                 std::size_t distanceComputationThreadsCount,
                                 std::size_t structuralFixThreadsCount,
-                                std::size_t sqrtComputationThreadsCount);
+                                std::size_t sqrtComputationThreadsCount,
+                                Metrics metric,
+                                parallel::ClusteringCheckpoint *checkpoint);
 
     /**
      * Executes the requested version of the clustering algorithm
@@ -47,8 +58,14 @@ public:
      * @param avxAlignedIndirectData Data samples to cluster, stored as indirect pointers and
      * aligned for AVX.
      * @param sseAlignedData Data samples to cluster, aligned for SSE.
-     * @param avxAlignedData Data samples to cluster, aligned for AVX.
+     * @param avxAlignedData Data samples to cluster, aligned for AVX. If the version 23 is
+     * requested, the data samples are stored in blocks whose attributes are interleaved. If the
+     * version 24 is requested, this is the condensed matrix of the distances between the data
+     * samples.
      * @param uniqueArrayData ata samples to cluster, stored as a unique array.
+     * @param avxAlignedFloatData Data samples to cluster, converted to <code>float</code> and
+     * aligned for AVX. If the version 25 is requested, the data samples are neither aligned nor
+     * padded.
      * @param piIterator Iterator over the data structure holding <code>pi</code>.
      * @param lambdaIterator Iterator over the data structure holding <code>lambda</code>.
      */
@@ -60,17 +77,105 @@ public:
                                     const double *sseAlignedData,
                                     const double *avxAlignedData,
                                     const double *uniqueArrayData,
+                                    const float *avxAlignedFloatData,
                                     std::vector<std::size_t>::iterator piIterator,
                                     std::vector<double>::iterator lambdaIterator);
 
+    /**
+     * Executes the requested version of the parallel clustering algorithm, reading the data
+     * samples from a file through an <code>utils::OutOfCoreDataset</code>, which streams the ones
+     * that do not fit in the resident prefix.<br>
+     * Only the versions 11 and 20 are supported, since their execution modes release the data
+     * samples swept by every iteration. The data samples <b>MUST BE</b> stored with the layout
+     * required by the requested version, and the Euclidean metric is always used.
+     *
+     * @param version Version of the algorithm to execute.
+     * @param filePath Path of the file holding the data samples.
+     * @param dataOffset Offset, in bytes, of the first data sample from the beginning of the file.
+     * @param stride Number of attributes between the first attribute of a data sample and the
+     * first attribute of the following one.
+     * @param residentSetSize Size, in bytes, of the prefix of the data samples that is never
+     * released.
+     * @param piIterator Iterator over the data structure holding <code>pi</code>.
+     * @param lambdaIterator Iterator over the data structure holding <code>lambda</code>.
+     * @throws std::invalid_argument If the requested version is not supported, or if the
+     * out-of-core datasets are not supported by the platform.
+     */
+    void executeOutOfCoreClusteringAlgorithm(std::size_t version,
+                                             const std::filesystem::path &filePath,
+                                             std::size_t dataOffset,
+                                             std::size_t stride,
+                                             std::size_t residentSetSize,
+                                             std::vector<std::size_t>::iterator piIterator,
+                                             std::vector<double>::iterator lambdaIterator) const;
+
+    /**
+     * Executes the requested version of the parallel clustering algorithm, storing
+     * <code>pi</code> as 32-bit unsigned integers instead of <code>std::size_t</code>.<br>
+     * Only the versions 11, 12, 16 and 20 are supported, i.e., one version for every execution
+     * mode, and the Euclidean metric is always used.
+     *
+     * @param version Version of the algorithm to execute.
+     * @param avxAlignedData Data samples to cluster, aligned for AVX.
+     * @param piIterator Iterator over the data structure holding <code>pi</code>.
+     * @param lambdaIterator Iterator over the data structure holding <code>lambda</code>.
+     * @throws std::invalid_argument If the requested version is not supported, or if the indices
+     * of the data samples do not fit in 32 bits.
+     */
+    void executeCompactPiClusteringAlgorithm(std::size_t version,
+                                             const double *avxAlignedData,
+                                             std::vector<std::uint32_t>::iterator piIterator,
+                                             std::vector<double>::iterator lambdaIterator) const;
+
 private:
+    /**
+     * Executes the requested version of the clustering algorithm, using the specified metric.
+     *
+     * @tparam MT Policy describing the metric used to measure the distance between two data
+     * samples.
+     * @param isParallel <code>true</code> if the parallel implementation of the clustering
+     * algorithm should be executed, <code>false</code> otherwise.
+     * @param version Version of the algorithm to execute.
+     * @param indirectData Data samples to cluster, stored as indirect pointers.
+     * @param sseAlignedIndirectData Data samples to cluster, stored as indirect pointers and
+     * aligned for SSE.
+     * @param avxAlignedIndirectData Data samples to cluster, stored as indirect pointers and
+     * aligned for AVX.
+     * @param sseAlignedData Data samples to cluster, aligned for SSE.
+     * @param avxAlignedData Data samples to cluster, aligned for AVX. If the version 23 is
+     * requested, the data samples are stored in blocks whose attributes are interleaved. If the
+     * version 24 is requested, this is the condensed matrix of the distances between the data
+     * samples.
+     * @param uniqueArrayData ata samples to cluster, stored as a unique array.
+     * @param avxAlignedFloatData Data samples to cluster, converted to <code>float</code> and
+     * aligned for AVX. If the version 25 is requested, the data samples are neither aligned nor
+     * padded.
+     * @param piIterator Iterator over the data structure holding <code>pi</code>.
+     * @param lambdaIterator Iterator over the data structure holding <code>lambda</code>.
+     */
+    template <typename MT>
+    void executeVersion(bool isParallel,
+                        std::size_t version,
+                        const std::vector<double *> &indirectData,
+                        const std::vector<double *> &sseAlignedIndirectData,
+                        const std::vector<double *> &avxAlignedIndirectData,
+                        const double *sseAlignedData,
+                        const double *avxAlignedData,
+                        const double *uniqueArrayData,
+                        const float *avxAlignedFloatData,
+                        std::vector<std::size_t>::iterator piIterator,
+                        std::vector<double>::iterator lambdaIterator);
+
     /**
      * Executes the first version of the parallel clustering algorithm.
      *
+     * @tparam MT Policy describing the metric used to measure the distance between two data
+     * samples.
      * @param data Data to cluster.
      * @param piIterator Iterator over the data structure holding <code>pi</code>.
      * @param lambdaIterator Iterator over the data structure holding <code>lambda</code>.
      */
+    template <typename MT>
     void executeParallelV1(const std::vector<double *> &data,
                            std::vector<std::size_t>::iterator piIterator,
                            std::vector<double>::iterator lambdaIterator) const;
@@ -78,10 +183,13 @@ private:
     /**
      * Executes the second version of the parallel clustering algorithm.
      *
+     * @tparam MT Policy describing the metric used to measure the distance between two data
+     * samples.
      * @param sseAlignedIndirectData Data to cluster.
      * @param piIterator Iterator over the data structure holding <code>pi</code>.
      * @param lambdaIterator Iterator over the data structure holding <code>lambda</code>.
      */
+    template <typename MT>
     void executeParallelV2(const std::vector<double *> &sseAlignedIndirectData,
                            std::vector<std::size_t>::iterator piIterator,
                            std::vector<double>::iterator lambdaIterator) const;
@@ -89,10 +197,13 @@ private:
     /**
      * Executes the third version of the parallel clustering algorithm.
      *
+     * @tparam MT Policy describing the metric used to measure the distance between two data
+     * samples.
      * @param avxAlignedIndirectData Data to cluster.
      * @param piIterator Iterator over the data structure holding <code>pi</code>.
      * @param lambdaIterator Iterator over the data structure holding <code>lambda</code>.
      */
+    template <typename MT>
     void executeParallelV3(const std::vector<double *> &avxAlignedIndirectData,
                            std::vector<std::size_t>::iterator piIterator,
                            std::vector<double>::iterator lambdaIterator) const;
@@ -100,10 +211,13 @@ private:
     /**
      * Executes the fourth version of the parallel clustering algorithm.
      *
+     * @tparam MT Policy describing the metric used to measure the distance between two data
+     * samples.
      * @param avxAlignedData Data to cluster.
      * @param piIterator Iterator over the data structure holding <code>pi</code>.
      * @param lambdaIterator Iterator over the data structure holding <code>lambda</code>.
      */
+    template <typename MT>
     void executeParallelV4(const double *avxAlignedData,
                            std::vector<std::size_t>::iterator piIterator,
                            std::vector<double>::iterator lambdaIterator) const;
@@ -111,10 +225,13 @@ private:
     /**
      * Executes the fifth version of the parallel clustering algorithm.
      *
+     * @tparam MT Policy describing the metric used to measure the distance between two data
+     * samples.
      * @param sseAlignedIndirectData Data to cluster.
      * @param piIterator Iterator over the data structure holding <code>pi</code>.
      * @param lambdaIterator Iterator over the data structure holding <code>lambda</code>.
      */
+    template <typename MT>
     void executeParallelV5(const std::vector<double *> &sseAlignedIndirectData,
                            std::vector<std::size_t>::iterator piIterator,
                            std::vector<double>::iterator lambdaIterator) const;
@@ -122,10 +239,13 @@ private:
     /**
      * Executes the sixth version of the parallel clustering algorithm.
      *
+     * @tparam MT Policy describing the metric used to measure the distance between two data
+     * samples.
      * @param sseAlignedIndirectData Data to cluster.
      * @param piIterator Iterator over the data structure holding <code>pi</code>.
      * @param lambdaIterator Iterator over the data structure holding <code>lambda</code>.
      */
+    template <typename MT>
     void executeParallelV6(const std::vector<double *> &sseAlignedIndirectData,
                            std::vector<std::size_t>::iterator piIterator,
                            std::vector<double>::iterator lambdaIterator) const;
@@ -133,10 +253,13 @@ private:
     /**
      * Executes the seventh version of the parallel clustering algorithm.
      *
+     * @tparam MT Policy describing the metric used to measure the distance between two data
+     * samples.
      * @param avxAlignedIndirectData Data to cluster.
      * @param piIterator Iterator over the data structure holding <code>pi</code>.
      * @param lambdaIterator Iterator over the data structure holding <code>lambda</code>.
      */
+    template <typename MT>
     void executeParallelV7(const std::vector<double *> &avxAlignedIndirectData,
                            std::vector<std::size_t>::iterator piIterator,
                            std::vector<double>::iterator lambdaIterator) const;
@@ -144,10 +267,13 @@ private:
     /**
      * Executes the eighth version of the parallel clustering algorithm.
      *
+     * @tparam MT Policy describing the metric used to measure the distance between two data
+     * samples.
      * @param sseAlignedData Data to cluster.
      * @param piIterator Iterator over the data structure holding <code>pi</code>.
      * @param lambdaIterator Iterator over the data structure holding <code>lambda</code>.
      */
+    template <typename MT>
     void executeParallelV8(const double *sseAlignedData,
                            std::vector<std::size_t>::iterator piIterator,
                            std::vector<double>::iterator lambdaIterator) const;
@@ -155,10 +281,13 @@ private:
     /**
      * Executes the ninth version of the parallel clustering algorithm.
      *
+     * @tparam MT Policy describing the metric used to measure the distance between two data
+     * samples.
      * @param avxAlignedData Data to cluster.
      * @param piIterator Iterator over the data structure holding <code>pi</code>.
      * @param lambdaIterator Iterator over the data structure holding <code>lambda</code>.
      */
+    template <typename MT>
     void executeParallelV9(const double *avxAlignedData,
                            std::vector<std::size_t>::iterator piIterator,
                            std::vector<double>::iterator lambdaIterator) const;
@@ -166,10 +295,13 @@ private:
     /**
      * Executes the tenth version of the parallel clustering algorithm.
      *
+     * @tparam MT Policy describing the metric used to measure the distance between two data
+     * samples.
      * @param avxAlignedData Data to cluster.
      * @param piIterator Iterator over the data structure holding <code>pi</code>.
      * @param lambdaIterator Iterator over the data structure holding <code>lambda</code>.
      */
+    template <typename MT>
     void executeParallelV10(const double *avxAlignedData,
                             std::vector<std::size_t>::iterator piIterator,
                             std::vector<double>::iterator lambdaIterator) const;
@@ -177,21 +309,186 @@ private:
     /**
      * Executes the eleventh version of the parallel clustering algorithm.
      *
+     * @tparam MT Policy describing the metric used to measure the distance between two data
+     * samples.
      * @param avxAlignedData Data to cluster.
      * @param piIterator Iterator over the data structure holding <code>pi</code>.
      * @param lambdaIterator Iterator over the data structure holding <code>lambda</code>.
      */
+    template <typename MT>
     void executeParallelV11(const double *avxAlignedData,
                             std::vector<std::size_t>::iterator piIterator,
                             std::vector<double>::iterator lambdaIterator) const;
 
+    /**
+     * Executes the twelfth version of the parallel clustering algorithm.
+     *
+     * @param avxAlignedData Data to cluster.
+     * @param piIterator Iterator over the data structure holding <code>pi</code>.
+     * @param lambdaIterator Iterator over the data structure holding <code>lambda</code>.
+     */
+    void executeParallelV12(const double *avxAlignedData,
+                            std::vector<std::size_t>::iterator piIterator,
+                            std::vector<double>::iterator lambdaIterator) const;
+
+    /**
+     * Executes the thirteenth version of the parallel clustering algorithm.
+     *
+     * @param uniqueArrayData Data to cluster.
+     * @param piIterator Iterator over the data structure holding <code>pi</code>.
+     * @param lambdaIterator Iterator over the data structure holding <code>lambda</code>.
+     */
+    void executeParallelV13(const double *uniqueArrayData,
+                            std::vector<std::size_t>::iterator piIterator,
+                            std::vector<double>::iterator lambdaIterator) const;
+
+    /**
+     * Executes the fourteenth version of the parallel clustering algorithm.
+     *
+     * @param uniqueArrayData Data to cluster.
+     * @param piIterator Iterator over the data structure holding <code>pi</code>.
+     * @param lambdaIterator Iterator over the data structure holding <code>lambda</code>.
+     */
+    void executeParallelV14(const double *uniqueArrayData,
+                            std::vector<std::size_t>::iterator piIterator,
+                            std::vector<double>::iterator lambdaIterator) const;
+
+    /**
+     * Executes the fifteenth version of the parallel clustering algorithm.
+     *
+     * @param avxAlignedFloatData Data to cluster.
+     * @param piIterator Iterator over the data structure holding <code>pi</code>.
+     * @param lambdaIterator Iterator over the data structure holding <code>lambda</code>.
+     */
+    void executeParallelV15(const float *avxAlignedFloatData,
+                            std::vector<std::size_t>::iterator piIterator,
+                            std::vector<double>::iterator lambdaIterator) const;
+
+    /**
+     * Executes the sixteenth version of the parallel clustering algorithm.
+     *
+     * @param avxAlignedData Data to cluster.
+     * @param piIterator Iterator over the data structure holding <code>pi</code>.
+     * @param lambdaIterator Iterator over the data structure holding <code>lambda</code>.
+     */
+    void executeParallelV16(const double *avxAlignedData,
+                            std::vector<std::size_t>::iterator piIterator,
+                            std::vector<double>::iterator lambdaIterator) const;
+
+    /**
+     * Executes the seventeenth version of the parallel clustering algorithm.
+     *
+     * @param avxAlignedData Data to cluster.
+     * @param piIterator Iterator over the data structure holding <code>pi</code>.
+     * @param lambdaIterator Iterator over the data structure holding <code>lambda</code>.
+     */
+    void executeParallelV17(const double *avxAlignedData,
+                            std::vector<std::size_t>::iterator piIterator,
+                            std::vector<double>::iterator lambdaIterator) const;
+
+    /**
+     * Executes the eighteenth version of the parallel clustering algorithm.
+     *
+     * @param uniqueArrayData Data to cluster.
+     * @param piIterator Iterator over the data structure holding <code>pi</code>.
+     * @param lambdaIterator Iterator over the data structure holding <code>lambda</code>.
+     */
+    void executeParallelV18(const double *uniqueArrayData,
+                            std::vector<std::size_t>::iterator piIterator,
+                            std::vector<double>::iterator lambdaIterator) const;
+
+    /**
+     * Executes the nineteenth version of the parallel clustering algorithm.
+     *
+     * @param uniqueArrayData Data to cluster.
+     * @param piIterator Iterator over the data structure holding <code>pi</code>.
+     * @param lambdaIterator Iterator over the data structure holding <code>lambda</code>.
+     */
+    void executeParallelV19(const double *uniqueArrayData,
+                            std::vector<std::size_t>::iterator piIterator,
+                            std::vector<double>::iterator lambdaIterator) const;
+
+    /**
+     * Executes the twentieth version of the parallel clustering algorithm.
+     *
+     * @param avxAlignedData Data to cluster.
+     * @param piIterator Iterator over the data structure holding <code>pi</code>.
+     * @param lambdaIterator Iterator over the data structure holding <code>lambda</code>.
+     */
+    void executeParallelV20(const double *avxAlignedData,
+                            std::vector<std::size_t>::iterator piIterator,
+                            std::vector<double>::iterator lambdaIterator) const;
+
+    /**
+     * Executes the twenty-first version of the parallel clustering algorithm.
+     *
+     * @param avxAlignedData Data to cluster.
+     * @param piIterator Iterator over the data structure holding <code>pi</code>.
+     * @param lambdaIterator Iterator over the data structure holding <code>lambda</code>.
+     */
+    void executeParallelV21(const double *avxAlignedData,
+                            std::vector<std::size_t>::iterator piIterator,
+                            std::vector<double>::iterator lambdaIterator) const;
+
+    /**
+     * Executes the twenty-second version of the parallel clustering algorithm.
+     *
+     * @tparam MT Policy describing the metric used to measure the distance between two data
+     * samples.
+     * @param avxAlignedData Data to cluster.
+     * @param piIterator Iterator over the data structure holding <code>pi</code>.
+     * @param lambdaIterator Iterator over the data structure holding <code>lambda</code>.
+     */
+    template <typename MT>
+    void executeParallelV22(const double *avxAlignedData,
+                            std::vector<std::size_t>::iterator piIterator,
+                            std::vector<double>::iterator lambdaIterator) const;
+
+    /**
+     * Executes the twenty-third version of the parallel clustering algorithm.
+     *
+     * @param avxInterleavedData Data to cluster, stored in blocks whose attributes are
+     * interleaved.
+     * @param piIterator Iterator over the data structure holding <code>pi</code>.
+     * @param lambdaIterator Iterator over the data structure holding <code>lambda</code>.
+     */
+    void executeParallelV23(const double *avxInterleavedData,
+                            std::vector<std::size_t>::iterator piIterator,
+                            std::vector<double>::iterator lambdaIterator) const;
+
+    /**
+     * Executes the twenty-fourth version of the parallel clustering algorithm.
+     *
+     * @param distanceMatrix Condensed matrix of the distances between the data samples to
+     * cluster.
+     * @param piIterator Iterator over the data structure holding <code>pi</code>.
+     * @param lambdaIterator Iterator over the data structure holding <code>lambda</code>.
+     */
+    void executeParallelV24(const double *distanceMatrix,
+                            std::vector<std::size_t>::iterator piIterator,
+                            std::vector<double>::iterator lambdaIterator) const;
+
+    /**
+     * Executes the twenty-fifth version of the parallel clustering algorithm.
+     *
+     * @param uniqueArrayFloatData Data to cluster.
+     * @param piIterator Iterator over the data structure holding <code>pi</code>.
+     * @param lambdaIterator Iterator over the data structure holding <code>lambda</code>.
+     */
+    void executeParallelV25(const float *uniqueArrayFloatData,
+                            std::vector<std::size_t>::iterator piIterator,
+                            std::vector<double>::iterator lambdaIterator) const;
+
     /**
      * Executes the first version of the sequential clustering algorithm.
      *
+     * @tparam MT Policy describing the metric used to measure the distance between two data
+     * samples.
      * @param data Data to cluster.
      * @param piIterator Iterator over the data structure holding <code>pi</code>.
      * @param lambdaIterator Iterator over the data structure holding <code>lambda</code>.
      */
+    template <typename MT>
     void executeSequentialV1(const std::vector<double *> &data,
                              std::vector<std::size_t>::iterator piIterator,
                              std::vector<double>::iterator lambdaIterator) const;
@@ -199,10 +496,13 @@ private:
     /**
      * Executes the second version of the sequential clustering algorithm.
      *
+     * @tparam MT Policy describing the metric used to measure the distance between two data
+     * samples.
      * @param uniqueArrayData Data to cluster.
      * @param piIterator Iterator over the data structure holding <code>pi</code>.
      * @param lambdaIterator Iterator over the data structure holding <code>lambda</code>.
      */
+    template <typename MT>
     void executeSequentialV2(const double *uniqueArrayData,
                              std::vector<std::size_t>::iterator piIterator,
                              std::vector<double>::iterator lambdaIterator) const;
@@ -233,6 +533,17 @@ private:
      * <code>lambda</code>.
      */
     const std::size_t sqrtComputationThreadsCount;
+
+    /**
+     * Metric used to measure the distance between two data samples.
+     */
+    const Metrics metric;
+
+    /**
+     * Checkpoint where the state of the clustering is periodically saved, or <code>nullptr</code>
+     * if no checkpoint is saved.
+     */
+    parallel::ClusteringCheckpoint *const checkpoint;
 };
 
 }  // namespace cluster::test::main
@@ -0,0 +1,43 @@
+#ifndef FINAL_PROJECT_HPC_METRICS_H
+#define FINAL_PROJECT_HPC_METRICS_H
+
+namespace cluster::test {
+/**
+ * Enumeration of the metrics that can be requested via command line to measure the distance
+ * between two data samples. Each value corresponds to one of the metric policies of the library.
+ *
+ * @author DeB
+ * @author Jonathan
+ * @version 1.0 2022-10-16
+ * @since 1.0
+ */
+enum class Metrics {
+
+    /**
+     * Euclidean metric, i.e., <code>utils::EuclideanMetric</code>.
+     */
+    EUCLIDEAN,
+
+    /**
+     * Manhattan metric, i.e., <code>utils::ManhattanMetric</code>.
+     */
+    MANHATTAN,
+
+    /**
+     * Chebyshev metric, i.e., <code>utils::ChebyshevMetric</code>.
+     */
+    CHEBYSHEV,
+
+    /**
+     * Cosine distance, i.e., <code>utils::CosineMetric</code>.
+     */
+    COSINE,
+
+    /**
+     * Minkowski metric of order 3, i.e., <code>utils::MinkowskiMetric<3></code>.
+     */
+    MINKOWSKI
+};
+}  // namespace cluster::test
+
+#endif  // FINAL_PROJECT_HPC_METRICS_H
@@ -3,13 +3,18 @@
  *
  * @author DeB
  * @author Jonathan
- * @version 1.3 2022-08-22
+ * @version 1.15 2022-10-16
  * @since 1.0
  */
 #include "CliArguments.h"
 
 namespace cluster::test::cli {
 
+/**
+ * Destroys the values specified via command line.
+ */
+CliArguments::~CliArguments() = default;
+
 /**
  * Returns the number of the first column of each line of the input file to be considered containing
  * the coordinates of the point.
@@ -270,6 +275,429 @@ void CliArguments::setMathematicaOutputFilePath(
     CliArguments::mathematicaOutputFilePath = mathematicaOutputFilePath;
 }
 
+/**
+ * Returns whether the user has requested to store the data samples in a binary dataset file.
+ *
+ * @return Whether the user has requested to store the data samples in a binary dataset file.
+ */
+bool CliArguments::isBinaryOutputEnabled() const {
+
+    return this->binaryOutputEnabled;
+}
+
+/**
+ * Sets whether the user has requested to store the data samples in a binary dataset file.
+ *
+ * @param binaryOutputEnabled Whether the user has requested to store the data samples in a binary
+ * dataset file.
+ */
+void CliArguments::setBinaryOutputEnabled(const bool binaryOutputEnabled) {
+
+    CliArguments::binaryOutputEnabled = binaryOutputEnabled;
+}
+
+/**
+ * Returns the path of the binary dataset file where the data samples will be stored.
+ *
+ * @return The path of the binary dataset file where the data samples will be stored.
+ */
+const std::filesystem::path& CliArguments::getBinaryOutputFilePath() const {
+
+    return this->binaryOutputFilePath;
+}
+
+/**
+ * Sets the path of the binary dataset file where the data samples will be stored.
+ *
+ * @param binaryOutputFilePath Path of the binary dataset file where the data samples will be
+ * stored.
+ */
+void CliArguments::setBinaryOutputFilePath(const std::filesystem::path& binaryOutputFilePath) {
+
+    CliArguments::binaryOutputFilePath = binaryOutputFilePath;
+}
+
+/**
+ * Returns whether the user has requested to store the computed values of pi and lambda in a file.
+ *
+ * @return Whether the user has requested to store the computed values of pi and lambda in a file.
+ */
+bool CliArguments::isResultsOutputEnabled() const {
+
+    return this->resultsOutputEnabled;
+}
+
+/**
+ * Sets whether the user has requested to store the computed values of pi and lambda in a file.
+ *
+ * @param resultsOutputEnabled Whether the user has requested to store the computed values of pi
+ * and lambda in a file.
+ */
+void CliArguments::setResultsOutputEnabled(const bool resultsOutputEnabled) {
+
+    CliArguments::resultsOutputEnabled = resultsOutputEnabled;
+}
+
+/**
+ * Returns the path of the file where the computed values of pi and lambda will be stored.
+ *
+ * @return The path of the file where the computed values of pi and lambda will be stored.
+ */
+const std::filesystem::path& CliArguments::getResultsOutputFilePath() const {
+
+    return this->resultsOutputFilePath;
+}
+
+/**
+ * Sets the path of the file where the computed values of pi and lambda will be stored.
+ *
+ * @param resultsOutputFilePath Path of the file where the computed values of pi and lambda will be
+ * stored.
+ */
+void CliArguments::setResultsOutputFilePath(const std::filesystem::path& resultsOutputFilePath) {
+
+    CliArguments::resultsOutputFilePath = resultsOutputFilePath;
+}
+
+/**
+ * Returns whether the user has requested to store the linkage matrix of the dendrogram in a file.
+ *
+ * @return Whether the user has requested to store the linkage matrix of the dendrogram in a file.
+ */
+bool CliArguments::isLinkageOutputEnabled() const {
+
+    return this->linkageOutputEnabled;
+}
+
+/**
+ * Sets whether the user has requested to store the linkage matrix of the dendrogram in a file.
+ *
+ * @param linkageOutputEnabled Whether the user has requested to store the linkage matrix of the
+ * dendrogram in a file.
+ */
+void CliArguments::setLinkageOutputEnabled(const bool linkageOutputEnabled) {
+
+    CliArguments::linkageOutputEnabled = linkageOutputEnabled;
+}
+
+/**
+ * Returns the path of the file where the linkage matrix of the dendrogram will be stored.
+ *
+ * @return The path of the file where the linkage matrix of the dendrogram will be stored.
+ */
+const std::filesystem::path& CliArguments::getLinkageOutputFilePath() const {
+
+    return this->linkageOutputFilePath;
+}
+
+/**
+ * Sets the path of the file where the linkage matrix of the dendrogram will be stored.
+ *
+ * @param linkageOutputFilePath Path of the file where the linkage matrix of the dendrogram will be
+ * stored.
+ */
+void CliArguments::setLinkageOutputFilePath(const std::filesystem::path& linkageOutputFilePath) {
+
+    CliArguments::linkageOutputFilePath = linkageOutputFilePath;
+}
+
+/**
+ * Returns whether the user has requested to periodically save the state of the clustering in a
+ * checkpoint file.
+ *
+ * @return Whether the user has requested to periodically save the state of the clustering in a
+ * checkpoint file.
+ */
+bool CliArguments::isCheckpointEnabled() const {
+
+    return this->checkpointEnabled;
+}
+
+/**
+ * Sets whether the user has requested to periodically save the state of the clustering in a
+ * checkpoint file.
+ *
+ * @param checkpointEnabled Whether the user has requested to periodically save the state of the
+ * clustering in a checkpoint file.
+ */
+void CliArguments::setCheckpointEnabled(const bool checkpointEnabled) {
+
+    CliArguments::checkpointEnabled = checkpointEnabled;
+}
+
+/**
+ * Returns the path of the checkpoint file where the state of the clustering will be saved.
+ *
+ * @return The path of the checkpoint file.
+ */
+const std::filesystem::path& CliArguments::getCheckpointFilePath() const {
+
+    return this->checkpointFilePath;
+}
+
+/**
+ * Sets the path of the checkpoint file where the state of the clustering will be saved.
+ *
+ * @param checkpointFilePath Path of the checkpoint file.
+ */
+void CliArguments::setCheckpointFilePath(const std::filesystem::path& checkpointFilePath) {
+
+    CliArguments::checkpointFilePath = checkpointFilePath;
+}
+
+/**
+ * Returns the number of data samples after which the clustering is stopped.
+ *
+ * @return The number of data samples after which the clustering is stopped, or <code>0</code> if
+ * it is never stopped.
+ */
+std::size_t CliArguments::getCheckpointSamplesLimit() const {
+
+    return this->checkpointSamplesLimit;
+}
+
+/**
+ * Sets the number of data samples after which the clustering is stopped.
+ *
+ * @param checkpointSamplesLimit Number of data samples after which the clustering is stopped, or
+ * <code>0</code> if it is never stopped.
+ */
+void CliArguments::setCheckpointSamplesLimit(const std::size_t checkpointSamplesLimit) {
+
+    CliArguments::checkpointSamplesLimit = checkpointSamplesLimit;
+}
+
+/**
+ * Returns the metric used to measure the distance between two data samples.
+ *
+ * @return The metric used to measure the distance between two data samples.
+ */
+Metrics CliArguments::getMetric() const {
+
+    return this->metric;
+}
+
+/**
+ * Sets the metric used to measure the distance between two data samples.
+ *
+ * @param metric Metric used to measure the distance between two data samples.
+ */
+void CliArguments::setMetric(const Metrics metric) {
+
+    CliArguments::metric = metric;
+}
+
+/**
+ * Returns whether the user has requested to read the condensed distance matrix from a file.
+ *
+ * @return Whether the user has requested to read the condensed distance matrix from a file.
+ */
+bool CliArguments::isDistanceMatrixInputEnabled() const {
+
+    return this->distanceMatrixInputEnabled;
+}
+
+/**
+ * Sets whether the user has requested to read the condensed distance matrix from a file.
+ *
+ * @param distanceMatrixInputEnabled Whether the user has requested to read the condensed distance
+ * matrix from a file.
+ */
+void CliArguments::setDistanceMatrixInputEnabled(const bool distanceMatrixInputEnabled) {
+
+    CliArguments::distanceMatrixInputEnabled = distanceMatrixInputEnabled;
+}
+
+/**
+ * Returns the path of the file containing the condensed distance matrix.
+ *
+ * @return The path of the file containing the condensed distance matrix.
+ */
+const std::filesystem::path& CliArguments::getDistanceMatrixInputFilePath() const {
+
+    return this->distanceMatrixInputFilePath;
+}
+
+/**
+ * Sets the path of the file containing the condensed distance matrix.
+ *
+ * @param distanceMatrixInputFilePath Path of the file containing the condensed distance matrix.
+ */
+void CliArguments::setDistanceMatrixInputFilePath(
+        const std::filesystem::path& distanceMatrixInputFilePath) {
+
+    CliArguments::distanceMatrixInputFilePath = distanceMatrixInputFilePath;
+}
+
+/**
+ * Returns whether the user has requested to store the condensed distance matrix in a file.
+ *
+ * @return Whether the user has requested to store the condensed distance matrix in a file.
+ */
+bool CliArguments::isDistanceMatrixOutputEnabled() const {
+
+    return this->distanceMatrixOutputEnabled;
+}
+
+/**
+ * Sets whether the user has requested to store the condensed distance matrix in a file.
+ *
+ * @param distanceMatrixOutputEnabled Whether the user has requested to store the condensed
+ * distance matrix in a file.
+ */
+void CliArguments::setDistanceMatrixOutputEnabled(const bool distanceMatrixOutputEnabled) {
+
+    CliArguments::distanceMatrixOutputEnabled = distanceMatrixOutputEnabled;
+}
+
+/**
+ * Returns the path of the file where the condensed distance matrix will be stored.
+ *
+ * @return The path of the file where the condensed distance matrix will be stored.
+ */
+const std::filesystem::path& CliArguments::getDistanceMatrixOutputFilePath() const {
+
+    return this->distanceMatrixOutputFilePath;
+}
+
+/**
+ * Sets the path of the file where the condensed distance matrix will be stored.
+ *
+ * @param distanceMatrixOutputFilePath Path of the file where the condensed distance matrix will be
+ * stored.
+ */
+void CliArguments::setDistanceMatrixOutputFilePath(
+        const std::filesystem::path& distanceMatrixOutputFilePath) {
+
+    CliArguments::distanceMatrixOutputFilePath = distanceMatrixOutputFilePath;
+}
+
+/**
+ * Returns the number of cuts of the dendrogram to check in test mode.
+ *
+ * @return The number of cuts of the dendrogram to check, or <code>0</code> if the cuts are not
+ * checked.
+ */
+std::size_t CliArguments::getTestCutsCount() const {
+
+    return this->testCutsCount;
+}
+
+/**
+ * Sets the number of cuts of the dendrogram to check in test mode.
+ *
+ * @param testCutsCount Number of cuts of the dendrogram to check, or <code>0</code> if the cuts are
+ * not checked.
+ */
+void CliArguments::setTestCutsCount(const std::size_t testCutsCount) {
+
+    CliArguments::testCutsCount = testCutsCount;
+}
+
+/**
+ * Returns whether the user has requested to check the cophenetic distances in test mode.
+ *
+ * @return Whether the user has requested to check the cophenetic distances.
+ */
+bool CliArguments::isTestCopheneticEnabled() const {
+
+    return this->testCopheneticEnabled;
+}
+
+/**
+ * Sets whether the user has requested to check the cophenetic distances in test mode.
+ *
+ * @param testCopheneticEnabled Whether the user has requested to check the cophenetic distances.
+ */
+void CliArguments::setTestCopheneticEnabled(const bool testCopheneticEnabled) {
+
+    CliArguments::testCopheneticEnabled = testCopheneticEnabled;
+}
+
+/**
+ * Returns whether the user has requested to check the incremental clustering in test mode.
+ *
+ * @return Whether the user has requested to check the incremental clustering.
+ */
+bool CliArguments::isTestIncrementalEnabled() const {
+
+    return this->testIncrementalEnabled;
+}
+
+/**
+ * Sets whether the user has requested to check the incremental clustering in test mode.
+ *
+ * @param testIncrementalEnabled Whether the user has requested to check the incremental
+ * clustering.
+ */
+void CliArguments::setTestIncrementalEnabled(const bool testIncrementalEnabled) {
+
+    CliArguments::testIncrementalEnabled = testIncrementalEnabled;
+}
+
+/**
+ * Returns whether the user has requested to read the data samples out of core.
+ *
+ * @return Whether the user has requested to read the data samples out of core.
+ */
+bool CliArguments::isOutOfCoreEnabled() const {
+
+    return this->outOfCoreEnabled;
+}
+
+/**
+ * Sets whether the user has requested to read the data samples out of core.
+ *
+ * @param outOfCoreEnabled Whether the user has requested to read the data samples out of core.
+ */
+void CliArguments::setOutOfCoreEnabled(const bool outOfCoreEnabled) {
+
+    CliArguments::outOfCoreEnabled = outOfCoreEnabled;
+}
+
+/**
+ * Returns the size, in bytes, of the prefix of the data samples that is never released when they
+ * are read out of core.
+ *
+ * @return The size of the prefix of the data samples that is never released.
+ */
+std::size_t CliArguments::getOutOfCoreResidentSetSize() const {
+
+    return this->outOfCoreResidentSetSize;
+}
+
+/**
+ * Sets the size, in bytes, of the prefix of the data samples that is never released when they are
+ * read out of core.
+ *
+ * @param outOfCoreResidentSetSize Size of the prefix of the data samples that is never released.
+ */
+void CliArguments::setOutOfCoreResidentSetSize(const std::size_t outOfCoreResidentSetSize) {
+
+    CliArguments::outOfCoreResidentSetSize = outOfCoreResidentSetSize;
+}
+
+/**
+ * Returns whether the user has requested to store <code>pi</code> as 32-bit unsigned integers.
+ *
+ * @return Whether the user has requested to store <code>pi</code> as 32-bit unsigned integers.
+ */
+bool CliArguments::isCompactPiEnabled() const {
+
+    return this->compactPiEnabled;
+}
+
+/**
+ * Sets whether the user has requested to store <code>pi</code> as 32-bit unsigned integers.
+ *
+ * @param compactPiEnabled Whether the user has requested to store <code>pi</code> as 32-bit
+ * unsigned integers.
+ */
+void CliArguments::setCompactPiEnabled(const bool compactPiEnabled) {
+
+    CliArguments::compactPiEnabled = compactPiEnabled;
+}
+
 /**
  * Returns whether the user has requested to execute a parallel implementation of the clustering
  * algorithm.
@@ -1,6 +1,7 @@
 #ifndef FINAL_PROJECT_HPC_CLIARGUMENTS_H
 #define FINAL_PROJECT_HPC_CLIARGUMENTS_H
 
+#include "../Metrics.h"
 #include <cstddef>
 #include <filesystem>
 
@@ -11,12 +12,23 @@ namespace cluster::test::cli {
  *
  * @author DeB
  * @author Jonathan
- * @version 1.3 2022-08-22
+ * @version 1.15 2022-10-16
  * @since 1.0
  */
 class CliArguments {
 
 public:
+    CliArguments() = default;
+    CliArguments(const CliArguments &) = default;
+    CliArguments(CliArguments &&) noexcept = default;
+    CliArguments &operator=(const CliArguments &) = default;
+    CliArguments &operator=(CliArguments &&) noexcept = default;
+
+    /**
+     * Destroys the values specified via command line.
+     */
+    ~CliArguments();
+
     /**
      * Returns the number of the first column of each line of the input file to be considered
      * containing the coordinates of the point.<br>
@@ -226,6 +238,341 @@ public:
      */
     void setMathematicaOutputFilePath(const std::filesystem::path& mathematicaOutputFilePath);
 
+    /**
+     * Returns <code>true</code> if the user has requested to store the data samples in a binary
+     * dataset file, <code>false</code> otherwise.
+     *
+     * @return <code>true</code> if the user has requested to store the data samples in a binary
+     * dataset file, <code>false</code> otherwise.
+     */
+    bool isBinaryOutputEnabled() const;
+
+    /**
+     * Sets whether the user has requested to store the data samples in a binary dataset file.
+     *
+     * @param binaryOutputEnabled <code>true</code> if the user has requested to store the data
+     * samples in a binary dataset file, <code>false</code> otherwise.
+     */
+    void setBinaryOutputEnabled(bool binaryOutputEnabled);
+
+    /**
+     * Returns the path of the binary dataset file where the data samples will be stored.
+     *
+     * @return The path of the binary dataset file where the data samples will be stored.
+     */
+    const std::filesystem::path& getBinaryOutputFilePath() const;
+
+    /**
+     * Sets the path of the binary dataset file where the data samples will be stored.
+     *
+     * @param binaryOutputFilePath Path of the binary dataset file where the data samples will be
+     * stored.
+     */
+    void setBinaryOutputFilePath(const std::filesystem::path& binaryOutputFilePath);
+
+    /**
+     * Returns <code>true</code> if the user has requested to store the computed values of
+     * <code>pi</code> and <code>lambda</code> in a file, <code>false</code> otherwise.
+     *
+     * @return <code>true</code> if the user has requested to store the computed values of
+     * <code>pi</code> and <code>lambda</code> in a file, <code>false</code> otherwise.
+     */
+    bool isResultsOutputEnabled() const;
+
+    /**
+     * Sets whether the user has requested to store the computed values of <code>pi</code> and
+     * <code>lambda</code> in a file.
+     *
+     * @param resultsOutputEnabled <code>true</code> if the user has requested to store the
+     * computed values of <code>pi</code> and <code>lambda</code> in a file, <code>false</code>
+     * otherwise.
+     */
+    void setResultsOutputEnabled(bool resultsOutputEnabled);
+
+    /**
+     * Returns the path of the file where the computed values of <code>pi</code> and
+     * <code>lambda</code> will be stored.
+     *
+     * @return The path of the file where the computed values of <code>pi</code> and
+     * <code>lambda</code> will be stored.
+     */
+    const std::filesystem::path& getResultsOutputFilePath() const;
+
+    /**
+     * Sets the path of the file where the computed values of <code>pi</code> and
+     * <code>lambda</code> will be stored.
+     *
+     * @param resultsOutputFilePath Path of the file where the computed values of <code>pi</code>
+     * and <code>lambda</code> will be stored.
+     */
+    void setResultsOutputFilePath(const std::filesystem::path& resultsOutputFilePath);
+
+    /**
+     * Returns <code>true</code> if the user has requested to store the linkage matrix of the
+     * dendrogram in a file, <code>false</code> otherwise.
+     *
+     * @return <code>true</code> if the user has requested to store the linkage matrix of the
+     * dendrogram in a file, <code>false</code> otherwise.
+     */
+    bool isLinkageOutputEnabled() const;
+
+    /**
+     * Sets whether the user has requested to store the linkage matrix of the dendrogram in a file.
+     *
+     * @param linkageOutputEnabled <code>true</code> if the user has requested to store the linkage
+     * matrix of the dendrogram in a file, <code>false</code> otherwise.
+     */
+    void setLinkageOutputEnabled(bool linkageOutputEnabled);
+
+    /**
+     * Returns the path of the file where the linkage matrix of the dendrogram will be stored.
+     *
+     * @return The path of the file where the linkage matrix of the dendrogram will be stored.
+     */
+    const std::filesystem::path& getLinkageOutputFilePath() const;
+
+    /**
+     * Sets the path of the file where the linkage matrix of the dendrogram will be stored.
+     *
+     * @param linkageOutputFilePath Path of the file where the linkage matrix of the dendrogram will
+     * be stored.
+     */
+    void setLinkageOutputFilePath(const std::filesystem::path& linkageOutputFilePath);
+
+    /**
+     * Returns <code>true</code> if the user has requested to periodically save the state of the
+     * clustering in a checkpoint file, <code>false</code> otherwise.
+     *
+     * @return <code>true</code> if the user has requested to periodically save the state of the
+     * clustering in a checkpoint file, <code>false</code> otherwise.
+     */
+    bool isCheckpointEnabled() const;
+
+    /**
+     * Sets whether the user has requested to periodically save the state of the clustering in a
+     * checkpoint file.
+     *
+     * @param checkpointEnabled <code>true</code> if the user has requested to periodically save the
+     * state of the clustering in a checkpoint file, <code>false</code> otherwise.
+     */
+    void setCheckpointEnabled(bool checkpointEnabled);
+
+    /**
+     * Returns the path of the checkpoint file where the state of the clustering will be saved, and
+     * from which it will be resumed if the file exists.
+     *
+     * @return The path of the checkpoint file.
+     */
+    const std::filesystem::path& getCheckpointFilePath() const;
+
+    /**
+     * Sets the path of the checkpoint file where the state of the clustering will be saved, and
+     * from which it will be resumed if the file exists.
+     *
+     * @param checkpointFilePath Path of the checkpoint file.
+     */
+    void setCheckpointFilePath(const std::filesystem::path& checkpointFilePath);
+
+    /**
+     * Returns the number of data samples after which the clustering is stopped, once the
+     * checkpoint has been saved.<br>
+     * <code>0</code> means that the clustering is never stopped.
+     *
+     * @return The number of data samples after which the clustering is stopped.
+     */
+    std::size_t getCheckpointSamplesLimit() const;
+
+    /**
+     * Sets the number of data samples after which the clustering is stopped, once the checkpoint
+     * has been saved.
+     *
+     * @param checkpointSamplesLimit Number of data samples after which the clustering is stopped,
+     * or <code>0</code> if it is never stopped.
+     */
+    void setCheckpointSamplesLimit(std::size_t checkpointSamplesLimit);
+
+    /**
+     * Returns the metric used to measure the distance between two data samples.
+     *
+     * @return The metric used to measure the distance between two data samples.
+     */
+    Metrics getMetric() const;
+
+    /**
+     * Sets the metric used to measure the distance between two data samples.
+     *
+     * @param metric Metric used to measure the distance between two data samples.
+     */
+    void setMetric(Metrics metric);
+
+    /**
+     * Returns <code>true</code> if the user has requested to read the condensed distance matrix
+     * from a file, <code>false</code> otherwise.
+     *
+     * @return <code>true</code> if the user has requested to read the condensed distance matrix
+     * from a file, <code>false</code> otherwise.
+     */
+    bool isDistanceMatrixInputEnabled() const;
+
+    /**
+     * Sets whether the user has requested to read the condensed distance matrix from a file.
+     *
+     * @param distanceMatrixInputEnabled <code>true</code> if the user has requested to read the
+     * condensed distance matrix from a file, <code>false</code> otherwise.
+     */
+    void setDistanceMatrixInputEnabled(bool distanceMatrixInputEnabled);
+
+    /**
+     * Returns the path of the file containing the condensed distance matrix.
+     *
+     * @return The path of the file containing the condensed distance matrix.
+     */
+    const std::filesystem::path& getDistanceMatrixInputFilePath() const;
+
+    /**
+     * Sets the path of the file containing the condensed distance matrix.
+     *
+     * @param distanceMatrixInputFilePath Path of the file containing the condensed distance
+     * matrix.
+     */
+    void setDistanceMatrixInputFilePath(const std::filesystem::path& distanceMatrixInputFilePath);
+
+    /**
+     * Returns <code>true</code> if the user has requested to store the condensed distance matrix
+     * in a file, <code>false</code> otherwise.
+     *
+     * @return <code>true</code> if the user has requested to store the condensed distance matrix
+     * in a file, <code>false</code> otherwise.
+     */
+    bool isDistanceMatrixOutputEnabled() const;
+
+    /**
+     * Sets whether the user has requested to store the condensed distance matrix in a file.
+     *
+     * @param distanceMatrixOutputEnabled <code>true</code> if the user has requested to store the
+     * condensed distance matrix in a file, <code>false</code> otherwise.
+     */
+    void setDistanceMatrixOutputEnabled(bool distanceMatrixOutputEnabled);
+
+    /**
+     * Returns the path of the file where the condensed distance matrix will be stored.
+     *
+     * @return The path of the file where the condensed distance matrix will be stored.
+     */
+    const std::filesystem::path& getDistanceMatrixOutputFilePath() const;
+
+    /**
+     * Sets the path of the file where the condensed distance matrix will be stored.
+     *
+     * @param distanceMatrixOutputFilePath Path of the file where the condensed distance matrix
+     * will be stored.
+     */
+    void setDistanceMatrixOutputFilePath(
+            const std::filesystem::path& distanceMatrixOutputFilePath);
+
+    /**
+     * Returns the number of cuts of the dendrogram to check in test mode, both at a height and
+     * into a number of clusters.<br>
+     * <code>0</code> means that the cuts are not checked.
+     *
+     * @return The number of cuts of the dendrogram to check.
+     */
+    std::size_t getTestCutsCount() const;
+
+    /**
+     * Sets the number of cuts of the dendrogram to check in test mode, both at a height and into a
+     * number of clusters.
+     *
+     * @param testCutsCount Number of cuts of the dendrogram to check, or <code>0</code> if the cuts
+     * are not checked.
+     */
+    void setTestCutsCount(std::size_t testCutsCount);
+
+    /**
+     * Returns <code>true</code> if the user has requested to check the cophenetic distances in
+     * test mode, <code>false</code> otherwise.
+     *
+     * @return <code>true</code> if the user has requested to check the cophenetic distances,
+     * <code>false</code> otherwise.
+     */
+    bool isTestCopheneticEnabled() const;
+
+    /**
+     * Sets whether the user has requested to check the cophenetic distances in test mode.
+     *
+     * @param testCopheneticEnabled <code>true</code> if the user has requested to check the
+     * cophenetic distances, <code>false</code> otherwise.
+     */
+    void setTestCopheneticEnabled(bool testCopheneticEnabled);
+
+    /**
+     * Returns <code>true</code> if the user has requested to check the incremental clustering in
+     * test mode, <code>false</code> otherwise.
+     *
+     * @return <code>true</code> if the user has requested to check the incremental clustering,
+     * <code>false</code> otherwise.
+     */
+    bool isTestIncrementalEnabled() const;
+
+    /**
+     * Sets whether the user has requested to check the incremental clustering in test mode.
+     *
+     * @param testIncrementalEnabled <code>true</code> if the user has requested to check the
+     * incremental clustering, <code>false</code> otherwise.
+     */
+    void setTestIncrementalEnabled(bool testIncrementalEnabled);
+
+    /**
+     * Returns <code>true</code> if the user has requested to read the data samples out of core,
+     * <code>false</code> otherwise.
+     *
+     * @return <code>true</code> if the user has requested to read the data samples out of core,
+     * <code>false</code> otherwise.
+     */
+    bool isOutOfCoreEnabled() const;
+
+    /**
+     * Sets whether the user has requested to read the data samples out of core.
+     *
+     * @param outOfCoreEnabled <code>true</code> if the user has requested to read the data samples
+     * out of core, <code>false</code> otherwise.
+     */
+    void setOutOfCoreEnabled(bool outOfCoreEnabled);
+
+    /**
+     * Returns the size, in bytes, of the prefix of the data samples that is never released when
+     * they are read out of core.
+     *
+     * @return The size of the prefix of the data samples that is never released.
+     */
+    std::size_t getOutOfCoreResidentSetSize() const;
+
+    /**
+     * Sets the size, in bytes, of the prefix of the data samples that is never released when they
+     * are read out of core.
+     *
+     * @param outOfCoreResidentSetSize Size of the prefix of the data samples that is never
+     * released.
+     */
+    void setOutOfCoreResidentSetSize(std::size_t outOfCoreResidentSetSize);
+
+    /**
+     * Returns <code>true</code> if the user has requested to store <code>pi</code> as 32-bit
+     * unsigned integers, <code>false</code> otherwise.
+     *
+     * @return <code>true</code> if the user has requested to store <code>pi</code> as 32-bit
+     * unsigned integers, <code>false</code> otherwise.
+     */
+    bool isCompactPiEnabled() const;
+
+    /**
+     * Sets whether the user has requested to store <code>pi</code> as 32-bit unsigned integers.
+     *
+     * @param compactPiEnabled <code>true</code> if the user has requested to store <code>pi</code>
+     * as 32-bit unsigned integers, <code>false</code> otherwise.
+     */
+    void setCompactPiEnabled(bool compactPiEnabled);
+
     /**
      * Returns <code>true</code> if the user has requested the execution of a parallel
      * implementation of the clustering algorithm, <code>false</code> otherwise.
@@ -386,6 +733,119 @@ private:
      */
     std::filesystem::path mathematicaOutputFilePath;
 
+    /**
+     * Flag indicating whether the user has enabled the generation of the binary dataset file where
+     * the data samples will be stored.
+     */
+    bool binaryOutputEnabled;
+
+    /**
+     * Path of the binary dataset file where the data samples will be stored.
+     */
+    std::filesystem::path binaryOutputFilePath;
+
+    /**
+     * Flag indicating whether the user has enabled the generation of the file where the computed
+     * values of <code>pi</code> and <code>lambda</code> will be stored.
+     */
+    bool resultsOutputEnabled;
+
+    /**
+     * Path of the file where the computed values of <code>pi</code> and <code>lambda</code> will
+     * be stored.
+     */
+    std::filesystem::path resultsOutputFilePath;
+
+    /**
+     * Flag indicating whether the user has enabled the generation of the file where the linkage
+     * matrix of the dendrogram will be stored.
+     */
+    bool linkageOutputEnabled;
+
+    /**
+     * Path of the file where the linkage matrix of the dendrogram will be stored.
+     */
+    std::filesystem::path linkageOutputFilePath;
+
+    /**
+     * Flag indicating whether the user has enabled the checkpoint file where the state of the
+     * clustering will be saved.
+     */
+    bool checkpointEnabled;
+
+    /**
+     * Path of the checkpoint file where the state of the clustering will be saved.
+     */
+    std::filesystem::path checkpointFilePath;
+
+    /**
+     * Number of data samples after which the clustering is stopped, or <code>0</code> if it is
+     * never stopped.
+     */
+    std::size_t checkpointSamplesLimit;
+
+    /**
+     * Metric used to measure the distance between two data samples.
+     */
+    Metrics metric;
+
+    /**
+     * Flag indicating whether the user has requested to read the condensed distance matrix from a
+     * file.
+     */
+    bool distanceMatrixInputEnabled;
+
+    /**
+     * Path of the file containing the condensed distance matrix.
+     */
+    std::filesystem::path distanceMatrixInputFilePath;
+
+    /**
+     * Flag indicating whether the user has enabled the generation of the file where the condensed
+     * distance matrix will be stored.
+     */
+    bool distanceMatrixOutputEnabled;
+
+    /**
+     * Path of the file where the condensed distance matrix will be stored.
+     */
+    std::filesystem::path distanceMatrixOutputFilePath;
+
+    /**
+     * Number of cuts of the dendrogram to check in test mode, or <code>0</code> if the cuts are not
+     * checked.
+     */
+    std::size_t testCutsCount;
+
+    /**
+     * Flag indicating whether the user has requested to check the cophenetic distances in test
+     * mode.
+     */
+    bool testCopheneticEnabled;
+
+    /**
+     * Flag indicating whether the user has requested to check the incremental clustering in test
+     * mode.
+     */
+    bool testIncrementalEnabled;
+
+    /**
+     * Flag indicating whether the user has requested to read the data samples out of core.
+     */
+    bool outOfCoreEnabled;
+
+    /**
+     * Size, in bytes, of the prefix of the data samples that is never released when they are read
+     * out of core.
+     */
+    std::size_t outOfCoreResidentSetSize;
+
+    /**
+     * Flag indicating whether the user has requested to store <code>pi</code> as 32-bit unsigned
+     * integers.
+     */
+    bool compactPiEnabled;
+
     /**
      * Flag indicating whether the parallel implementation of the clustering algorithm has been
      * requested.
@@ -3,7 +3,7 @@
  *
  * @author DeB
  * @author Jonathan
- * @version 1.2 2022-08-22
+ * @version 1.20 2022-10-16
  * @since 1.0
  */
 #include "CliArgumentException.h"
@@ -29,6 +29,17 @@ const std::unordered_map<std::string, std::tuple<std::string, std::size_t, std::
                                              {"same-distance", {"same-distance.data", 1, 2}},
                                              {"slide", {"slide.data", 1, 2}}};
 
+/**
+ * Map containing the names of the metrics.
+ */
+// NOLINTNEXTLINE(cert-err58-cpp)
+const std::unordered_map<std::string, Metrics> CliArgumentsParser::METRIC_NAMES{
+        {"euclidean", Metrics::EUCLIDEAN},
+        {"manhattan", Metrics::MANHATTAN},
+        {"chebyshev", Metrics::CHEBYSHEV},
+        {"cosine", Metrics::COSINE},
+        {"minkowski", Metrics::MINKOWSKI}};
+
 /**
  * Creates a new parser of the command line arguments.
  *
@@ -76,22 +87,48 @@ CliArguments CliArgumentsParser::parseArguments() {
         this->nextArgumentIndex++;
 
         // Parse the argument
-        if (argument == "-c") {
+        if (argument.starts_with("--binary-output-path=")) {
+            CliArgumentsParser::parseBinaryOutputOption(result, argument);
+        } else if (argument.starts_with("--checkpoint-path=")) {
+            CliArgumentsParser::parseCheckpointPathOption(result, argument);
+        } else if (argument.starts_with("--checkpoint-stop=")) {
+            CliArgumentsParser::parseCheckpointStopOption(result, argument);
+        } else if (argument == "-c") {
             this->parseColumnsOption(result);
+        } else if (argument == "--compact-pi") {
+            CliArgumentsParser::parseCompactPiOption(result);
+        } else if (argument.starts_with("--distance-matrix-output-path=")) {
+            CliArgumentsParser::parseDistanceMatrixOutputOption(result, argument);
+        } else if (argument.starts_with("--distance-matrix-path=")) {
+            CliArgumentsParser::parseDistanceMatrixPathOption(result, argument);
         } else if (argument == "-l") {
             this->parseLinesOption(result);
+        } else if (argument.starts_with("--linkage-output-path=")) {
+            CliArgumentsParser::parseLinkageOutputOption(result, argument);
         } else if (argument.starts_with("--mathematica-output-path=")) {
             CliArgumentsParser::parseMathematicaOutputOption(result, argument);
+        } else if (argument.starts_with("--metric=")) {
+            CliArgumentsParser::parseMetricOption(result, argument);
         } else if (argument == "-n") {
             this->parseNumberOfThreadsOption(result);
+        } else if (argument.starts_with("--out-of-core=")) {
+            CliArgumentsParser::parseOutOfCoreOption(result, argument);
         } else if (argument == "-p") {
             versionSpecified = true;
             this->parseAlgorithmVersion(result, true);
+        } else if (argument.starts_with("--results-output-path=")) {
+            CliArgumentsParser::parseResultsOutputOption(result, argument);
         } else if (argument == "-s") {
             versionSpecified = true;
             this->parseAlgorithmVersion(result, false);
         } else if (argument == "-t") {
             CliArgumentsParser::parseTestOption(result);
+        } else if (argument == "--test-cophenetic") {
+            CliArgumentsParser::parseTestCopheneticOption(result);
+        } else if (argument.starts_with("--test-cuts=")) {
+            CliArgumentsParser::parseTestCutsOption(result, argument);
+        } else if (argument == "--test-incremental") {
+            CliArgumentsParser::parseTestIncrementalOption(result);
         } else if (argument.starts_with("--test-results-path=")) {
             CliArgumentsParser::parseTestResultsPath(result, argument);
         } else if (argument.starts_with("--visualizer-output-path=")) {
@@ -109,6 +146,57 @@ CliArguments CliArgumentsParser::parseArguments() {
         throw CliArgumentException("None of the mandatory options -p and -s has been specified.");
     }
 
+    // Require the checkpoint to be supported by the requested version
+    if (result.getCheckpointSamplesLimit() != 0 && !result.isCheckpointEnabled()) {
+        throw CliArgumentException(
+                "The --checkpoint-stop option requires the --checkpoint-path option");
+    }
+    // NOLINTBEGIN(cppcoreguidelines-avoid-magic-numbers, readability-magic-numbers)
+    if (result.isCheckpointEnabled() &&
+        (!result.isParallel() || result.getAlgorithmVersion() == 12 ||
+         (result.getAlgorithmVersion() >= 16 && result.getAlgorithmVersion() <= 21) ||
+         result.getAlgorithmVersion() >= 23)) {
+        throw CliArgumentException(
+                "The --checkpoint-path option is not supported by the requested version");
+    }
+
+    // Require the metric to be supported by the requested version
+    if (result.getMetric() != Metrics::EUCLIDEAN && result.isParallel() &&
+        result.getAlgorithmVersion() > 11 && result.getAlgorithmVersion() != 22) {
+        throw CliArgumentException("The --metric option is not supported by the requested version");
+    }
+
+    // Require the distance matrix to be used by the requested version
+    if ((result.isDistanceMatrixInputEnabled() || result.isDistanceMatrixOutputEnabled()) &&
+        (!result.isParallel() || result.getAlgorithmVersion() != 24)) {
+        throw CliArgumentException(
+                "The --distance-matrix-path and --distance-matrix-output-path options are "
+                "supported only by the parallel version 24");
+    }
+
+    // Require the data samples to be released by the requested version
+    if (result.isOutOfCoreEnabled() &&
+        (!result.isParallel() ||
+         (result.getAlgorithmVersion() != 11 && result.getAlgorithmVersion() != 20) ||
+         result.getMetric() != Metrics::EUCLIDEAN)) {
+        throw CliArgumentException(
+                "The --out-of-core option is supported only by the parallel versions 11 and 20, "
+                "with the Euclidean metric");
+    }
+
+    // Require pi to be stored as 32-bit unsigned integers by the requested version
+    if (result.isCompactPiEnabled() &&
+        (!result.isParallel() ||
+         (result.getAlgorithmVersion() != 11 && result.getAlgorithmVersion() != 12 &&
+          result.getAlgorithmVersion() != 16 && result.getAlgorithmVersion() != 20) ||
+         result.getMetric() != Metrics::EUCLIDEAN || result.isOutOfCoreEnabled())) {
+        throw CliArgumentException(
+                "The --compact-pi option is supported only by the parallel versions 11, 12, 16 "
+                "and 20, with the Euclidean metric, and cannot be specified together with the "
+                "--out-of-core option");
+    }
+    // NOLINTEND(cppcoreguidelines-avoid-magic-numbers, readability-magic-numbers)
+
     return result;
 }
 
@@ -295,6 +383,268 @@ void CliArgumentsParser::parseMathematicaOutputOption(CliArguments &result,
     result.setMathematicaOutputFilePath(mathematicaOutputPath);
 }
 
+/**
+ * Parses the --binary-output-path option.
+ *
+ * @param result Container where the parsed arguments will be placed.
+ * @param option The string containing the full argument specified in the command line.
+ * @throws CliArgumentException If the specified command line arguments are not correct.
+ */
+void CliArgumentsParser::parseBinaryOutputOption(CliArguments &result, const std::string &option) {
+
+    // Extract the path
+    const std::string binaryOutputPathString = option.substr(BINARY_OUTPUT_OPTION_LENGTH);
+
+    // Resolve the path
+    std::filesystem::path binaryOutputPath{binaryOutputPathString};
+    binaryOutputPath = absolute(binaryOutputPath).lexically_normal();
+
+    // Check its validity
+    using namespace std::literals::string_literals;
+    requireFilePathValidity(
+            binaryOutputPath,
+            "The directory"s + ' ' + binaryOutputPath.parent_path().string() +
+                    " where the binary dataset file will be generated does not exist",
+            "The binary dataset file path"s + ' ' + binaryOutputPath.string() +
+                    " refers to a non-regular file");
+
+    // Set the values in the result
+    result.setBinaryOutputEnabled(true);
+    result.setBinaryOutputFilePath(binaryOutputPath);
+}
+
+/**
+ * Parses the --results-output-path option.
+ *
+ * @param result Container where the parsed arguments will be placed.
+ * @param option The string containing the full argument specified in the command line.
+ * @throws CliArgumentException If the specified command line arguments are not correct.
+ */
+void CliArgumentsParser::parseResultsOutputOption(CliArguments &result, const std::string &option) {
+
+    // Extract the path
+    const std::string resultsOutputPathString = option.substr(RESULTS_OUTPUT_OPTION_LENGTH);
+
+    // Resolve the path
+    std::filesystem::path resultsOutputPath{resultsOutputPathString};
+    resultsOutputPath = absolute(resultsOutputPath).lexically_normal();
+
+    // Check its validity
+    using namespace std::literals::string_literals;
+    requireFilePathValidity(
+            resultsOutputPath,
+            "The directory"s + ' ' + resultsOutputPath.parent_path().string() +
+                    " where the results file will be generated does not exist",
+            "The results file path"s + ' ' + resultsOutputPath.string() +
+                    " refers to a non-regular file");
+
+    // Set the values in the result
+    result.setResultsOutputEnabled(true);
+    result.setResultsOutputFilePath(resultsOutputPath);
+}
+
+/**
+ * Parses the --linkage-output-path option.
+ *
+ * @param result Container where the parsed arguments will be placed.
+ * @param option The string containing the full argument specified in the command line.
+ * @throws CliArgumentException If the specified command line arguments are not correct.
+ */
+void CliArgumentsParser::parseLinkageOutputOption(CliArguments &result, const std::string &option) {
+
+    // Extract the path
+    const std::string linkageOutputPathString = option.substr(LINKAGE_OUTPUT_OPTION_LENGTH);
+
+    // Resolve the path
+    std::filesystem::path linkageOutputPath{linkageOutputPathString};
+    linkageOutputPath = absolute(linkageOutputPath).lexically_normal();
+
+    // Check its validity
+    using namespace std::literals::string_literals;
+    requireFilePathValidity(
+            linkageOutputPath,
+            "The directory"s + ' ' + linkageOutputPath.parent_path().string() +
+                    " where the linkage matrix file will be generated does not exist",
+            "The linkage matrix file path"s + ' ' + linkageOutputPath.string() +
+                    " refers to a non-regular file");
+
+    // Set the values in the result
+    result.setLinkageOutputEnabled(true);
+    result.setLinkageOutputFilePath(linkageOutputPath);
+}
+
+/**
+ * Parses the --checkpoint-path option.
+ *
+ * @param result Container where the parsed arguments will be placed.
+ * @param option The string containing the full argument specified in the command line.
+ * @throws CliArgumentException If the specified command line arguments are not correct.
+ */
+void CliArgumentsParser::parseCheckpointPathOption(CliArguments &result,
+                                                   const std::string &option) {
+
+    // Extract the path
+    const std::string checkpointPathString = option.substr(CHECKPOINT_PATH_OPTION_LENGTH);
+
+    // Resolve the path
+    std::filesystem::path checkpointPath{checkpointPathString};
+    checkpointPath = absolute(checkpointPath).lexically_normal();
+
+    // Check its validity
+    using namespace std::literals::string_literals;
+    requireFilePathValidity(
+            checkpointPath,
+            "The directory"s + ' ' + checkpointPath.parent_path().string() +
+                    " where the checkpoint file will be saved does not exist",
+            "The checkpoint file path"s + ' ' + checkpointPath.string() +
+                    " refers to a non-regular file");
+
+    // Set the values in the result
+    result.setCheckpointEnabled(true);
+    result.setCheckpointFilePath(checkpointPath);
+}
+
+/**
+ * Parses the --checkpoint-stop option.
+ *
+ * @param result Container where the parsed arguments will be placed.
+ * @param option The string containing the full argument specified in the command line.
+ * @throws CliArgumentException If the specified command line arguments are not correct.
+ */
+void CliArgumentsParser::parseCheckpointStopOption(CliArguments &result,
+                                                   const std::string &option) {
+
+    // Parse the number of data samples
+    const std::size_t samplesLimit =
+            parseSizeT(option.substr(CHECKPOINT_STOP_OPTION_LENGTH),
+                       "The number of samples specified in the --checkpoint-stop option is not "
+                       "valid");
+    if (samplesLimit < 1) {
+        throw CliArgumentException(
+                "The number of samples specified in the --checkpoint-stop option must be greater "
+                "than 0");
+    }
+
+    // Set the value in the result
+    result.setCheckpointSamplesLimit(samplesLimit);
+}
+
+/**
+ * Parses the --metric option.
+ *
+ * @param result Container where the parsed arguments will be placed.
+ * @param option The string containing the full argument specified in the command line.
+ * @throws CliArgumentException If the specified command line arguments are not correct.
+ */
+void CliArgumentsParser::parseMetricOption(CliArguments &result, const std::string &option) {
+
+    // Extract the name of the metric
+    const std::string metricName = option.substr(METRIC_OPTION_LENGTH);
+
+    // Check its validity
+    if (!METRIC_NAMES.contains(metricName)) {
+        using namespace std::literals::string_literals;
+        throw CliArgumentException("Unknown metric"s + ' ' + metricName +
+                                   " in the --metric option");
+    }
+
+    // Set the value in the result
+    result.setMetric(METRIC_NAMES.at(metricName));
+}
+
+/**
+ * Parses the --distance-matrix-path option.
+ *
+ * @param result Container where the parsed arguments will be placed.
+ * @param option The string containing the full argument specified in the command line.
+ * @throws CliArgumentException If the specified command line arguments are not correct.
+ */
+void CliArgumentsParser::parseDistanceMatrixPathOption(CliArguments &result,
+                                                       const std::string &option) {
+
+    // Extract the path
+    const std::string distanceMatrixPathString =
+            option.substr(DISTANCE_MATRIX_PATH_OPTION_LENGTH);
+
+    // Resolve the path
+    std::filesystem::path distanceMatrixPath{distanceMatrixPathString};
+    distanceMatrixPath = absolute(distanceMatrixPath).lexically_normal();
+
+    // Check its existence
+    using namespace std::literals::string_literals;
+    if (!std::filesystem::is_regular_file(distanceMatrixPath)) {
+        throw CliArgumentException("The distance matrix file"s + ' ' +
+                                   distanceMatrixPath.string() +
+                                   " does not exist or refers to a non-regular file");
+    }
+
+    // Set the values in the result
+    result.setDistanceMatrixInputEnabled(true);
+    result.setDistanceMatrixInputFilePath(distanceMatrixPath);
+}
+
+/**
+ * Parses the --distance-matrix-output-path option.
+ *
+ * @param result Container where the parsed arguments will be placed.
+ * @param option The string containing the full argument specified in the command line.
+ * @throws CliArgumentException If the specified command line arguments are not correct.
+ */
+void CliArgumentsParser::parseDistanceMatrixOutputOption(CliArguments &result,
+                                                         const std::string &option) {
+
+    // Extract the path
+    const std::string distanceMatrixOutputPathString =
+            option.substr(DISTANCE_MATRIX_OUTPUT_OPTION_LENGTH);
+
+    // Resolve the path
+    std::filesystem::path distanceMatrixOutputPath{distanceMatrixOutputPathString};
+    distanceMatrixOutputPath = absolute(distanceMatrixOutputPath).lexically_normal();
+
+    // Check its validity
+    using namespace std::literals::string_literals;
+    requireFilePathValidity(
+            distanceMatrixOutputPath,
+            "The directory"s + ' ' + distanceMatrixOutputPath.parent_path().string() +
+                    " where the distance matrix file will be generated does not exist",
+            "The distance matrix file path"s + ' ' + distanceMatrixOutputPath.string() +
+                    " refers to a non-regular file");
+
+    // Set the values in the result
+    result.setDistanceMatrixOutputEnabled(true);
+    result.setDistanceMatrixOutputFilePath(distanceMatrixOutputPath);
+}
+
+/**
+ * Parses the --out-of-core option.
+ *
+ * @param result Container where the parsed arguments will be placed.
+ * @param option The string containing the full argument specified in the command line.
+ * @throws CliArgumentException If the specified command line arguments are not correct.
+ */
+void CliArgumentsParser::parseOutOfCoreOption(CliArguments &result, const std::string &option) {
+
+    // Parse the size of the resident prefix
+    const std::size_t residentSetSize = parseSizeT(
+            option.substr(OUT_OF_CORE_OPTION_LENGTH),
+            "The size specified in the --out-of-core option is not valid");
+
+    // Set the values in the result
+    result.setOutOfCoreEnabled(true);
+    result.setOutOfCoreResidentSetSize(residentSetSize);
+}
+
+/**
+ * Parses the --compact-pi option.
+ *
+ * @param result Container where the parsed arguments will be placed.
+ */
+void CliArgumentsParser::parseCompactPiOption(CliArguments &result) {
+
+    // Store pi as 32-bit unsigned integers
+    result.setCompactPiEnabled(true);
+}
+
 /**
  * Parses the version specified in the -p and -s options.
  *
@@ -361,6 +711,53 @@ void CliArgumentsParser::parseTestResultsPath(CliArguments &result, const std::s
     result.setTestResultsFilePath(textResultsPath);
 }
 
+/**
+ * Parses the --test-cophenetic option.
+ *
+ * @param result Container where the parsed arguments will be placed.
+ */
+void CliArgumentsParser::parseTestCopheneticOption(CliArguments &result) {
+
+    // Enable the test mode and the check of the cophenetic distances
+    result.setTestModeEnabled(true);
+    result.setTestCopheneticEnabled(true);
+}
+
+/**
+ * Parses the --test-incremental option.
+ *
+ * @param result Container where the parsed arguments will be placed.
+ */
+void CliArgumentsParser::parseTestIncrementalOption(CliArguments &result) {
+
+    // Enable the test mode and the check of the incremental clustering
+    result.setTestModeEnabled(true);
+    result.setTestIncrementalEnabled(true);
+}
+
+/**
+ * Parses the --test-cuts option.
+ *
+ * @param result Container where the parsed arguments will be placed.
+ * @param option The string containing the full argument specified in the command line.
+ * @throws CliArgumentException If the specified command line argument is incorrect.
+ */
+void CliArgumentsParser::parseTestCutsOption(CliArguments &result, const std::string &option) {
+
+    // Parse the number of cuts
+    const std::size_t cutsCount =
+            parseSizeT(option.substr(TEST_CUTS_OPTION_LENGTH),
+                       "The number of cuts specified in the --test-cuts option is not valid");
+    if (cutsCount < 1) {
+        throw CliArgumentException(
+                "The number of cuts specified in the --test-cuts option must be greater than 0");
+    }
+
+    // Set the values in the result
+    result.setTestModeEnabled(true);
+    result.setTestCutsCount(cutsCount);
+}
+
 /**
  * Parses the input file path.
  *
@@ -560,6 +957,16 @@ DESCRIPTION
     The input file may contain more columns or more rows than needed. Use the
     -c and -r options to deal with these cases.
     
+    The INPUT_FILE_PATH file can also be a binary dataset file, created with the
+    --binary-output-path option. Its data samples are loaded without parsing
+    them and, if they are already stored with the layout required by the
+    selected version, without copying them. The -c and -l options cannot be
+    used with binary dataset files.
+    NumPy .npy files, and .npz archives stored without compression, are loaded
+    in the same way. The array, or the first one of the archive, must contain
+    little-endian float64 or float32 values in row-major order, with one row
+    per point.
+    
     There are some well-known files that do not require the specification of the
     full path, nor the columns range. These files are contained in the test
     resources directory, assumed to be in the path ../../test/resources.
@@ -574,6 +981,34 @@ DESCRIPTION
         - "two-points"    for "two-points.data",         columns from 1 to 2.
 
 OPTIONS
+    --binary-output-path=OUTPUT_PATH
+        Specifies the path of the binary dataset file that will be filled with
+        the data samples to cluster, stored with the layout required by the
+        selected version. This file can be given as INPUT_FILE_PATH to the
+        following executions, to avoid parsing the data samples again.
+    
+        If this option is omitted, then no binary dataset file is created.
+    
+    --checkpoint-path=CHECKPOINT_PATH
+        Specifies the path of the checkpoint file where the state of the
+        clustering is saved every few seconds, so that an interrupted
+        execution can be resumed. If the file already exists, then the
+        clustering is resumed from the state it holds, which must have been
+        saved while clustering the same samples with the same version.
+
+        This option is supported only by the parallel versions from 1 to 11,
+        13, 14, 15 and 22.
+
+        If this option is omitted, then no checkpoint file is saved.
+
+    --checkpoint-stop=SAMPLES
+        Stops the clustering as soon as SAMPLES samples have been added to the
+        dendrogram, after saving the checkpoint, as if the execution had been
+        interrupted. In this case, no output file is created and the results
+        are not checked. SAMPLES must be greater than 0.
+
+        This option requires the --checkpoint-path option.
+
     -c FIRST LAST
         Specifies the range of columns to be considered as coordinates of the
         points to cluster in each line of the INPUT_FILE_PATH file. Any other
@@ -586,6 +1021,46 @@ OPTIONS
         the INPUT_FILE_PATH file are considered containing coordinates of the
         points.
 
+    --compact-pi
+        Stores the values of pi as 32-bit unsigned integers instead of 64-bit
+        ones during the clustering, halving their memory footprint. The values
+        are widened before they are printed, stored or tested, so that the test
+        mode compares them with the ones stored as 64-bit unsigned integers by
+        the sequential implementation.
+
+        This option is supported only by the parallel versions 11, 12, 16 and
+        20, i.e., by a version for every execution mode, with the Euclidean
+        metric, and cannot be specified together with the --out-of-core option.
+
+        If this option is omitted, then pi is stored as 64-bit unsigned
+        integers.
+
+    --distance-matrix-output-path=OUTPUT_PATH
+        Specifies the path of the binary dataset file that will be filled with
+        the condensed distance matrix used by the clustering, with one distance
+        per data sample. This file can be given to the --distance-matrix-path
+        option of the following executions.
+
+        This option is supported only by the parallel version 24.
+
+        If this option is omitted, then no distance matrix file is created.
+
+    --distance-matrix-path=MATRIX_PATH
+        Specifies the path of the file containing the condensed distance matrix
+        to cluster, i.e., the upper triangle of the matrix of the distances
+        between all the pairs of points, without the diagonal, stored row by
+        row as the one computed by scipy.spatial.distance.pdist. The file is
+        mapped in memory and the distances are read without copying them.
+        It must be a binary dataset file, a NumPy .npy file or a .npz archive
+        stored without compression, holding N * (N - 1) / 2 float64 values,
+        where N is the number of points read from INPUT_FILE_PATH.
+        In test mode, the results are checked against the sequential clustering
+        of the points, hence the matrix must hold their Euclidean distances.
+
+        This option is supported only by the parallel version 24.
+
+        If this option is omitted, then the matrix is computed from the points.
+
     -h, --help
         Prints this help.
     
@@ -601,12 +1076,40 @@ OPTIONS
         If this option is not specified, then all the lines of the
         INPUT_FILE_PATH are considered as points to cluster.
     
+    --linkage-output-path=LINKAGE_OUTPUT_PATH
+        Specifies the path of the output file that will be filled with the
+        linkage matrix of the dendrogram, in the format used by SciPy. Each
+        row holds the two merged clusters, the distance at which they merge
+        and the number of samples in the new cluster. If the path has the .npy
+        extension, then the matrix is stored as a NumPy float64 array.
+        Otherwise, every row is stored as a line of comma-separated values.
+
+        If this option is omitted, then no output file is created.
+
     --mathematica-output-path=MATHEMATICA_OUTPUT_PATH
         Specifies the path of the output file that will be filled with the
         Mathematica code that generates the dendrogram tree of the clusters.
    
         If this option is omitted, then no output file is created.
 
+    --metric=METRIC
+        Specifies the METRIC used to measure the distance between two points.
+        METRIC can be one of:
+            - euclidean, for the Euclidean metric;
+            - manhattan, for the Manhattan metric;
+            - chebyshev, for the Chebyshev metric;
+            - cosine,    for the cosine distance;
+            - minkowski, for the Minkowski metric of order 3.
+        In test mode, the results are checked against the results of the
+        sequential implementation using the same metric. The results read from
+        the --test-results-path file must have been computed with the same
+        metric as well.
+
+        Metrics other than the Euclidean one are supported only by the
+        sequential versions, and by the parallel versions from 1 to 11 and 22.
+
+        If this option is omitted, then the Euclidean metric is used.
+
     -n DISTANCE_THREADS STRUCTURAL_FIX_THREADS SQRT_THREADS
         Specifies the number of threads to use when parallelizing the stages of
         the clustering algorithm.
@@ -631,6 +1134,21 @@ OPTIONS
         hence OpenMP will use the default number of threads for all the three
         stages.
 
+    --out-of-core=RESIDENT_SIZE
+        Reads the data samples out of core, mapping the input file instead of
+        loading it in memory. The kernel is advised to keep the first
+        RESIDENT_SIZE bytes of the data samples in memory and to release the
+        other ones once they have been swept in each iteration, which are only
+        advices and do not bound the memory used.
+
+        The input file must be a binary dataset of doubles with the layout
+        required by the requested version, e.g., one created with the
+        --binary-output-path option. This option is supported only by the
+        parallel versions 11 and 20, with the Euclidean metric, and only on
+        POSIX systems.
+
+        If this option is omitted, then the data samples are loaded in memory.
+
     -p VERSION
         Specifies the VERSION of the parallel clustering algorithm to use. See
         the PARALLEL VERSIONS section to know what number correspond to a
@@ -639,6 +1157,15 @@ OPTIONS
         This option is mandatory, and cannot be specified together with the -s
         option.
     
+    --results-output-path=RESULTS_OUTPUT_PATH
+        Specifies the path of the output file that will be filled with the
+        computed values of pi and lambda. If the path has the .npz extension,
+        then the values are stored as a NumPy archive holding the pi (uint64)
+        and lambda (float64) arrays. Otherwise, they are stored as two lines of
+        comma-separated values.
+    
+        If this option is omitted, then no output file is created.
+    
     -s VERSION
         Specifies the VERSION of the sequential clustering algorithm to use. See
         the SEQUENTIAL VERSIONS section to know what number correspond to a
@@ -657,6 +1184,37 @@ OPTIONS
         
         If this option is omitted, then the test mode is disabled.
     
+    --test-cophenetic
+        Checks also the cophenetic distances between all the pairs of points,
+        i.e., the heights at which they are merged into the same cluster. The
+        distances answered, in parallel, by the index built from the dendrogram
+        are compared with the ones obtained by applying the merges one at a
+        time and assigning the height of every merge to all the pairs of points
+        it joins.
+
+        This option implies -t.
+
+    --test-cuts=CUTS
+        Checks also the flat clusters obtained by cutting the dendrogram at CUTS
+        heights, evenly spaced between the lowest and the highest merge, and
+        into CUTS numbers of clusters, evenly spaced between 1 and the number
+        of points. All the cuts of each kind are extracted together, in
+        parallel, and every cut is compared with the one obtained by applying
+        the merges one at a time. CUTS must be greater than 0.
+
+        This option implies -t.
+
+    --test-incremental
+        Checks also the incremental clustering, by appending the points in
+        batches of doubling size, with the metric specified by the --metric
+        option. After every batch, the dendrogram of the points appended so far
+        is compared with the one computed by clustering them all at once. The
+        points are appended both with a distance computer that takes the square
+        roots of the distances and with one that defers them, the first one
+        storing pi as 32-bit unsigned integers.
+
+        This option implies -t.
+
     --test-results-path=TEST_RESULTS_PATH
         Avoids the execution of the sequential implementation every time the
         program is executed, by reading results of the sequential implementation
@@ -664,7 +1222,8 @@ OPTIONS
         
         If the file does not exist, then the sequential implementation of the
         clustering algorithm is executed, and the results are stored in the
-        specified path.
+        specified path. As for the --results-output-path option, the results
+        are stored as a NumPy archive if the path has the .npz extension.
 
         If this option is omitted, then the sequential implementation of the
         clustering algorithm is always executed to retrieve the correct results.
@@ -758,6 +1317,92 @@ PARALLEL VERSIONS
             compute the square root while computing the distances, but perform
             this computation in parallel using threads at the end of the
             algorithm.
+        12  Parallel implementation that works like the version 11, but creates
+            the threads only once and keeps them alive for the whole execution
+            of the algorithm, instead of creating new threads every time the
+            computation of the distances or the structural fix is parallelized.
+            In this version, DISTANCE_THREADS specifies the number of threads
+            used by both the computation of the distances and the structural
+            fix.
+        13  Parallel implementation that uses a unique contiguous array to hold
+            the samples to cluster, which are neither aligned nor padded, and
+            parallelizes the computation of the distance between two data
+            samples using both threads and AVX-512 instructions. Moreover, the
+            rearrangement of the structure dendrogram after a new point it added
+            is performed in parallel by using threads. In addition, this
+            implementation does not compute the square root while computing the
+            distances, but perform this computation in parallel using threads
+            at the end of the algorithm. This version requires a CPU supporting
+            the AVX-512 instructions.
+        14  Parallel implementation that works like the version 13, but selects
+            at run-time the fastest instructions supported by the CPU among
+            SSE2, AVX, AVX2 with FMA, and AVX-512 to compute the distance
+            between two data samples. This version can be executed on any
+            x86-64 CPU.
+        15  Parallel implementation that works like the version 11, but
+            converts the attributes of the data samples to single precision
+            floating point numbers before clustering them, so that each AVX
+            register holds 8 attributes. Hence, the results may slightly differ
+            from the ones computed in double precision.
+        16  Parallel implementation that works like the version 12, but
+            computes the distances required by the following data sample while
+            the current data sample is added to the dendrogram.
+        17  Parallel implementation that computes the minimum spanning tree of
+            the samples to cluster, which are aligned and padded like in the
+            version 11, using the Prim's algorithm, and then converts it into
+            the pointer representation. Each iteration of the Prim's algorithm
+            is parallelized using threads, while the distance between two data
+            samples is computed using AVX instructions. The square roots are
+            computed in parallel using threads at the end of the algorithm. In
+            this version, STRUCTURAL_FIX_THREADS is ignored.
+        18  Parallel implementation that computes the minimum spanning tree of
+            the samples to cluster, which are stored one after the other in a
+            unique array, using the Boruvka algorithm accelerated by a kd-tree,
+            and then converts it into the pointer representation. The closest
+            samples of each leaf of the kd-tree are searched with a single-tree
+            traversal. The search of the closest samples and the square roots
+            are parallelized using DISTANCE_THREADS threads. This version is
+            suited only for samples with few attributes. In this version,
+            STRUCTURAL_FIX_THREADS and SQRT_THREADS are ignored.
+        19  Parallel implementation that works like the version 14, but appends
+            the samples to cluster one after the other to an object that
+            clusters them incrementally, so that the dendrogram of the samples
+            appended so far is available after each append. In this version,
+            SQRT_THREADS is ignored.
+        20  Parallel implementation that works like the version 11, but
+            computes the distances required by 8 consecutive samples in a
+            unique sweep over the previous samples, so that each of them is
+            read from the memory once every 8 samples instead of once per
+            sample.
+        21  Parallel implementation that works like the version 20, but
+            computes the squared distances as the sum of the squared norms of
+            the samples minus twice their dot product, using AVX and FMA
+            instructions. The distances that are too small to be computed in
+            this way are computed again from the differences of the attributes.
+        22  Parallel implementation that works like the version 11, but
+            computes the distance between two data samples using fused
+            multiply-add instructions, keeping 4 independent partial sums in
+            the registers.
+        23  Parallel implementation that works like the version 11, but
+            stores the samples to cluster in blocks of 4 samples whose
+            attributes are interleaved, so that the distances between a sample
+            and all the samples of a block are computed at once using AVX
+            instructions. This version is suited for samples with few
+            attributes.
+        24  Parallel implementation that reads the distances from the
+            condensed matrix of all the pairwise distances, computed in parallel
+            before the clustering starts, or read from the file specified in
+            the --distance-matrix-path option, instead of computing them, and
+            parallelizes both the reading of the distances and the structural
+            fix using threads. The memory required by the matrix grows with the
+            square of the number of samples. In this version, SQRT_THREADS is
+            ignored.
+        25  Parallel implementation that works like the version 13, but
+            converts the attributes of the data samples to single precision
+            floating point numbers before clustering them, so that each AVX-512
+            register holds 16 attributes. Hence, the results may slightly differ
+            from the ones computed in double precision. This version requires a
+            CPU supporting the AVX-512 instructions.
         
 EXIT CODE
     0   If the -t option has not been specified, of if it has been specified and
@@ -772,6 +1417,9 @@ EXIT CODE
 
     3   If the specified input file path contains invalid information.
 
+    4   If the requested version requires instructions not supported by the
+        CPU, e.g., the AVX-512 ones.
+
 )"";
 }
 
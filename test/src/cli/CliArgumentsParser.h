@@ -14,7 +14,7 @@ namespace cluster::test::cli {
  *
  * @author DeB
  * @author Jonathan
- * @version 1.2 2022-08-22
+ * @version 1.13 2022-10-16
  * @since 1.0
  */
 class CliArgumentsParser {
@@ -49,6 +49,77 @@ private:
      */
     static const constexpr std::size_t TEST_RESULTS_PATH_OPTION_LENGTH = 20;
 
+    /**
+     * Length of the option specifying the number of cuts of the dendrogram to check, i.e., the
+     * length of the string <code>--test-cuts=</code>.
+     */
+    static const constexpr std::size_t TEST_CUTS_OPTION_LENGTH = 12;
+
+    /**
+     * Length of the option specifying the size of the prefix of the data samples that is never
+     * released when they are read out of core, i.e., the length of the string
+     * <code>--out-of-core=</code>.
+     */
+    static const constexpr std::size_t OUT_OF_CORE_OPTION_LENGTH = 14;
+
+    /**
+     * Length of the option specifying the path of the binary dataset file that will be filled with
+     * the data samples to cluster, i.e., the length of the string
+     * <code>--binary-output-path=</code>.
+     */
+    static const constexpr std::size_t BINARY_OUTPUT_OPTION_LENGTH = 21;
+
+    /**
+     * Length of the option specifying the path of the output file that will be filled with the
+     * computed values of <code>pi</code> and <code>lambda</code>, to be used outside this program,
+     * i.e., the length of the string <code>--results-output-path=</code>.
+     */
+    static const constexpr std::size_t RESULTS_OUTPUT_OPTION_LENGTH = 22;
+
+    /**
+     * Length of the option specifying the path of the output file that will be filled with the
+     * linkage matrix of the dendrogram, i.e., the length of the string
+     * <code>--linkage-output-path=</code>.
+     */
+    static const constexpr std::size_t LINKAGE_OUTPUT_OPTION_LENGTH = 22;
+
+    /**
+     * Length of the option specifying the path of the checkpoint file where the state of the
+     * clustering will be saved, i.e., the length of the string <code>--checkpoint-path=</code>.
+     */
+    static const constexpr std::size_t CHECKPOINT_PATH_OPTION_LENGTH = 18;
+
+    /**
+     * Length of the option specifying the number of data samples after which the clustering is
+     * stopped, i.e., the length of the string <code>--checkpoint-stop=</code>.
+     */
+    static const constexpr std::size_t CHECKPOINT_STOP_OPTION_LENGTH = 18;
+
+    /**
+     * Length of the option specifying the metric used to measure the distance between two data
+     * samples, i.e., the length of the string <code>--metric=</code>.
+     */
+    static const constexpr std::size_t METRIC_OPTION_LENGTH = 9;
+
+    /**
+     * Length of the option specifying the path of the file containing the condensed distance
+     * matrix, i.e., the length of the string <code>--distance-matrix-path=</code>.
+     */
+    static const constexpr std::size_t DISTANCE_MATRIX_PATH_OPTION_LENGTH = 23;
+
+    /**
+     * Length of the option specifying the path of the output file that will be filled with the
+     * condensed distance matrix, i.e., the length of the string
+     * <code>--distance-matrix-output-path=</code>.
+     */
+    static const constexpr std::size_t DISTANCE_MATRIX_OUTPUT_OPTION_LENGTH = 30;
+
+    /**
+     * Map associating the names that can be specified in the --metric option to the corresponding
+     * metrics.
+     */
+    static const std::unordered_map<std::string, Metrics> METRIC_NAMES;
+
 public:
     /**
      * Creates a new parser that parses the specified command line arguments.
@@ -118,6 +189,103 @@ private:
      */
     static void parseMathematicaOutputOption(CliArguments &result, const std::string &option);
 
+    /**
+     * Parses the --binary-output-path option.
+     *
+     * @param result Container where the parsed arguments will be placed.
+     * @param option The string containing the full argument specified in the command line, i.e.,
+     * the string <code>--binary-output-path=...</code>.
+     * @throws CliArgumentException If the specified file path is not valid.
+     */
+    static void parseBinaryOutputOption(CliArguments &result, const std::string &option);
+
+    /**
+     * Parses the --results-output-path option.
+     *
+     * @param result Container where the parsed arguments will be placed.
+     * @param option The string containing the full argument specified in the command line, i.e.,
+     * the string <code>--results-output-path=...</code>.
+     * @throws CliArgumentException If the specified file path is not valid.
+     */
+    static void parseResultsOutputOption(CliArguments &result, const std::string &option);
+
+    /**
+     * Parses the --linkage-output-path option.
+     *
+     * @param result Container where the parsed arguments will be placed.
+     * @param option The string containing the full argument specified in the command line, i.e.,
+     * the string <code>--linkage-output-path=...</code>.
+     * @throws CliArgumentException If the specified file path is not valid.
+     */
+    static void parseLinkageOutputOption(CliArguments &result, const std::string &option);
+
+    /**
+     * Parses the --checkpoint-path option.
+     *
+     * @param result Container where the parsed arguments will be placed.
+     * @param option The string containing the full argument specified in the command line, i.e.,
+     * the string <code>--checkpoint-path=...</code>.
+     * @throws CliArgumentException If the specified file path is not valid.
+     */
+    static void parseCheckpointPathOption(CliArguments &result, const std::string &option);
+
+    /**
+     * Parses the --checkpoint-stop option.
+     *
+     * @param result Container where the parsed arguments will be placed.
+     * @param option The string containing the full argument specified in the command line, i.e.,
+     * the string <code>--checkpoint-stop=...</code>.
+     * @throws CliArgumentException If the specified number of data samples is not valid.
+     */
+    static void parseCheckpointStopOption(CliArguments &result, const std::string &option);
+
+    /**
+     * Parses the --metric option.
+     *
+     * @param result Container where the parsed arguments will be placed.
+     * @param option The string containing the full argument specified in the command line, i.e.,
+     * the string <code>--metric=...</code>.
+     * @throws CliArgumentException If the specified metric is not known.
+     */
+    static void parseMetricOption(CliArguments &result, const std::string &option);
+
+    /**
+     * Parses the --distance-matrix-path option.
+     *
+     * @param result Container where the parsed arguments will be placed.
+     * @param option The string containing the full argument specified in the command line, i.e.,
+     * the string <code>--distance-matrix-path=...</code>.
+     * @throws CliArgumentException If the specified file path is not valid.
+     */
+    static void parseDistanceMatrixPathOption(CliArguments &result, const std::string &option);
+
+    /**
+     * Parses the --distance-matrix-output-path option.
+     *
+     * @param result Container where the parsed arguments will be placed.
+     * @param option The string containing the full argument specified in the command line, i.e.,
+     * the string <code>--distance-matrix-output-path=...</code>.
+     * @throws CliArgumentException If the specified file path is not valid.
+     */
+    static void parseDistanceMatrixOutputOption(CliArguments &result, const std::string &option);
+
+    /**
+     * Parses the --out-of-core option.
+     *
+     * @param result Container where the parsed arguments will be placed.
+     * @param option The string containing the full argument specified in the command line, i.e.,
+     * the string <code>--out-of-core=...</code>.
+     * @throws CliArgumentException If the specified size is not valid.
+     */
+    static void parseOutOfCoreOption(CliArguments &result, const std::string &option);
+
+    /**
+     * Parses the --compact-pi option.
+     *
+     * @param result Container where the parsed arguments will be placed.
+     */
+    static void parseCompactPiOption(CliArguments &result);
+
     /**
      * Parses the version of the clustering algorithm to invoke. This method is called for both the
      * -p and -s option.
@@ -150,6 +318,30 @@ private:
      */
     static void parseTestResultsPath(CliArguments &result, const std::string &option);
 
+    /**
+     * Parses the --test-cuts option.
+     *
+     * @param result Container where the parsed arguments will be placed.
+     * @param option The string containing the full argument specified in the command line, i.e.,
+     * the string <code>--test-cuts=...</code>.
+     * @throws CliArgumentException If the specified number of cuts is not valid.
+     */
+    static void parseTestCutsOption(CliArguments &result, const std::string &option);
+
+    /**
+     * Parses the --test-cophenetic option.
+     *
+     * @param result Container where the parsed arguments will be placed.
+     */
+    static void parseTestCopheneticOption(CliArguments &result);
+
+    /**
+     * Parses the --test-incremental option.
+     *
+     * @param result Container where the parsed arguments will be placed.
+     */
+    static void parseTestIncrementalOption(CliArguments &result);
+
     /**
      * Parses the input file path.
      *
@@ -0,0 +1,258 @@
+/*
+ * BinaryDataset implementation.
+ *
+ * @author DeB
+ * @author Jonathan
+ * @version 1.2 2022-10-16
+ * @since 1.0
+ */
+#include "BinaryDataset.h"
+#include "MalformedFileException.h"
+#include "NpyFormat.h"
+#include <cstring>
+#include <fstream>
+#include <string>
+#include <string_view>
+#include <vector>
+
+namespace cluster::test::data {
+
+/**
+ * Maps the specified binary dataset file in memory and checks its header.
+ *
+ * @param inputFilePath Path of the binary dataset file.
+ * @throws IOException If an I/O error occurs while reading the file.
+ * @throws MalformedFileException If the file is not a valid binary dataset file.
+ */
+BinaryDataset::BinaryDataset(const std::filesystem::path &inputFilePath) :
+    file(inputFilePath, true),
+    header(),
+    dataOffset(DATA_OFFSET) {
+
+    using namespace std::literals::string_literals;
+    const char *const fileBegin = this->file.begin();
+    const char *const fileEnd = this->file.end();
+
+    // Read the array stored in the NumPy formats, if any
+    if (NpyFormat::isArray(fileBegin, fileEnd)) {
+        this->readArray(0, this->file.size(), inputFilePath);
+        return;
+    }
+    if (NpyFormat::isArchive(fileBegin, fileEnd)) {
+        // Use the first array of the archive
+        for (const NpyFormat::ArchiveMember &member :
+             NpyFormat::listArchiveMembers(fileBegin, fileEnd, inputFilePath)) {
+            if (member.name.ends_with(".npy")) {
+                if (!member.stored) {
+                    throw MalformedFileException("The file"s + ' ' + inputFilePath.string() +
+                                                 " is a compressed .npz archive, which is not"
+                                                 " supported");
+                }
+                this->readArray(member.offset, member.size, inputFilePath);
+                return;
+            }
+        }
+        throw MalformedFileException("The file"s + ' ' + inputFilePath.string() +
+                                     " does not contain any .npy array");
+    }
+
+    // Read the header
+    if (this->file.size() < DATA_OFFSET) {
+        throw MalformedFileException("The file"s + ' ' + inputFilePath.string() +
+                                     " is not a valid binary dataset file");
+    }
+    std::memcpy(&(this->header), this->file.begin(), sizeof(Header));
+
+    // Check the header
+    const std::size_t attributeSize =
+            (this->header.type == Types::FLOAT) ? sizeof(float) : sizeof(double);
+    if (this->header.magicNumber != MAGIC_NUMBER ||
+        this->header.formatVersion != FORMAT_VERSION ||
+        (this->header.type != Types::DOUBLE && this->header.type != Types::FLOAT) ||
+        this->header.stride < this->header.dimension || this->header.alignment == 0 ||
+        this->header.alignment > DATA_OFFSET ||
+        (this->header.alignment & (this->header.alignment - 1)) != 0 ||
+        (this->header.stride * attributeSize) % this->header.alignment != 0) {
+        throw MalformedFileException("The file"s + ' ' + inputFilePath.string() +
+                                     " is not a valid binary dataset file");
+    }
+    if (this->file.size() !=
+        DATA_OFFSET + this->header.dataSamplesCount * this->header.stride * attributeSize) {
+        throw MalformedFileException("The binary dataset file"s + ' ' + inputFilePath.string() +
+                                     " has a size that does not match its header");
+    }
+}
+
+/**
+ * Checks whether the specified file is a binary dataset file, by looking at its magic number.
+ *
+ * @param inputFilePath Path of the file to check.
+ * @return <code>true</code> if the file starts with the magic number of the binary datasets, or
+ * with the one of the <code>.npy</code> or <code>.npz</code> formats, <code>false</code> otherwise.
+ */
+bool BinaryDataset::isBinaryDataset(const std::filesystem::path &inputFilePath) {
+
+    std::ifstream file{inputFilePath, std::ios::binary};
+    std::array<char, MAGIC_NUMBER.size()> magicNumber{};
+    file.read(magicNumber.data(), magicNumber.size());
+    const char *const magicNumberEnd = magicNumber.data() + file.gcount();
+
+    return (file && magicNumber == MAGIC_NUMBER) ||
+           NpyFormat::isArray(magicNumber.data(), magicNumberEnd) ||
+           NpyFormat::isArchive(magicNumber.data(), magicNumberEnd);
+}
+
+/**
+ * Returns the number of data samples contained in the file.
+ *
+ * @return The number of data samples contained in the file.
+ */
+std::size_t BinaryDataset::getDataSamplesCount() const noexcept {
+
+    return this->header.dataSamplesCount;
+}
+
+/**
+ * Returns the dimension of each data sample.
+ *
+ * @return The dimension of each data sample.
+ */
+std::size_t BinaryDataset::getDimension() const noexcept {
+
+    return this->header.dimension;
+}
+
+/**
+ * Returns the number of attributes between the first attribute of a data sample and the first
+ * attribute of the following one.
+ *
+ * @return The stride of the data samples.
+ */
+std::size_t BinaryDataset::getStride() const noexcept {
+
+    return this->header.stride;
+}
+
+/**
+ * Returns the alignment, in bytes, of every data sample.
+ *
+ * @return The alignment of every data sample.
+ */
+std::size_t BinaryDataset::getAlignment() const noexcept {
+
+    return this->header.alignment;
+}
+
+/**
+ * Returns the offset, in bytes, of the first attribute of the first data sample from the beginning
+ * of the file.
+ *
+ * @return The offset of the first data sample.
+ */
+std::size_t BinaryDataset::getDataOffset() const noexcept {
+
+    return this->dataOffset;
+}
+
+/**
+ * Returns the type of the attributes of the data samples.
+ *
+ * @return The type of the attributes of the data samples.
+ */
+BinaryDataset::Types BinaryDataset::getType() const noexcept {
+
+    return this->header.type;
+}
+
+/**
+ * Copies the data samples into the specified buffer, converting their attributes to
+ * <code>double</code> if needed.
+ *
+ * @param buffer Buffer where the data samples will be placed.
+ * @param stride Number of values between the first coordinate of a data sample and the first
+ * coordinate of the following one.
+ */
+void BinaryDataset::copyInto(double *const buffer, const std::size_t stride) const {
+
+    const std::size_t dimension = this->header.dimension;
+    const char *const dataBegin = this->file.begin() + this->dataOffset;
+    for (std::size_t i = 0; i < this->header.dataSamplesCount; i++) {
+        double *const dataSample = &(buffer[i * stride]);
+        if (this->header.type == Types::DOUBLE) {
+            std::memcpy(dataSample,
+                        dataBegin + i * this->header.stride * sizeof(double),
+                        dimension * sizeof(double));
+        } else {
+            // The attributes may be misaligned in a .npz archive, so they are copied bytewise
+            const char *const source = dataBegin + i * this->header.stride * sizeof(float);
+            for (std::size_t j = 0; j < dimension; j++) {
+                float attribute{};
+                std::memcpy(&attribute, source + j * sizeof(float), sizeof(float));
+                dataSample[j] = attribute;
+            }
+        }
+        // Fill the remaining coordinates with 0
+        std::memset(&(dataSample[dimension]), 0, (stride - dimension) * sizeof(double));
+    }
+}
+
+/**
+ * Reads the description of the array stored in the <code>.npy</code> format at the specified
+ * position of the file, filling the header accordingly.
+ *
+ * @param arrayOffset Offset, in bytes, of the <code>.npy</code> file from the beginning of the
+ * mapped file.
+ * @param arraySize Size, in bytes, of the <code>.npy</code> file.
+ * @param inputFilePath Path of the file, used only to report errors.
+ * @throws MalformedFileException If the array is not a valid dataset.
+ */
+void BinaryDataset::readArray(const std::size_t arrayOffset,
+                              const std::size_t arraySize,
+                              const std::filesystem::path &inputFilePath) {
+
+    using namespace std::literals::string_literals;
+    const char *const arrayBegin = this->file.begin() + arrayOffset;
+    const NpyFormat::ArrayHeader arrayHeader =
+            NpyFormat::parseArrayHeader(arrayBegin, arrayBegin + arraySize, inputFilePath);
+
+    // Check the type, the order and the shape of the array
+    const std::string_view byteOrder = arrayHeader.type.substr(0, 1);
+    const std::string_view type = std::string_view{arrayHeader.type}.substr(1);
+    if ((byteOrder != "<" && byteOrder != "=") || (type != "f8" && type != "f4")) {
+        throw MalformedFileException("The file"s + ' ' + inputFilePath.string() +
+                                     " contains an array of type " + arrayHeader.type +
+                                     ", while only little-endian float64 and float32 arrays are"
+                                     " supported");
+    }
+    const std::vector<std::size_t> &shape = arrayHeader.shape;
+    if (shape.empty() || shape.size() > 2) {
+        throw MalformedFileException("The file"s + ' ' + inputFilePath.string() +
+                                     " contains an array that is not one or two dimensional");
+    }
+    const std::size_t dimension = (shape.size() == 2) ? shape[1] : 1;
+    if (arrayHeader.fortranOrder && shape.size() == 2 && shape[0] > 1 && dimension > 1) {
+        throw MalformedFileException("The file"s + ' ' + inputFilePath.string() +
+                                     " contains an array in column-major order, which is not"
+                                     " supported");
+    }
+
+    // Describe the data samples, which are not padded
+    this->header.type = (type == "f8") ? Types::DOUBLE : Types::FLOAT;
+    this->header.dataSamplesCount = shape[0];
+    this->header.dimension = dimension;
+    this->header.stride = dimension;
+    this->dataOffset = arrayOffset + arrayHeader.dataOffset;
+
+    // Every data sample is aligned to the largest power of two that divides both the offset of the
+    // first data sample and the size of a data sample, since the file is mapped at the beginning
+    // of a page
+    const std::size_t attributeSize =
+            (this->header.type == Types::FLOAT) ? sizeof(float) : sizeof(double);
+    std::size_t alignment = DATA_OFFSET;
+    while (this->dataOffset % alignment != 0 ||
+           (dimension > 0 && (dimension * attributeSize) % alignment != 0)) {
+        alignment /= 2;
+    }
+    this->header.alignment = alignment;
+}
+}  // namespace cluster::test::data
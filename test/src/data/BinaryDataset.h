@@ -0,0 +1,207 @@
+#ifndef FINAL_PROJECT_HPC_BINARYDATASET_H
+#define FINAL_PROJECT_HPC_BINARYDATASET_H
+
+#include "MappedFile.h"
+#include <array>
+#include <cstddef>
+#include <cstdint>
+#include <filesystem>
+#include <stdexcept>
+#include <type_traits>
+
+namespace cluster::test::data {
+/**
+ * Dataset stored in the native binary format, mapped in memory.<br>
+ * The file is made of a header, holding a magic number, the version of the format, the type of
+ * the attributes, the number of data samples, their dimension, the stride and the alignment,
+ * followed by the data samples. The data samples are stored one after the other, each one padded
+ * with zeros up to the stride, exactly as the clustering algorithm reads them. Since the data
+ * samples start at an offset that is a multiple of the maximum supported alignment, and the file
+ * is mapped at the beginning of a page, the mapped data samples can be given to the clustering
+ * algorithm directly, without copying them. All the values are stored in the native byte order.<br>
+ * Arrays in the NumPy <code>.npy</code> format, and the first array of archives in the NumPy
+ * <code>.npz</code> format whose members are stored without compression, are accepted as well.
+ * The array must have little-endian <code>float64</code> or <code>float32</code> values in
+ * row-major order, and either two dimensions, i.e., one row per data sample, or one dimension, i.e.,
+ * one attribute per data sample. Such data samples are never padded, and their alignment depends
+ * on where the values start in the file.
+ *
+ * @author DeB
+ * @author Jonathan
+ * @version 1.2 2022-10-16
+ * @since 1.0
+ */
+class BinaryDataset {
+
+public:
+    /**
+     * Type of the attributes of the data samples.
+     */
+    enum class Types : std::uint32_t { DOUBLE = 0, FLOAT = 1 };
+
+    /**
+     * Header of the file.
+     */
+    struct Header {
+        std::array<char, 8> magicNumber;
+        std::uint32_t formatVersion;
+        Types type;
+        std::uint64_t dataSamplesCount;
+        std::uint64_t dimension;
+        std::uint64_t stride;
+        std::uint64_t alignment;
+    };
+
+    /**
+     * Magic number identifying a binary dataset file.
+     */
+    static const constexpr std::array<char, 8> MAGIC_NUMBER{'S', 'L', 'N', 'K', 'D', 'A', 'T', 'A'};
+
+    /**
+     * Version of the format of the file.
+     */
+    static const constexpr std::uint32_t FORMAT_VERSION = 1;
+
+    /**
+     * Offset, in bytes, of the first data sample from the beginning of the file. It is also the
+     * maximum alignment, in bytes, the data samples can have.
+     */
+    static const constexpr std::size_t DATA_OFFSET = 64;
+
+    /**
+     * Maps the specified binary dataset file in memory and checks its header.<br>
+     * The file is mapped privately, so that the data samples can be handed to the clustering
+     * algorithm as non-constant pointers, but any change is never written back to the file.
+     *
+     * @param inputFilePath Path of the binary dataset file.
+     * @throws IOException If an I/O error occurs while reading the file.
+     * @throws MalformedFileException If the file is not a valid binary dataset file, or a valid
+     * <code>.npy</code> or <code>.npz</code> file with a supported array.
+     */
+    explicit BinaryDataset(const std::filesystem::path &inputFilePath);
+
+    /**
+     * Checks whether the specified file is a binary dataset file, by looking at its magic number.
+     *
+     * @param inputFilePath Path of the file to check.
+     * @return <code>true</code> if the file starts with the magic number of the binary datasets,
+     * or with the one of the <code>.npy</code> or <code>.npz</code> formats, <code>false</code>
+     * otherwise, including when the file cannot be read.
+     */
+    static bool isBinaryDataset(const std::filesystem::path &inputFilePath);
+
+    /**
+     * Returns the number of data samples contained in the file.
+     *
+     * @return The number of data samples contained in the file.
+     */
+    std::size_t getDataSamplesCount() const noexcept;
+
+    /**
+     * Returns the dimension of each data sample.
+     *
+     * @return The dimension of each data sample.
+     */
+    std::size_t getDimension() const noexcept;
+
+    /**
+     * Returns the number of attributes between the first attribute of a data sample and the first
+     * attribute of the following one.
+     *
+     * @return The stride of the data samples.
+     */
+    std::size_t getStride() const noexcept;
+
+    /**
+     * Returns the alignment, in bytes, of every data sample.
+     *
+     * @return The alignment of every data sample.
+     */
+    std::size_t getAlignment() const noexcept;
+
+    /**
+     * Returns the offset, in bytes, of the first attribute of the first data sample from the
+     * beginning of the file.
+     *
+     * @return The offset of the first data sample.
+     */
+    std::size_t getDataOffset() const noexcept;
+
+    /**
+     * Returns the type of the attributes of the data samples.
+     *
+     * @return The type of the attributes of the data samples.
+     */
+    Types getType() const noexcept;
+
+    /**
+     * Returns a pointer to the first attribute of the first data sample, stored in the mapped file.
+     * <br>
+     * The pointer is aligned only to <code>getAlignment()</code> bytes, which, for a
+     * <code>.npz</code> archive, can be smaller than the size of <code>S</code>.
+     *
+     * @tparam S Type of the attributes of the data samples. It <b>MUST BE</b> the type stored in
+     * the file.
+     * @return A pointer to the first attribute of the first data sample.
+     * @throws std::invalid_argument If the file does not store attributes of type <code>S</code>.
+     */
+    template <typename S>
+    S *getData() {
+
+        static_assert(std::is_same_v<S, double> || std::is_same_v<S, float>,
+                      "The attributes of the data samples must be either doubles or floats.");
+
+        if (this->header.type != (std::is_same_v<S, double> ? Types::DOUBLE : Types::FLOAT)) {
+            throw std::invalid_argument("The binary dataset stores attributes of a different type");
+        }
+        // The data samples are aligned, since they start at a multiple of the alignment
+        return static_cast<S *>(static_cast<void *>(this->file.begin() + this->dataOffset));
+    }
+
+    /**
+     * Copies the data samples into the specified buffer, converting their attributes to
+     * <code>double</code> if needed.<br>
+     * The data sample <code>i</code> is placed starting from <code>buffer + i * stride</code>, and
+     * the coordinates between its last one and the first one of the following data sample are
+     * set to <code>0</code>.
+     *
+     * @param buffer Buffer where the data samples will be placed. It <b>MUST BE</b> large enough
+     * to hold <code>getDataSamplesCount() * stride</code> values.
+     * @param stride Number of values between the first coordinate of a data sample and the first
+     * coordinate of the following one. It <b>MUST BE</b> greater than or equal to
+     * <code>getDimension()</code>.
+     */
+    void copyInto(double *buffer, std::size_t stride) const;
+
+private:
+    /**
+     * Content of the file.
+     */
+    MappedFile file;
+
+    /**
+     * Header of the file, describing the data samples also when the file is in the NumPy formats.
+     */
+    Header header;
+
+    /**
+     * Offset, in bytes, of the first data sample from the beginning of the file.
+     */
+    std::size_t dataOffset;
+
+    /**
+     * Reads the description of the array stored in the <code>.npy</code> format at the specified
+     * position of the file, filling the header accordingly.
+     *
+     * @param arrayOffset Offset, in bytes, of the <code>.npy</code> file from the beginning of the
+     * mapped file.
+     * @param arraySize Size, in bytes, of the <code>.npy</code> file.
+     * @param inputFilePath Path of the file, used only to report errors.
+     * @throws MalformedFileException If the array is not a valid dataset.
+     */
+    void readArray(std::size_t arrayOffset,
+                   std::size_t arraySize,
+                   const std::filesystem::path &inputFilePath);
+};
+}  // namespace cluster::test::data
+#endif  // FINAL_PROJECT_HPC_BINARYDATASET_H
@@ -3,17 +3,26 @@
  *
  * @author DeB
  * @author Jonathan
- * @version 1.2.1 2022-08-22
+ * @version 1.4 2022-10-03
  * @since 1.0
  */
 #include "DataReader.h"
 #include "IoException.h"
 #include "MalformedFileException.h"
+#include "MappedFile.h"
+#include "NpyFormat.h"
+#include <algorithm>
+#include <charconv>
+#include <cstring>
 #include <fstream>
+#include <sstream>
 
 namespace cluster::test::data {
 /**
- * Reads and parses the data from the specified file.
+ * Reads and parses the data from the specified file.<br>
+ * The file is mapped in memory and parsed in place, without copying its lines, and the values are
+ * converted using <code>std::from_chars</code>. Once the first line has been parsed, the space
+ * needed by all the remaining lines is reserved in advance.
  *
  * @param inputFilePath Path of the file that contains the data to parse.
  * @param firstLineNumber Number of the first line to parse of the file.
@@ -49,63 +58,76 @@ std::size_t DataReader::readAndParseData(const std::filesystem::path &inputFileP
         throw std::invalid_argument("The file '"s + inputFilePath.string() + "' does not exist.");
     }
 
-    // Open the input file
-    std::ifstream file{inputFilePath};
-    if (file) {
-        // Number of the line being parsed
-        std::size_t lineNumber = 1;
-        // Read all the content of the file
-        while (file) {
-            // Read the next line of the file
-            std::string line{};
-            std::getline(file, line);
-            if (file.good() || file.eof()) {
-                // Skip lines outside the range and empty lines
-                if (!line.empty() &&
-                    (firstLineNumber == 0 || lastLineNumber == 0 ||
-                     (lineNumber >= firstLineNumber && lineNumber <= lastLineNumber))) {
-
-                    // Parse the line
-                    std::stringstream lineValuesStream{line};
-                    std::string columnString{};
-                    std::size_t columnNumber = 1;
-                    std::size_t lineDimension = 0;
-                    while (std::getline(lineValuesStream, columnString, ',') &&
-                           (lastColumnNumber == 0 || columnNumber <= lastColumnNumber)) {
-                        if (firstColumnNumber == 0 || columnNumber >= firstColumnNumber) {
-                            // Add the parsed coordinate
-                            parsedData.push_back(
-                                    parseDouble(columnString, lineNumber, columnNumber));
-                            lineDimension++;
-                        }
-                        columnNumber++;
-                    }
-                    // Check if all the dimensions has been filled
-                    if (!firstLine) {
-                        if (lineDimension != dimension) {
-                            using namespace std::literals::string_literals;
-                            throw MalformedFileException(
-                                    "Line"s + ' ' + std::to_string(lineNumber) + " contains " +
-                                    std::to_string(lineDimension) +
-                                    " coordinates, but the first line contains" + ' ' +
-                                    std::to_string(dimension) + " coordinates");
-                        }
-                    } else {
-                        firstLine = false;
-                        dimension = lineDimension;
-                    }
-
-                    // Pass to the next line
-                    lineNumber++;
+    // Map the input file
+    const MappedFile file{inputFilePath};
+    const char *const fileEnd = file.end();
+
+    // Number of the line being parsed
+    std::size_t lineNumber = 1;
+    // Parse all the lines of the file, up to the last requested one
+    const char *lineBegin = file.begin();
+    while (lineBegin != fileEnd && (lastLineNumber == 0 || lineNumber <= lastLineNumber)) {
+        // Find the end of the line
+        const auto *lineEnd = static_cast<const char *>(
+                std::memchr(lineBegin, '\n', static_cast<std::size_t>(fileEnd - lineBegin)));
+        if (lineEnd == nullptr) {
+            lineEnd = fileEnd;
+        }
+        // Ignore the carriage return of files with Windows line endings
+        const char *const contentEnd =
+                (lineEnd != lineBegin && *(lineEnd - 1) == '\r') ? lineEnd - 1 : lineEnd;
+
+        // Skip lines outside the range and empty lines
+        if (contentEnd != lineBegin && (firstLineNumber == 0 || lineNumber >= firstLineNumber)) {
+            // Parse the line
+            const char *columnBegin = lineBegin;
+            std::size_t columnNumber = 1;
+            std::size_t lineDimension = 0;
+            while (columnBegin != nullptr &&
+                   (lastColumnNumber == 0 || columnNumber <= lastColumnNumber)) {
+                // Find the end of the column
+                const auto *columnEnd = static_cast<const char *>(std::memchr(
+                        columnBegin, ',', static_cast<std::size_t>(contentEnd - columnBegin)));
+                if (firstColumnNumber == 0 || columnNumber >= firstColumnNumber) {
+                    // Add the parsed coordinate
+                    parsedData.push_back(
+                            parseDouble(columnBegin,
+                                        (columnEnd == nullptr) ? contentEnd : columnEnd,
+                                        lineNumber,
+                                        columnNumber));
+                    lineDimension++;
+                }
+                columnBegin = (columnEnd == nullptr) ? nullptr : columnEnd + 1;
+                columnNumber++;
+            }
+            // Check if all the dimensions has been filled
+            if (!firstLine) {
+                if (lineDimension != dimension) {
+                    using namespace std::literals::string_literals;
+                    throw MalformedFileException("Line"s + ' ' + std::to_string(lineNumber) +
+                                                 " contains " + std::to_string(lineDimension) +
+                                                 " coordinates, but the first line contains" +
+                                                 ' ' + std::to_string(dimension) +
+                                                 " coordinates");
                 }
             } else {
-                using namespace std::literals::string_literals;
-                throw IOException("Error while reading the file"s + ' ' + inputFilePath.string());
+                firstLine = false;
+                dimension = lineDimension;
+
+                // Reserve the space for all the remaining lines, so that the data are never moved
+                const auto remainingLinesCount =
+                        static_cast<std::size_t>(std::count(lineEnd, fileEnd, '\n')) + 1;
+                const std::size_t requestedLinesCount =
+                        (lastLineNumber == 0) ? remainingLinesCount
+                                              : std::min(remainingLinesCount,
+                                                         lastLineNumber - lineNumber + 1);
+                parsedData.reserve(requestedLinesCount * dimension);
             }
         }
-    } else {
-        using namespace std::literals::string_literals;
-        throw IOException("Error while reading the file"s + ' ' + inputFilePath.string());
+
+        // Pass to the next line
+        lineNumber++;
+        lineBegin = (lineEnd == fileEnd) ? fileEnd : lineEnd + 1;
     }
 
     // Return the dimension
@@ -134,6 +156,12 @@ void DataReader::readPiLambda(const std::filesystem::path &inputFilePath,
         throw std::invalid_argument("The file '"s + inputFilePath.string() + "' does not exist.");
     }
 
+    // Read a NumPy archive, if requested
+    if (inputFilePath.extension() == ".npz") {
+        DataReader::readPiLambdaArchive(inputFilePath, piVector, lambdaVector);
+        return;
+    }
+
     // Open the input file
     std::ifstream file{inputFilePath};
     if (file) {
@@ -215,6 +243,53 @@ double DataReader::parseDouble(
     return value;
 }
 
+/**
+ * Extracts a <code>double</code> value from the specified range of characters. Spaces and
+ * tabulations surrounding the value, as well as a leading plus sign, are ignored.
+ *
+ * @param begin Pointer to the first character of the range.
+ * @param end Pointer to the character following the last one of the range.
+ * @param lineNumber Number of the line that contains the range to parse.
+ * @param columnNumber Number of the column that contains the range to parse.
+ * @return The extracted value.
+ * @throws MalformedFileException If some errors occur while parsing the range.
+ */
+double DataReader::parseDouble(const char *begin,
+                               const char *end,
+                               const std::size_t lineNumber,
+                               const std::size_t columnNumber) {
+
+    // Skip the surrounding blanks
+    const char *const originalBegin = begin;
+    const char *const originalEnd = end;
+    while (begin != end && (*begin == ' ' || *begin == '\t')) {
+        ++begin;
+    }
+    while (end != begin && (*(end - 1) == ' ' || *(end - 1) == '\t')) {
+        --end;
+    }
+    // Skip the plus sign, that std::from_chars does not accept
+    if (begin != end && *begin == '+') {
+        ++begin;
+    }
+
+    // Parse the value
+    double value = 0;
+    const auto [firstNonParsedCharacter, error] = std::from_chars(begin, end, value);
+
+    // Check the validity
+    if (error != std::errc{} || firstNonParsedCharacter != end || begin == end) {
+        using namespace std::literals::string_literals;
+        throw MalformedFileException(
+                "Line"s + ' ' + std::to_string(lineNumber) + " contains the invalid value '" +
+                std::string{originalBegin, originalEnd} + "' at column " +
+                std::to_string(columnNumber) +
+                ((error == std::errc::result_out_of_range) ? ": value out of range" : ""));
+    }
+
+    return value;
+}
+
 /**
  * Extracts a <code>std::size_t</code> value from the specified string.
  *
@@ -253,4 +328,68 @@ std::size_t DataReader::parseSizeT(
 
     return value;
 }
+
+/**
+ * Reads the values of pi and lambda from the specified NumPy <code>.npz</code> archive.
+ *
+ * @param inputFilePath Path of the archive to read the information from.
+ * @param piVector Vector where the read values of pi will be put.
+ * @param lambdaVector Vector where the read values of lambda will be put.
+ * @throws MalformedFileException If the archive does not follow the correct format.
+ * @throws IOException If an I/O error occurs while reading the file.
+ */
+void DataReader::readPiLambdaArchive(const std::filesystem::path &inputFilePath,
+                                     std::vector<std::size_t> &piVector,
+                                     std::vector<double> &lambdaVector) {
+
+    using namespace std::literals::string_literals;
+
+    // Map the archive and find the arrays
+    const MappedFile file{inputFilePath};
+    std::size_t piOffset = 0;
+    std::size_t piSize = 0;
+    std::size_t lambdaOffset = 0;
+    std::size_t lambdaSize = 0;
+    for (const NpyFormat::ArchiveMember &member :
+         NpyFormat::listArchiveMembers(file.begin(), file.end(), inputFilePath)) {
+        if ((member.name == "pi.npy" || member.name == "lambda.npy") && !member.stored) {
+            throw MalformedFileException("The file"s + ' ' + inputFilePath.string() +
+                                         " is a compressed .npz archive, which is not supported");
+        }
+        if (member.name == "pi.npy") {
+            piOffset = member.offset;
+            piSize = member.size;
+        } else if (member.name == "lambda.npy") {
+            lambdaOffset = member.offset;
+            lambdaSize = member.size;
+        }
+    }
+    if (piSize == 0 || lambdaSize == 0) {
+        throw MalformedFileException("The file"s + ' ' + inputFilePath.string() +
+                                     " does not contain both the pi and lambda arrays");
+    }
+
+    // Check the arrays
+    const char *const piBegin = file.begin() + piOffset;
+    const char *const lambdaBegin = file.begin() + lambdaOffset;
+    const NpyFormat::ArrayHeader piHeader =
+            NpyFormat::parseArrayHeader(piBegin, piBegin + piSize, inputFilePath);
+    const NpyFormat::ArrayHeader lambdaHeader =
+            NpyFormat::parseArrayHeader(lambdaBegin, lambdaBegin + lambdaSize, inputFilePath);
+    if (piHeader.type != "<u8" || piHeader.shape.size() != 1 || lambdaHeader.type != "<f8" ||
+        lambdaHeader.shape.size() != 1 || piHeader.shape[0] != lambdaHeader.shape[0]) {
+        throw MalformedFileException("The file"s + ' ' + inputFilePath.string() +
+                                     " does not contain valid pi and lambda arrays");
+    }
+
+    // Copy the values, which may be misaligned inside the archive
+    piVector.resize(piHeader.shape[0]);
+    std::memcpy(piVector.data(),
+                piBegin + piHeader.dataOffset,
+                piVector.size() * sizeof(std::size_t));
+    lambdaVector.resize(lambdaHeader.shape[0]);
+    std::memcpy(lambdaVector.data(),
+                lambdaBegin + lambdaHeader.dataOffset,
+                lambdaVector.size() * sizeof(double));
+}
 }  // namespace cluster::test::data
@@ -11,11 +11,14 @@ namespace cluster::test::data {
  *
  * @author DeB
  * @author Jonathan
- * @version 1.2.1 2022-08-22
+ * @version 1.5 2022-10-03
  * @since 1.0
  */
 class DataReader {
 
+    // The parallel reader parses the values in the same way
+    friend class ParallelDataReader;
+
 public:
     /**
      * Reads and parses the data from the specified file.
@@ -55,7 +58,9 @@ public:
                                         std::size_t lastColumnNumber = 0);
 
     /**
-     * Reads from the specified file the values of pi and lambda to use in the tests.
+     * Reads from the specified file the values of pi and lambda to use in the tests.<br>
+     * If the file has the <code>.npz</code> extension, it is read as the NumPy archive written by
+     * <code>DataWriter::writePiLambda</code>.
      *
      * @param inputFilePath Path to read the information from.
      * @param piVector Vector where the read values of pi will be put.
@@ -81,6 +86,22 @@ private:
     static double parseDouble(
             const std::string &string, std::size_t lineNumber, std::size_t columnNumber);
 
+    /**
+     * Extracts a <code>double</code> value from the specified range of characters. Spaces and
+     * tabulations surrounding the value, as well as a leading plus sign, are ignored.
+     *
+     * @param begin Pointer to the first character of the range.
+     * @param end Pointer to the character following the last one of the range.
+     * @param lineNumber Number of the line that contains the range to parse.
+     * @param columnNumber Number of the column that contains the range to parse.
+     * @return The extracted value.
+     * @throws MalformedFileException If some errors occur while parsing the range.
+     */
+    static double parseDouble(const char *begin,
+                              const char *end,
+                              std::size_t lineNumber,
+                              std::size_t columnNumber);
+
     /**
      * Extracts a <code>std::size_t</code> value from the specified string.
      *
@@ -92,6 +113,21 @@ private:
      */
     static std::size_t parseSizeT(
             const std::string &string, std::size_t lineNumber, std::size_t columnNumber);
+
+    /**
+     * Reads the values of pi and lambda from the specified NumPy <code>.npz</code> archive, which
+     * must contain the <code>pi</code> array, of type <code>uint64</code>, and the
+     * <code>lambda</code> array, of type <code>float64</code>, both stored without compression.
+     *
+     * @param inputFilePath Path of the archive to read the information from.
+     * @param piVector Vector where the read values of pi will be put.
+     * @param lambdaVector Vector where the read values of lambda will be put.
+     * @throws MalformedFileException If the archive does not follow the correct format.
+     * @throws IOException If an I/O error occurs while reading the file.
+     */
+    static void readPiLambdaArchive(const std::filesystem::path &inputFilePath,
+                                    std::vector<std::size_t> &piVector,
+                                    std::vector<double> &lambdaVector);
 };
 }  // namespace cluster::test::data
 #endif  // FINAL_PROJECT_HPC_DATAREADER_H
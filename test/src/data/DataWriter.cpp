@@ -3,14 +3,23 @@
  *
  * @author DeB
  * @author Jonathan
- * @version 1.2 2022-08-22
+ * @version 1.7 2022-10-14
  * @since 1.0
  */
 #include "DataWriter.h"
+#include "BinaryDataset.h"
 #include "IoException.h"
+#include "NpyFormat.h"
 #include <algorithm>
+#include <array>
+#include <charconv>
+#include <cstdint>
+#include <cstring>
 #include <fstream>
 #include <iostream>
+#include <stdexcept>
+#include <string>
+#include <type_traits>
 #include <unordered_map>
 
 namespace cluster::test::data {
@@ -46,44 +55,31 @@ void DataWriter::createVisualizerOutputFile(const std::filesystem::path &outputF
     std::ofstream fileOutputStream{outputFilePath};
     if (fileOutputStream) {
 
-        // Map containing the association between the identifiers of the points and the identifier
-        // of the last printed cluster they belong to.
-        // Initially, every point is associated to itself.
-        std::unordered_map<std::string, std::string> names{};
+        // Text not written to the file yet, which is written in large blocks
+        std::string buffer{};
+        buffer.reserve(WRITE_BUFFER_SIZE + WRITE_BUFFER_SIZE / 4);
 
-        // Number identifying the point
-        std::size_t pointIdentifier = 0;
-
-        // Print the points
+        // Print the points, named after their index
         for (std::size_t i = 0; i < pointsCount; i++) {
             // Print the name
-            const std::string pointName{"P"s + std::to_string(pointIdentifier)};
-            fileOutputStream << pointName << ": \"" << std::to_string(pointIdentifier + 1) << "\" ";
-            // Print the coordinates
+            buffer += 'P';
+            DataWriter::appendNumber(buffer, i);
+            buffer += ": \"";
+            DataWriter::appendNumber(buffer, i + 1);
+            buffer += "\" ";
+            // Print the coordinates, separated by a space
             for (std::size_t j = 0; j < dimension; j++) {
-                // Write the coordinate
-                fileOutputStream << pointCoordinates[i * dimension + j];
-                DataWriter::requireFileGoodness(fileOutputStream, outputFilePath);
-                // Write a comma to separate the coordinates, if it is not the last one
-                if (j == (dimension - 1)) {
-                    fileOutputStream << std::endl;
-                } else {
-                    fileOutputStream << ' ';
-                }
-                DataWriter::requireFileGoodness(fileOutputStream, outputFilePath);
+                DataWriter::appendNumber(buffer, pointCoordinates[i * dimension + j]);
+                buffer += (j == (dimension - 1)) ? '\n' : ' ';
             }
-            // Map the point with itself
-            names[pointName] = std::to_string(pointIdentifier + 1);
-            // Increase the identifier of the points
-            pointIdentifier++;
+            DataWriter::writeBuffer(fileOutputStream, buffer, outputFilePath, WRITE_BUFFER_SIZE);
         }
 
         // Create pi and lambda according to the values of lambda, in increasing order.
         // Instead of sorting the two vectors, we create a vector of indexes, and we sort it using
         // the values of lambda, i.e., if result[i] < result[j] for some i and j, then lambda[i] <
         // lambda[j].
-        std::vector<std::size_t> result{};
-        result.resize(piVector.size());
+        std::vector<std::size_t> result(piVector.size());
         for (std::size_t i = 0; i < piVector.size(); i++) {
             result[i] = i;
         }
@@ -94,49 +90,89 @@ void DataWriter::createVisualizerOutputFile(const std::filesystem::path &outputF
                       return lambdaVector[first] < lambdaVector[second];
                   });
 
-        // Map associating, for each point, the identifier of the last printed cluster it belongs to
-        // and the name of that cluster. Initially, every point is associated to itself
-        std::unordered_map<std::size_t, std::pair<std::string, std::string>> clusters{};
-
-        // Initialize the map
+        // Last printed cluster every point belongs to. The identifiers smaller than the number of
+        // points identify the points themselves, while the greater ones identify the printed
+        // clusters. Initially, every point is associated to itself, and it is named after its
+        // index, starting from 1
+        const std::size_t firstClusterIdentifier = piVector.size();
+        std::vector<VisualizerCluster> clusters{};
+        clusters.reserve(piVector.size());
         for (std::size_t i = 0; i < piVector.size(); i++) {
-            std::string firstPointName = "P" + std::to_string(i);
-            clusters[i] = {firstPointName, names[firstPointName]};
+            VisualizerCluster point{i, {}, 0};
+            char *const nameBegin = point.name.data();
+            const std::to_chars_result nameEnd =
+                    std::to_chars(nameBegin, nameBegin + VISUALIZER_NAME_LENGTH, i + 1);
+            point.nameLength = (nameEnd.ec == std::errc{})
+                                       ? static_cast<std::size_t>(nameEnd.ptr - nameBegin)
+                                       : 0;
+            clusters.push_back(point);
         }
+        // Appends the name of the point or of the cluster with the specified identifier
+        auto appendIdentifier = [firstClusterIdentifier](std::string &text,
+                                                         const std::size_t identifier) {
+            if (identifier < firstClusterIdentifier) {
+                text += 'P';
+                DataWriter::appendNumber(text, identifier);
+            } else {
+                text += 'C';
+                DataWriter::appendNumber(text, identifier - firstClusterIdentifier);
+            }
+        };
 
         // Identifier of the cluster
         std::size_t clusterIdentifier = 0;
 
         for (const auto index : result) {
             if (index != piVector[index]) {
-                // Compose the identifier of the cluster
-                const std::string clusterName{"C"s + std::to_string(clusterIdentifier)};
                 // Extract the two sub-clusters
-                const auto &[firstClusterIndex, firstName] = clusters[index];
-                const auto &[secondClusterIndex, secondName] = clusters[piVector[index]];
-
-                // Compose the name of the cluster
-                std::string fullClusterName = firstName;
-                fullClusterName += secondName;
-                // Truncate it at 10 characters
-                if (fullClusterName.length() > 10) {
-                    fullClusterName = fullClusterName.substr(0, 7) + "...";
+                const VisualizerCluster &firstCluster = clusters[index];
+                const VisualizerCluster &secondCluster = clusters[piVector[index]];
+
+                // Compose the name of the cluster by concatenating the two names, and truncate it
+                // to 7 characters followed by an ellipsis if it is longer than 10 characters
+                VisualizerCluster cluster{firstClusterIdentifier + clusterIdentifier, {}, 0};
+                const std::size_t fullNameLength =
+                        firstCluster.nameLength + secondCluster.nameLength;
+                const std::size_t keptLength = (fullNameLength > VISUALIZER_NAME_LENGTH)
+                                                       ? VISUALIZER_NAME_LENGTH - 3
+                                                       : fullNameLength;
+                const std::size_t firstLength = std::min(firstCluster.nameLength, keptLength);
+                std::copy_n(firstCluster.name.cbegin(), firstLength, cluster.name.begin());
+                std::copy_n(secondCluster.name.cbegin(),
+                            keptLength - firstLength,
+                            cluster.name.begin() + static_cast<std::ptrdiff_t>(firstLength));
+                cluster.nameLength = keptLength;
+                if (keptLength != fullNameLength) {
+                    std::fill_n(cluster.name.begin() + static_cast<std::ptrdiff_t>(keptLength),
+                                3,
+                                '.');
+                    cluster.nameLength = VISUALIZER_NAME_LENGTH;
                 }
 
                 // Output the row
-                fileOutputStream << clusterName << ": \"" << fullClusterName << "\" "
-                                 << firstClusterIndex << ' ' << secondClusterIndex << ' '
-                                 << lambdaVector[index] << '\n';
-                DataWriter::requireFileGoodness(fileOutputStream, outputFilePath);
+                buffer += 'C';
+                DataWriter::appendNumber(buffer, clusterIdentifier);
+                buffer += ": \"";
+                buffer.append(cluster.name.data(), cluster.nameLength);
+                buffer += "\" ";
+                appendIdentifier(buffer, firstCluster.identifier);
+                buffer += ' ';
+                appendIdentifier(buffer, secondCluster.identifier);
+                buffer += ' ';
+                DataWriter::appendNumber(buffer, lambdaVector[index]);
+                buffer += '\n';
+                DataWriter::writeBuffer(
+                        fileOutputStream, buffer, outputFilePath, WRITE_BUFFER_SIZE);
 
                 // Update the last printed cluster the points belong to
-                clusters[index] = {clusterName, fullClusterName};
-                clusters[piVector[index]] = {clusterName, fullClusterName};
+                clusters[index] = cluster;
+                clusters[piVector[index]] = cluster;
 
                 // Increase the identifier
                 clusterIdentifier++;
             }
         }
+        DataWriter::writeBuffer(fileOutputStream, buffer, outputFilePath, 0);
     } else {
         using namespace std::literals::string_literals;
         throw IOException("Unable to open output file"s + ' ' + outputFilePath.string() +
@@ -223,6 +259,12 @@ void DataWriter::writePiLambda(const std::filesystem::path &outputFilePath,
                                const std::vector<std::size_t> &piVector,
                                const std::vector<double> &lambdaVector) {
 
+    // Write a NumPy archive, if requested
+    if (outputFilePath.extension() == ".npz") {
+        DataWriter::writePiLambdaArchive(outputFilePath, piVector, lambdaVector);
+        return;
+    }
+
     // Open the file
     std::ofstream fileOutputStream{outputFilePath};
     if (fileOutputStream) {
@@ -261,6 +303,242 @@ void DataWriter::writePiLambda(const std::filesystem::path &outputFilePath,
     }
 }
 
+/**
+ * Writes to the specified file the linkage matrix of the dendrogram.
+ *
+ * @param outputFilePath Path of the file where the linkage matrix will be written to.
+ * @param linkageMatrix Rows of the linkage matrix.
+ * @throws IOException If an I/O error occurs while writing to the file.
+ */
+void DataWriter::writeLinkageMatrix(const std::filesystem::path &outputFilePath,
+                                    const std::vector<parallel::LinkageMatrixRow> &linkageMatrix) {
+
+    using namespace std::literals::string_literals;
+
+    // Open the file
+    std::ofstream fileOutputStream{outputFilePath, std::ios::binary | std::ios::trunc};
+    if (!fileOutputStream) {
+        throw IOException("Unable to open output file"s + ' ' + outputFilePath.string() +
+                          " where the linkage matrix will be stored.");
+    }
+
+    // Write a NumPy array, if requested
+    if (outputFilePath.extension() == ".npy") {
+        const std::string header =
+                NpyFormat::createArrayHeader("<f8", {linkageMatrix.size(), 4});
+        fileOutputStream.write(header.data(), static_cast<std::streamsize>(header.size()));
+        DataWriter::requireFileGoodness(fileOutputStream, outputFilePath);
+        for (const parallel::LinkageMatrixRow &row : linkageMatrix) {
+            const std::array<double, 4> values{static_cast<double>(row.firstCluster),
+                                               static_cast<double>(row.secondCluster),
+                                               row.height,
+                                               static_cast<double>(row.size)};
+            // NOLINTNEXTLINE(cppcoreguidelines-pro-type-reinterpret-cast)
+            fileOutputStream.write(reinterpret_cast<const char *>(values.data()),
+                                   static_cast<std::streamsize>(sizeof(values)));
+            DataWriter::requireFileGoodness(fileOutputStream, outputFilePath);
+        }
+        return;
+    }
+
+    // Write a row per line
+    for (const parallel::LinkageMatrixRow &row : linkageMatrix) {
+        fileOutputStream << row.firstCluster << ',' << row.secondCluster << ',' << row.height
+                         << ',' << row.size << '\n';
+        DataWriter::requireFileGoodness(fileOutputStream, outputFilePath);
+    }
+}
+
+/**
+ * Writes to the specified file the values of pi and lambda as a NumPy <code>.npz</code> archive.
+ *
+ * @param outputFilePath Path of the file where the values of pi and lambda will be written to.
+ * @param piVector Vector containing the values of pi.
+ * @param lambdaVector Vector containing the values of lambda.
+ * @throws IOException If an I/O error occurs while writing to the file.
+ */
+void DataWriter::writePiLambdaArchive(const std::filesystem::path &outputFilePath,
+                                      const std::vector<std::size_t> &piVector,
+                                      const std::vector<double> &lambdaVector) {
+
+    static_assert(sizeof(std::size_t) == sizeof(std::uint64_t),
+                  "The values of pi are written as 64-bit unsigned integers.");
+
+    // Create the arrays, whose values are stored in the native byte order
+    std::string piArray = NpyFormat::createArrayHeader("<u8", {piVector.size()});
+    piArray.append(static_cast<const char *>(static_cast<const void *>(piVector.data())),
+                   piVector.size() * sizeof(std::size_t));
+    std::string lambdaArray = NpyFormat::createArrayHeader("<f8", {lambdaVector.size()});
+    lambdaArray.append(static_cast<const char *>(static_cast<const void *>(lambdaVector.data())),
+                       lambdaVector.size() * sizeof(double));
+
+    // Write the archive
+    NpyFormat::writeArchive(outputFilePath, {"pi.npy", "lambda.npy"}, {piArray, lambdaArray});
+}
+
+/**
+ * Writes the specified data samples to a file in the binary dataset format, so that they can be
+ * loaded by <code>BinaryDataset</code> without parsing them again.
+ *
+ * @param outputFilePath Path of the file where the dataset will be written to.
+ * @param data Pointer to the first attribute of the first data sample to write.
+ * @param dataSamplesCount Number of data samples to write.
+ * @param dimension Number of attributes of each data sample.
+ * @param stride Number of attributes between the first attribute of a data sample and the first
+ * attribute of the following one.
+ * @param alignment Alignment, in bytes, of every data sample in the written file.
+ * @throws IOException If an I/O error occurs while writing to the file.
+ * @throws std::invalid_argument If the specified <code>stride</code> or <code>alignment</code> are
+ * not valid.
+ */
+void DataWriter::createBinaryDatasetFile(const std::filesystem::path &outputFilePath,
+                                         const double *const data,
+                                         const std::size_t dataSamplesCount,
+                                         const std::size_t dimension,
+                                         const std::size_t stride,
+                                         const std::size_t alignment) {
+
+    DataWriter::writeBinaryDataset(
+            outputFilePath, data, dataSamplesCount, dimension, stride, alignment);
+}
+
+/**
+ * Writes the specified data samples, having <code>float</code> attributes, to a file in the
+ * binary dataset format.
+ *
+ * @param outputFilePath Path of the file where the dataset will be written to.
+ * @param data Pointer to the first attribute of the first data sample to write.
+ * @param dataSamplesCount Number of data samples to write.
+ * @param dimension Number of attributes of each data sample.
+ * @param stride Number of attributes between the first attribute of a data sample and the first
+ * attribute of the following one.
+ * @param alignment Alignment, in bytes, of every data sample in the written file.
+ * @throws IOException If an I/O error occurs while writing to the file.
+ * @throws std::invalid_argument If the specified <code>stride</code> or <code>alignment</code> are
+ * not valid.
+ */
+void DataWriter::createBinaryDatasetFile(const std::filesystem::path &outputFilePath,
+                                         const float *const data,
+                                         const std::size_t dataSamplesCount,
+                                         const std::size_t dimension,
+                                         const std::size_t stride,
+                                         const std::size_t alignment) {
+
+    DataWriter::writeBinaryDataset(
+            outputFilePath, data, dataSamplesCount, dimension, stride, alignment);
+}
+
+/**
+ * Writes the specified data samples to a file in the binary dataset format.
+ *
+ * @tparam S Type of the attributes of the data samples.
+ * @param outputFilePath Path of the file where the dataset will be written to.
+ * @param data Pointer to the first attribute of the first data sample to write.
+ * @param dataSamplesCount Number of data samples to write.
+ * @param dimension Number of attributes of each data sample.
+ * @param stride Number of attributes between the first attribute of a data sample and the first
+ * attribute of the following one.
+ * @param alignment Alignment, in bytes, of every data sample in the written file.
+ * @throws IOException If an I/O error occurs while writing to the file.
+ * @throws std::invalid_argument If the specified <code>stride</code> or <code>alignment</code> are
+ * not valid.
+ */
+template <typename S>
+void DataWriter::writeBinaryDataset(const std::filesystem::path &outputFilePath,
+                                    const S *const data,
+                                    const std::size_t dataSamplesCount,
+                                    const std::size_t dimension,
+                                    const std::size_t stride,
+                                    const std::size_t alignment) {
+
+    using namespace std::literals::string_literals;
+
+    // Check the arguments
+    if (stride < dimension || alignment == 0 || alignment > BinaryDataset::DATA_OFFSET ||
+        (alignment & (alignment - 1)) != 0 || (stride * sizeof(S)) % alignment != 0) {
+        throw std::invalid_argument("Invalid stride or alignment of the binary dataset");
+    }
+
+    // Open the file
+    std::ofstream fileOutputStream{outputFilePath, std::ios::binary | std::ios::trunc};
+    if (!fileOutputStream) {
+        throw IOException("Error while opening the file"s + ' ' + outputFilePath.string());
+    }
+
+    // Write the header, padded up to the first data sample
+    const BinaryDataset::Header header{
+            BinaryDataset::MAGIC_NUMBER,
+            BinaryDataset::FORMAT_VERSION,
+            std::is_same_v<S, double> ? BinaryDataset::Types::DOUBLE : BinaryDataset::Types::FLOAT,
+            dataSamplesCount,
+            dimension,
+            stride,
+            alignment};
+    std::array<char, BinaryDataset::DATA_OFFSET> headerBytes{};
+    std::memcpy(headerBytes.data(), &header, sizeof(BinaryDataset::Header));
+    fileOutputStream.write(headerBytes.data(), headerBytes.size());
+    DataWriter::requireFileGoodness(fileOutputStream, outputFilePath);
+
+    // Write the data samples, padded with zeros
+    std::vector<S> dataSample(stride, S{0});
+    for (std::size_t i = 0; i < dataSamplesCount; i++) {
+        std::copy(&(data[i * stride]), &(data[i * stride + dimension]), dataSample.begin());
+        // NOLINTNEXTLINE(cppcoreguidelines-pro-type-reinterpret-cast)
+        fileOutputStream.write(reinterpret_cast<const char *>(dataSample.data()),
+                               static_cast<std::streamsize>(stride * sizeof(S)));
+        DataWriter::requireFileGoodness(fileOutputStream, outputFilePath);
+    }
+}
+
+/**
+ * Appends the specified number to the specified text, formatted as <code>std::ofstream</code>
+ * formats it by default, i.e., with <code>STREAM_PRECISION</code> significant digits if it is a
+ * floating-point number.
+ *
+ * @tparam T Type of the number.
+ * @param text Text where the number will be appended.
+ * @param value Number to append.
+ */
+template <typename T>
+void DataWriter::appendNumber(std::string &text, const T value) {
+
+    std::array<char, NUMBER_MAXIMUM_LENGTH> characters{};
+    std::to_chars_result result{};
+    if constexpr (std::is_floating_point_v<T>) {
+        result = std::to_chars(characters.data(),
+                               characters.data() + characters.size(),
+                               value,
+                               std::chars_format::general,
+                               STREAM_PRECISION);
+    } else {
+        result = std::to_chars(characters.data(), characters.data() + characters.size(), value);
+    }
+    text.append(characters.data(), result.ptr);
+}
+
+/**
+ * Writes the specified buffer to the specified file stream and clears it, if it holds at least the
+ * specified number of characters.
+ *
+ * @param fileStream File stream where the buffer will be written to.
+ * @param buffer Buffer to write.
+ * @param outputFilePath Path of the output file the specified <code>fileStream</code> writes
+ * to.
+ * @param minimumSize Minimum number of characters the buffer must hold to be written.
+ * @throws IOException If an I/O error occurs while writing to the file.
+ */
+void DataWriter::writeBuffer(std::ofstream &fileStream,
+                             std::string &buffer,
+                             const std::filesystem::path &outputFilePath,
+                             const std::size_t minimumSize) {
+
+    if (buffer.size() >= minimumSize) {
+        fileStream.write(buffer.data(), static_cast<std::streamsize>(buffer.size()));
+        DataWriter::requireFileGoodness(fileStream, outputFilePath);
+        buffer.clear();
+    }
+}
+
 /**
  * Requires the specified file stream to be in a good state.
  *
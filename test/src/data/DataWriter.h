@@ -1,7 +1,12 @@
 #ifndef FINAL_PROJECT_HPC_DATAWRITER_H
 #define FINAL_PROJECT_HPC_DATAWRITER_H
 
+#include "LinkageMatrixConverter.h"
+#include <array>
+#include <cstddef>
 #include <filesystem>
+#include <fstream>
+#include <string>
 #include <vector>
 
 namespace cluster::test::data {
@@ -11,7 +16,7 @@ namespace cluster::test::data {
  *
  * @author DeB
  * @author Jonathan
- * @version 1.2 2022-08-22
+ * @version 1.6 2022-10-14
  * @since 1.0
  */
 class DataWriter {
@@ -54,7 +59,11 @@ public:
 
     /**
      * Writes to the specified file the values of pi and lambda, so to retrieve them instead of
-     * re-executing the clustering algorithm.
+     * re-executing the clustering algorithm.<br>
+     * If the file has the <code>.npz</code> extension, the values are written as a NumPy archive
+     * containing the <code>pi</code> array, of type <code>uint64</code>, and the
+     * <code>lambda</code> array, of type <code>float64</code>. Otherwise, they are written as two
+     * lines of comma-separated values.
      *
      * @param outputFilePath Path of the file where the values of pi and lambda will be written to.
      * @param piVector Vector containing the values of pi.
@@ -65,7 +74,183 @@ public:
                               const std::vector<std::size_t> &piVector,
                               const std::vector<double> &lambdaVector);
 
+    /**
+     * Writes to the specified file the linkage matrix of the dendrogram, in the format used by
+     * SciPy.<br>
+     * If the file has the <code>.npy</code> extension, the matrix is written as a NumPy array of
+     * type <code>float64</code> having a row for each merge and 4 columns, i.e., the two merged
+     * clusters, the distance at which they merge and the size of the new cluster. Otherwise, every
+     * row is written as a line of comma-separated values.
+     *
+     * @param outputFilePath Path of the file where the linkage matrix will be written to.
+     * @param linkageMatrix Rows of the linkage matrix.
+     * @throws IOException If an I/O error occurs while writing to the file.
+     */
+    static void writeLinkageMatrix(const std::filesystem::path &outputFilePath,
+                                   const std::vector<parallel::LinkageMatrixRow> &linkageMatrix);
+
+    /**
+     * Writes the specified data samples to a file in the binary dataset format, so that they can be
+     * loaded by <code>BinaryDataset</code> without parsing them again.<br>
+     * The attributes between the last attribute of a data sample and the first attribute of the
+     * following one are written as zeros, whatever their value in <code>data</code>.
+     *
+     * @param outputFilePath Path of the file where the dataset will be written to.
+     * @param data Pointer to the first attribute of the first data sample to write.
+     * @param dataSamplesCount Number of data samples to write.
+     * @param dimension Number of attributes of each data sample.
+     * @param stride Number of attributes between the first attribute of a data sample and the
+     * first attribute of the following one, both in <code>data</code> and in the written file. It
+     * <b>MUST BE</b> greater than or equal to <code>dimension</code>.
+     * @param alignment Alignment, in bytes, of every data sample in the written file. It
+     * <b>MUST BE</b> a power of two, not greater than <code>BinaryDataset::DATA_OFFSET</code>, and
+     * <code>stride</code> attributes must occupy a multiple of it.
+     * @throws IOException If an I/O error occurs while writing to the file.
+     * @throws std::invalid_argument If the specified <code>stride</code> or
+     * <code>alignment</code> are not valid.
+     */
+    static void createBinaryDatasetFile(const std::filesystem::path &outputFilePath,
+                                        const double *data,
+                                        std::size_t dataSamplesCount,
+                                        std::size_t dimension,
+                                        std::size_t stride,
+                                        std::size_t alignment);
+
+    /**
+     * Writes the specified data samples, having <code>float</code> attributes, to a file in the
+     * binary dataset format.
+     *
+     * @param outputFilePath Path of the file where the dataset will be written to.
+     * @param data Pointer to the first attribute of the first data sample to write.
+     * @param dataSamplesCount Number of data samples to write.
+     * @param dimension Number of attributes of each data sample.
+     * @param stride Number of attributes between the first attribute of a data sample and the
+     * first attribute of the following one, both in <code>data</code> and in the written file. It
+     * <b>MUST BE</b> greater than or equal to <code>dimension</code>.
+     * @param alignment Alignment, in bytes, of every data sample in the written file. It
+     * <b>MUST BE</b> a power of two, not greater than <code>BinaryDataset::DATA_OFFSET</code>, and
+     * <code>stride</code> attributes must occupy a multiple of it.
+     * @throws IOException If an I/O error occurs while writing to the file.
+     * @throws std::invalid_argument If the specified <code>stride</code> or
+     * <code>alignment</code> are not valid.
+     */
+    static void createBinaryDatasetFile(const std::filesystem::path &outputFilePath,
+                                        const float *data,
+                                        std::size_t dataSamplesCount,
+                                        std::size_t dimension,
+                                        std::size_t stride,
+                                        std::size_t alignment);
+
 private:
+    /**
+     * Number of characters written to a file at once, at least.
+     */
+    static const constexpr std::size_t WRITE_BUFFER_SIZE = 1024 * 1024;
+
+    /**
+     * Number of significant digits used by <code>std::ofstream</code> by default to format the
+     * floating-point numbers.
+     */
+    static const constexpr int STREAM_PRECISION = 6;
+
+    /**
+     * Maximum number of characters of a formatted number.
+     */
+    static const constexpr std::size_t NUMBER_MAXIMUM_LENGTH = 32;
+
+    /**
+     * Maximum number of characters of the name of a cluster in the visualizer output file.
+     */
+    static const constexpr std::size_t VISUALIZER_NAME_LENGTH = 10;
+
+    /**
+     * Last printed cluster a point belongs to, while creating the visualizer output file.
+     */
+    struct VisualizerCluster {
+
+        /**
+         * Identifier of the cluster. If it is smaller than the number of points, it identifies
+         * the point with that index.
+         */
+        std::size_t identifier;
+
+        /**
+         * Characters of the name of the cluster.
+         */
+        std::array<char, VISUALIZER_NAME_LENGTH> name;
+
+        /**
+         * Number of characters of the name of the cluster.
+         */
+        std::size_t nameLength;
+    };
+
+    /**
+     * Writes to the specified file the values of pi and lambda as a NumPy <code>.npz</code>
+     * archive.
+     *
+     * @param outputFilePath Path of the file where the values of pi and lambda will be written to.
+     * @param piVector Vector containing the values of pi.
+     * @param lambdaVector Vector containing the values of lambda.
+     * @throws IOException If an I/O error occurs while writing to the file.
+     */
+    static void writePiLambdaArchive(const std::filesystem::path &outputFilePath,
+                                     const std::vector<std::size_t> &piVector,
+                                     const std::vector<double> &lambdaVector);
+
+    /**
+     * Writes the specified data samples to a file in the binary dataset format.
+     *
+     * @tparam S Type of the attributes of the data samples.
+     * @param outputFilePath Path of the file where the dataset will be written to.
+     * @param data Pointer to the first attribute of the first data sample to write.
+     * @param dataSamplesCount Number of data samples to write.
+     * @param dimension Number of attributes of each data sample.
+     * @param stride Number of attributes between the first attribute of a data sample and the
+     * first attribute of the following one, both in <code>data</code> and in the written file. It
+     * <b>MUST BE</b> greater than or equal to <code>dimension</code>.
+     * @param alignment Alignment, in bytes, of every data sample in the written file. It
+     * <b>MUST BE</b> a power of two, not greater than <code>BinaryDataset::DATA_OFFSET</code>, and
+     * <code>stride</code> attributes must occupy a multiple of it.
+     * @throws IOException If an I/O error occurs while writing to the file.
+     * @throws std::invalid_argument If the specified <code>stride</code> or
+     * <code>alignment</code> are not valid.
+     */
+    template <typename S>
+    static void writeBinaryDataset(const std::filesystem::path &outputFilePath,
+                                   const S *data,
+                                   std::size_t dataSamplesCount,
+                                   std::size_t dimension,
+                                   std::size_t stride,
+                                   std::size_t alignment);
+
+    /**
+     * Appends the specified number to the specified text, formatted as
+     * <code>std::ofstream</code> formats it by default.
+     *
+     * @tparam T Type of the number.
+     * @param text Text where the number will be appended.
+     * @param value Number to append.
+     */
+    template <typename T>
+    static void appendNumber(std::string &text, T value);
+
+    /**
+     * Writes the specified buffer to the specified file stream and clears it, if it holds at least
+     * the specified number of characters.
+     *
+     * @param fileStream File stream where the buffer will be written to.
+     * @param buffer Buffer to write.
+     * @param outputFilePath Path of the output file the specified <code>fileStream</code> writes
+     * to.
+     * @param minimumSize Minimum number of characters the buffer must hold to be written.
+     * @throws IOException If an I/O error occurs while writing to the file.
+     */
+    static void writeBuffer(std::ofstream &fileStream,
+                            std::string &buffer,
+                            const std::filesystem::path &outputFilePath,
+                            std::size_t minimumSize);
+
     /**
      * Requires the specified file stream to be in a good state.
      *
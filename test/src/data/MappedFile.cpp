@@ -0,0 +1,221 @@
+/*
+ * MappedFile implementation.
+ *
+ * @author DeB
+ * @author Jonathan
+ * @version 1.2 2022-10-16
+ * @since 1.0
+ */
+#include "MappedFile.h"
+#include "IoException.h"
+#include <string>
+#ifdef _WIN32
+#define NOMINMAX
+#define WIN32_LEAN_AND_MEAN
+#include <system_error>
+#include <windows.h>
+#else
+#include <cerrno>
+#include <cstring>
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+#endif
+
+namespace cluster::test::data {
+
+#ifdef _WIN32
+namespace {
+
+/**
+ * Describes the last error occurred in a call to the Windows API by the calling thread.
+ *
+ * @return The description of the error.
+ */
+std::string describeLastError() {
+
+    return std::system_category().message(static_cast<int>(GetLastError()));
+}
+}  // namespace
+
+/**
+ * Maps in memory the content of the specified file.
+ *
+ * @param filePath Path of the file to map.
+ * @param copyOnWrite <code>true</code> if the content must be writable, with the changes visible
+ * only to this process, <code>false</code> if the content is read-only.
+ * @throws IOException If the file cannot be opened or mapped.
+ */
+MappedFile::MappedFile(const std::filesystem::path &filePath, const bool copyOnWrite) :
+    content(nullptr),
+    contentSize(0) {
+
+    using namespace std::literals::string_literals;
+
+    // Open the file, hinting that it will be read sequentially
+    const HANDLE file = CreateFileW(filePath.c_str(),
+                                    GENERIC_READ,
+                                    FILE_SHARE_READ,
+                                    nullptr,
+                                    OPEN_EXISTING,
+                                    FILE_FLAG_SEQUENTIAL_SCAN,
+                                    nullptr);
+    if (file == INVALID_HANDLE_VALUE) {
+        throw IOException("Error while opening the file"s + ' ' + filePath.string() + ": " +
+                          describeLastError());
+    }
+
+    // Retrieve its size
+    LARGE_INTEGER fileSize{};
+    if (GetFileSizeEx(file, &fileSize) == 0) {
+        const std::string reason{describeLastError()};
+        CloseHandle(file);
+        throw IOException("Error while reading the file"s + ' ' + filePath.string() + ": " +
+                          reason);
+    }
+    this->contentSize = static_cast<std::size_t>(fileSize.QuadPart);
+
+    // Map the file, unless it is empty since empty mappings are not allowed. A copy-on-write view
+    // behaves like a private mapping
+    if (this->contentSize > 0) {
+        const HANDLE mapping = CreateFileMappingW(
+                file, nullptr, copyOnWrite ? PAGE_WRITECOPY : PAGE_READONLY, 0, 0, nullptr);
+        void *view = nullptr;
+        std::string reason{};
+        if (mapping != nullptr) {
+            view = MapViewOfFile(mapping, copyOnWrite ? FILE_MAP_COPY : FILE_MAP_READ, 0, 0, 0);
+            if (view == nullptr) {
+                reason = describeLastError();
+            }
+            // The view keeps the mapping alive
+            CloseHandle(mapping);
+        } else {
+            reason = describeLastError();
+        }
+        if (view == nullptr) {
+            CloseHandle(file);
+            throw IOException("Error while mapping the file"s + ' ' + filePath.string() + ": " +
+                              reason);
+        }
+        this->content = static_cast<char *>(view);
+    }
+
+    // The view stays valid after the file is closed
+    CloseHandle(file);
+}
+
+/**
+ * Unmaps the content of the file.
+ */
+MappedFile::~MappedFile() {
+
+    if (this->content != nullptr) {
+        UnmapViewOfFile(this->content);
+    }
+}
+#else
+
+/**
+ * Maps in memory the content of the specified file.
+ *
+ * @param filePath Path of the file to map.
+ * @param copyOnWrite <code>true</code> if the content must be writable, with the changes visible
+ * only to this process, <code>false</code> if the content is read-only.
+ * @throws IOException If the file cannot be opened or mapped.
+ */
+MappedFile::MappedFile(const std::filesystem::path &filePath, const bool copyOnWrite) :
+    content(nullptr),
+    contentSize(0) {
+
+    using namespace std::literals::string_literals;
+
+    // Open the file
+    // NOLINTNEXTLINE(cppcoreguidelines-pro-type-vararg)
+    const int fileDescriptor = open(filePath.c_str(), O_RDONLY | O_CLOEXEC);
+    if (fileDescriptor < 0) {
+        throw IOException("Error while opening the file"s + ' ' + filePath.string() + ": " +
+                          std::strerror(errno));
+    }
+
+    // Retrieve its size
+    struct stat fileStatus {};
+    if (fstat(fileDescriptor, &fileStatus) != 0) {
+        const std::string reason{std::strerror(errno)};
+        close(fileDescriptor);
+        throw IOException("Error while reading the file"s + ' ' + filePath.string() + ": " +
+                          reason);
+    }
+    this->contentSize = static_cast<std::size_t>(fileStatus.st_size);
+
+    // Map the file, unless it is empty since empty mappings are not allowed
+    if (this->contentSize > 0) {
+        const int protection = copyOnWrite ? (PROT_READ | PROT_WRITE) : PROT_READ;
+        void *const mapping =
+                mmap(nullptr, this->contentSize, protection, MAP_PRIVATE, fileDescriptor, 0);
+        if (mapping == MAP_FAILED) {
+            const std::string reason{std::strerror(errno)};
+            close(fileDescriptor);
+            throw IOException("Error while mapping the file"s + ' ' + filePath.string() + ": " +
+                              reason);
+        }
+        // The advice is only a hint, so its failure is not an error
+        madvise(mapping, this->contentSize, MADV_SEQUENTIAL);
+        this->content = static_cast<char *>(mapping);
+    }
+
+    // The mapping stays valid after the file is closed
+    close(fileDescriptor);
+}
+
+/**
+ * Unmaps the content of the file.
+ */
+MappedFile::~MappedFile() {
+
+    if (this->content != nullptr) {
+        munmap(this->content, this->contentSize);
+    }
+}
+#endif
+
+/**
+ * Returns a pointer to the first character of the file.
+ *
+ * @return A pointer to the first character of the file.
+ */
+const char *MappedFile::begin() const noexcept {
+
+    return this->content;
+}
+
+/**
+ * Returns a writable pointer to the first character of the file.
+ *
+ * @return A writable pointer to the first character of the file.
+ */
+char *MappedFile::begin() noexcept {
+
+    return this->content;
+}
+
+/**
+ * Returns a pointer to the character following the last one of the file.
+ *
+ * @return A pointer to the character following the last one of the file.
+ */
+const char *MappedFile::end() const noexcept {
+
+    return this->content + this->contentSize;
+}
+
+/**
+ * Returns the size of the file, in bytes.
+ *
+ * @return The size of the file.
+ */
+std::size_t MappedFile::size() const noexcept {
+
+    return this->contentSize;
+}
+}  // namespace cluster::test::data
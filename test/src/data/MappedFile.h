@@ -0,0 +1,89 @@
+#ifndef FINAL_PROJECT_HPC_MAPPEDFILE_H
+#define FINAL_PROJECT_HPC_MAPPEDFILE_H
+
+#include <cstddef>
+#include <filesystem>
+
+namespace cluster::test::data {
+/**
+ * Read-only view of the content of a file, mapped in memory.<br>
+ * The file is mapped when the object is created and unmapped when it is destroyed. The kernel is
+ * advised that the content will be read sequentially, so that it can read ahead aggressively.<br>
+ * The mapping can also be made private and writable, in which case a page is copied only when it
+ * is written, and the changes are never written back to the file.<br>
+ * The file is mapped with <code>mmap</code> on POSIX systems, and with
+ * <code>CreateFileMapping</code> on Windows, where the sequential access is hinted when the file
+ * is opened.
+ *
+ * @author DeB
+ * @author Jonathan
+ * @version 1.2 2022-10-16
+ * @since 1.0
+ */
+class MappedFile {
+
+public:
+    /**
+     * Maps in memory the content of the specified file.
+     *
+     * @param filePath Path of the file to map.
+     * @param copyOnWrite <code>true</code> if the content must be writable, with the changes
+     * visible only to this process, <code>false</code> if the content is read-only.
+     * @throws IOException If the file cannot be opened or mapped.
+     */
+    explicit MappedFile(const std::filesystem::path &filePath, bool copyOnWrite = false);
+
+    MappedFile(const MappedFile &) = delete;
+    MappedFile(MappedFile &&) = delete;
+    MappedFile &operator=(const MappedFile &) = delete;
+    MappedFile &operator=(MappedFile &&) = delete;
+
+    /**
+     * Unmaps the content of the file.
+     */
+    ~MappedFile();
+
+    /**
+     * Returns a pointer to the first character of the file.
+     *
+     * @return A pointer to the first character of the file.
+     */
+    const char *begin() const noexcept;
+
+    /**
+     * Returns a writable pointer to the first character of the file.<br>
+     * The content <b>MUST BE</b> written only if the file has been mapped with
+     * <code>copyOnWrite</code> set to <code>true</code>.
+     *
+     * @return A writable pointer to the first character of the file.
+     */
+    char *begin() noexcept;
+
+    /**
+     * Returns a pointer to the character following the last one of the file.
+     *
+     * @return A pointer to the character following the last one of the file.
+     */
+    const char *end() const noexcept;
+
+    /**
+     * Returns the size of the file, in bytes.
+     *
+     * @return The size of the file.
+     */
+    std::size_t size() const noexcept;
+
+private:
+    /**
+     * First character of the mapped content, or <code>nullptr</code> if the file is empty.
+     */
+    char *content;
+
+    /**
+     * Size of the file, in bytes.
+     */
+    std::size_t contentSize;
+};
+}  // namespace cluster::test::data
+
+#endif  // FINAL_PROJECT_HPC_MAPPEDFILE_H
@@ -0,0 +1,549 @@
+/*
+ * NpyFormat implementation.
+ *
+ * @author DeB
+ * @author Jonathan
+ * @version 1.1 2022-10-16
+ * @since 1.0
+ */
+#include "NpyFormat.h"
+#include "IoException.h"
+#include "MalformedFileException.h"
+#include <algorithm>
+#include <cctype>
+#include <charconv>
+#include <cstring>
+#include <fstream>
+#include <limits>
+#include <stdexcept>
+#include <string_view>
+
+namespace cluster::test::data {
+
+namespace {
+/**
+ * Creates the lookup table used to compute the CRC-32 checksum one byte at a time.
+ *
+ * @return The lookup table of the CRC-32 checksum.
+ */
+constexpr std::array<std::uint32_t, 256> createCrc32Table() noexcept {
+
+    std::array<std::uint32_t, 256> table{};
+    for (std::uint32_t i = 0; i < 256; i++) {
+        std::uint32_t value = i;
+        for (int bit = 0; bit < 8; bit++) {
+            value = ((value & 1U) != 0) ? (0xEDB88320U ^ (value >> 1U)) : (value >> 1U);
+        }
+        table[i] = value;
+    }
+    return table;
+}
+
+/**
+ * Lookup table used to compute the CRC-32 checksum.
+ */
+constexpr std::array<std::uint32_t, 256> CRC32_TABLE = createCrc32Table();
+
+/**
+ * Skips the spaces at the beginning of the specified string.
+ *
+ * @param string String whose leading spaces must be skipped.
+ * @return The specified string, without its leading spaces.
+ */
+std::string_view skipSpaces(std::string_view string) noexcept {
+
+    while (!string.empty() && std::isspace(static_cast<unsigned char>(string.front())) != 0) {
+        string.remove_prefix(1);
+    }
+    return string;
+}
+
+/**
+ * Finds the value of the specified key in the Python dictionary literal describing an array.
+ *
+ * @param dictionary Python dictionary literal.
+ * @param key Key whose value must be found.
+ * @return The dictionary literal, starting from the first character of the value of the key, or an
+ * empty string if the key is not present.
+ */
+std::string_view findValue(const std::string_view dictionary, const std::string_view key) noexcept {
+
+    for (const char quote : {'\'', '"'}) {
+        const std::string quotedKey = quote + std::string{key} + quote;
+        const std::size_t keyPosition = dictionary.find(quotedKey);
+        if (keyPosition != std::string_view::npos) {
+            std::string_view value = skipSpaces(dictionary.substr(keyPosition + quotedKey.size()));
+            if (value.empty() || value.front() != ':') {
+                return {};
+            }
+            return skipSpaces(value.substr(1));
+        }
+    }
+    return {};
+}
+}  // namespace
+
+/**
+ * Destroys the description of the array.
+ */
+NpyFormat::ArrayHeader::~ArrayHeader() = default;
+
+/**
+ * Checks whether the specified content starts with the magic string of the <code>.npy</code>
+ * format.
+ *
+ * @param begin Pointer to the first character of the content.
+ * @param end Pointer to the character following the last one of the content.
+ * @return <code>true</code> if the content starts with the magic string of the <code>.npy</code>
+ * format, <code>false</code> otherwise.
+ */
+bool NpyFormat::isArray(const char *const begin, const char *const end) noexcept {
+
+    return static_cast<std::size_t>(end - begin) >= ARRAY_MAGIC_STRING.size() &&
+           std::equal(ARRAY_MAGIC_STRING.cbegin(), ARRAY_MAGIC_STRING.cend(), begin);
+}
+
+/**
+ * Checks whether the specified content starts with the magic string of the <code>.npz</code>
+ * format.
+ *
+ * @param begin Pointer to the first character of the content.
+ * @param end Pointer to the character following the last one of the content.
+ * @return <code>true</code> if the content starts with the magic string of the <code>.npz</code>
+ * format, <code>false</code> otherwise.
+ */
+bool NpyFormat::isArchive(const char *const begin, const char *const end) noexcept {
+
+    return static_cast<std::size_t>(end - begin) >= ARCHIVE_MAGIC_STRING.size() &&
+           std::equal(ARCHIVE_MAGIC_STRING.cbegin(), ARCHIVE_MAGIC_STRING.cend(), begin);
+}
+
+/**
+ * Parses the header of the array stored in the <code>.npy</code> format in the specified content.
+ *
+ * @param begin Pointer to the first character of the <code>.npy</code> file.
+ * @param end Pointer to the character following the last one of the <code>.npy</code> file.
+ * @param filePath Path of the file containing the array, used only to report errors.
+ * @return The description of the array.
+ * @throws MalformedFileException If the content is not a valid <code>.npy</code> file, or if the
+ * type of the array is not known.
+ */
+NpyFormat::ArrayHeader NpyFormat::parseArrayHeader(const char *const begin,
+                                                   const char *const end,
+                                                   const std::filesystem::path &filePath) {
+
+    using namespace std::literals::string_literals;
+    const std::string errorMessage = "The file"s + ' ' + filePath.string() +
+                                     " is not a valid .npy file";
+    const auto size = static_cast<std::size_t>(end - begin);
+
+    // Read the version of the format and the length of the header
+    const std::size_t versionOffset = ARRAY_MAGIC_STRING.size();
+    if (!NpyFormat::isArray(begin, end) || size < versionOffset + 2 + sizeof(std::uint16_t)) {
+        throw MalformedFileException(errorMessage);
+    }
+    const auto majorVersion = static_cast<unsigned char>(begin[versionOffset]);
+    std::size_t headerOffset = versionOffset + 2;
+    std::size_t headerLength = 0;
+    if (majorVersion == 1) {
+        headerLength = NpyFormat::readLittleEndian<std::uint16_t>(begin + headerOffset);
+        headerOffset += sizeof(std::uint16_t);
+    } else if ((majorVersion == 2 || majorVersion == 3) &&
+               size >= headerOffset + sizeof(std::uint32_t)) {
+        headerLength = NpyFormat::readLittleEndian<std::uint32_t>(begin + headerOffset);
+        headerOffset += sizeof(std::uint32_t);
+    } else {
+        throw MalformedFileException(errorMessage);
+    }
+    if (headerLength > size - headerOffset) {
+        throw MalformedFileException(errorMessage);
+    }
+    const std::string_view dictionary{begin + headerOffset, headerLength};
+
+    // **** 1) Parse the type of the values ****
+    ArrayHeader header{};
+    header.dataOffset = headerOffset + headerLength;
+    std::string_view value = findValue(dictionary, "descr");
+    if (value.empty() || (value.front() != '\'' && value.front() != '"')) {
+        throw MalformedFileException(errorMessage);
+    }
+    const std::size_t typeLength = value.find(value.front(), 1);
+    if (typeLength == std::string_view::npos) {
+        throw MalformedFileException(errorMessage);
+    }
+    header.type = value.substr(1, typeLength - 1);
+
+    // Compute the size of each value, i.e., the number following the kind of the type
+    std::size_t valueSize = 0;
+    const char *const typeEnd = header.type.data() + header.type.size();
+    if (header.type.size() < 3 ||
+        std::from_chars(header.type.data() + 2, typeEnd, valueSize).ptr != typeEnd ||
+        valueSize == 0) {
+        throw MalformedFileException("The file"s + ' ' + filePath.string() +
+                                     " contains an array of unknown type " + header.type);
+    }
+
+    // **** 2) Parse the order of the values ****
+    value = findValue(dictionary, "fortran_order");
+    if (value.starts_with("True")) {
+        header.fortranOrder = true;
+    } else if (value.starts_with("False")) {
+        header.fortranOrder = false;
+    } else {
+        throw MalformedFileException(errorMessage);
+    }
+
+    // **** 3) Parse the shape of the array ****
+    value = findValue(dictionary, "shape");
+    if (value.empty() || value.front() != '(') {
+        throw MalformedFileException(errorMessage);
+    }
+    value = skipSpaces(value.substr(1));
+    while (!value.empty() && value.front() != ')') {
+        std::size_t extent = 0;
+        const auto [extentEnd, error] =
+                std::from_chars(value.data(), value.data() + value.size(), extent);
+        if (error != std::errc{}) {
+            throw MalformedFileException(errorMessage);
+        }
+        header.shape.push_back(extent);
+        value = skipSpaces(value.substr(static_cast<std::size_t>(extentEnd - value.data())));
+        if (!value.empty() && value.front() == ',') {
+            value = skipSpaces(value.substr(1));
+        } else if (value.empty() || value.front() != ')') {
+            throw MalformedFileException(errorMessage);
+        }
+    }
+    if (value.empty()) {
+        throw MalformedFileException(errorMessage);
+    }
+
+    // **** 4) Check that all the values are present ****
+    std::size_t dataSize = valueSize;
+    for (const std::size_t extent : header.shape) {
+        if (extent != 0 && dataSize > std::numeric_limits<std::size_t>::max() / extent) {
+            throw MalformedFileException(errorMessage);
+        }
+        dataSize *= extent;
+    }
+    if (dataSize > size - header.dataOffset) {
+        throw MalformedFileException("The .npy file"s + ' ' + filePath.string() +
+                                     " has a size that does not match its header");
+    }
+
+    return header;
+}
+
+/**
+ * Lists the members of the archive stored in the <code>.npz</code> format in the specified
+ * content, by reading its central directory.
+ *
+ * @param begin Pointer to the first character of the archive.
+ * @param end Pointer to the character following the last one of the archive.
+ * @param filePath Path of the archive, used only to report errors.
+ * @return The members of the archive, in the order they appear in the central directory.
+ * @throws MalformedFileException If the content is not a valid ZIP archive.
+ */
+std::vector<NpyFormat::ArchiveMember> NpyFormat::listArchiveMembers(
+        const char *const begin, const char *const end, const std::filesystem::path &filePath) {
+
+    using namespace std::literals::string_literals;
+    const std::string errorMessage = "The file"s + ' ' + filePath.string() +
+                                     " is not a valid .npz file";
+    const auto size = static_cast<std::size_t>(end - begin);
+    const std::size_t endRecordSize = 22;
+    const std::size_t maximumCommentLength = std::numeric_limits<std::uint16_t>::max();
+
+    // **** 1) Find the end of central directory record, which is followed only by a comment ****
+    if (size < endRecordSize) {
+        throw MalformedFileException(errorMessage);
+    }
+    const std::size_t lowestEndRecordOffset =
+            (size - endRecordSize > maximumCommentLength)
+                    ? size - endRecordSize - maximumCommentLength
+                    : 0;
+    std::size_t endRecordOffset = size - endRecordSize;
+    while (std::memcmp(begin + endRecordOffset, "PK\x05\x06", 4) != 0) {
+        if (endRecordOffset == lowestEndRecordOffset) {
+            throw MalformedFileException(errorMessage);
+        }
+        endRecordOffset--;
+    }
+    const char *endRecord = begin + endRecordOffset;
+    std::uint64_t membersCount = NpyFormat::readLittleEndian<std::uint16_t>(endRecord + 10);
+    std::uint64_t directoryOffset = NpyFormat::readLittleEndian<std::uint32_t>(endRecord + 16);
+
+    // Use the ZIP64 end of central directory record, if present
+    const std::size_t locatorSize = 20;
+    const std::size_t zip64EndRecordSize = 56;
+    if (endRecordOffset >= locatorSize &&
+        std::memcmp(endRecord - locatorSize, "PK\x06\x07", 4) == 0) {
+        const auto recordOffset =
+                NpyFormat::readLittleEndian<std::uint64_t>(endRecord - locatorSize + 8);
+        if (size < zip64EndRecordSize || recordOffset > size - zip64EndRecordSize ||
+            std::memcmp(begin + recordOffset, "PK\x06\x06", 4) != 0) {
+            throw MalformedFileException(errorMessage);
+        }
+        endRecord = begin + recordOffset;
+        membersCount = NpyFormat::readLittleEndian<std::uint64_t>(endRecord + 32);
+        directoryOffset = NpyFormat::readLittleEndian<std::uint64_t>(endRecord + 48);
+    }
+
+    // **** 2) Read the entries of the central directory ****
+    std::vector<ArchiveMember> members{};
+    std::size_t entryOffset = directoryOffset;
+    const std::size_t entrySize = 46;
+    const std::size_t localHeaderSize = 30;
+    const std::uint32_t escapeValue = std::numeric_limits<std::uint32_t>::max();
+    for (std::uint64_t i = 0; i < membersCount; i++) {
+        if (entryOffset > size - entrySize ||
+            std::memcmp(begin + entryOffset, "PK\x01\x02", 4) != 0) {
+            throw MalformedFileException(errorMessage);
+        }
+        const char *const entry = begin + entryOffset;
+        const auto method = NpyFormat::readLittleEndian<std::uint16_t>(entry + 10);
+        std::uint64_t memberSize = NpyFormat::readLittleEndian<std::uint32_t>(entry + 20);
+        const std::uint64_t uncompressedSize = NpyFormat::readLittleEndian<std::uint32_t>(entry + 24);
+        const std::size_t nameLength = NpyFormat::readLittleEndian<std::uint16_t>(entry + 28);
+        const std::size_t extraLength = NpyFormat::readLittleEndian<std::uint16_t>(entry + 30);
+        const std::size_t commentLength = NpyFormat::readLittleEndian<std::uint16_t>(entry + 32);
+        std::uint64_t localHeaderOffset = NpyFormat::readLittleEndian<std::uint32_t>(entry + 42);
+        if (nameLength + extraLength > size - entryOffset - entrySize) {
+            throw MalformedFileException(errorMessage);
+        }
+
+        // Read the sizes and the offset from the ZIP64 extra field, if they do not fit
+        const char *extra = entry + entrySize + nameLength;
+        const char *const extraEnd = extra + extraLength;
+        while (extraEnd - extra >= 4) {
+            const auto fieldId = NpyFormat::readLittleEndian<std::uint16_t>(extra);
+            const std::size_t fieldSize = NpyFormat::readLittleEndian<std::uint16_t>(extra + 2);
+            const char *field = extra + 4;
+            const char *const fieldEnd = field + std::min<std::size_t>(
+                                                         fieldSize,
+                                                         static_cast<std::size_t>(extraEnd - field));
+            if (fieldId == 1) {
+                // The field holds, in order, only the values that do not fit in the entry
+                if (uncompressedSize == escapeValue) {
+                    field += 8;
+                }
+                if (memberSize == escapeValue && fieldEnd - field >= 8) {
+                    memberSize = NpyFormat::readLittleEndian<std::uint64_t>(field);
+                    field += 8;
+                }
+                if (localHeaderOffset == escapeValue && fieldEnd - field >= 8) {
+                    localHeaderOffset = NpyFormat::readLittleEndian<std::uint64_t>(field);
+                }
+            }
+            extra = fieldEnd;
+        }
+
+        // Find the content of the member, which follows its local file header
+        if (localHeaderOffset > size - localHeaderSize ||
+            std::memcmp(begin + localHeaderOffset, "PK\x03\x04", 4) != 0) {
+            throw MalformedFileException(errorMessage);
+        }
+        const char *const localHeader = begin + localHeaderOffset;
+        const std::size_t contentOffset =
+                localHeaderOffset + localHeaderSize +
+                NpyFormat::readLittleEndian<std::uint16_t>(localHeader + 26) +
+                NpyFormat::readLittleEndian<std::uint16_t>(localHeader + 28);
+        if (contentOffset > size || memberSize > size - contentOffset) {
+            throw MalformedFileException(errorMessage);
+        }
+        members.push_back(ArchiveMember{std::string{entry + entrySize, nameLength},
+                                        method == 0,
+                                        contentOffset,
+                                        memberSize});
+
+        // Move to the next entry
+        entryOffset += entrySize + nameLength + extraLength + commentLength;
+    }
+
+    return members;
+}
+
+/**
+ * Creates the beginning of a <code>.npy</code> file storing an array in row-major order with the
+ * specified type and shape.
+ *
+ * @param type Type of the values of the array, as a NumPy type string.
+ * @param shape Shape of the array.
+ * @return The beginning of the <code>.npy</code> file.
+ */
+std::string NpyFormat::createArrayHeader(const std::string &type,
+                                         const std::vector<std::size_t> &shape) {
+
+    // Create the dictionary describing the array
+    std::string dictionary = "{'descr': '" + type + "', 'fortran_order': False, 'shape': (";
+    for (const std::size_t extent : shape) {
+        dictionary += std::to_string(extent);
+        dictionary += ", ";
+    }
+    if (shape.size() > 1) {
+        // A tuple with more than one element has no trailing comma
+        dictionary.resize(dictionary.size() - 2);
+    } else if (shape.size() == 1) {
+        dictionary.pop_back();
+    }
+    dictionary += "), }";
+
+    // Pad the dictionary with spaces and terminate it with a new line
+    const std::size_t prefixLength = ARRAY_MAGIC_STRING.size() + 2 + sizeof(std::uint16_t);
+    const std::size_t unpaddedLength = prefixLength + dictionary.size() + 1;
+    const std::size_t paddedLength =
+            (unpaddedLength + ARRAY_ALIGNMENT - 1) / ARRAY_ALIGNMENT * ARRAY_ALIGNMENT;
+    dictionary.append(paddedLength - unpaddedLength, ' ');
+    dictionary += '\n';
+
+    // Create the beginning of the file, using the version 1.0 of the format
+    std::string result{ARRAY_MAGIC_STRING.cbegin(), ARRAY_MAGIC_STRING.cend()};
+    result += '\x01';
+    result += '\x00';
+    NpyFormat::appendLittleEndian(result, static_cast<std::uint16_t>(dictionary.size()));
+    result += dictionary;
+
+    return result;
+}
+
+/**
+ * Writes an archive in the <code>.npz</code> format, whose members are stored without compression.
+ *
+ * @param outputFilePath Path of the file where the archive will be written to.
+ * @param names Names of the members of the archive.
+ * @param contents Contents of the members of the archive.
+ * @throws IOException If an I/O error occurs while writing to the file.
+ * @throws std::invalid_argument If the sizes of <code>names</code> and <code>contents</code> differ,
+ * or if the archive would be too large for a ZIP archive without the ZIP64 extension.
+ */
+void NpyFormat::writeArchive(const std::filesystem::path &outputFilePath,
+                             const std::vector<std::string> &names,
+                             const std::vector<std::string> &contents) {
+
+    // Check the arguments
+    if (names.size() != contents.size()) {
+        throw std::invalid_argument("Each member of the archive must have a name");
+    }
+    const std::uint32_t maximumValue = std::numeric_limits<std::uint32_t>::max() - 1;
+    const std::uint16_t version = 20;
+    const std::uint16_t date = (1U << 5U) | 1U;  // 1980-01-01
+
+    // Create the local file headers and the central directory
+    std::string localFiles{};
+    std::string centralDirectory{};
+    for (std::size_t i = 0; i < names.size(); i++) {
+        const std::string &name = names[i];
+        const std::string &content = contents[i];
+        if (content.size() + name.size() + 30 > maximumValue - localFiles.size()) {
+            throw std::invalid_argument("The archive is too large");
+        }
+        const std::uint32_t checksum = NpyFormat::computeCrc32(content.data(), content.size());
+        const auto contentSize = static_cast<std::uint32_t>(content.size());
+        const auto localHeaderOffset = static_cast<std::uint32_t>(localFiles.size());
+
+        // Local file header
+        localFiles += "PK\x03\x04";
+        NpyFormat::appendLittleEndian(localFiles, version);
+        NpyFormat::appendLittleEndian<std::uint16_t>(localFiles, 0);  // Flags
+        NpyFormat::appendLittleEndian<std::uint16_t>(localFiles, 0);  // Stored
+        NpyFormat::appendLittleEndian<std::uint16_t>(localFiles, 0);  // Time
+        NpyFormat::appendLittleEndian(localFiles, date);
+        NpyFormat::appendLittleEndian(localFiles, checksum);
+        NpyFormat::appendLittleEndian(localFiles, contentSize);
+        NpyFormat::appendLittleEndian(localFiles, contentSize);
+        NpyFormat::appendLittleEndian(localFiles, static_cast<std::uint16_t>(name.size()));
+        NpyFormat::appendLittleEndian<std::uint16_t>(localFiles, 0);  // Extra field length
+        localFiles += name;
+        localFiles += content;
+
+        // Central directory entry
+        centralDirectory += "PK\x01\x02";
+        NpyFormat::appendLittleEndian(centralDirectory, version);
+        NpyFormat::appendLittleEndian(centralDirectory, version);
+        NpyFormat::appendLittleEndian<std::uint16_t>(centralDirectory, 0);  // Flags
+        NpyFormat::appendLittleEndian<std::uint16_t>(centralDirectory, 0);  // Stored
+        NpyFormat::appendLittleEndian<std::uint16_t>(centralDirectory, 0);  // Time
+        NpyFormat::appendLittleEndian(centralDirectory, date);
+        NpyFormat::appendLittleEndian(centralDirectory, checksum);
+        NpyFormat::appendLittleEndian(centralDirectory, contentSize);
+        NpyFormat::appendLittleEndian(centralDirectory, contentSize);
+        NpyFormat::appendLittleEndian(centralDirectory, static_cast<std::uint16_t>(name.size()));
+        NpyFormat::appendLittleEndian<std::uint16_t>(centralDirectory, 0);  // Extra field length
+        NpyFormat::appendLittleEndian<std::uint16_t>(centralDirectory, 0);  // Comment length
+        NpyFormat::appendLittleEndian<std::uint16_t>(centralDirectory, 0);  // Disk number
+        NpyFormat::appendLittleEndian<std::uint16_t>(centralDirectory, 0);  // Internal attributes
+        NpyFormat::appendLittleEndian<std::uint32_t>(centralDirectory, 0);  // External attributes
+        NpyFormat::appendLittleEndian(centralDirectory, localHeaderOffset);
+        centralDirectory += name;
+    }
+
+    // End of central directory record
+    std::string endRecord{"PK\x05\x06"};
+    NpyFormat::appendLittleEndian<std::uint16_t>(endRecord, 0);  // Disk number
+    NpyFormat::appendLittleEndian<std::uint16_t>(endRecord, 0);  // Central directory disk
+    NpyFormat::appendLittleEndian(endRecord, static_cast<std::uint16_t>(names.size()));
+    NpyFormat::appendLittleEndian(endRecord, static_cast<std::uint16_t>(names.size()));
+    NpyFormat::appendLittleEndian(endRecord, static_cast<std::uint32_t>(centralDirectory.size()));
+    NpyFormat::appendLittleEndian(endRecord, static_cast<std::uint32_t>(localFiles.size()));
+    NpyFormat::appendLittleEndian<std::uint16_t>(endRecord, 0);  // Comment length
+
+    // Write the archive
+    std::ofstream fileOutputStream{outputFilePath, std::ios::binary};
+    if (fileOutputStream) {
+        fileOutputStream << localFiles << centralDirectory << endRecord;
+    }
+    if (!fileOutputStream) {
+        using namespace std::literals::string_literals;
+        throw IOException("Error while writing the file"s + ' ' + outputFilePath.string());
+    }
+}
+
+/**
+ * Computes the CRC-32 checksum of the specified bytes, as required by the ZIP format.
+ *
+ * @param data Pointer to the first byte.
+ * @param size Number of bytes.
+ * @return The CRC-32 checksum of the specified bytes.
+ */
+std::uint32_t NpyFormat::computeCrc32(const char *const data, const std::size_t size) noexcept {
+
+    std::uint32_t checksum = std::numeric_limits<std::uint32_t>::max();
+    for (std::size_t i = 0; i < size; i++) {
+        checksum = CRC32_TABLE[(checksum ^ static_cast<unsigned char>(data[i])) & 0xFFU] ^
+                   (checksum >> 8U);
+    }
+    return ~checksum;
+}
+
+/**
+ * Reads an unsigned little-endian integer of the specified size from the specified position.<br>
+ * Since the clustering algorithms target x86 processors, the native byte order is little-endian,
+ * so the integer is simply copied.
+ *
+ * @tparam T Type of the integer to read.
+ * @param position Pointer to the first byte of the integer.
+ * @return The read integer.
+ */
+template <typename T>
+T NpyFormat::readLittleEndian(const char *const position) noexcept {
+
+    T value{};
+    std::memcpy(&value, position, sizeof(T));
+    return value;
+}
+
+/**
+ * Appends to the specified string an unsigned integer in little-endian order.
+ *
+ * @tparam T Type of the integer to append.
+ * @param string String where the integer will be appended.
+ * @param value Integer to append.
+ */
+template <typename T>
+void NpyFormat::appendLittleEndian(std::string &string, const T value) {
+
+    std::array<char, sizeof(T)> bytes{};
+    std::memcpy(bytes.data(), &value, sizeof(T));
+    string.append(bytes.data(), bytes.size());
+}
+}  // namespace cluster::test::data
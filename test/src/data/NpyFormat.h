@@ -0,0 +1,222 @@
+#ifndef FINAL_PROJECT_HPC_NPYFORMAT_H
+#define FINAL_PROJECT_HPC_NPYFORMAT_H
+
+#include <array>
+#include <cstddef>
+#include <cstdint>
+#include <filesystem>
+#include <string>
+#include <vector>
+
+namespace cluster::test::data {
+/**
+ * Utility class to read and write arrays in the NumPy <code>.npy</code> format, and archives of
+ * arrays in the NumPy <code>.npz</code> format.<br>
+ * A <code>.npy</code> file is made of a magic string, the version of the format, the length of the
+ * header, the header itself, i.e., a Python dictionary literal describing the type, the order and
+ * the shape of the array, and finally the raw values of the array. A <code>.npz</code> file is a
+ * ZIP archive whose members are <code>.npy</code> files. Only archives whose members are stored
+ * without compression are supported, since only those members can be mapped in memory directly.
+ *
+ * @author DeB
+ * @author Jonathan
+ * @version 1.1 2022-10-16
+ * @since 1.0
+ */
+class NpyFormat {
+
+public:
+    /**
+     * Description of an array stored in the <code>.npy</code> format.
+     */
+    struct ArrayHeader {
+        /**
+         * Type of the values of the array, as a NumPy type string, e.g., <code>&lt;f8</code>.
+         */
+        std::string type;
+
+        /**
+         * <code>true</code> if the array is stored in column-major order, <code>false</code> if it
+         * is stored in row-major order.
+         */
+        bool fortranOrder;
+
+        /**
+         * Shape of the array.
+         */
+        std::vector<std::size_t> shape;
+
+        /**
+         * Offset, in bytes, of the first value of the array from the beginning of the
+         * <code>.npy</code> file.
+         */
+        std::size_t dataOffset;
+
+        ArrayHeader() = default;
+        ArrayHeader(const ArrayHeader &) = default;
+        ArrayHeader(ArrayHeader &&) noexcept = default;
+        ArrayHeader &operator=(const ArrayHeader &) = default;
+        ArrayHeader &operator=(ArrayHeader &&) noexcept = default;
+
+        /**
+         * Destroys the description of the array.
+         */
+        ~ArrayHeader();
+    };
+
+    /**
+     * Member of an archive in the <code>.npz</code> format.
+     */
+    struct ArchiveMember {
+        /**
+         * Name of the member.
+         */
+        std::string name;
+
+        /**
+         * <code>true</code> if the member is stored without compression, <code>false</code>
+         * otherwise.
+         */
+        bool stored;
+
+        /**
+         * Offset, in bytes, of the content of the member from the beginning of the archive.
+         */
+        std::size_t offset;
+
+        /**
+         * Size, in bytes, of the content of the member, as stored in the archive.
+         */
+        std::size_t size;
+    };
+
+    /**
+     * Magic string identifying a file in the <code>.npy</code> format.
+     */
+    static const constexpr std::array<char, 6> ARRAY_MAGIC_STRING{
+            '\x93', 'N', 'U', 'M', 'P', 'Y'};
+
+    /**
+     * Magic string identifying a file in the <code>.npz</code> format, i.e., the signature of the
+     * first local file header of a ZIP archive.
+     */
+    static const constexpr std::array<char, 4> ARCHIVE_MAGIC_STRING{'P', 'K', '\x03', '\x04'};
+
+    /**
+     * Alignment, in bytes, of the values of the arrays written by this class, relative to the
+     * beginning of the <code>.npy</code> file. It is the same alignment used by NumPy.
+     */
+    static const constexpr std::size_t ARRAY_ALIGNMENT = 64;
+
+    /**
+     * Checks whether the specified content starts with the magic string of the <code>.npy</code>
+     * format.
+     *
+     * @param begin Pointer to the first character of the content.
+     * @param end Pointer to the character following the last one of the content.
+     * @return <code>true</code> if the content starts with the magic string of the
+     * <code>.npy</code> format, <code>false</code> otherwise.
+     */
+    static bool isArray(const char *begin, const char *end) noexcept;
+
+    /**
+     * Checks whether the specified content starts with the magic string of the <code>.npz</code>
+     * format.
+     *
+     * @param begin Pointer to the first character of the content.
+     * @param end Pointer to the character following the last one of the content.
+     * @return <code>true</code> if the content starts with the magic string of the
+     * <code>.npz</code> format, <code>false</code> otherwise.
+     */
+    static bool isArchive(const char *begin, const char *end) noexcept;
+
+    /**
+     * Parses the header of the array stored in the <code>.npy</code> format in the specified
+     * content, checking that the content is large enough to hold all the values of the array.
+     *
+     * @param begin Pointer to the first character of the <code>.npy</code> file.
+     * @param end Pointer to the character following the last one of the <code>.npy</code> file.
+     * @param filePath Path of the file containing the array, used only to report errors.
+     * @return The description of the array.
+     * @throws MalformedFileException If the content is not a valid <code>.npy</code> file, or if
+     * the type of the array is not known.
+     */
+    static ArrayHeader parseArrayHeader(const char *begin,
+                                        const char *end,
+                                        const std::filesystem::path &filePath);
+
+    /**
+     * Lists the members of the archive stored in the <code>.npz</code> format in the specified
+     * content, by reading its central directory.
+     *
+     * @param begin Pointer to the first character of the archive.
+     * @param end Pointer to the character following the last one of the archive.
+     * @param filePath Path of the archive, used only to report errors.
+     * @return The members of the archive, in the order they appear in the central directory.
+     * @throws MalformedFileException If the content is not a valid ZIP archive.
+     */
+    static std::vector<ArchiveMember> listArchiveMembers(const char *begin,
+                                                         const char *end,
+                                                         const std::filesystem::path &filePath);
+
+    /**
+     * Creates the beginning of a <code>.npy</code> file storing an array in row-major order with
+     * the specified type and shape, i.e., everything that precedes the values of the array.<br>
+     * The header is padded with spaces so that the values of the array start at a multiple of
+     * <code>ARRAY_ALIGNMENT</code>.
+     *
+     * @param type Type of the values of the array, as a NumPy type string.
+     * @param shape Shape of the array.
+     * @return The beginning of the <code>.npy</code> file.
+     */
+    static std::string createArrayHeader(const std::string &type,
+                                         const std::vector<std::size_t> &shape);
+
+    /**
+     * Writes an archive in the <code>.npz</code> format, whose members are stored without
+     * compression.
+     *
+     * @param outputFilePath Path of the file where the archive will be written to.
+     * @param names Names of the members of the archive.
+     * @param contents Contents of the members of the archive. The member <code>i</code> is named
+     * <code>names[i]</code>.
+     * @throws IOException If an I/O error occurs while writing to the file.
+     * @throws std::invalid_argument If the sizes of <code>names</code> and <code>contents</code>
+     * differ, or if the archive would be too large for a ZIP archive without the ZIP64 extension.
+     */
+    static void writeArchive(const std::filesystem::path &outputFilePath,
+                             const std::vector<std::string> &names,
+                             const std::vector<std::string> &contents);
+
+private:
+    /**
+     * Computes the CRC-32 checksum of the specified bytes, as required by the ZIP format.
+     *
+     * @param data Pointer to the first byte.
+     * @param size Number of bytes.
+     * @return The CRC-32 checksum of the specified bytes.
+     */
+    static std::uint32_t computeCrc32(const char *data, std::size_t size) noexcept;
+
+    /**
+     * Reads an unsigned little-endian integer of the specified size from the specified position.
+     *
+     * @tparam T Type of the integer to read.
+     * @param position Pointer to the first byte of the integer.
+     * @return The read integer.
+     */
+    template <typename T>
+    static T readLittleEndian(const char *position) noexcept;
+
+    /**
+     * Appends to the specified string an unsigned integer in little-endian order.
+     *
+     * @tparam T Type of the integer to append.
+     * @param string String where the integer will be appended.
+     * @param value Integer to append.
+     */
+    template <typename T>
+    static void appendLittleEndian(std::string &string, T value);
+};
+}  // namespace cluster::test::data
+#endif  // FINAL_PROJECT_HPC_NPYFORMAT_H
@@ -0,0 +1,354 @@
+/*
+ * ParallelDataReader implementation.
+ *
+ * @author DeB
+ * @author Jonathan
+ * @version 1.0 2022-10-01
+ * @since 1.0
+ */
+#include "ParallelDataReader.h"
+#include "DataReader.h"
+#include "MalformedFileException.h"
+#include <algorithm>
+#include <cstring>
+#include <exception>
+#include <omp.h>
+#include <stdexcept>
+#include <string>
+
+namespace cluster::test::data {
+
+/**
+ * Maps the specified file in memory and counts the data samples it contains.
+ *
+ * @param inputFilePath Path of the file that contains the data to parse.
+ * @param firstLineNumber Number of the first line to parse of the file.
+ * @param lastLineNumber Number of the last line to parse of the file.
+ * @param firstColumnNumber Number of the first column of each line to parse as a coordinate of
+ * the point.
+ * @param lastColumnNumber Number of the last column of each line to parse as a coordinate of
+ * the point.
+ * @param threadsCount Number of threads to use to read the file.
+ * @throws IOException If an I/O error occurs while reading the file.
+ * @throws std::invalid_argument If the specified <code>lastColumnNumber</code> is smaller than
+ * the specified <code>firstColumnNumber</code>, or if the file with the specified path does not
+ * exist.
+ */
+ParallelDataReader::ParallelDataReader(const std::filesystem::path &inputFilePath,
+                                       const std::size_t firstLineNumber,
+                                       const std::size_t lastLineNumber,
+                                       const std::size_t firstColumnNumber,
+                                       const std::size_t lastColumnNumber,
+                                       const std::size_t threadsCount) :
+    file(checkArguments(inputFilePath, firstColumnNumber, lastColumnNumber)),
+    firstLineNumber(firstLineNumber),
+    lastLineNumber(lastLineNumber),
+    firstColumnNumber(firstColumnNumber),
+    lastColumnNumber(lastColumnNumber),
+    threadsCount(threadsCount),
+    chunks(),
+    dataSamplesCount(0),
+    dimension(0) {
+
+    const char *const fileBegin = this->file.begin();
+    const char *const fileEnd = this->file.end();
+    const std::size_t fileSize = this->file.size();
+
+    // **** 1) Split the file into chunks, each one starting at the beginning of a line ****
+    const std::size_t availableThreadsCount =
+            (threadsCount == 0) ? static_cast<std::size_t>(omp_get_max_threads()) : threadsCount;
+    const std::size_t chunksCount = std::max<std::size_t>(
+            1, std::min(availableThreadsCount * CHUNKS_PER_THREAD, fileSize / MINIMUM_CHUNK_SIZE));
+    const char *chunkBegin = fileBegin;
+    for (std::size_t i = 1; i <= chunksCount && chunkBegin != fileEnd; i++) {
+        // Move the nominal end of the chunk to the beginning of the following line
+        const char *chunkEnd = fileEnd;
+        if (i != chunksCount) {
+            const char *const nominalEnd =
+                    std::max(chunkBegin, fileBegin + (fileSize / chunksCount) * i);
+            const auto *const lineEnd = static_cast<const char *>(std::memchr(
+                    nominalEnd, '\n', static_cast<std::size_t>(fileEnd - nominalEnd)));
+            chunkEnd = (lineEnd == nullptr) ? fileEnd : lineEnd + 1;
+        }
+        this->chunks.push_back(Chunk{chunkBegin, chunkEnd, 0, 0, 0});
+        chunkBegin = chunkEnd;
+    }
+
+    // **** 2) Count the lines of each chunk ****
+    std::vector<Chunk> &fileChunks = this->chunks;
+    const auto fileChunksCount = static_cast<std::ptrdiff_t>(fileChunks.size());
+#pragma omp parallel for default(none) shared(fileChunks, fileChunksCount) \
+        num_threads(threadsCount) schedule(dynamic, 1)
+    for (std::ptrdiff_t i = 0; i < fileChunksCount; i++) {
+        Chunk &chunk = fileChunks[static_cast<std::size_t>(i)];
+        chunk.firstLineNumber =
+                static_cast<std::size_t>(std::count(chunk.begin, chunk.end, '\n'));
+    }
+    // Compute the number of the first line of each chunk
+    std::size_t lineNumber = 1;
+    for (Chunk &chunk : fileChunks) {
+        const std::size_t chunkLinesCount = chunk.firstLineNumber;
+        chunk.firstLineNumber = lineNumber;
+        lineNumber += chunkLinesCount;
+    }
+
+    // **** 3) Count the data samples of each chunk ****
+#pragma omp parallel for default(none) shared(fileChunks, fileChunksCount) \
+        num_threads(threadsCount) schedule(dynamic, 1)
+    for (std::ptrdiff_t i = 0; i < fileChunksCount; i++) {
+        Chunk &chunk = fileChunks[static_cast<std::size_t>(i)];
+        this->forEachLine(chunk,
+                          [&chunk](const char *, const char *, std::size_t) noexcept -> void {
+                              chunk.dataSamplesCount++;
+                          });
+    }
+    // Compute the index of the first data sample of each chunk
+    for (Chunk &chunk : fileChunks) {
+        chunk.firstDataSampleIndex = this->dataSamplesCount;
+        this->dataSamplesCount += chunk.dataSamplesCount;
+    }
+
+    // **** 4) Compute the dimension from the first data sample ****
+    const auto firstChunk = std::find_if(
+            fileChunks.cbegin(), fileChunks.cend(), [](const Chunk &chunk) noexcept -> bool {
+                return chunk.dataSamplesCount != 0;
+            });
+    if (firstChunk != fileChunks.cend()) {
+        bool isFirstLine = true;
+        this->forEachLine(
+                *firstChunk,
+                [this, &isFirstLine](const char *lineBegin, const char *lineEnd, std::size_t) {
+                    if (isFirstLine) {
+                        isFirstLine = false;
+                        this->dimension = this->countColumns(lineBegin, lineEnd);
+                    }
+                });
+    }
+}
+
+/**
+ * Returns the number of data samples contained in the file.
+ *
+ * @return The number of data samples contained in the file.
+ */
+std::size_t ParallelDataReader::getDataSamplesCount() const noexcept {
+
+    return this->dataSamplesCount;
+}
+
+/**
+ * Returns the dimension of each data sample, i.e., the number of coordinates of the first one.
+ *
+ * @return The dimension of each data sample, or <code>0</code> if the file contains no data
+ * samples.
+ */
+std::size_t ParallelDataReader::getDimension() const noexcept {
+
+    return this->dimension;
+}
+
+/**
+ * Parses the data samples contained in the file, placing them in the specified buffer.<br>
+ * Each chunk is parsed by a single thread. Since an exception cannot leave the parallel region,
+ * the error raised while parsing each chunk is stored and, once all the chunks have been parsed,
+ * the error of the first chunk, which is about the first malformed line, is rethrown.
+ *
+ * @param buffer Buffer where the parsed data samples will be placed.
+ * @param stride Number of values between the first coordinate of a data sample and the first
+ * coordinate of the following one.
+ * @throws MalformedFileException If the file does not follow the correct format.
+ */
+void ParallelDataReader::parseInto(double *const buffer, const std::size_t stride) const {
+
+    const std::vector<Chunk> &fileChunks = this->chunks;
+    const auto fileChunksCount = static_cast<std::ptrdiff_t>(fileChunks.size());
+    const std::size_t fileThreadsCount = this->threadsCount;
+    std::vector<std::exception_ptr> errors(fileChunks.size());
+
+#pragma omp parallel for default(none) shared(fileChunks, fileChunksCount, buffer, stride, errors) \
+        num_threads(fileThreadsCount) schedule(dynamic, 1)
+    for (std::ptrdiff_t i = 0; i < fileChunksCount; i++) {
+        const Chunk &chunk = fileChunks[static_cast<std::size_t>(i)];
+        try {
+            this->parseChunk(chunk, buffer, stride);
+        } catch (...) {
+            errors[static_cast<std::size_t>(i)] = std::current_exception();
+        }
+    }
+
+    // Report the error about the first malformed line, if any
+    for (const std::exception_ptr &error : errors) {
+        if (error) {
+            std::rethrow_exception(error);
+        }
+    }
+}
+
+/**
+ * Checks the arguments of the constructor.
+ *
+ * @param inputFilePath Path of the file that contains the data to parse.
+ * @param firstColumnNumber Number of the first column of each line to parse.
+ * @param lastColumnNumber Number of the last column of each line to parse.
+ * @return The specified <code>inputFilePath</code>.
+ * @throws std::invalid_argument If the specified <code>lastColumnNumber</code> is smaller than
+ * the specified <code>firstColumnNumber</code>, or if the file with the specified path does not
+ * exist.
+ */
+const std::filesystem::path &ParallelDataReader::checkArguments(
+        const std::filesystem::path &inputFilePath,
+        const std::size_t firstColumnNumber,
+        const std::size_t lastColumnNumber) {
+
+    // Check the arguments
+    if (firstColumnNumber != 0 && lastColumnNumber != 0 && lastColumnNumber < firstColumnNumber) {
+        throw std::invalid_argument("Invalid first and last column numbers.");
+    }
+
+    // Check the existence of the file
+    if (!exists(inputFilePath)) {
+        using namespace std::literals::string_literals;
+        throw std::invalid_argument("The file '"s + inputFilePath.string() + "' does not exist.");
+    }
+
+    return inputFilePath;
+}
+
+/**
+ * Calls the specified function for each line of the specified chunk that must be parsed, i.e.,
+ * for each non-empty line between the first and the last line to parse.
+ *
+ * @tparam F Type of the function to call.
+ * @param chunk Chunk whose lines must be visited.
+ * @param function Function to call.
+ */
+template <typename F>
+void ParallelDataReader::forEachLine(const Chunk &chunk, F function) const {
+
+    // Number of the line being visited
+    std::size_t lineNumber = chunk.firstLineNumber;
+    // Visit all the lines of the chunk, up to the last requested one
+    const char *lineBegin = chunk.begin;
+    while (lineBegin != chunk.end &&
+           (this->lastLineNumber == 0 || lineNumber <= this->lastLineNumber)) {
+        // Find the end of the line
+        const auto *lineEnd = static_cast<const char *>(
+                std::memchr(lineBegin, '\n', static_cast<std::size_t>(chunk.end - lineBegin)));
+        if (lineEnd == nullptr) {
+            lineEnd = chunk.end;
+        }
+        // Ignore the carriage return of files with Windows line endings
+        const char *const contentEnd =
+                (lineEnd != lineBegin && *(lineEnd - 1) == '\r') ? lineEnd - 1 : lineEnd;
+
+        // Skip lines outside the range and empty lines
+        if (contentEnd != lineBegin &&
+            (this->firstLineNumber == 0 || lineNumber >= this->firstLineNumber)) {
+            function(lineBegin, contentEnd, lineNumber);
+        }
+
+        // Pass to the next line
+        lineNumber++;
+        lineBegin = (lineEnd == chunk.end) ? chunk.end : lineEnd + 1;
+    }
+}
+
+/**
+ * Counts the columns of the specified line that must be parsed.
+ *
+ * @param lineBegin Pointer to the first character of the line.
+ * @param lineEnd Pointer to the character following the last one of the line, excluding the line
+ * terminator.
+ * @return The number of columns of the line between the first and the last column to parse.
+ */
+std::size_t ParallelDataReader::countColumns(const char *const lineBegin,
+                                             const char *const lineEnd) const {
+
+    const auto columnsCount = static_cast<std::size_t>(std::count(lineBegin, lineEnd, ',')) + 1;
+    const std::size_t first = std::max<std::size_t>(this->firstColumnNumber, 1);
+    const std::size_t last = (this->lastColumnNumber == 0)
+                                     ? columnsCount
+                                     : std::min(this->lastColumnNumber, columnsCount);
+
+    return (last >= first) ? last - first + 1 : 0;
+}
+
+/**
+ * Parses the data samples of the specified chunk, placing them in the specified buffer.
+ *
+ * @param chunk Chunk to parse.
+ * @param buffer Buffer where the parsed data samples will be placed.
+ * @param stride Number of values between the first coordinate of a data sample and the first
+ * coordinate of the following one.
+ * @throws MalformedFileException If the chunk does not follow the correct format.
+ */
+void ParallelDataReader::parseChunk(const Chunk &chunk,
+                                    double *const buffer,
+                                    const std::size_t stride) const {
+
+    double *dataSample = &(buffer[chunk.firstDataSampleIndex * stride]);
+    this->forEachLine(chunk,
+                      [this, &dataSample, stride](const char *lineBegin,
+                                                  const char *lineEnd,
+                                                  const std::size_t lineNumber) -> void {
+                          // Parse the line
+                          const std::size_t lineDimension =
+                                  this->parseLine(lineBegin, lineEnd, lineNumber, dataSample);
+                          // Check if all the dimensions has been filled
+                          if (lineDimension != this->dimension) {
+                              using namespace std::literals::string_literals;
+                              throw MalformedFileException(
+                                      "Line"s + ' ' + std::to_string(lineNumber) + " contains " +
+                                      std::to_string(lineDimension) +
+                                      " coordinates, but the first line contains" + ' ' +
+                                      std::to_string(this->dimension) + " coordinates");
+                          }
+                          // Fill the remaining coordinates with 0
+                          std::fill(dataSample + this->dimension, dataSample + stride, 0.0);
+                          dataSample += stride;
+                      });
+}
+
+/**
+ * Parses a line of the file.
+ *
+ * @param lineBegin Pointer to the first character of the line.
+ * @param lineEnd Pointer to the character following the last one of the line, excluding the line
+ * terminator.
+ * @param lineNumber Number of the line.
+ * @param dataSample Pointer to the location where the first coordinate must be placed.
+ * @return The number of coordinates contained in the line.
+ * @throws MalformedFileException If a coordinate is not a valid number.
+ */
+std::size_t ParallelDataReader::parseLine(const char *const lineBegin,
+                                          const char *const lineEnd,
+                                          const std::size_t lineNumber,
+                                          double *const dataSample) const {
+
+    const char *columnBegin = lineBegin;
+    std::size_t columnNumber = 1;
+    std::size_t lineDimension = 0;
+    while (columnBegin != nullptr &&
+           (this->lastColumnNumber == 0 || columnNumber <= this->lastColumnNumber)) {
+        // Find the end of the column
+        const auto *columnEnd = static_cast<const char *>(
+                std::memchr(columnBegin, ',', static_cast<std::size_t>(lineEnd - columnBegin)));
+        if (this->firstColumnNumber == 0 || columnNumber >= this->firstColumnNumber) {
+            // Parse the coordinate, placing it only if the data sample has room for it
+            const double value =
+                    DataReader::parseDouble(columnBegin,
+                                            (columnEnd == nullptr) ? lineEnd : columnEnd,
+                                            lineNumber,
+                                            columnNumber);
+            if (lineDimension < this->dimension) {
+                dataSample[lineDimension] = value;
+            }
+            lineDimension++;
+        }
+        columnBegin = (columnEnd == nullptr) ? nullptr : columnEnd + 1;
+        columnNumber++;
+    }
+
+    return lineDimension;
+}
+}  // namespace cluster::test::data
@@ -0,0 +1,243 @@
+#ifndef FINAL_PROJECT_HPC_PARALLELDATAREADER_H
+#define FINAL_PROJECT_HPC_PARALLELDATAREADER_H
+
+#include "MappedFile.h"
+#include <cstddef>
+#include <filesystem>
+#include <vector>
+
+namespace cluster::test::data {
+/**
+ * Reader that reads the data from files using several threads.<br>
+ * The file is mapped in memory and split into chunks, each one starting at the beginning of a
+ * line, that are processed concurrently. When the reader is created, the lines of each chunk are
+ * counted, so that the number of data samples, their dimension and the position of the first data
+ * sample of each chunk are known before anything is parsed. Then, the data samples can be parsed
+ * directly into the buffer used by the clustering algorithm, with the layout it requires, without
+ * storing them in an intermediate data structure first.<br>
+ * The file must follow the same format accepted by <code>DataReader::readAndParseData</code>, and
+ * the same errors are reported.
+ *
+ * @author DeB
+ * @author Jonathan
+ * @version 1.0 2022-10-01
+ * @since 1.0
+ */
+class ParallelDataReader {
+
+public:
+    /**
+     * Maps the specified file in memory and counts the data samples it contains.
+     *
+     * @param inputFilePath Path of the file that contains the data to parse.
+     * @param firstLineNumber Number of the first line to parse of the file. If <code>0</code> is
+     * specified, then the lines are parsed starting from the first one in the file.
+     * @param lastLineNumber Number of the last line to parse of the file. If <code>0</code> is
+     * specified, then all the lines from the specified <code>firstLineNumber</code> to the last
+     * line of the file are parsed.
+     * @param firstColumnNumber Number of the first column of each line to parse as a coordinate of
+     * the point. If <code>0</code> is specified, then the first column of the line is parsed as the
+     * first coordinate of the point.
+     * @param lastColumnNumber Number of the last column of each line to parse as a coordinate of
+     * the point. If <code>0</code> is specified, then the last column of the line is parsed as the
+     * last coordinate of the point.
+     * @param threadsCount Number of threads to use to read the file. If not specified, or if
+     * <code>0</code> is specified, then the default number of threads computed by OpenMP is used.
+     * @throws IOException If an I/O error occurs while reading the file.
+     * @throws std::invalid_argument If the specified <code>lastColumnNumber</code> is smaller than
+     * the specified <code>firstColumnNumber</code>, or if the file with the specified path does not
+     * exist.
+     */
+    ParallelDataReader(const std::filesystem::path &inputFilePath,
+                       std::size_t firstLineNumber,
+                       std::size_t lastLineNumber,
+                       std::size_t firstColumnNumber,
+                       std::size_t lastColumnNumber,
+                       std::size_t threadsCount = 0);
+
+    /**
+     * Returns the number of data samples contained in the file.
+     *
+     * @return The number of data samples contained in the file.
+     */
+    std::size_t getDataSamplesCount() const noexcept;
+
+    /**
+     * Returns the dimension of each data sample, i.e., the number of coordinates of the first one.
+     *
+     * @return The dimension of each data sample, or <code>0</code> if the file contains no data
+     * samples.
+     */
+    std::size_t getDimension() const noexcept;
+
+    /**
+     * Parses the data samples contained in the file, placing them in the specified buffer.<br>
+     * The data sample <code>i</code> is placed starting from <code>buffer + i * stride</code>, and
+     * the coordinates between its last one and the first one of the following data sample are
+     * set to <code>0</code>. Therefore, the buffer <b>MUST BE</b> large enough to hold
+     * <code>getDataSamplesCount() * stride</code> values.
+     *
+     * @param buffer Buffer where the parsed data samples will be placed.
+     * @param stride Number of values between the first coordinate of a data sample and the first
+     * coordinate of the following one. It <b>MUST BE</b> greater than or equal to
+     * <code>getDimension()</code>.
+     * @throws MalformedFileException If the file does not follow the correct format. If more lines
+     * are malformed, the error about the first one is reported.
+     */
+    void parseInto(double *buffer, std::size_t stride) const;
+
+private:
+    /**
+     * Portion of the file processed by a single thread.
+     */
+    struct Chunk {
+        /**
+         * Pointer to the first character of the chunk, which is the first one of a line.
+         */
+        const char *begin;
+
+        /**
+         * Pointer to the character following the last one of the chunk.
+         */
+        const char *end;
+
+        /**
+         * Number of the line starting at the beginning of the chunk.
+         */
+        std::size_t firstLineNumber;
+
+        /**
+         * Number of data samples contained in the chunk.
+         */
+        std::size_t dataSamplesCount;
+
+        /**
+         * Index of the first data sample of the chunk among all the data samples of the file.
+         */
+        std::size_t firstDataSampleIndex;
+    };
+
+    /**
+     * Number of chunks each thread processes, on average. Using more chunks than threads balances
+     * the work when the lines have different lengths.
+     */
+    static const constexpr std::size_t CHUNKS_PER_THREAD = 4;
+
+    /**
+     * Minimum size, in bytes, of a chunk.
+     */
+    static const constexpr std::size_t MINIMUM_CHUNK_SIZE = 64 * 1024;
+
+    /**
+     * Content of the file.
+     */
+    const MappedFile file;
+
+    /**
+     * Number of the first line to parse of the file.
+     */
+    const std::size_t firstLineNumber;
+
+    /**
+     * Number of the last line to parse of the file.
+     */
+    const std::size_t lastLineNumber;
+
+    /**
+     * Number of the first column of each line to parse.
+     */
+    const std::size_t firstColumnNumber;
+
+    /**
+     * Number of the last column of each line to parse.
+     */
+    const std::size_t lastColumnNumber;
+
+    /**
+     * Number of threads to use to read the file.
+     */
+    const std::size_t threadsCount;
+
+    /**
+     * Chunks the file is split into.
+     */
+    std::vector<Chunk> chunks;
+
+    /**
+     * Number of data samples contained in the file.
+     */
+    std::size_t dataSamplesCount;
+
+    /**
+     * Dimension of each data sample.
+     */
+    std::size_t dimension;
+
+    /**
+     * Checks the arguments of the constructor.
+     *
+     * @param inputFilePath Path of the file that contains the data to parse.
+     * @param firstColumnNumber Number of the first column of each line to parse.
+     * @param lastColumnNumber Number of the last column of each line to parse.
+     * @return The specified <code>inputFilePath</code>.
+     * @throws std::invalid_argument If the specified <code>lastColumnNumber</code> is smaller than
+     * the specified <code>firstColumnNumber</code>, or if the file with the specified path does not
+     * exist.
+     */
+    static const std::filesystem::path &checkArguments(const std::filesystem::path &inputFilePath,
+                                                       std::size_t firstColumnNumber,
+                                                       std::size_t lastColumnNumber);
+
+    /**
+     * Calls the specified function for each line of the specified chunk that must be parsed, i.e.,
+     * for each non-empty line between the first and the last line to parse.
+     *
+     * @tparam F Type of the function to call.
+     * @param chunk Chunk whose lines must be visited.
+     * @param function Function to call. It receives the pointer to the first character of the
+     * line, the pointer to the character following the last one of the line, excluding the line
+     * terminator, and the number of the line.
+     */
+    template <typename F>
+    void forEachLine(const Chunk &chunk, F function) const;
+
+    /**
+     * Counts the columns of the specified line that must be parsed.
+     *
+     * @param lineBegin Pointer to the first character of the line.
+     * @param lineEnd Pointer to the character following the last one of the line, excluding the
+     * line terminator.
+     * @return The number of columns of the line between the first and the last column to parse.
+     */
+    std::size_t countColumns(const char *lineBegin, const char *lineEnd) const;
+
+    /**
+     * Parses the data samples of the specified chunk, placing them in the specified buffer.
+     *
+     * @param chunk Chunk to parse.
+     * @param buffer Buffer where the parsed data samples will be placed.
+     * @param stride Number of values between the first coordinate of a data sample and the first
+     * coordinate of the following one.
+     * @throws MalformedFileException If the chunk does not follow the correct format.
+     */
+    void parseChunk(const Chunk &chunk, double *buffer, std::size_t stride) const;
+
+    /**
+     * Parses a line of the file.
+     *
+     * @param lineBegin Pointer to the first character of the line.
+     * @param lineEnd Pointer to the character following the last one of the line, excluding the
+     * line terminator.
+     * @param lineNumber Number of the line.
+     * @param dataSample Pointer to the location where the first coordinate must be placed.
+     * @return The number of coordinates contained in the line. Only the first
+     * <code>dimension</code> ones are placed in <code>dataSample</code>.
+     * @throws MalformedFileException If a coordinate is not a valid number.
+     */
+    std::size_t parseLine(const char *lineBegin,
+                          const char *lineEnd,
+                          std::size_t lineNumber,
+                          double *dataSample) const;
+};
+}  // namespace cluster::test::data
+#endif  // FINAL_PROJECT_HPC_PARALLELDATAREADER_H
@@ -3,7 +3,7 @@
  *
  * @author DeB
  * @author Jonathan
- * @version 1.1.1 2022-08-16
+ * @version 1.1.2 2022-10-16
  * @since 1.0
  */
 #include <cstring>
@@ -74,7 +74,7 @@ int main(int argc, char *argv[]) {
     }
     // Extract the output path, if specified
     std::filesystem::path outputPath{".."};
-    if (argc == 4) {
+    if (argc >= 4) {
         outputPath = argv[3];
     } else {
         outputPath = outputPath / ".." / "test" / "resources" / "generated.data";
@@ -4,12 +4,16 @@
  *
  * @author DeB
  * @author Jonathan
- * @version 1.3 2022-09-11
+ * @version 1.15 2022-10-16
  * @since 1.0
  */
+#include "BoruvkaClustering.h"
 #include "DistanceComputers.h"
+#include "IncrementalClustering.h"
 #include "ParallelClustering.h"
+#include "PrimClustering.h"
 #include "SequentialClustering.h"
+#include "data/BinaryDataset.h"
 #include "data/DataReader.h"
 #include "data/DataWriter.h"
 #include "data/ResultsChecker.h"
@@ -18,17 +22,23 @@
 #include <cstring>
 #include <fstream>
 #include <iostream>
+#include <memory>
 #include <mm_malloc.h>
 #include <vector>
 
 #pragma clang diagnostic push
 #pragma clang diagnostic ignored "-Wunknown-pragmas"
+using cluster::parallel::BoruvkaClustering;
+using cluster::parallel::IncrementalClustering;
 using cluster::parallel::ParallelClustering;
+using cluster::parallel::PrimClustering;
 using cluster::sequential::SequentialClustering;
 using cluster::utils::ParallelDataIterator;
 using cluster::utils::Timer;
 using DistanceComputers = cluster::parallel::DistanceComputers;
+using ExecutionModes = cluster::parallel::ExecutionModes;
 using cluster::test::ResultsChecker;
+using cluster::test::data::BinaryDataset;
 using cluster::test::data::DataReader;
 using cluster::test::data::DataWriter;
 
@@ -45,13 +55,18 @@ const constexpr bool CHECK_ALIGNMENT = false;
  * dendrogram, <code>false</code> otherwise.
  * @tparam PS <code>true</code> if the parallel implementation of the clustering algorithm should
  * parallelize the computation of the square roots using threads, <code>false</code> otherwise.
+ * @tparam M Way the parallel implementation of the clustering algorithm should organize the threads
+ * executing the stages of each iteration.
  *
  * @author DeB
  * @author Jonathan
- * @version 1.2 2022-09-11
+ * @version 1.6 2022-10-16
  * @since 1.0
  */
-template <bool PD = true, bool PF = false, bool PS = false>
+template <bool PD = true,
+          bool PF = false,
+          bool PS = false,
+          ExecutionModes M = ExecutionModes::STAGED>
 class ClusteringAlgorithmExecutor {
 
 public:
@@ -85,6 +100,73 @@ public:
      * Measures the time taken to execute a parallel implementation of the clustering algorithm.
      *
      * @tparam C Distance computer to use to compute the distance between two data samples.
+     * @tparam S Type of the attributes of the data samples.
+     * @tparam D Type of the data structure/iterator holding the data samples to cluster.
+     * @param data Data to cluster.
+     * @param dataElementsCount Number of samples to cluster.
+     * @param dimension Dimension of the samples.
+     * @param threadCount Number of threads to use to parallelize the various steps of the
+     * implementation.
+     * @param piVector Vector where the computed values of <code>pi</code> will be placed.
+     * @param lambdaVector Vector where the computed values of <code>lambda</code> will be placed.
+     */
+    template <DistanceComputers C, typename S = double, ParallelDataIterator<S> D>
+    static void executeParallelClustering(const D &data,
+                                          const std::size_t dataElementsCount,
+                                          const std::size_t dimension,
+                                          const std::size_t threadCount,
+                                          std::vector<std::size_t> &piVector,
+                                          std::vector<double> &lambdaVector) {
+
+        // Zero the timers
+        Timer::zeroTimers();
+
+        // Execute the algorithm
+        auto piBegin = piVector.begin();
+        auto lambdaBegin = lambdaVector.begin();
+        ParallelClustering<PD, PF, PS, CHECK_ALIGNMENT, M>::template cluster<C, S>(
+                data,
+                dataElementsCount,
+                dimension,
+                piBegin,
+                lambdaBegin,
+                threadCount,
+                threadCount,
+                threadCount);
+    }
+
+    /**
+     * Measures the time taken to execute the parallel implementation of the clustering algorithm
+     * that reads the distances from a condensed distance matrix.
+     *
+     * @param distanceMatrix Condensed matrix of the distances between the samples to cluster.
+     * @param dataElementsCount Number of samples to cluster.
+     * @param threadCount Number of threads to use to parallelize the various steps of the
+     * implementation.
+     * @param piVector Vector where the computed values of <code>pi</code> will be placed.
+     * @param lambdaVector Vector where the computed values of <code>lambda</code> will be placed.
+     */
+    static inline void executeDistanceMatrixClustering(const double *distanceMatrix,
+                                                       const std::size_t dataElementsCount,
+                                                       const std::size_t threadCount,
+                                                       std::vector<std::size_t> &piVector,
+                                                       std::vector<double> &lambdaVector) {
+
+        // Zero the timers
+        Timer::zeroTimers();
+
+        // Execute the algorithm
+        auto piBegin = piVector.begin();
+        auto lambdaBegin = lambdaVector.begin();
+        ParallelClustering<PD, PF, PS, CHECK_ALIGNMENT, M>::clusterDistanceMatrix(
+                distanceMatrix, dataElementsCount, piBegin, lambdaBegin, threadCount, threadCount);
+    }
+
+    /**
+     * Measures the time taken to execute the implementation of the clustering algorithm based on
+     * the minimum spanning tree.
+     *
+     * @tparam C Distance computer to use to compute the distance between two data samples.
      * @tparam D Type of the data structure/iterator holding the data samples to cluster.
      * @param data Data to cluster.
      * @param dataElementsCount Number of samples to cluster.
@@ -95,12 +177,12 @@ public:
      * @param lambdaVector Vector where the computed values of <code>lambda</code> will be placed.
      */
     template <DistanceComputers C, ParallelDataIterator D>
-    static inline void executeParallelClustering(const D &data,
-                                                 const std::size_t dataElementsCount,
-                                                 const std::size_t dimension,
-                                                 const std::size_t threadCount,
-                                                 std::vector<std::size_t> &piVector,
-                                                 std::vector<double> &lambdaVector) {
+    static inline void executePrimClustering(const D &data,
+                                             const std::size_t dataElementsCount,
+                                             const std::size_t dimension,
+                                             const std::size_t threadCount,
+                                             std::vector<std::size_t> &piVector,
+                                             std::vector<double> &lambdaVector) {
 
         // Zero the timers
         Timer::zeroTimers();
@@ -108,14 +190,70 @@ public:
         // Execute the algorithm
         auto piBegin = piVector.begin();
         auto lambdaBegin = lambdaVector.begin();
-        ParallelClustering<PD, PF, PS, CHECK_ALIGNMENT>::template cluster<C>(data,
-                                                                             dataElementsCount,
-                                                                             dimension,
-                                                                             piBegin,
-                                                                             lambdaBegin,
-                                                                             threadCount,
-                                                                             threadCount,
-                                                                             threadCount);
+        PrimClustering<PD, PS, CHECK_ALIGNMENT>::template cluster<C>(
+                data, dataElementsCount, dimension, piBegin, lambdaBegin, threadCount, threadCount);
+    }
+
+    /**
+     * Measures the time taken to execute the implementation of the clustering algorithm based on
+     * the Borůvka algorithm accelerated by a kd-tree.
+     *
+     * @tparam D Type of the data structure/iterator holding the data samples to cluster.
+     * @param data Data to cluster.
+     * @param dataElementsCount Number of samples to cluster.
+     * @param dimension Dimension of the samples.
+     * @param threadCount Number of threads to use to parallelize the various steps of the
+     * implementation.
+     * @param piVector Vector where the computed values of <code>pi</code> will be placed.
+     * @param lambdaVector Vector where the computed values of <code>lambda</code> will be placed.
+     */
+    template <ParallelDataIterator D>
+    static inline void executeBoruvkaClustering(const D &data,
+                                                const std::size_t dataElementsCount,
+                                                const std::size_t dimension,
+                                                const std::size_t threadCount,
+                                                std::vector<std::size_t> &piVector,
+                                                std::vector<double> &lambdaVector) {
+
+        // Zero the timers
+        Timer::zeroTimers();
+
+        // Execute the algorithm
+        auto piBegin = piVector.begin();
+        auto lambdaBegin = lambdaVector.begin();
+        BoruvkaClustering<PD>::cluster(
+                data, dataElementsCount, dimension, piBegin, lambdaBegin, threadCount);
+    }
+
+    /**
+     * Measures the time taken to execute the implementation of the clustering algorithm that
+     * accepts the data samples incrementally, appending all of them one after the other.
+     *
+     * @tparam C Distance computer to use to compute the distance between two data samples.
+     * @param data Data to cluster.
+     * @param dataElementsCount Number of samples to cluster.
+     * @param dimension Dimension of the samples.
+     * @param threadCount Number of threads to use to parallelize the various steps of the
+     * implementation.
+     * @param piVector Vector where the computed values of <code>pi</code> will be placed.
+     * @param lambdaVector Vector where the computed values of <code>lambda</code> will be placed.
+     */
+    template <DistanceComputers C>
+    static void executeIncrementalClustering(const double *data,
+                                             const std::size_t dataElementsCount,
+                                             const std::size_t dimension,
+                                             const std::size_t threadCount,
+                                             std::vector<std::size_t> &piVector,
+                                             std::vector<double> &lambdaVector) {
+
+        // Zero the timers
+        Timer::zeroTimers();
+
+        // Execute the algorithm
+        IncrementalClustering<C, double, PD, PF> clustering{dimension, threadCount, threadCount};
+        clustering.appendBatch(data, dataElementsCount);
+        piVector = clustering.getPi();
+        lambdaVector = clustering.getLambda();
     }
 };
 
@@ -145,6 +283,14 @@ static constexpr std::false_type always_false{};
  * other, and aligned so that each data samples can be used in SSE instructions.
  * @param avxMMAlignedData Array where all the samples to cluster will be stored one after the
  * other, and aligned so that each data samples can be used in AVX instructions.
+ * @param avxMMAlignedFloatData Array where all the samples to cluster will be stored one after the
+ * other, converted to <code>float</code> and aligned so that each data samples can be used in AVX
+ * instructions.
+ * @param uniqueVectorFloatData Array where all the samples to cluster will be stored one after the
+ * other, converted to <code>float</code>.
+ * @param avxMMInterleavedData Array where all the samples to cluster will be stored in aligned
+ * blocks of <code>ParallelClustering::AVX_PACK_SIZE</code> samples whose attributes are
+ * interleaved.
  */
 void initializeDataStructures(const double *dataIterator,
                               std::size_t dataElementsCount,
@@ -154,7 +300,10 @@ void initializeDataStructures(const double *dataIterator,
                               std::vector<double *> &avxIndirectData,
                               double *&uniqueVectorData,
                               double *&sseMMAlignedData,
-                              double *&avxMMAlignedData);
+                              double *&avxMMAlignedData,
+                              float *&avxMMAlignedFloatData,
+                              float *&uniqueVectorFloatData,
+                              double *&avxMMInterleavedData);
 
 /**
  * Prints the usage to the console.
@@ -244,16 +393,54 @@ int main(int argc, char *argv[]) {
     }
     std::cout << " on" << ' ' << std::get<0>(dataset) << std::endl;
 
+    // Compute the path of the binary dataset file that contains the data samples already parsed
+    std::string binaryDatasetFileName{"./dataset-"};
+    binaryDatasetFileName += std::to_string(dataSetIndex);
+    binaryDatasetFileName += ".bin";
+    std::filesystem::path binaryDatasetPath{binaryDatasetFileName};
+    binaryDatasetPath = absolute(binaryDatasetPath).lexically_normal();
+
     // Read the data
     std::vector<double> data{};
-    std::size_t dimension = DataReader::readAndParseData(
-            std::filesystem::path{"../../test/resources"} / std::get<0>(dataset),
-            data,
-            0,
-            0,
-            std::get<1>(dataset),
-            std::get<2>(dataset));
-    std::size_t dataElementsCount = data.size() / dimension;
+    std::unique_ptr<BinaryDataset> binaryDataset{};
+    const double *dataIterator = nullptr;
+    // NOLINTBEGIN(cppcoreguidelines-init-variables)
+    std::size_t dimension;
+    std::size_t dataElementsCount;
+    // NOLINTEND(cppcoreguidelines-init-variables)
+    if (std::filesystem::exists(binaryDatasetPath)) {
+        // Map the data samples parsed by a previous execution
+        std::cout << "Reading the dataset from the file \'" << binaryDatasetPath.string() << '\''
+                  << std::endl;
+        binaryDataset = std::make_unique<BinaryDataset>(binaryDatasetPath);
+        dimension = binaryDataset->getDimension();
+        dataElementsCount = binaryDataset->getDataSamplesCount();
+        if (binaryDataset->getType() == BinaryDataset::Types::DOUBLE &&
+            binaryDataset->getStride() == dimension) {
+            dataIterator = binaryDataset->getData<double>();
+        } else {
+            data.resize(dataElementsCount * dimension);
+            binaryDataset->copyInto(data.data(), dimension);
+            dataIterator = data.data();
+        }
+    } else {
+        // Parse the data samples, storing them for the following executions
+        dimension = DataReader::readAndParseData(
+                std::filesystem::path{"../../test/resources"} / std::get<0>(dataset),
+                data,
+                0,
+                0,
+                std::get<1>(dataset),
+                std::get<2>(dataset));
+        dataElementsCount = data.size() / dimension;
+        dataIterator = data.data();
+        DataWriter::createBinaryDatasetFile(binaryDatasetPath,
+                                            dataIterator,
+                                            dataElementsCount,
+                                            dimension,
+                                            dimension,
+                                            sizeof(double));
+    }
 
     // Allocate the indirect data
     std::vector<double *> indirectData{};
@@ -263,9 +450,12 @@ int main(int argc, char *argv[]) {
     double *sseMMAlignedData = nullptr;
     double *avxMMAlignedData = nullptr;
     double *uniqueVectorData = nullptr;
+    float *avxMMAlignedFloatData = nullptr;
+    float *uniqueVectorFloatData = nullptr;
+    double *avxMMInterleavedData = nullptr;
 
     // Fill the data structures
-    initializeDataStructures(data.data(),
+    initializeDataStructures(dataIterator,
                              dataElementsCount,
                              dimension,
                              indirectData,
@@ -273,7 +463,10 @@ int main(int argc, char *argv[]) {
                              avxIndirectData,
                              uniqueVectorData,
                              sseMMAlignedData,
-                             avxMMAlignedData);
+                             avxMMAlignedData,
+                             avxMMAlignedFloatData,
+                             uniqueVectorFloatData,
+                             avxMMInterleavedData);
 
     // Resize pi and lambda
     std::vector<std::size_t> expectedPi{};
@@ -415,6 +608,135 @@ int main(int argc, char *argv[]) {
                                                                      threadsCount,
                                                                      piVector,
                                                                      lambdaVector);
+        } else if constexpr (VERSION == 12) {
+            ClusteringAlgorithmExecutor<true, true, true, ExecutionModes::PERSISTENT_TEAM>::
+                    executeParallelClustering<DistanceComputers::AVX_OPTIMIZED_NO_SQUARE_ROOT>(
+                            avxMMAlignedData,
+                            dataElementsCount,
+                            dimension,
+                            threadsCount,
+                            piVector,
+                            lambdaVector);
+        } else if constexpr (VERSION == 13) {
+            ClusteringAlgorithmExecutor<true, true, true>::executeParallelClustering<
+                    DistanceComputers::AVX512_NO_SQUARE_ROOT>(uniqueVectorData,
+                                                              dataElementsCount,
+                                                              dimension,
+                                                              threadsCount,
+                                                              piVector,
+                                                              lambdaVector);
+        } else if constexpr (VERSION == 14) {
+            ClusteringAlgorithmExecutor<true, true, true>::executeParallelClustering<
+                    DistanceComputers::AUTO>(uniqueVectorData,
+                                             dataElementsCount,
+                                             dimension,
+                                             threadsCount,
+                                             piVector,
+                                             lambdaVector);
+        } else if constexpr (VERSION == 15) {
+            ClusteringAlgorithmExecutor<true, true, true>::executeParallelClustering<
+                    DistanceComputers::AVX_OPTIMIZED_NO_SQUARE_ROOT,
+                    float>(avxMMAlignedFloatData,
+                           dataElementsCount,
+                           dimension,
+                           threadsCount,
+                           piVector,
+                           lambdaVector);
+        } else if constexpr (VERSION == 16) {
+            ClusteringAlgorithmExecutor<true, true, true, ExecutionModes::PIPELINED>::
+                    executeParallelClustering<DistanceComputers::AVX_OPTIMIZED_NO_SQUARE_ROOT>(
+                            avxMMAlignedData,
+                            dataElementsCount,
+                            dimension,
+                            threadsCount,
+                            piVector,
+                            lambdaVector);
+        } else if constexpr (VERSION == 17) {
+            ClusteringAlgorithmExecutor<true, false, true>::executePrimClustering<
+                    DistanceComputers::AVX_OPTIMIZED_NO_SQUARE_ROOT>(avxMMAlignedData,
+                                                                     dataElementsCount,
+                                                                     dimension,
+                                                                     threadsCount,
+                                                                     piVector,
+                                                                     lambdaVector);
+        } else if constexpr (VERSION == 18) {
+            ClusteringAlgorithmExecutor<true, false, false>::executeBoruvkaClustering(
+                    uniqueVectorData,
+                    dataElementsCount,
+                    dimension,
+                    threadsCount,
+                    piVector,
+                    lambdaVector);
+        } else if constexpr (VERSION == 19) {
+            ClusteringAlgorithmExecutor<true, true, false>::executeIncrementalClustering<
+                    DistanceComputers::AUTO>(uniqueVectorData,
+                                             dataElementsCount,
+                                             dimension,
+                                             threadsCount,
+                                             piVector,
+                                             lambdaVector);
+        } else if constexpr (VERSION == 20) {
+            ClusteringAlgorithmExecutor<true, true, true, ExecutionModes::BLOCKED>::
+                    executeParallelClustering<DistanceComputers::AVX_OPTIMIZED_NO_SQUARE_ROOT>(
+                            avxMMAlignedData,
+                            dataElementsCount,
+                            dimension,
+                            threadsCount,
+                            piVector,
+                            lambdaVector);
+        } else if constexpr (VERSION == 21) {
+            ClusteringAlgorithmExecutor<true, true, true, ExecutionModes::BLOCKED>::
+                    executeParallelClustering<DistanceComputers::NORM_EXPANSION>(avxMMAlignedData,
+                                                                                 dataElementsCount,
+                                                                                 dimension,
+                                                                                 threadsCount,
+                                                                                 piVector,
+                                                                                 lambdaVector);
+        } else if constexpr (VERSION == 22) {
+            ClusteringAlgorithmExecutor<true, true, true>::executeParallelClustering<
+                    DistanceComputers::AVX_FMA_NO_SQUARE_ROOT>(avxMMAlignedData,
+                                                               dataElementsCount,
+                                                               dimension,
+                                                               threadsCount,
+                                                               piVector,
+                                                               lambdaVector);
+        } else if constexpr (VERSION == 23) {
+            ClusteringAlgorithmExecutor<true, true, true>::executeParallelClustering<
+                    DistanceComputers::AVX_INTERLEAVED_NO_SQUARE_ROOT>(avxMMInterleavedData,
+                                                                       dataElementsCount,
+                                                                       dimension,
+                                                                       threadsCount,
+                                                                       piVector,
+                                                                       lambdaVector);
+        } else if constexpr (VERSION == 24) {
+            // Compute the condensed distance matrix in parallel before measuring the time, a row
+            // at a time, since the position of every row is known in advance
+            std::vector<double> distanceMatrix(dataElementsCount * (dataElementsCount - 1) / 2);
+#pragma omp parallel for default(none) shared(indirectData, dimension, distanceMatrix) \
+        shared(dataElementsCount) schedule(dynamic)
+            for (std::size_t i = 0; i < dataElementsCount; i++) {
+                const std::size_t rowBegin =
+                        ParallelClustering<>::computeCondensedIndex(i, i + 1, dataElementsCount);
+                for (std::size_t j = i + 1; j < dataElementsCount; j++) {
+                    double sum = 0;
+                    for (std::size_t k = 0; k < dimension; k++) {
+                        const double difference = indirectData[i][k] - indirectData[j][k];
+                        sum += difference * difference;
+                    }
+                    distanceMatrix[rowBegin + j - i - 1] = sqrt(sum);
+                }
+            }
+            ClusteringAlgorithmExecutor<true, true>::executeDistanceMatrixClustering(
+                    distanceMatrix.data(), dataElementsCount, threadsCount, piVector, lambdaVector);
+        } else if constexpr (VERSION == 25) {
+            ClusteringAlgorithmExecutor<true, true, true>::executeParallelClustering<
+                    DistanceComputers::AVX512_NO_SQUARE_ROOT,
+                    float>(uniqueVectorFloatData,
+                           dataElementsCount,
+                           dimension,
+                           threadsCount,
+                           piVector,
+                           lambdaVector);
         } else {
             always_false<VERSION>();
         }
@@ -450,7 +772,10 @@ int main(int argc, char *argv[]) {
 
     _mm_free(sseMMAlignedData);
     _mm_free(avxMMAlignedData);
+    _mm_free(avxMMAlignedFloatData);
+    _mm_free(avxMMInterleavedData);
     delete[] uniqueVectorData;
+    delete[] uniqueVectorFloatData;
 
     // Print the mean execution times to file
     std::ofstream meanTimesFile{argv[2], std::ios_base::app};
@@ -491,6 +816,14 @@ int main(int argc, char *argv[]) {
  * other, and aligned so that each data samples can be used in SSE instructions.
  * @param avxMMAlignedData Array where all the samples to cluster will be stored one after the
  * other, and aligned so that each data samples can be used in AVX instructions.
+ * @param avxMMAlignedFloatData Array where all the samples to cluster will be stored one after the
+ * other, converted to <code>float</code> and aligned so that each data samples can be used in AVX
+ * instructions.
+ * @param uniqueVectorFloatData Array where all the samples to cluster will be stored one after the
+ * other, converted to <code>float</code>.
+ * @param avxMMInterleavedData Array where all the samples to cluster will be stored in aligned
+ * blocks of <code>ParallelClustering::AVX_PACK_SIZE</code> samples whose attributes are
+ * interleaved.
  */
 void initializeDataStructures(const double *const dataIterator,
                               const std::size_t dataElementsCount,
@@ -500,11 +833,15 @@ void initializeDataStructures(const double *const dataIterator,
                               std::vector<double *> &avxIndirectData,
                               double *&uniqueVectorData,
                               double *&sseMMAlignedData,
-                              double *&avxMMAlignedData) {
+                              double *&avxMMAlignedData,
+                              float *&avxMMAlignedFloatData,
+                              float *&uniqueVectorFloatData,
+                              double *&avxMMInterleavedData) {
 
     // Compute the strides
     const std::size_t sseStride = ParallelClustering<>::computeSseDimension(dimension);
     const std::size_t avxStride = ParallelClustering<>::computeAvxDimension(dimension);
+    const std::size_t avxFloatStride = ParallelClustering<>::computeAvxDimension<float>(dimension);
 
     // Initialize the indirect data structures
     for (std::size_t i = 0; i < dataElementsCount; i++) {
@@ -540,17 +877,28 @@ void initializeDataStructures(const double *const dataIterator,
     // Compute the aligned data arrays size
     std::size_t sseSize = sizeof(double) * (dataElementsCount * sseStride);
     std::size_t avxSize = sizeof(double) * (dataElementsCount * avxStride);
+    std::size_t avxFloatSize = sizeof(float) * (dataElementsCount * avxFloatStride);
+    std::size_t avxInterleavedSize =
+            sizeof(double) *
+            ParallelClustering<>::computeAvxInterleavedSize(dataElementsCount, dimension);
 
     // Allocate the containers
     sseMMAlignedData = static_cast<double *>(
             _mm_malloc(sseSize, ParallelClustering<>::SSE_PACK_SIZE * sizeof(double)));
     avxMMAlignedData = static_cast<double *>(
             _mm_malloc(avxSize, ParallelClustering<>::AVX_PACK_SIZE * sizeof(double)));
+    avxMMAlignedFloatData = static_cast<float *>(
+            _mm_malloc(avxFloatSize, ParallelClustering<>::AVX_FLOAT_PACK_SIZE * sizeof(float)));
+    avxMMInterleavedData = static_cast<double *>(
+            _mm_malloc(avxInterleavedSize, ParallelClustering<>::AVX_PACK_SIZE * sizeof(double)));
     uniqueVectorData = new double[dataElementsCount * dimension];
+    uniqueVectorFloatData = new float[dataElementsCount * dimension];
 
     // Zero the aligned data
     memset(sseMMAlignedData, 0, sseSize);
     memset(avxMMAlignedData, 0, avxSize);
+    memset(avxMMAlignedFloatData, 0, avxFloatSize);
+    memset(avxMMInterleavedData, 0, avxInterleavedSize);
 
     // Fill the containers
     for (std::size_t i = 0; i < dataElementsCount; i++) {
@@ -559,6 +907,17 @@ void initializeDataStructures(const double *const dataIterator,
         memcpy(&(sseMMAlignedData[i * sseStride]), currentDataBegin, dimension * sizeof(double));
         memcpy(&(avxMMAlignedData[i * avxStride]), currentDataBegin, dimension * sizeof(double));
         memcpy(&(uniqueVectorData[i * dimension]), currentDataBegin, dimension * sizeof(double));
+        // Convert the values to float
+        for (std::size_t j = 0; j < dimension; j++) {
+            avxMMAlignedFloatData[i * avxFloatStride + j] = static_cast<float>(currentDataBegin[j]);
+            uniqueVectorFloatData[i * dimension + j] = static_cast<float>(currentDataBegin[j]);
+        }
+        // Interleave the values with the ones of the other samples of the same block
+        const std::size_t packSize = ParallelClustering<>::AVX_PACK_SIZE;
+        double *const block = &(avxMMInterleavedData[(i / packSize) * packSize * dimension]);
+        for (std::size_t j = 0; j < dimension; j++) {
+            block[j * packSize + i % packSize] = currentDataBegin[j];
+        }
     }
 }
 
@@ -582,6 +941,11 @@ DESCRIPTION
         - 0 tests the "accelerometer.csv" dataset, columns from 3 to 5;
         - 1 tests the "generated.data" dataset, columns from 1 to 45.
     
+    The first execution on a dataset stores the parsed data samples in the
+    binary dataset file dataset-DATASET_INDEX.bin, in the current directory.
+    The following executions map that file instead of parsing the dataset
+    again. Delete the file to parse the dataset again.
+    
     The measured execution times are appended to the file OUTPUT_FILE, which
     must be a valid path.
     
@@ -3,19 +3,30 @@
  *
  * @author DeB
  * @author Jonathan
- * @version 1.9 2022-06-22
+ * @version 1.28 2022-10-16
  * @since 1.0
  */
 #include "ClusteringAlgorithmExecutor.h"
+#include "ClusteringCheckpoint.h"
+#include "CopheneticIndex.h"
+#include "IncrementalClustering.h"
+#include "LinkageMatrixConverter.h"
+#include "Metrics.h"
 #include "ParallelClustering.h"
 #include "SequentialClustering.h"
+#include "TreeCutter.h"
 #include "Types.h"
 #include "cli/CliArgumentsParser.h"
+#include "data/BinaryDataset.h"
 #include "data/DataReader.h"
 #include "data/DataWriter.h"
+#include "data/ParallelDataReader.h"
 #include "data/ResultsChecker.h"
+#include <algorithm>
 #include <atomic>
+#include <chrono>
 #include <cmath>
+#include <cstdint>
 #include <cstring>
 #include <deque>
 #include <filesystem>
@@ -23,18 +34,35 @@
 #include <functional>
 #include <iomanip>
 #include <iostream>
+#include <limits>
+#include <memory>
+#include <numeric>
+#include <string>
+#include <type_traits>
 #include <unistd.h>
 #include <unordered_map>
+#include <utility>
 #include <vector>
 #include <xmmintrin.h>
 
+using cluster::parallel::ClusteringCheckpoint;
+using cluster::parallel::CopheneticIndex;
+using cluster::parallel::DistanceComputers;
+using cluster::parallel::DistanceKernelDispatcher;
+using cluster::parallel::IncrementalClustering;
+using cluster::parallel::InstructionSets;
+using cluster::parallel::LinkageMatrixConverter;
 using cluster::parallel::ParallelClustering;
+using cluster::parallel::TreeCutter;
 using cluster::sequential::SequentialClustering;
+using cluster::test::Metrics;
 using cluster::test::ResultsChecker;
 using cluster::test::cli::CliArguments;
 using cluster::test::cli::CliArgumentsParser;
+using cluster::test::data::BinaryDataset;
 using cluster::test::data::DataReader;
 using cluster::test::data::DataWriter;
+using cluster::test::data::ParallelDataReader;
 using cluster::test::main::ClusteringAlgorithmExecutor;
 
 /**
@@ -45,33 +73,80 @@ using cluster::test::main::ClusteringAlgorithmExecutor;
 void printThreadsCount(std::size_t threadsCount);
 
 /**
- * Initializes the data structures
+ * Initializes the data structures, parsing the data samples directly into the one used by the
+ * requested version of the algorithm. The data samples are parsed only once: all the other data
+ * structures are filled from it.<br>
+ * If the data samples are read from a binary dataset file that already stores them with the
+ * layout required by the requested version, then the mapped data samples are used directly,
+ * without copying them.
  *
+ * @tparam R Type of the reader, either <code>ParallelDataReader</code> or
+ * <code>BinaryDataset</code>.
  * @param isParallel <code>true</code> if the parallel implementation of the clustering
  * algorithm should be executed, <code>false</code> otherwise.
  * @param version Version of the algorithm to execute.
- * @param dimension Dimension of the data samples to cluster.
- * @param dataBegin Pointer to the first data sample to cluster.
- * @param dataElementsCount Number of data samples to cluster.
+ * @param reader Reader of the file containing the data samples to cluster.
+ * @param distanceMatrix Mapped file containing the condensed matrix of the distances between the
+ * data samples, used by the version 24 instead of computing it, or <code>nullptr</code>.
  * @param uniqueVectorData Data samples to cluster, stored as a unique array.
  * @param indirectData Data samples to cluster, stored as indirect pointers.
  * @param alignedIndirectData Data samples to cluster, stored as indirect pointers and
  * aligned for SSE or AVX.
- * @param alignedData Data samples to cluster, aligned for SSE or AVX.
+ * @param alignedData Data samples to cluster, aligned for SSE or AVX, or stored in blocks whose
+ * attributes are interleaved, or the condensed matrix of the distances between them.
+ * @param floatAlignedData Data samples to cluster, converted to <code>float</code> and aligned
+ * for AVX, or neither padded nor aligned if the version 25 is requested.
  * @param freeFunction Function that should be called to deallocate the memory this function has
- * allocated.
+ * allocated. It is set before the data samples are parsed, so it must be called even if this
+ * function throws.
+ * @throws MalformedFileException If the file does not follow the correct format.
  */
+template <typename R>
 void initializeDataStructure(bool isParallel,
                              std::size_t version,
-                             std::size_t dimension,
-                             const double *dataBegin,
-                             std::size_t dataElementsCount,
+                             R &reader,
+                             BinaryDataset *distanceMatrix,
                              double *&uniqueVectorData,
                              std::vector<double *> &indirectData,
                              std::vector<double *> &alignedIndirectData,
                              double *&alignedData,
+                             float *&floatAlignedData,
                              std::function<void()> &freeFunction);
 
+/**
+ * Computes the layout of the data structure holding the data samples used by the requested
+ * version of the algorithm.
+ *
+ * @param isParallel <code>true</code> if the parallel implementation of the clustering
+ * algorithm should be executed, <code>false</code> otherwise.
+ * @param version Version of the algorithm to execute.
+ * @param dimension Dimension of the data samples to cluster.
+ * @param stride Variable where the number of attributes between the first attribute of a data
+ * sample and the first attribute of the following one will be placed.
+ * @param alignment Variable where the alignment, in bytes, of every data sample will be placed.
+ * @return <code>true</code> if the data structure must be allocated as aligned memory,
+ * <code>false</code> otherwise.
+ */
+bool computeDataLayout(bool isParallel,
+                       std::size_t version,
+                       std::size_t dimension,
+                       std::size_t &stride,
+                       std::size_t &alignment);
+
+/**
+ * Computes in parallel the condensed matrix of the Euclidean distances between the specified data
+ * samples, i.e., the upper triangle of the matrix of the distances between all the pairs of data
+ * samples, without the diagonal, stored row by row.
+ *
+ * @param data Data samples, stored as indirect pointers.
+ * @param dimension Dimension of the data samples.
+ * @param distanceMatrix Array where the distances will be placed. It <b>MUST BE</b> large enough
+ * to hold <code>data.size() * (data.size() - 1) / 2</code> distances.
+ */
+void computeDistanceMatrix(const std::vector<double *> &data,
+                           std::size_t dimension,
+                           double *distanceMatrix);
+
 /**
  * Print the values of pi and lambda, as well as the distance matrix.
  *
@@ -91,6 +166,7 @@ void printValues(const std::vector<double *> &data,
  * @param filePath Path of the file containing the data samples to cluster.
  * @param data Data structure holding the samples to cluster.
  * @param dimension Dimension of the samples to cluster.
+ * @param metric Metric used to measure the distance between two data samples.
  * @param resultPi Data structure holding the values of <code>pi</code> computed by the clustering
  * algorithm.
  * @param resultLambda Data structure holding the values of <code>lambda</code> computed by the
@@ -108,11 +184,89 @@ void printValues(const std::vector<double *> &data,
 bool checkTest(const std::filesystem::path &filePath,
                const std::vector<double *> &data,
                std::size_t dimension,
+               Metrics metric,
                const std::vector<std::size_t> &resultPi,
                const std::vector<double> &resultLambda,
                bool usePreviousResults,
                const std::filesystem::path &previousResultsPath);
 
+/**
+ * Utility function that checks the flat clusters extracted from the dendrogram, by comparing the
+ * cuts extracted together, in parallel, by a <code>TreeCutter</code> with the ones obtained by
+ * applying the merges one at a time to a disjoint-set forest. The dendrogram is cut both at
+ * heights evenly spaced up to the highest merge, and into numbers of clusters evenly spaced up to
+ * the number of data samples.
+ *
+ * @param pi Data structure holding the values of <code>pi</code> computed by the clustering
+ * algorithm. It is not modified.
+ * @param lambda Data structure holding the values of <code>lambda</code> computed by the
+ * clustering algorithm. It is not modified.
+ * @param cutsCount Number of cuts of each kind.
+ * @return <code>true</code> if all the cuts are correct, <code>false</code> otherwise.
+ */
+bool checkCuts(std::vector<std::size_t> &pi, std::vector<double> &lambda, std::size_t cutsCount);
+
+/**
+ * Utility function that labels the data samples by applying the specified merges one at a time to
+ * a disjoint-set forest. The clusters are labelled from <code>0</code>, in decreasing order of
+ * their greatest data sample, as done by <code>TreeCutter</code>.
+ *
+ * @param pi Data structure holding the values of <code>pi</code>.
+ * @param merges Merges sorted by height, each one described by its height and by the index of the
+ * data sample that joins the cluster of <code>pi</code>.
+ * @param mergesCount Number of merges to apply, starting from the first one.
+ * @param labels Vector where the label of the cluster of every data sample will be placed.
+ * @return The number of clusters.
+ */
+std::size_t computeReferenceCut(const std::vector<std::size_t> &pi,
+                                const std::vector<std::pair<double, std::size_t>> &merges,
+                                std::size_t mergesCount,
+                                std::vector<std::size_t> &labels);
+
+/**
+ * Utility function that checks the cophenetic distances between all the pairs of data samples,
+ * by comparing the ones answered, in parallel, by a <code>CopheneticIndex</code> with the ones
+ * obtained by brute force, i.e., by applying the merges one at a time in increasing order of
+ * height and assigning the height of every merge to all the pairs of data samples it joins.
+ *
+ * @param pi Data structure holding the values of <code>pi</code> computed by the clustering
+ * algorithm. It is not modified.
+ * @param lambda Data structure holding the values of <code>lambda</code> computed by the
+ * clustering algorithm. It is not modified.
+ * @return <code>true</code> if all the cophenetic distances are correct, <code>false</code>
+ * otherwise.
+ */
+bool checkCopheneticDistances(std::vector<std::size_t> &pi, std::vector<double> &lambda);
+
+/**
+ * Utility function that checks the incremental clustering, by appending the data samples in
+ * batches of doubling size, and by comparing, after every batch, the dendrogram of the data
+ * samples appended so far with the one computed by clustering them all at once. The data samples
+ * are appended both with a distance computer that computes the distances, storing
+ * <code>pi</code> as 32-bit unsigned integers, and with one that defers their transformation.
+ *
+ * @tparam MT Policy describing the metric used to measure the distance between two data samples.
+ * @param data Data samples, stored as indirect pointers.
+ * @param dimension Dimension of the data samples.
+ * @return <code>true</code> if the incremental clustering is correct, <code>false</code>
+ * otherwise.
+ */
+template <typename MT>
+bool checkIncrementalClustering(const std::vector<double *> &data, std::size_t dimension);
+
+/**
+ * Utility function that checks the incremental clustering with the specified metric.
+ *
+ * @param data Data samples, stored as indirect pointers.
+ * @param dimension Dimension of the data samples.
+ * @param metric Metric used to measure the distance between two data samples.
+ * @return <code>true</code> if the incremental clustering is correct, <code>false</code>
+ * otherwise.
+ */
+bool checkIncrementalClustering(const std::vector<double *> &data,
+                                std::size_t dimension,
+                                Metrics metric);
+
 /**
  * Utility function that appends to the specified vector the specified elements.
  *
@@ -123,6 +277,14 @@ bool checkTest(const std::filesystem::path &filePath,
 template <typename T>
 void addAll(std::vector<T> &vector, std::initializer_list<T> elements);
 
+/**
+ * Utility function that returns the description of the specified metric.
+ *
+ * @param metric Metric to describe.
+ * @return The description of the metric.
+ */
+const char *getMetricDescription(Metrics metric);
+
 /**
  * Main entrypoint of the application.
  *
@@ -143,30 +305,75 @@ int main(int argc, char *argv[]) {
         std::cerr << "Invalid argument:" << ' ' << exception.what() << std::endl;
         return 1;
     }
-    // Read the data
-    std::vector<double> data{};
-    // NOLINTNEXTLINE(cppcoreguidelines-init-variables)
-    std::size_t dimension;
+    // Check that the CPU supports the instructions required by the requested version, so that
+    // the tests of the versions that cannot be executed are skipped
+    // NOLINTNEXTLINE(cppcoreguidelines-avoid-magic-numbers, readability-magic-numbers)
+    if (arguments.isParallel() &&
+        (arguments.getAlgorithmVersion() == 13 || arguments.getAlgorithmVersion() == 25) &&
+        DistanceKernelDispatcher::getSelectedInstructionSet() != InstructionSets::AVX512) {
+        std::cerr << "The parallel version" << ' ' << arguments.getAlgorithmVersion()
+                  << " requires a CPU supporting the AVX-512 instructions" << std::endl;
+        // NOLINTNEXTLINE(cppcoreguidelines-avoid-magic-numbers, readability-magic-numbers)
+        return 4;
+    }
+    // Open the input file, counting the data samples if it must be parsed
+    std::unique_ptr<ParallelDataReader> reader{};
+    std::unique_ptr<BinaryDataset> binaryDataset{};
     try {
-        dimension = DataReader::readAndParseData(arguments.getInputFilePath(),
-                                                 data,
-                                                 arguments.getFirstLineNumber(),
-                                                 arguments.getLastLineNumber(),
-                                                 arguments.getFirstColumnNumber(),
-                                                 arguments.getLastColumnNumber());
+        if (BinaryDataset::isBinaryDataset(arguments.getInputFilePath())) {
+            if (arguments.getFirstLineNumber() != 0 || arguments.getLastLineNumber() != 0 ||
+                arguments.getFirstColumnNumber() != 0 || arguments.getLastColumnNumber() != 0) {
+                throw std::invalid_argument(
+                        "The lines and columns ranges cannot be specified for binary datasets");
+            }
+            binaryDataset = std::make_unique<BinaryDataset>(arguments.getInputFilePath());
+        } else {
+            reader = std::make_unique<ParallelDataReader>(arguments.getInputFilePath(),
+                                                          arguments.getFirstLineNumber(),
+                                                          arguments.getLastLineNumber(),
+                                                          arguments.getFirstColumnNumber(),
+                                                          arguments.getLastColumnNumber());
+        }
     } catch (std::exception &exception) {
         // Inform the user about the wrong arguments
         std::cerr << "Malformed input file:" << ' ' << exception.what() << std::endl;
         return 3;
     }
+    const std::size_t dimension =
+            (binaryDataset) ? binaryDataset->getDimension() : reader->getDimension();
+    const std::size_t dataElementsCount =
+            (binaryDataset) ? binaryDataset->getDataSamplesCount() : reader->getDataSamplesCount();
     // Check the data validity
-    if (data.empty() || dimension == 0) {
+    if (dataElementsCount == 0 || dimension == 0) {
         std::cerr << "The input file" << ' ' << arguments.getInputFilePath() << " is empty"
                   << std::endl;
         return 3;
     }
 
-    std::size_t dataElementsCount = data.size() / dimension;
+    // Map the condensed distance matrix, if requested, checking that it holds one distance for
+    // every pair of data samples
+    std::unique_ptr<BinaryDataset> distanceMatrix{};
+    if (arguments.isDistanceMatrixInputEnabled()) {
+        try {
+            distanceMatrix =
+                    std::make_unique<BinaryDataset>(arguments.getDistanceMatrixInputFilePath());
+            if (distanceMatrix->getType() != BinaryDataset::Types::DOUBLE ||
+                distanceMatrix->getStride() != 1 ||
+                distanceMatrix->getAlignment() % sizeof(double) != 0 ||
+                distanceMatrix->getDataSamplesCount() !=
+                        dataElementsCount * (dataElementsCount - 1) / 2) {
+                using namespace std::literals::string_literals;
+                throw std::invalid_argument(
+                        "The file"s + ' ' + arguments.getDistanceMatrixInputFilePath().string() +
+                        " does not contain the aligned doubles of the condensed distance matrix "
+                        "of " + std::to_string(dataElementsCount) + " data samples");
+            }
+        } catch (std::exception &exception) {
+            // Inform the user about the wrong distance matrix
+            std::cerr << "Malformed distance matrix file:" << ' ' << exception.what() << std::endl;
+            return 3;
+        }
+    }
 
     // Extract the information about the clustering algorithm to execute
     bool isParallel = arguments.isParallel();
@@ -175,23 +382,84 @@ int main(int argc, char *argv[]) {
     std::size_t structuralFixThreadsCount = arguments.getStructuralFixThreadsCount();
     std::size_t sqrtComputationThreadsCount = arguments.getSqrtComputationThreadsCount();
 
+    // Check that the data samples can be read out of core, if requested, i.e., that the input file
+    // is a binary dataset of doubles with the layout required by the version
+    // NOLINTBEGIN(cppcoreguidelines-init-variables)
+    std::size_t stride;
+    std::size_t alignment;
+    // NOLINTEND(cppcoreguidelines-init-variables)
+    computeDataLayout(isParallel, version, dimension, stride, alignment);
+    if (arguments.isOutOfCoreEnabled() &&
+        (!binaryDataset || binaryDataset->getType() != BinaryDataset::Types::DOUBLE ||
+         binaryDataset->getStride() != stride || binaryDataset->getAlignment() % alignment != 0)) {
+        std::cerr << "The input file" << ' ' << arguments.getInputFilePath()
+                  << " is not a binary dataset of doubles with the layout required to be read out "
+                     "of core"
+                  << std::endl;
+        return 3;
+    }
+
     // Initialize the data structures holding the data samples to cluster
     double *uniqueVectorData = nullptr;
     std::vector<double *> indirectData{};
     std::vector<double *> alignedIndirectData{};
     double *alignedData = nullptr;
+    float *floatAlignedData = nullptr;
     std::function<void()> freeFunction{};
 
-    initializeDataStructure(isParallel,
-                            version,
-                            dimension,
-                            &(data.begin()[0]),
-                            dataElementsCount,
-                            uniqueVectorData,
-                            indirectData,
-                            alignedIndirectData,
-                            alignedData,
-                            freeFunction);
+    try {
+        if (binaryDataset) {
+            initializeDataStructure(isParallel,
+                                    version,
+                                    *binaryDataset,
+                                    distanceMatrix.get(),
+                                    uniqueVectorData,
+                                    indirectData,
+                                    alignedIndirectData,
+                                    alignedData,
+                                    floatAlignedData,
+                                    freeFunction);
+        } else {
+            initializeDataStructure(isParallel,
+                                    version,
+                                    *reader,
+                                    distanceMatrix.get(),
+                                    uniqueVectorData,
+                                    indirectData,
+                                    alignedIndirectData,
+                                    alignedData,
+                                    floatAlignedData,
+                                    freeFunction);
+        }
+    } catch (std::exception &exception) {
+        // Inform the user about the malformed file
+        std::cerr << "Malformed input file:" << ' ' << exception.what() << std::endl;
+        freeFunction();
+        return 3;
+    }
+    // Unmap the file, unless the data samples are read from it directly
+    reader.reset();
+
+    // Store the data samples in a binary dataset file, if requested
+    if (arguments.isBinaryOutputEnabled()) {
+        DataWriter::createBinaryDatasetFile(arguments.getBinaryOutputFilePath(),
+                                            indirectData.front(),
+                                            dataElementsCount,
+                                            dimension,
+                                            stride,
+                                            alignment);
+    }
+
+    // Store the condensed distance matrix in a binary dataset file, with a distance per data
+    // sample, if requested
+    if (arguments.isDistanceMatrixOutputEnabled()) {
+        DataWriter::createBinaryDatasetFile(arguments.getDistanceMatrixOutputFilePath(),
+                                            alignedData,
+                                            dataElementsCount * (dataElementsCount - 1) / 2,
+                                            1,
+                                            1,
+                                            sizeof(double));
+    }
 
     // Print the informational summary
     if (isParallel) {
@@ -209,16 +477,69 @@ int main(int argc, char *argv[]) {
     if (isParallel) {
         std::cout << " with:" << std::endl << "    ";
         printThreadsCount(distanceComputationThreadsCount);
-        std::cout << " to compute the distance" << std::endl << "    ";
-        if (version >= 5) {
+        if (version == 12 || version == 16) {
+            std::cout << " to compute the distance and to execute the structural fix" << std::endl
+                      << "    ";
+        } else if (version == 18) {
+            std::cout << " to search the closest data samples and to execute the square roots "
+                         "computation"
+                      << std::endl
+                      << "    ";
+        } else {
+            std::cout << " to compute the distance" << std::endl << "    ";
+        }
+        if (version >= 5 && version != 12 && version != 16 && version != 17 && version != 18) {
             printThreadsCount(structuralFixThreadsCount);
             std::cout << " to execute the structural fix" << std::endl << "    ";
         }
-        if (version == 11) {
+        if (version >= 11 && version != 18 && version != 19 && version != 24) {
             printThreadsCount(sqrtComputationThreadsCount);
             std::cout << " to execute the square roots computation" << std::endl << "    ";
         }
+        if (version == 14 || version == 19) {
+            std::cout << "the " << DistanceKernelDispatcher::getDescription(
+                                           DistanceKernelDispatcher::getSelectedInstructionSet())
+                      << " instructions to compute the distance" << std::endl
+                      << "    ";
+        }
+        if (version == 15 || version == 25) {
+            std::cout << "single precision attributes to compute the distance" << std::endl
+                      << "    ";
+        }
+        if (version == 21) {
+            std::cout << "the dot products of the samples to compute the distance" << std::endl
+                      << "    ";
+        }
+        if (version == 23) {
+            std::cout << "blocks of " << ParallelClustering<>::AVX_PACK_SIZE
+                      << " interleaved samples to compute the distance" << std::endl
+                      << "    ";
+        }
+        if (version == 24) {
+            std::cout << "the precomputed condensed distance matrix";
+            if (arguments.isDistanceMatrixInputEnabled()) {
+                std::cout << " read from '"
+                          << arguments.getDistanceMatrixInputFilePath().string() << '\'';
+            }
+            std::cout << std::endl << "    ";
+        }
+        if (arguments.getMetric() != Metrics::EUCLIDEAN) {
+            std::cout << "the " << getMetricDescription(arguments.getMetric())
+                      << " between the data samples" << std::endl
+                      << "    ";
+        }
+        if (arguments.isCompactPiEnabled()) {
+            std::cout << "32-bit unsigned integers to store pi" << std::endl << "    ";
+        }
+        if (arguments.isOutOfCoreEnabled()) {
+            std::cout << "the data samples read out of core, keeping the first "
+                      << arguments.getOutOfCoreResidentSetSize() << " bytes resident" << std::endl
+                      << "    ";
+        }
     } else {
+        if (arguments.getMetric() != Metrics::EUCLIDEAN) {
+            std::cout << " using the " << getMetricDescription(arguments.getMetric());
+        }
         std::cout << std::endl;
     }
 
@@ -228,22 +549,71 @@ int main(int argc, char *argv[]) {
     std::vector<double> lambda{};
     lambda.resize(dataElementsCount);
 
+    // Create the checkpoint, if requested, saving it every few seconds
+    std::unique_ptr<ClusteringCheckpoint> checkpoint{};
+    if (arguments.isCheckpointEnabled()) {
+        // NOLINTNEXTLINE(cppcoreguidelines-avoid-magic-numbers, readability-magic-numbers)
+        checkpoint = std::make_unique<ClusteringCheckpoint>(arguments.getCheckpointFilePath(),
+                                                            std::chrono::seconds{5},
+                                                            arguments.getCheckpointSamplesLimit());
+        if (std::filesystem::exists(arguments.getCheckpointFilePath())) {
+            std::cout << "Resuming the clustering from the checkpoint '"
+                      << arguments.getCheckpointFilePath().string() << '\'' << std::endl;
+        }
+    }
+
     // Execute the requested clustering algorithm
     ClusteringAlgorithmExecutor executor{dataElementsCount,
                                          dimension,
                                          distanceComputationThreadsCount,
                                          structuralFixThreadsCount,
-                                         sqrtComputationThreadsCount};
-    executor.executeClusteringAlgorithm(isParallel,
-                                        version,
-                                        indirectData,
-                                        alignedIndirectData,
-                                        alignedIndirectData,
-                                        alignedData,
-                                        alignedData,
-                                        uniqueVectorData,
-                                        pi.begin(),
-                                        lambda.begin());
+                                         sqrtComputationThreadsCount,
+                                         arguments.getMetric(),
+                                         checkpoint.get()};
+    try {
+        if (arguments.isOutOfCoreEnabled()) {
+            executor.executeOutOfCoreClusteringAlgorithm(version,
+                                                         arguments.getInputFilePath(),
+                                                         binaryDataset->getDataOffset(),
+                                                         stride,
+                                                         arguments.getOutOfCoreResidentSetSize(),
+                                                         pi.begin(),
+                                                         lambda.begin());
+        } else if (arguments.isCompactPiEnabled()) {
+            // Widen the values of pi once the clustering is completed
+            std::vector<std::uint32_t> compactPi(dataElementsCount);
+            executor.executeCompactPiClusteringAlgorithm(
+                    version, alignedData, compactPi.begin(), lambda.begin());
+            std::copy(compactPi.cbegin(), compactPi.cend(), pi.begin());
+        } else {
+            executor.executeClusteringAlgorithm(isParallel,
+                                                version,
+                                                indirectData,
+                                                alignedIndirectData,
+                                                alignedIndirectData,
+                                                alignedData,
+                                                alignedData,
+                                                uniqueVectorData,
+                                                floatAlignedData,
+                                                pi.begin(),
+                                                lambda.begin());
+        }
+    } catch (std::exception &exception) {
+        // Inform the user about the clustering that cannot be executed, e.g., since the checkpoint
+        // has been saved by a different clustering
+        std::cerr << "Unable to execute the clustering:" << ' ' << exception.what() << std::endl;
+        freeFunction();
+        return 3;
+    }
+
+    // Stop if the clustering has been interrupted, since pi and lambda are not complete
+    if (checkpoint && checkpoint->isInterrupted()) {
+        std::cout << "Clustering stopped after" << ' ' << arguments.getCheckpointSamplesLimit()
+                  << " samples, its state has been saved in the checkpoint '"
+                  << arguments.getCheckpointFilePath().string() << '\'' << std::endl;
+        freeFunction();
+        return 0;
+    }
 
     // Print the values
     // printValues(indirectData, dimension, pi, lambda);
@@ -260,6 +630,7 @@ int main(int argc, char *argv[]) {
         if (!checkTest(arguments.getInputFilePath(),
                        indirectData,
                        dimension,
+                       arguments.getMetric(),
                        pi,
                        lambda,
                        arguments.isPreviousTestResultsToBeUsed(),
@@ -267,6 +638,23 @@ int main(int argc, char *argv[]) {
             std::cerr << std::endl << "Test failed!" << std::endl << std::endl;
             return 1;
         }
+        // Check the cuts of the dendrogram, if requested
+        if (arguments.getTestCutsCount() != 0 &&
+            !checkCuts(pi, lambda, arguments.getTestCutsCount())) {
+            std::cerr << std::endl << "Test failed!" << std::endl << std::endl;
+            return 1;
+        }
+        // Check the cophenetic distances, if requested
+        if (arguments.isTestCopheneticEnabled() && !checkCopheneticDistances(pi, lambda)) {
+            std::cerr << std::endl << "Test failed!" << std::endl << std::endl;
+            return 1;
+        }
+        // Check the incremental clustering, if requested
+        if (arguments.isTestIncrementalEnabled() &&
+            !checkIncrementalClustering(indirectData, dimension, arguments.getMetric())) {
+            std::cerr << std::endl << "Test failed!" << std::endl << std::endl;
+            return 1;
+        }
         std::cout << std::endl << "Test completed successfully" << std::endl << std::endl;
     }
 
@@ -275,12 +663,28 @@ int main(int argc, char *argv[]) {
     if (arguments.isVisualizerOutputEnabled()) {
         std::cout << "yes" << std::endl;
 
+        // Gather the data samples, since they may be padded
+        std::vector<double> data{};
+        data.reserve(dataElementsCount * dimension);
+        for (const double *point : indirectData) {
+            data.insert(data.end(), point, point + dimension);
+        }
         DataWriter::createVisualizerOutputFile(
                 arguments.getVisualizerOutputFilePath(), data, dimension, pi, lambda);
     } else {
         std::cout << "no" << std::endl;
     }
 
+    // Generate the output file with the values of pi and lambda, if requested
+    std::cout << "Generating results file:" << ' ';
+    if (arguments.isResultsOutputEnabled()) {
+        std::cout << "yes" << std::endl;
+
+        DataWriter::writePiLambda(arguments.getResultsOutputFilePath(), pi, lambda);
+    } else {
+        std::cout << "no" << std::endl;
+    }
+
     // Generate the output file for the Mathematica script, if requested
     std::cout << "Generating Mathematica script file:" << ' ';
     if (arguments.isMathematicaOutputEnabled()) {
@@ -292,6 +696,18 @@ int main(int argc, char *argv[]) {
         std::cout << "no" << std::endl;
     }
 
+    // Generate the output file with the linkage matrix, if requested
+    std::cout << "Generating linkage matrix file:" << ' ';
+    if (arguments.isLinkageOutputEnabled()) {
+        std::cout << "yes" << std::endl;
+
+        DataWriter::writeLinkageMatrix(
+                arguments.getLinkageOutputFilePath(),
+                LinkageMatrixConverter<>::toLinkageMatrix(pi, lambda, dataElementsCount));
+    } else {
+        std::cout << "no" << std::endl;
+    }
+
     // Deallocate the memory
     freeFunction();
 
@@ -316,47 +732,104 @@ void printThreadsCount(const std::size_t threadsCount) {
 }
 
 /**
- * Initializes the data structures
+ * Initializes the data structures, parsing the data samples directly into the one used by the
+ * requested version of the algorithm. The data samples are parsed only once: all the other data
+ * structures are filled from it.<br>
+ * If the data samples are read from a binary dataset file that already stores them with the
+ * layout required by the requested version, then the mapped data samples are used directly,
+ * without copying them.
  *
+ * @tparam R Type of the reader, either <code>ParallelDataReader</code> or
+ * <code>BinaryDataset</code>.
  * @param isParallel <code>true</code> if the parallel implementation of the clustering
  * algorithm should be executed, <code>false</code> otherwise.
  * @param version Version of the algorithm to execute.
- * @param dimension Dimension of the data samples to cluster.
- * @param dataBegin Pointer to the first data sample to cluster.
- * @param dataElementsCount Number of data samples to cluster.
+ * @param reader Reader of the file containing the data samples to cluster.
  * @param uniqueVectorData Data samples to cluster, stored as a unique array.
  * @param indirectData Data samples to cluster, stored as indirect pointers.
  * @param alignedIndirectData Data samples to cluster, stored as indirect pointers and
  * aligned for SSE or AVX.
- * @param alignedData Data samples to cluster, aligned for SSE or AVX.
+ * @param alignedData Data samples to cluster, aligned for SSE or AVX, or stored in blocks whose
+ * attributes are interleaved, or the condensed matrix of the distances between them.
+ * @param floatAlignedData Data samples to cluster, converted to <code>float</code> and aligned
+ * for AVX, or neither padded nor aligned if the version 25 is requested.
  * @param freeFunction Function that should be called to deallocate the memory this function has
- * allocated.
+ * allocated. It is set before the data samples are parsed, so it must be called even if this
+ * function throws.
+ * @throws MalformedFileException If the file does not follow the correct format.
  */
+template <typename R>
 void initializeDataStructure(const bool isParallel,
                              const std::size_t version,
-                             const std::size_t dimension,
-                             const double *dataBegin,
-                             std::size_t dataElementsCount,
+                             R &reader,
+                             BinaryDataset *const distanceMatrix,
                              double *&uniqueVectorData,
                              std::vector<double *> &indirectData,
                              std::vector<double *> &alignedIndirectData,
                              double *&alignedData,
+                             float *&floatAlignedData,
                              std::function<void()> &freeFunction) {
 
-    // Fill two levels
-    for (std::size_t i = 0; i < dataElementsCount; i++) {
-        auto *point = new double[dimension];
-        // Copy the doubles
-        memcpy(point, &(dataBegin[i * dimension]), dimension * sizeof(double));
-        indirectData.push_back(point);
+    const std::size_t dimension = reader.getDimension();
+    const std::size_t dataElementsCount = reader.getDataSamplesCount();
+
+    // Data structure where the data samples are placed
+    double *parsedData = nullptr;
+    // NOLINTBEGIN(cppcoreguidelines-init-variables)
+    std::size_t stride;
+    std::size_t dataAlignment;
+    // NOLINTEND(cppcoreguidelines-init-variables)
+    const bool isAligned = computeDataLayout(isParallel, version, dimension, stride, dataAlignment);
+    std::function<void()> dataFreeFunction = []() noexcept -> void {};
+    if constexpr (std::is_same_v<R, BinaryDataset>) {
+        // Use the mapped data samples directly, if they have the required layout
+        if (reader.getType() == BinaryDataset::Types::DOUBLE && reader.getStride() == stride &&
+            reader.getAlignment() % dataAlignment == 0) {
+            parsedData = reader.template getData<double>();
+        }
     }
-    // Set the de-allocation function
-    std::function<void()> indirectDataFreeFunction = [&indirectData]() noexcept -> void {
-        for (double *point : indirectData) {
-            delete[] point;
+    if (parsedData == nullptr) {
+        if (isAligned) {
+            // Create the data structure, that is filled directly by the reader
+            std::size_t size = sizeof(double) * (dataElementsCount * stride);
+            alignedData = static_cast<double *>(_mm_malloc(size, dataAlignment));
+            parsedData = alignedData;
+            // Set the de-allocation function
+            dataFreeFunction = [&alignedData]() noexcept -> void {
+                _mm_free(alignedData);
+            };
+        } else {
+            // Create the data structure, without aligning or padding the data samples
+            uniqueVectorData = new double[dataElementsCount * dimension];
+            parsedData = uniqueVectorData;
+            // Set the de-allocation function
+            dataFreeFunction = [&uniqueVectorData]() noexcept -> void {
+                delete[] uniqueVectorData;
+            };
         }
-    };
-    freeFunction = indirectDataFreeFunction;
+        freeFunction = dataFreeFunction;
+
+        // Fill the data structure
+        if constexpr (std::is_same_v<R, BinaryDataset>) {
+            reader.copyInto(parsedData, stride);
+        } else {
+            reader.parseInto(parsedData, stride);
+        }
+    } else {
+        // The mapped data samples are released together with the reader
+        if (isAligned) {
+            alignedData = parsedData;
+        } else {
+            uniqueVectorData = parsedData;
+        }
+        freeFunction = dataFreeFunction;
+    }
+
+    // Fill two levels, pointing to the parsed data samples
+    indirectData.reserve(dataElementsCount);
+    for (std::size_t i = 0; i < dataElementsCount; i++) {
+        indirectData.push_back(&(parsedData[i * stride]));
+    }
 
     if (version != 1) {
         if (isParallel) {
@@ -380,7 +853,7 @@ void initializeDataStructure(const bool isParallel,
                         auto *point = static_cast<double *>(_mm_malloc(
                                 pointDimension * sizeof(double), alignment * sizeof(double)));
                         // Copy the doubles
-                        memcpy(point, &(dataBegin[i * dimension]), dimension * sizeof(double));
+                        memcpy(point, indirectData[i], dimension * sizeof(double));
                         // Fill the remaining coordinates with 0
                         memset(&(point[dimension]),
                                0,
@@ -390,66 +863,182 @@ void initializeDataStructure(const bool isParallel,
                         alignedIndirectData.push_back(point);
                     }
                     // Set the de-allocation function
-                    freeFunction = [&alignedIndirectData,
-                                    indirectDataFreeFunction]() noexcept -> void {
-                        indirectDataFreeFunction();
+                    freeFunction = [&alignedIndirectData, dataFreeFunction]() noexcept -> void {
+                        dataFreeFunction();
                         for (double *point : alignedIndirectData) {
                             _mm_free(point);
                         }
                     };
                 } break;
-                case 4:
-                case 8:
-                case 9:
-                case 10:
-                case 11: {
-                    // Compute the alignment and dimension
+                case 15:
+                case 25: {
+                    // Compute the dimension of the data samples once converted to float, which
+                    // are padded for AVX only by the version 15
                     const std::size_t pointDimension =
-                            (version == 8) ? ParallelClustering<>::computeSseDimension(dimension)
-                                           : ParallelClustering<>::computeAvxDimension(dimension);
-                    const std::size_t alignment = (version == 8)
-                                                          ? ParallelClustering<>::SSE_PACK_SIZE
-                                                          : ParallelClustering<>::AVX_PACK_SIZE;
+                            (version == 15)
+                                    ? ParallelClustering<>::computeAvxDimension<float>(dimension)
+                                    : dimension;
+                    const std::size_t alignment = ParallelClustering<>::AVX_FLOAT_PACK_SIZE;
                     // Create and clear the data structure
-                    std::size_t size = sizeof(double) * (dataElementsCount * pointDimension);
+                    std::size_t size = sizeof(float) * (dataElementsCount * pointDimension);
+                    floatAlignedData =
+                            static_cast<float *>(_mm_malloc(size, alignment * sizeof(float)));
+                    memset(floatAlignedData, 0, size);
+
+                    // Fill the data structure, converting the attributes to float
+                    for (std::size_t i = 0; i < dataElementsCount; i++) {
+                        for (std::size_t j = 0; j < dimension; j++) {
+                            floatAlignedData[i * pointDimension + j] =
+                                    static_cast<float>(indirectData[i][j]);
+                        }
+                    }
+                    // Set the de-allocation function
+                    freeFunction = [&floatAlignedData, dataFreeFunction]() noexcept -> void {
+                        dataFreeFunction();
+                        _mm_free(floatAlignedData);
+                    };
+                } break;
+                case 23: {
+                    // Create and clear the data structure, whose blocks hold the attributes of
+                    // AVX_PACK_SIZE data samples interleaved
+                    const std::size_t packSize = ParallelClustering<>::AVX_PACK_SIZE;
+                    std::size_t size =
+                            sizeof(double) * ParallelClustering<>::computeAvxInterleavedSize(
+                                                     dataElementsCount, dimension);
                     alignedData =
-                            static_cast<double *>(_mm_malloc(size, alignment * sizeof(double)));
+                            static_cast<double *>(_mm_malloc(size, packSize * sizeof(double)));
                     memset(alignedData, 0, size);
 
-                    // Fill the indirect aligned data structure
+                    // Fill the data structure, placing the j-th attribute of the i-th data sample
+                    // at the j-th row of its block
                     for (std::size_t i = 0; i < dataElementsCount; i++) {
-                        memcpy(&(alignedData[i * pointDimension]),
-                               &(dataBegin[i * dimension]),
-                               dimension * sizeof(double));
+                        double *const block = &(alignedData[(i / packSize) * packSize * dimension]);
+                        for (std::size_t j = 0; j < dimension; j++) {
+                            block[j * packSize + i % packSize] = indirectData[i][j];
+                        }
                     }
                     // Set the de-allocation function
-                    freeFunction = [&alignedData, indirectDataFreeFunction]() noexcept -> void {
-                        indirectDataFreeFunction();
+                    freeFunction = [&alignedData, dataFreeFunction]() noexcept -> void {
+                        dataFreeFunction();
                         _mm_free(alignedData);
                     };
                 } break;
+                case 24: {
+                    // Use the mapped condensed distance matrix, if specified, since it is released
+                    // together with its file
+                    if (distanceMatrix != nullptr) {
+                        alignedData = distanceMatrix->getData<double>();
+                        break;
+                    }
+                    // Create the condensed matrix of the distances between the data samples
+                    alignedData = new double[dataElementsCount * (dataElementsCount - 1) / 2];
+                    // Set the de-allocation function
+                    freeFunction = [&alignedData, dataFreeFunction]() noexcept -> void {
+                        dataFreeFunction();
+                        delete[] alignedData;
+                    };
+                    computeDistanceMatrix(indirectData, dimension, alignedData);
+                } break;
+                case 4:
+                case 8:
+                case 9:
+                case 10:
+                case 11:
+                case 12:
+                case 13:
+                case 14:
+                case 16:
+                case 17:
+                case 18:
+                case 19:
+                case 20:
+                case 21:
+                case 22:
+                    // The data samples have already been placed in the right data structure
+                    break;
                 default:
                     std::cerr << "The parallel version" << ' ' << version << " is not implemented."
                               << std::endl;
                     exit(1);
             }
-        } else if (version == 2) {
-            // Create the data structure
-            uniqueVectorData = new double[dataElementsCount * dimension];
-            // Fill data structure
-            memcpy(uniqueVectorData, dataBegin, (dataElementsCount * dimension) * sizeof(double));
-            // Set the de-allocation function
-            freeFunction = [&uniqueVectorData, indirectDataFreeFunction]() noexcept -> void {
-                indirectDataFreeFunction();
-                delete[] uniqueVectorData;
-            };
-        } else {
+        } else if (version != 2) {
             std::cerr << "The version" << ' ' << version << " is not implemented." << std::endl;
             exit(1);
         }
     }
 }
 
+/**
+ * Computes the layout of the data structure holding the data samples used by the requested
+ * version of the algorithm.
+ *
+ * @param isParallel <code>true</code> if the parallel implementation of the clustering
+ * algorithm should be executed, <code>false</code> otherwise.
+ * @param version Version of the algorithm to execute.
+ * @param dimension Dimension of the data samples to cluster.
+ * @param stride Variable where the number of attributes between the first attribute of a data
+ * sample and the first attribute of the following one will be placed.
+ * @param alignment Variable where the alignment, in bytes, of every data sample will be placed.
+ * @return <code>true</code> if the data structure must be allocated as aligned memory,
+ * <code>false</code> otherwise.
+ */
+bool computeDataLayout(const bool isParallel,
+                       const std::size_t version,
+                       const std::size_t dimension,
+                       std::size_t &stride,
+                       std::size_t &alignment) {
+
+    if (isParallel && (version == 4 || (version >= 8 && version <= 12) || version == 16 ||
+                       version == 17 || (version >= 20 && version <= 22))) {
+        // Compute the alignment and dimension
+        stride = (version == 8) ? ParallelClustering<>::computeSseDimension(dimension)
+                                : ParallelClustering<>::computeAvxDimension(dimension);
+        alignment = ((version == 8) ? ParallelClustering<>::SSE_PACK_SIZE
+                                    : ParallelClustering<>::AVX_PACK_SIZE) *
+                    sizeof(double);
+        return true;
+    }
+
+    // The data samples are neither aligned nor padded
+    stride = dimension;
+    alignment = sizeof(double);
+    return false;
+}
+
+/**
+ * Computes in parallel the condensed matrix of the Euclidean distances between the specified data
+ * samples, i.e., the upper triangle of the matrix of the distances between all the pairs of data
+ * samples, without the diagonal, stored row by row.
+ *
+ * @param data Data samples, stored as indirect pointers.
+ * @param dimension Dimension of the data samples.
+ * @param distanceMatrix Array where the distances will be placed. It <b>MUST BE</b> large enough
+ * to hold <code>data.size() * (data.size() - 1) / 2</code> distances.
+ */
+void computeDistanceMatrix(const std::vector<double *> &data,
+                           const std::size_t dimension,
+                           double *const distanceMatrix) {
+
+    const std::size_t dataSamplesCount = data.size();
+
+    // Compute every row independently, since its position in the matrix is known in advance. The
+    // rows get shorter and shorter, so they are distributed dynamically
+#pragma omp parallel for default(none) shared(data, dimension, distanceMatrix, dataSamplesCount) \
+        schedule(dynamic)
+    for (std::size_t i = 0; i < dataSamplesCount; i++) {
+        double *const row = &(distanceMatrix[ParallelClustering<>::computeCondensedIndex(
+                i, i + 1, dataSamplesCount)]);
+        for (std::size_t j = i + 1; j < dataSamplesCount; j++) {
+            double sum = 0;
+            for (std::size_t k = 0; k < dimension; k++) {
+                const double difference = data[i][k] - data[j][k];
+                sum += difference * difference;
+            }
+            row[j - i - 1] = sqrt(sum);
+        }
+    }
+}
+
 /**
  * Print the values of pi and lambda, as well as the distance matrix.
  *
@@ -514,6 +1103,7 @@ void printValues(const std::vector<double *> &data,
  * @param filePath Path of the file containing the data samples to cluster.
  * @param data Data structure holding the samples to cluster.
  * @param dimension Dimension of the samples to cluster.
+ * @param metric Metric used to measure the distance between two data samples.
  * @param resultPi Data structure holding the values of <code>pi</code> computed by the clustering
  * algorithm.
  * @param resultLambda Data structure holding the values of <code>lambda</code> computed by the
@@ -531,6 +1121,7 @@ void printValues(const std::vector<double *> &data,
 bool checkTest(const std::filesystem::path &filePath,
                const std::vector<double *> &data,
                const std::size_t dimension,
+               const Metrics metric,
                const std::vector<std::size_t> &resultPi,
                const std::vector<double> &resultLambda,
                const bool usePreviousResults,
@@ -542,12 +1133,13 @@ bool checkTest(const std::filesystem::path &filePath,
 
     std::string fileName{filePath.filename().string()};
 
-    // Check if the test is a well-known test
+    // Check if the test is a well-known test, whose results are known for the Euclidean metric
+    const bool isEuclidean = metric == Metrics::EUCLIDEAN;
     // NOLINTBEGIN(cppcoreguidelines-avoid-magic-numbers, readability-magic-numbers)
-    if (fileName == "two-points.data") {
+    if (isEuclidean && fileName == "two-points.data") {
         addAll<std::size_t>(expectedPi, {1, 1});
         addAll(expectedLambda, {3.6055, std::numeric_limits<double>::infinity()});
-    } else if (fileName == "samples.data") {
+    } else if (isEuclidean && fileName == "samples.data") {
         addAll<std::size_t>(expectedPi, {1, 4, 3, 4, 5, 5});
         addAll(expectedLambda,
                {0.4472,                                   // A
@@ -557,7 +1149,7 @@ bool checkTest(const std::filesystem::path &filePath,
                 1.2806,                                   // E
                 std::numeric_limits<double>::infinity()}  // F
         );
-    } else if (fileName == "same-distance.data") {
+    } else if (isEuclidean && fileName == "same-distance.data") {
         addAll<std::size_t>(expectedPi, {3, 2, 3, 3});
         addAll(expectedLambda,
                {
@@ -566,7 +1158,7 @@ bool checkTest(const std::filesystem::path &filePath,
                        2.2360,                                  // C
                        std::numeric_limits<double>::infinity()  // D
                });
-    } else if (fileName == "slide.data") {
+    } else if (isEuclidean && fileName == "slide.data") {
         addAll<std::size_t>(expectedPi, {1, 5, 5, 5, 5, 5});
         addAll(expectedLambda,
                {0.7071,                                   // 1
@@ -596,8 +1188,29 @@ bool checkTest(const std::filesystem::path &filePath,
             cluster::utils::Timer::zeroTimers();
             std::cout << "Running sequential implementation of '" << fileName
                       << "' to check the results" << std::endl;
-            SequentialClustering::cluster(
-                    data.begin(), data.size(), dimension, piIterator, lambdaIterator);
+            switch (metric) {
+                case Metrics::EUCLIDEAN:
+                default:
+                    SequentialClustering::cluster(
+                            data.begin(), data.size(), dimension, piIterator, lambdaIterator);
+                    break;
+                case Metrics::MANHATTAN:
+                    SequentialClustering::cluster<cluster::utils::ManhattanMetric>(
+                            data.begin(), data.size(), dimension, piIterator, lambdaIterator);
+                    break;
+                case Metrics::CHEBYSHEV:
+                    SequentialClustering::cluster<cluster::utils::ChebyshevMetric>(
+                            data.begin(), data.size(), dimension, piIterator, lambdaIterator);
+                    break;
+                case Metrics::COSINE:
+                    SequentialClustering::cluster<cluster::utils::CosineMetric>(
+                            data.begin(), data.size(), dimension, piIterator, lambdaIterator);
+                    break;
+                case Metrics::MINKOWSKI:
+                    SequentialClustering::cluster<cluster::utils::MinkowskiMetric<3>>(
+                            data.begin(), data.size(), dimension, piIterator, lambdaIterator);
+                    break;
+            }
             // Store the results, if requested
             if (usePreviousResults) {
                 DataWriter::writePiLambda(previousResultsPath, expectedPi, expectedLambda);
@@ -617,6 +1230,339 @@ bool checkTest(const std::filesystem::path &filePath,
                                         expectedLambda.cend());
 }
 
+/**
+ * Utility function that checks the flat clusters extracted from the dendrogram, by comparing the
+ * cuts extracted together, in parallel, by a <code>TreeCutter</code> with the ones obtained by
+ * applying the merges one at a time to a disjoint-set forest. The dendrogram is cut both at
+ * heights evenly spaced up to the highest merge, and into numbers of clusters evenly spaced up to
+ * the number of data samples.
+ *
+ * @param pi Data structure holding the values of <code>pi</code> computed by the clustering
+ * algorithm. It is not modified.
+ * @param lambda Data structure holding the values of <code>lambda</code> computed by the
+ * clustering algorithm. It is not modified.
+ * @param cutsCount Number of cuts of each kind.
+ * @return <code>true</code> if all the cuts are correct, <code>false</code> otherwise.
+ */
+bool checkCuts(std::vector<std::size_t> &pi,
+               std::vector<double> &lambda,
+               const std::size_t cutsCount) {
+
+    const std::size_t dataSamplesCount = pi.size();
+
+    // Sort the merges by height, breaking the ties by index, as done by the cutter
+    std::vector<std::pair<double, std::size_t>> merges{};
+    merges.reserve(dataSamplesCount - 1);
+    for (std::size_t i = 0; i < dataSamplesCount - 1; i++) {
+        merges.emplace_back(lambda[i], i);
+    }
+    std::sort(merges.begin(), merges.end());
+
+    // Compute the heights and the numbers of clusters of the cuts
+    const double highestMerge = (merges.empty()) ? 0 : merges.back().first;
+    std::vector<double> heights{};
+    std::vector<std::size_t> clustersCounts{};
+    for (std::size_t j = 0; j < cutsCount; j++) {
+        heights.push_back(highestMerge * static_cast<double>(j + 1) /
+                          static_cast<double>(cutsCount));
+        clustersCounts.push_back(std::max<std::size_t>(1, (j + 1) * dataSamplesCount / cutsCount));
+    }
+
+    // Extract all the cuts of each kind together
+    const TreeCutter<> cutter{pi, lambda, dataSamplesCount};
+    std::vector<std::size_t> heightLabels{};
+    const std::vector<std::size_t> heightClustersCounts = cutter.cutTree(heights, heightLabels);
+    std::vector<std::size_t> clustersLabels{};
+    const std::vector<std::size_t> clustersClustersCounts =
+            cutter.cutTreeIntoClusters(clustersCounts, clustersLabels);
+
+    // Compare every cut with the one obtained by applying the merges one at a time. Both kinds of
+    // cuts apply the first merges in increasing order of height
+    std::vector<std::size_t> expectedLabels{};
+    for (std::size_t j = 0; j < cutsCount; j++) {
+        for (const bool isHeightCut : {true, false}) {
+            const std::size_t mergesCount =
+                    (isHeightCut)
+                            ? static_cast<std::size_t>(
+                                      std::upper_bound(merges.cbegin(),
+                                                       merges.cend(),
+                                                       std::pair{heights[j],
+                                                                 dataSamplesCount}) -
+                                      merges.cbegin())
+                            : dataSamplesCount - clustersCounts[j];
+            const std::size_t expectedClustersCount =
+                    computeReferenceCut(pi, merges, mergesCount, expectedLabels);
+            const std::size_t clustersCount =
+                    (isHeightCut) ? heightClustersCounts[j] : clustersClustersCounts[j];
+            const std::size_t *const labels = (isHeightCut)
+                                                      ? &(heightLabels[j * dataSamplesCount])
+                                                      : &(clustersLabels[j * dataSamplesCount]);
+            if (clustersCount != expectedClustersCount ||
+                !std::equal(expectedLabels.cbegin(), expectedLabels.cend(), labels)) {
+                std::cerr << "Error in the cut";
+                if (isHeightCut) {
+                    std::cerr << " at height" << ' ' << heights[j];
+                } else {
+                    std::cerr << " into" << ' ' << clustersCounts[j] << " clusters";
+                }
+                std::cerr << ':' << ' ' << "expected" << ' ' << expectedClustersCount
+                          << " clusters, found" << ' ' << clustersCount << std::endl;
+                return false;
+            }
+        }
+    }
+
+    return true;
+}
+
+/**
+ * Utility function that labels the data samples by applying the specified merges one at a time to
+ * a disjoint-set forest. The clusters are labelled from <code>0</code>, in decreasing order of
+ * their greatest data sample, as done by <code>TreeCutter</code>.
+ *
+ * @param pi Data structure holding the values of <code>pi</code>.
+ * @param merges Merges sorted by height, each one described by its height and by the index of the
+ * data sample that joins the cluster of <code>pi</code>.
+ * @param mergesCount Number of merges to apply, starting from the first one.
+ * @param labels Vector where the label of the cluster of every data sample will be placed.
+ * @return The number of clusters.
+ */
+std::size_t computeReferenceCut(const std::vector<std::size_t> &pi,
+                                const std::vector<std::pair<double, std::size_t>> &merges,
+                                const std::size_t mergesCount,
+                                std::vector<std::size_t> &labels) {
+
+    const std::size_t dataSamplesCount = pi.size();
+
+    // Parent of every data sample in the disjoint-set forest
+    std::vector<std::size_t> parents(dataSamplesCount);
+    std::iota(parents.begin(), parents.end(), 0);
+    const auto findRoot = [&parents](std::size_t sample) -> std::size_t {
+        while (parents[sample] != sample) {
+            parents[sample] = parents[parents[sample]];
+            sample = parents[sample];
+        }
+        return sample;
+    };
+
+    // Apply the merges
+    for (std::size_t k = 0; k < mergesCount; k++) {
+        const std::size_t sample = merges[k].second;
+        parents[findRoot(sample)] = findRoot(pi[sample]);
+    }
+
+    // Label the clusters in decreasing order of their greatest data sample
+    const std::size_t unlabelled = std::numeric_limits<std::size_t>::max();
+    std::vector<std::size_t> rootLabels(dataSamplesCount, unlabelled);
+    std::size_t clustersCount = 0;
+    labels.resize(dataSamplesCount);
+    for (std::size_t i = dataSamplesCount; i-- > 0;) {
+        std::size_t &rootLabel = rootLabels[findRoot(i)];
+        if (rootLabel == unlabelled) {
+            rootLabel = clustersCount++;
+        }
+        labels[i] = rootLabel;
+    }
+
+    return clustersCount;
+}
+
+/**
+ * Utility function that checks the cophenetic distances between all the pairs of data samples,
+ * by comparing the ones answered, in parallel, by a <code>CopheneticIndex</code> with the ones
+ * obtained by brute force, i.e., by applying the merges one at a time in increasing order of
+ * height and assigning the height of every merge to all the pairs of data samples it joins.
+ *
+ * @param pi Data structure holding the values of <code>pi</code> computed by the clustering
+ * algorithm. It is not modified.
+ * @param lambda Data structure holding the values of <code>lambda</code> computed by the
+ * clustering algorithm. It is not modified.
+ * @return <code>true</code> if all the cophenetic distances are correct, <code>false</code>
+ * otherwise.
+ */
+bool checkCopheneticDistances(std::vector<std::size_t> &pi, std::vector<double> &lambda) {
+
+    const std::size_t dataSamplesCount = pi.size();
+
+    // Sort the merges by height, breaking the ties by index
+    std::vector<std::pair<double, std::size_t>> merges{};
+    merges.reserve(dataSamplesCount - 1);
+    for (std::size_t i = 0; i < dataSamplesCount - 1; i++) {
+        merges.emplace_back(lambda[i], i);
+    }
+    std::sort(merges.begin(), merges.end());
+
+    // Apply the merges one at a time, keeping the data samples of every cluster in its root, and
+    // assign the height of every merge to all the pairs of data samples it joins
+    const auto computeCondensedIndex = [dataSamplesCount](const std::size_t first,
+                                                          const std::size_t second) {
+        const std::size_t i = std::min(first, second);
+        const std::size_t j = std::max(first, second);
+        return dataSamplesCount * i - i * (i + 1) / 2 + j - i - 1;
+    };
+    std::vector<double> expectedDistances(dataSamplesCount * (dataSamplesCount - 1) / 2);
+    std::vector<std::size_t> roots(dataSamplesCount);
+    std::iota(roots.begin(), roots.end(), 0);
+    std::vector<std::vector<std::size_t>> clusters(dataSamplesCount);
+    for (std::size_t i = 0; i < dataSamplesCount; i++) {
+        clusters[i].push_back(i);
+    }
+    for (const auto &[height, sample] : merges) {
+        const std::size_t firstRoot = roots[sample];
+        const std::size_t secondRoot = roots[pi[sample]];
+        for (const std::size_t first : clusters[firstRoot]) {
+            for (const std::size_t second : clusters[secondRoot]) {
+                expectedDistances[computeCondensedIndex(first, second)] = height;
+            }
+        }
+        for (const std::size_t first : clusters[firstRoot]) {
+            roots[first] = secondRoot;
+            clusters[secondRoot].push_back(first);
+        }
+        clusters[firstRoot].clear();
+        clusters[firstRoot].shrink_to_fit();
+    }
+
+    // Compare the distances of all the pairs, answered both as a condensed matrix and as a batch
+    // of pairs
+    const CopheneticIndex<> index{pi, lambda, dataSamplesCount};
+    std::vector<double> distances{};
+    index.getCondensedCopheneticDistances(distances);
+    std::vector<std::pair<std::size_t, std::size_t>> pairs{};
+    pairs.reserve(expectedDistances.size());
+    for (std::size_t i = 0; i < dataSamplesCount; i++) {
+        for (std::size_t j = i + 1; j < dataSamplesCount; j++) {
+            pairs.emplace_back(j, i);
+        }
+    }
+    std::vector<double> pairsDistances{};
+    index.getCopheneticDistances(pairs, pairsDistances);
+    for (const std::vector<double> *const foundDistances : {&distances, &pairsDistances}) {
+        const auto [expected, found] = std::mismatch(
+                expectedDistances.cbegin(), expectedDistances.cend(), foundDistances->cbegin());
+        if (expected != expectedDistances.cend()) {
+            const auto &[second, first] =
+                    pairs[static_cast<std::size_t>(expected - expectedDistances.cbegin())];
+            std::cerr << "Error in the cophenetic distance between the data samples" << ' '
+                      << first << " and " << second << ':' << ' ' << "expected" << ' '
+                      << *expected << ", found" << ' ' << *found << std::endl;
+            return false;
+        }
+    }
+    for (std::size_t i = 0; i < dataSamplesCount; i++) {
+        if (index.getCopheneticDistance(i, i) > 0) {
+            std::cerr << "Error in the cophenetic distance of the data sample" << ' ' << i
+                      << " from itself" << std::endl;
+            return false;
+        }
+    }
+
+    return true;
+}
+
+/**
+ * Utility function that checks the incremental clustering, by appending the data samples in
+ * batches of doubling size, and by comparing, after every batch, the dendrogram of the data
+ * samples appended so far with the one computed by clustering them all at once. The data samples
+ * are appended both with a distance computer that computes the distances, storing
+ * <code>pi</code> as 32-bit unsigned integers, and with one that defers their transformation.
+ *
+ * @tparam MT Policy describing the metric used to measure the distance between two data samples.
+ * @param data Data samples, stored as indirect pointers.
+ * @param dimension Dimension of the data samples.
+ * @return <code>true</code> if the incremental clustering is correct, <code>false</code>
+ * otherwise.
+ */
+template <typename MT>
+bool checkIncrementalClustering(const std::vector<double *> &data, const std::size_t dimension) {
+
+    const std::size_t dataSamplesCount = data.size();
+
+    // Flatten the data samples, since they are appended as contiguous arrays
+    std::vector<double> samples(dataSamplesCount * dimension);
+    for (std::size_t i = 0; i < dataSamplesCount; i++) {
+        std::copy(data[i], data[i] + dimension, &(samples[i * dimension]));
+    }
+
+    IncrementalClustering<DistanceComputers::CLASSICAL, double, true, true, MT, std::uint32_t>
+            clustering{dimension};
+    IncrementalClustering<DistanceComputers::AVX_OPTIMIZED_NO_SQUARE_ROOT, double, true, true, MT>
+            deferredClustering{dimension};
+    std::vector<std::size_t> expectedPi{};
+    std::vector<double> expectedLambda{};
+    for (std::size_t batchSize = 1, appendedCount = 0; appendedCount < dataSamplesCount;
+         batchSize *= 2) {
+        // Append the next batch
+        const std::size_t samplesCount = std::min(batchSize, dataSamplesCount - appendedCount);
+        clustering.appendBatch(&(samples[appendedCount * dimension]), samplesCount);
+        deferredClustering.appendBatch(&(samples[appendedCount * dimension]), samplesCount);
+        appendedCount += samplesCount;
+
+        // Cluster all the data samples appended so far at once
+        expectedPi.resize(appendedCount);
+        expectedLambda.resize(appendedCount);
+        ParallelClustering<>::cluster<DistanceComputers::CLASSICAL, double, MT>(
+                data, appendedCount, dimension, expectedPi, expectedLambda);
+
+        // Compare the dendrograms
+        const std::vector<std::uint32_t> &pi = clustering.getPi();
+        const std::vector<double> lambda = clustering.getLambda();
+        const std::vector<std::size_t> &deferredPi = deferredClustering.getPi();
+        const std::vector<double> deferredLambda = deferredClustering.getLambda();
+        if (!ResultsChecker::checkResults(pi.cbegin(),
+                                          pi.cend(),
+                                          lambda.cbegin(),
+                                          lambda.cend(),
+                                          expectedPi.cbegin(),
+                                          expectedPi.cend(),
+                                          expectedLambda.cbegin(),
+                                          expectedLambda.cend()) ||
+            !ResultsChecker::checkResults(deferredPi.cbegin(),
+                                          deferredPi.cend(),
+                                          deferredLambda.cbegin(),
+                                          deferredLambda.cend(),
+                                          expectedPi.cbegin(),
+                                          expectedPi.cend(),
+                                          expectedLambda.cbegin(),
+                                          expectedLambda.cend())) {
+            std::cerr << "Error in the incremental clustering of the first" << ' ' << appendedCount
+                      << " data samples" << std::endl;
+            return false;
+        }
+    }
+
+    return true;
+}
+
+/**
+ * Utility function that checks the incremental clustering with the specified metric.
+ *
+ * @param data Data samples, stored as indirect pointers.
+ * @param dimension Dimension of the data samples.
+ * @param metric Metric used to measure the distance between two data samples.
+ * @return <code>true</code> if the incremental clustering is correct, <code>false</code>
+ * otherwise.
+ */
+bool checkIncrementalClustering(const std::vector<double *> &data,
+                                const std::size_t dimension,
+                                const Metrics metric) {
+
+    switch (metric) {
+        case Metrics::MANHATTAN:
+            return checkIncrementalClustering<cluster::utils::ManhattanMetric>(data, dimension);
+        case Metrics::CHEBYSHEV:
+            return checkIncrementalClustering<cluster::utils::ChebyshevMetric>(data, dimension);
+        case Metrics::COSINE:
+            return checkIncrementalClustering<cluster::utils::CosineMetric>(data, dimension);
+        case Metrics::MINKOWSKI:
+            // NOLINTNEXTLINE(cppcoreguidelines-avoid-magic-numbers, readability-magic-numbers)
+            return checkIncrementalClustering<cluster::utils::MinkowskiMetric<3>>(data, dimension);
+        case Metrics::EUCLIDEAN:
+        default:
+            return checkIncrementalClustering<cluster::utils::EuclideanMetric>(data, dimension);
+    }
+}
+
 /**
  * Utility function that appends to the specified vector the specified elements.
  *
@@ -631,3 +1577,26 @@ void addAll(std::vector<T> &vector, const std::initializer_list<T> elements) {
         vector.template emplace_back(value);
     }
 }
+
+/**
+ * Utility function that returns the description of the specified metric.
+ *
+ * @param metric Metric to describe.
+ * @return The description of the metric.
+ */
+const char *getMetricDescription(const Metrics metric) {
+
+    switch (metric) {
+        case Metrics::MANHATTAN:
+            return "Manhattan metric";
+        case Metrics::CHEBYSHEV:
+            return "Chebyshev metric";
+        case Metrics::COSINE:
+            return "cosine distance";
+        case Metrics::MINKOWSKI:
+            return "Minkowski metric of order 3";
+        case Metrics::EUCLIDEAN:
+        default:
+            return "Euclidean metric";
+    }
+}